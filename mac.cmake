@@ -32,6 +32,8 @@ add_executable(bookr-mod-vita
   src/graphics/texture2d.cpp
   src/graphics/sprite_renderer.cpp
   src/graphics/text_renderer.cpp
+  src/graphics/glyph_cache.cpp
+  src/graphics/font_faces.cpp
   "${CMAKE_SOURCE_DIR}/ext/glad/src/glad.c"
 )
 
@@ -17,7 +17,9 @@
 #include "graphics/screen.hpp"
 #include "graphics/controls.hpp"
 
-//#include "document.hpp"
+#ifdef __vita__
+  #include "document.hpp"
+#endif
 //#include "mainmenu.hpp"
 //#include "filechooser.hpp"
 
@@ -63,10 +65,16 @@ void mainloop() {
   while (!exitApp) {
     // draw state to back buffer and swap
     if (dirty) {
-      Screen::startDirectList();
       LayersIt it(layers.begin());
       LayersIt end(layers.end());
       while (it != end)
+      {
+        (*it)->prepare();
+        ++it;
+      }
+      Screen::startDirectList();
+      it = layers.begin();
+      while (it != end)
       {
         (*it)->render();
         ++it;
@@ -132,6 +140,10 @@ void cleanup() {
     layer->release();
   }
   layers.clear();
+  // documents are only built on vita for now
+  #ifdef __vita__
+    Document::releaseWarmDocuments();
+  #endif
 
   Screen::close(); // deinit graphics layer
   // Layer::unload(); // free textures
@@ -18,25 +18,79 @@
 #include "graphics/controls.hpp"
 #include "document.hpp"
 #include "filetypes/mudocument.hpp"
-// #include "filetypes/bkdjvu.h"
-// #include "filetypes/bkpalmdoc.h"
+#ifdef ENABLE_DJVU
+  #include "filetypes/djvu.hpp"
+#endif
+#include "filetypes/palmdoc.hpp"
 #include "filetypes/plaintext.hpp"
+#include "user.hpp"
+#include "stagetimer.hpp"
+
+#include <list>
 
 namespace bookr {
 
+// Recently opened documents, most recent first. Each entry holds its own
+// reference so the document (and its context, caches and texture) outlives
+// the shell closing it.
+static std::list<Document*> warmDocuments;
+
+static Document* findWarmDocument(const string& filePath) {
+  for (auto it = warmDocuments.begin(); it != warmDocuments.end(); ++it) {
+    string fn;
+    (*it)->getFileName(fn);
+    if (fn == filePath) {
+      Document* doc = *it;
+      warmDocuments.erase(it);
+      warmDocuments.push_front(doc);
+      return doc;
+    }
+  }
+  return nullptr;
+}
+
+static void keepWarm(Document* doc) {
+  if (User::options.documentPoolSize <= 0)
+    return;
+  doc->retain();
+  warmDocuments.push_front(doc);
+  while ((int)warmDocuments.size() > User::options.documentPoolSize) {
+    // the least recently opened one goes; if the shell still has it open
+    // it lives on until that reference is dropped as well
+    warmDocuments.back()->release();
+    warmDocuments.pop_back();
+  }
+}
+
+void Document::releaseWarmDocuments() {
+  for (auto doc : warmDocuments)
+    doc->release();
+  warmDocuments.clear();
+}
+
 Document* Document::create(string filePath) {
   #ifdef DEBUG
     printf("Document::create %s\n", filePath.c_str());
   #endif
-  Document* doc = nullptr;
+  Document* doc = findWarmDocument(filePath);
+  if (doc != nullptr) {
+    #ifdef DEBUG
+      printf("Document::create warm %s\n", filePath.c_str());
+    #endif
+    // already positioned where the reader left it
+    doc->retain();
+    return doc;
+  }
 
   // TODO(refactor): open file handle only once and send
   if (MUDocument::isMUDocument(filePath)) {
       doc = MUDocument::create(filePath);
-  // } else if (DJVU::isDJVU(filePath)) {
-  // 	doc = DJVU::create(filePath);
-  // } else if (PalmDoc::isPalmDoc(filePath)) {
-  // 	doc = PalmDoc::create(filePath);
+  #ifdef ENABLE_DJVU
+  } else if (DJVU::isDJVU(filePath)) {
+    doc = DJVU::create(filePath);
+  #endif
+  } else if (PalmDoc::isPalmDoc(filePath)) {
+    doc = PalmDoc::create(filePath);
   } else if (PlainText::isPlainText(filePath)) {
     doc = PlainText::create(filePath);
   } else {
@@ -50,6 +104,8 @@ Document* Document::create(string filePath) {
     printf("NULLPTR\n");
     return doc;
   }
+
+  keepWarm(doc);
     
 
   #ifdef DEBUG
@@ -323,6 +379,8 @@ void Document::buildToolbarMenus() {
     ToolbarItem i("No pagination support");
     toolbarMenus[1].push_back(i);
   }
+  // always last, see processEventsForToolbar
+  toolbarMenus[1].push_back(ToolbarItem("Save page turn timings", "", "Select"));
 
   toolbarMenus[2].clear();
   if (isZoomable()) {
@@ -458,6 +516,19 @@ int Document::processEventsForToolbar() {
       if (r != 0)
         return r;
     }
+    // save page turn timings for later inspection
+    if (toolbarSelMenu == 1 && toolbarSelMenuItem == (int)toolbarMenus[1].size() - 1) {
+      char filename[1024];
+      #ifdef __vita__
+        snprintf(filename, 1024, "%s%s", Screen::basePath().c_str(), "data/Bookr/timings.txt");
+      #else
+        snprintf(filename, 1024, "%s/%s", Screen::basePath().c_str(), "timings.txt");
+      #endif
+      char t[256];
+      snprintf(t, 256, StageTimer::dump(filename) ? "Timings saved" : "Cannot save timings");
+      setBanner(t);
+      return BK_CMD_MARK_DIRTY;
+    }
     // go to page
     if (toolbarSelMenu == 1 && toolbarSelMenuItem == 4 && isPaginated()) {
       return BK_CMD_INVOKE_PAGE_CHOOSER;
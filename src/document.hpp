@@ -94,6 +94,9 @@ public:
 	// Factory with file detection
 	static Document* create(string filePath);
 
+	// Drop the pool of recently closed documents kept warm by create().
+	static void releaseWarmDocuments();
+
 	// Document metadata
 	virtual void getFileName(string&) = 0;
 	virtual void getTitle(string&) = 0;
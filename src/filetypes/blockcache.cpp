@@ -0,0 +1,182 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifdef __vita__
+#include <psp2/io/fcntl.h>
+#endif
+
+#include <cstdlib>
+
+#include "blockcache.hpp"
+#include "../graphics/screen.hpp"
+
+namespace bookr {
+
+BlockCache::BlockCache() : memory(nullptr), blocks(nullptr), count(0), useClock(0) {
+}
+
+BlockCache::~BlockCache() {
+  free(memory);
+  delete[] blocks;
+}
+
+bool BlockCache::allocate(int n, int size) {
+  free(memory);
+  delete[] blocks;
+  blocks = nullptr;
+  count = 0;
+  // keep every buffer aligned, not just the first
+  size_t stride = ((size_t)size + FILE_BLOCK_ALIGN - 1) & ~(size_t)(FILE_BLOCK_ALIGN - 1);
+  memory = malloc(n * stride + FILE_BLOCK_ALIGN);
+  if (memory == nullptr)
+    return false;
+  char* aligned = (char*)(((uintptr_t)memory + FILE_BLOCK_ALIGN - 1) & ~(uintptr_t)(FILE_BLOCK_ALIGN - 1));
+  blocks = new Block[n];
+  count = n;
+  for (int i = 0; i < n; ++i)
+    blocks[i].data = aligned + i * stride;
+  clear();
+  return true;
+}
+
+void BlockCache::clear() {
+  for (int i = 0; i < count; ++i) {
+    blocks[i].key = -1;
+    blocks[i].len = 0;
+    blocks[i].lastUse = 0;
+    blocks[i].pinned = false;
+  }
+  useClock = 0;
+}
+
+BlockCache::Block* BlockCache::find(int64_t key) {
+  for (int i = 0; i < count; ++i) {
+    if (blocks[i].key == key) {
+      blocks[i].lastUse = ++useClock;
+      return &blocks[i];
+    }
+  }
+  return nullptr;
+}
+
+BlockCache::Block* BlockCache::victim() {
+  Block* best = nullptr;
+  for (int i = 0; i < count; ++i) {
+    Block* b = &blocks[i];
+    if (b->key < 0) {
+      best = b;
+      break;
+    }
+    if (best == nullptr || (best->pinned && !b->pinned) ||
+        (best->pinned == b->pinned && b->lastUse < best->lastUse))
+      best = b;
+  }
+  // a failed fill must not leave the old key on new contents
+  best->key = -1;
+  best->len = 0;
+  return best;
+}
+
+void BlockCache::store(Block* b, int64_t key, int len, bool pinned) {
+  b->key = key;
+  b->len = len;
+  b->pinned = pinned;
+  b->lastUse = ++useClock;
+}
+
+
+FileHandle::FileHandle() : length(0), serial(0) {
+  #ifdef __vita__
+    fd = -1;
+  #else
+    file = nullptr;
+  #endif
+}
+
+FileHandle::~FileHandle() {
+  close();
+}
+
+bool FileHandle::isOpen() {
+  #ifdef __vita__
+    return fd >= 0;
+  #else
+    return file != nullptr;
+  #endif
+}
+
+void FileHandle::close() {
+  #ifdef __vita__
+    if (fd >= 0)
+      sceIoClose(fd);
+    fd = -1;
+  #else
+    if (file != nullptr)
+      fclose(file);
+    file = nullptr;
+  #endif
+}
+
+bool FileHandle::open(const string& p) {
+  close();
+  path = p;
+  #ifdef __vita__
+    fd = sceIoOpen(path.c_str(), SCE_O_RDONLY, 0777);
+    if (fd >= 0)
+      length = sceIoLseek(fd, 0, SCE_SEEK_END);
+  #else
+    file = fopen(path.c_str(), "rb");
+    if (file != nullptr) {
+      fseek(file, 0, SEEK_END);
+      length = ftell(file);
+    }
+  #endif
+  serial = Screen::getSuspendSerial();
+  return isOpen();
+}
+
+bool FileHandle::reopen() {
+  #ifdef DEBUG
+    printf("FileHandle: reopening %s\n", path.c_str());
+  #endif
+  return open(path);
+}
+
+int64_t FileHandle::readAt(int64_t offset, void* buf, int n) {
+  #ifdef __vita__
+    return sceIoPread(fd, buf, n, offset);
+  #else
+    if (fseek(file, (long)offset, SEEK_SET) != 0)
+      return -1;
+    int64_t r = fread(buf, 1, n, file);
+    if (r < n && ferror(file))
+      return -1;
+    return r;
+  #endif
+}
+
+int64_t FileHandle::read(int64_t offset, void* buf, int n) {
+  if (serial != Screen::getSuspendSerial() || !isOpen()) {
+    if (!reopen())
+      return -1;
+  }
+  int64_t r = readAt(offset, buf, n);
+  if (r < 0) {
+    // the handle may have gone stale without the serial changing
+    if (!reopen())
+      return -1;
+    r = readAt(offset, buf, n);
+  }
+  return r;
+}
+
+}
@@ -0,0 +1,123 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKBLOCKCACHE_H
+#define BKBLOCKCACHE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#ifdef __vita__
+#include <psp2/types.h>
+#endif
+
+using std::string;
+
+namespace bookr {
+
+// Memory cards and SD2Vita adapters hate small reads. Files are read in
+// 64KB blocks at block aligned offsets into 64 byte aligned buffers.
+#define FILE_BLOCK_SHIFT 16
+#define FILE_BLOCK_SIZE (1 << FILE_BLOCK_SHIFT)
+#define FILE_BLOCK_ALIGN 64
+
+/*! \brief A few equal sized buffers, kept LRU by key.
+ *
+ *  Keys are whatever the owner caches by: file offsets, block or record
+ *  numbers. Nothing is locked here; owners read from more than one thread
+ *  hold their own lock around find(), victim() and the buffer contents.
+ */
+class BlockCache {
+public:
+  struct Block {
+    int64_t key;      // -1 when empty
+    int len;
+    int64_t lastUse;
+    bool pinned;      // evicted only when nothing else can be
+    char* data;
+  };
+
+private:
+  void* memory;       // unaligned allocation behind all the buffers
+  Block* blocks;
+  int count;
+  int64_t useClock;
+
+public:
+  BlockCache();
+  ~BlockCache();
+
+  /**
+   * Allocate count buffers of size bytes each, all empty. False when out
+   * of memory.
+   */
+  bool allocate(int count, int size);
+  bool ready() { return blocks != nullptr; }
+
+  /**
+   * The block holding key, marked as just used; NULL if it isn't cached.
+   */
+  Block* find(int64_t key);
+
+  /**
+   * An empty block, or the least recently used one not pinned, emptied.
+   * Fill its data and hand it back to store().
+   */
+  Block* victim();
+  void store(Block* b, int64_t key, int len, bool pinned = false);
+
+  Block* at(int i) { return &blocks[i]; }
+  void clear();
+};
+
+/*! \brief A read only file that survives a suspend.
+ *
+ *  File handles are invalid after the Vita resumes. The handle is reopened
+ *  the first time it is read after Screen::getSuspendSerial() changes, and
+ *  once more when a read fails anyway. Reads are all positioned, so there
+ *  is nothing to seek back to. Not locked either.
+ */
+class FileHandle {
+  string path;
+  int64_t length;
+  #ifdef __vita__
+    SceUID fd;
+  #else
+    FILE* file;
+  #endif
+  int serial;
+
+  bool isOpen();
+  bool reopen();
+  int64_t readAt(int64_t offset, void* buf, int n);
+
+public:
+  FileHandle();
+  ~FileHandle();
+
+  bool open(const string& path);
+  void close();
+
+  const string& name() { return path; }
+  int64_t size() { return length; }
+
+  /**
+   * Up to n bytes at offset into buf. Returns the bytes read, or -1 when
+   * the file cannot be read even after reopening it.
+   */
+  int64_t read(int64_t offset, void* buf, int n);
+};
+
+}
+
+#endif
@@ -16,895 +16,816 @@
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
- 
-#include <map>
-#include <cstdlib>
-#include <cstdio>
+
+#ifdef __vita__
+#include <psp2/io/fcntl.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <ctime>
-#include <ddjvuapi.h>
-#include <miniexp.h>
-#ifdef MAC
-static void *memalign(int t, int s)
-{
-	return malloc(s);
-}
-#else
-#include <malloc.h>
-#endif
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <libdjvu/ddjvuapi.h>
 
-#include "../bookmark.hpp"
 #include "djvu.hpp"
+#include "../graphics/resolutions.hpp"
+#include "../graphics/controls.hpp"
+#include "../graphics/fzscreen_defs.h"
+#include "../bookmark.hpp"
+#include "../utils.hpp"
+#include "../user.hpp"
+#include "../membudget.hpp"
+#include "../stagetimer.hpp"
+
+using std::list;
+using std::shared_ptr;
 
 namespace bookr {
 
 static const char* bookrName = "bookr";
 
-static const int cacheSize = 4*1024*1024;		// MB
+// ddjvu's own cache of decoded page data. Sized from MemBudget between
+// these, and re-checked before every page.
+static const size_t minDecodeCache = 4 << 20;
+static const size_t maxDecodeCache = 64 << 20;
+// rendered pages kept around: current, next and previous, more if the
+// budget allows. Pages are rendered small enough for this many to fit, and
+// never below a screenful; under pressure only the wanted page is kept.
+static const int minRenderedPages = 3;
+static const size_t minPageBytes = DEFAULT_SCREEN_WIDTH * DEFAULT_SCREEN_HEIGHT * 4;
+static const size_t maxPageCache = 128 << 20;
+
+// how often a worker waiting on ddjvu looks whether it should stop
+static const int pumpPollMs = 5;
+
+static DJVUCacheStats cacheStats;
+static std::mutex statsMutex;
+// vita2d can't make textures bigger than this
+static const int maxTextureSize = 4096;
+
+// multiples of fit to width
+static const float zoomLevels[] = { 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 1.75f, 2.0f, 2.5f, 3.0f, 4.0f };
+static const int defaultZoomLevel = 2;
 
-static const float zoomLevels[] = {
-	0.1f, 0.15f, 0.2f, 0.25f, 0.3f, 0.35f,
-	0.4f, 0.5f, 0.75f, 0.90f, 1.0f, 1.1f,
-	1.2f, 1.3f, 1.4f, 1.5f, 1.6f, 1.7f, 1.8f,
-	1.9f, 2.0f, 2.25f, 2.5f, 2.75f, 3.0f
+static const ddjvu_page_rotation_t rotateLevels[] = {
+  DDJVU_ROTATE_0, DDJVU_ROTATE_270, DDJVU_ROTATE_180, DDJVU_ROTATE_90
 };
 
-static const ddjvu_page_rotation_t rotateLevels[] = {
-	DDJVU_ROTATE_0, DDJVU_ROTATE_270, DDJVU_ROTATE_180, DDJVU_ROTATE_90
+// A page rendered for one view, rows top to bottom. Bilevel pages come
+// back as an 8 bit coverage mask (0 ink, 255 paper) and are tinted at draw
+// time; everything else is RGBA8888.
+struct DJVURendered {
+  DJVUView view;
+  int w, h;
+  bool mask;
+  vector<unsigned int> pixels;
+  vector<unsigned char> grey;
+
+  size_t bytes() const {
+    return pixels.size() * sizeof(unsigned int) + grey.size();
+  }
 };
 
-static char* bounceBuffer = NULL;
-
-struct DJVUContext {
-	/* current document params */
-	//string docTitle;
-	ddjvu_context_t *context;
-	ddjvu_document_t *document;
-	ddjvu_page_t *page;
-	
-	/* current page params */
-	int pageno;
-	int djvupageno;
-	float zoom;
-	int zoomLevel;
-	ddjvu_page_rotation_t rotate;
-	int rotateLevel;
+/*! \brief Owns the ddjvu context and does all decoding and rendering.
+ *
+ *  Nothing outside this class touches djvulibre, so it is only ever used
+ *  from one thread. The worker renders the view asked for last and then
+ *  prefetches the following page.
+ */
+class DJVUWorker {
+  string path;
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable cond;
+
+  // guarded by mutex
+  bool running;
+  int pages;
+  bool hasWanted;
+  DJVUView wanted;
+  list<shared_ptr<DJVURendered>> cache;   // most recent first
+  size_t cacheBytes;
+
+  // worker thread only
+  ddjvu_context_t* context;
+  ddjvu_document_t* document;
+  size_t decodeCacheSize;
+
+  void loop();
+  void adjustDecodeCache();
+  void trimLocked();
+  bool open();
+  void close();
+  bool pump(bool wait);
+  bool isStale(const DJVUView& job);
+  bool nextJob(DJVUView& job);
+  shared_ptr<DJVURendered> findLocked(const DJVUView& v);
+  shared_ptr<DJVURendered> render(const DJVUView& v);
+
+public:
+  DJVUWorker(const string& p);
+  ~DJVUWorker();
+
+  // -1 while opening, 0 if the file could not be opened
+  int pageCount();
+  void request(const DJVUView& v);
+  shared_ptr<DJVURendered> find(const DJVUView& v);
 };
 
-static int djvuHandle(ddjvu_context_t* const ctx, int wait)
+DJVUWorker::DJVUWorker(const string& p) : path(p), running(true), pages(-1),
+  hasWanted(false), cacheBytes(0), context(nullptr), document(nullptr), decodeCacheSize(0)
 {
-	const ddjvu_message_t *msg;
-	int retval = 1;
-	if(!ctx) {
-		retval = 0;
-		return retval;
-	}
-	if(wait)
-		msg = ddjvu_message_wait(ctx);
-	while ((msg = ddjvu_message_peek(ctx))){
-		switch(msg->m_any.tag){ 
-			case DDJVU_ERROR:
-				printf("ddjvu error: %s, %s, %s, %d\n", msg->m_error.message, msg->m_error.function, msg->m_error.filename, msg->m_error.lineno);
-				retval = 0;
-				break;
-
-			default:
-				break;
-		}
-		ddjvu_message_pop(ctx);
-	}
-	return retval;
-}
-
- static int djvuInit() {
- 	if (bounceBuffer == NULL) {
-		bounceBuffer = (char*)memalign(16, 480*272*4);
-	}
- 	return bounceBuffer==NULL?0:1;
- }
-
-static DJVUContext* djvuOpen(char *filename) {
-	DJVUContext* ctx = new DJVUContext();
-	if(ctx == NULL) {
-		return NULL;
-	}
-	memset(ctx, 0, sizeof(DJVUContext));
-
-	ctx->pageno = 1;
-	ctx->djvupageno = 0;
-	ctx->zoom = 0.2f;
-	ctx->zoomLevel = 2;
-	ctx->rotate = DDJVU_ROTATE_0;
-	ctx->rotateLevel = 0;
-
-	ctx->context = ddjvu_context_create(bookrName);
-	if(ctx->context == NULL) {
-		delete ctx;
-		return NULL;
-	}
-	ddjvu_cache_set_size(ctx->context, cacheSize);
-	ctx->document = ddjvu_document_create_by_filename(ctx->context, filename, true);
-	djvuHandle(ctx->context, TRUE);
-	if(ctx->document == NULL) {
-		ddjvu_context_release(ctx->context);
-		delete ctx;
-		return NULL;
-	}
-	//ctx->page = ddjvu_page_create_by_pageno(ctx->document, ctx->djvupageno);	 
-	//djvuHandle(ctx->context, TRUE);
-
-	return ctx;
-}
-
-static void djvuClose(DJVUContext* ctx) {
-	if (ctx->page)
-		ddjvu_page_release(ctx->page);
-	ctx->page = 0;
-	if (ctx->document)
-		ddjvu_document_release(ctx->document);
-	ctx->document = 0;
-	if (ctx->context)
-		ddjvu_context_release(ctx->context);
-	ctx->context = 0;
-}
-
-static void djvuFree() {
-	if(bounceBuffer)
-		free(bounceBuffer);
-	bounceBuffer = 0;
-}
-
-DJVU::DJVU(string& f) : ctx(0), fileName(f), panX(0), panY(0), loadNewPage(false), pageError(false) {
-  resetPanXY = false;
-}
-
-static DJVU* singleton = 0;
+  thread = std::thread(&DJVUWorker::loop, this);
+}
 
-DJVU::~DJVU() {
-	if (ctx != 0) {
-		saveLastView();
-		djvuClose(ctx);
-		delete ctx;
-	}
-	ctx = 0;
-	djvuFree();
-	singleton = 0;
-}
-
-DJVU* DJVU::create(string& file, string& longFileName) {
-	if (singleton != 0) {
-		printf("cannot open more than 1 pdf at the same time\n");
-		return singleton;
-	}
-	
-	DJVU* b = new DJVU(file);
-	singleton = b;
-	b->longFileName = longFileName;
-	b->xpos_mode = 0;
-	if (!djvuInit())
-		return 0;
-
-	DJVUContext* ctx = djvuOpen((char*)file.c_str());
-	if (ctx == 0) {
-		delete b;
-		return 0;
-	}
-	b->ctx = ctx;
-	int lastSlash = -1;
-	int n = b->longFileName.size();
-	for (int i = 0; i < n; ++i) {
-		if (b->longFileName[i] == '\\')
-			lastSlash = i;
-		else if (b->longFileName[i] == '/')
-			lastSlash = i;
-	}
-	b->title.assign(b->longFileName, lastSlash+1, n - 1 - lastSlash);
-	
-	//load bookmark info if it is available
-	if (b->isBookmarkable()){
-	  BKBookmark bm;
-	  string fn;
-	  b->getFileName(fn); 
-	  if (BKBookmarksManager::getLastView(fn, bm)) {
-	    b->setBookmarkPosition(bm.viewData);
-	    b->setZoom(bm.zoom);
-	  }
-	}
-	ctx->page = ddjvu_page_create_by_pageno(ctx->document, ctx->djvupageno);
-	//djvuHandle(ctx->context, TRUE);
-	
- 	b->redrawBuffer();
-	return b;
-}
-
-void DJVU::clipCoords(float& nx, float& ny) {
-		float w = (float)ddjvu_page_get_width(ctx->page) * ctx->zoom;
-		float h = (float)ddjvu_page_get_height(ctx->page) * ctx->zoom;
-		if (ny < 0.0f) {
-			ny = 0.0f;
-		}
-		if (h <= 272.0f) {
-			ny = 0.0f;
-		} else if (ny >= h - 272.0f) {
-			ny = h - 272.0f;
-		}
-		if (nx < 0.0f) {
-			nx = 0.0f;
-		}
-		if (w <= 480.0f) {
-			nx = 0.0f;
-		} else if (nx >= w - 480.0f) {
-			nx = w - 480.0f;
-		}
+DJVUWorker::~DJVUWorker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    running = false;
+  }
+  cond.notify_all();
+  // the worker stops its decoding job within pumpPollMs
+  thread.join();
 }
 
-bool DJVU::isZoomable() {
-	return true;
+int DJVUWorker::pageCount() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return pages;
 }
 
-void DJVU::getZoomLevels(vector<BKDocument::ZoomLevel>& v) {
-	int n = sizeof(zoomLevels)/sizeof(float);
-	for (int i = 0; i < n; ++i)
-		v.push_back(BKDocument::ZoomLevel(BKDOCUMENT_ZOOMTYPE_ABSOLUTE, "FIX ZOOM LABELS"));
+void DJVUWorker::request(const DJVUView& v) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    wanted = v;
+    hasWanted = true;
+  }
+  cond.notify_all();
 }
 
-int DJVU::getCurrentZoomLevel() {
-	int zl = ctx->zoomLevel;
-// 	if(zoomLevels[zl] != ctx->zoom){
-// 	  zl = 0;
-// 	  while (zoomLevels[zl]<ctx->zoom){
-// 	    zl++;
-// 	  }
-// 	}
-	return zl;
-}
-int DJVU::setZoomLevel2(int z) {
-
-	int n = sizeof(zoomLevels)/sizeof(float);
-	ctx->zoomLevel = z;
-
-	if (ctx->zoomLevel < 0)
-		ctx->zoomLevel = 0;
-	if (ctx->zoomLevel >= n)
-		ctx->zoomLevel = n - 1;
-  	ctx->zoom = zoomLevels[ctx->zoomLevel];
-	return ctx->zoomLevel;
+shared_ptr<DJVURendered> DJVUWorker::findLocked(const DJVUView& v) {
+  for (auto it = cache.begin(); it != cache.end(); ++it) {
+    if ((*it)->view == v) {
+      shared_ptr<DJVURendered> r = *it;
+      cache.erase(it);
+      cache.push_front(r);
+      return r;
+    }
+  }
+  return nullptr;
 }
-int DJVU::setZoomLevel(int z) {
-	if (z == ctx->zoomLevel)
-		return 0;
-
-	if (z == ctx->zoomLevel+1 && zoomLevels[ctx->zoomLevel] > ctx->zoom)
-	  z -= 1;
-
-	int n = sizeof(zoomLevels)/sizeof(float);
-	ctx->zoomLevel = z;
-
-	if (ctx->zoomLevel < 0)
-		ctx->zoomLevel = 0;
-	if (ctx->zoomLevel >= n)
-		ctx->zoomLevel = n - 1;
-
-
-	if (ctx->zoom == zoomLevels[ctx->zoomLevel]){
-	  char t[256];
-	  snprintf(t, 256, "Zoom %2.3gx", ctx->zoom);
-	  setBanner(t);
-	  //	  redrawBuffer();
-	  return 0;
-	}
-
-        panX = int(float( panX + 240 ) * zoomLevels[ctx->zoomLevel] / ctx->zoom - 240);
-        panY = int(float( panY + 136 ) * zoomLevels[ctx->zoomLevel] / ctx->zoom - 136);
-
-	if(xpos_mode || alwaysSetXPos){
-	  int* currentPage;
-	  int* adjPage;
-	  if (ctx->pageno%2){ // current page is odd page
-	    currentPage = &xpos_odd;
-	    adjPage = &xpos_even;
-	  }
-	  else{ // current page is even page.
-	    currentPage = &xpos_even;
-	    adjPage = &xpos_odd;
-	  }
-	
-	  if(ctx->rotateLevel%2){ //vetical mode, take panY value
-	    *currentPage = panY;
-	    *adjPage = int(float( *adjPage + 136 ) * zoomLevels[ctx->zoomLevel] / ctx->zoom - 136);
-	  }
-	  else{ // normal or upsidedown mode, take panX value
-	    *currentPage = panX;
-	    *adjPage = int(float( *adjPage + 240 ) * zoomLevels[ctx->zoomLevel] / ctx->zoom - 240);
-	  }
-	}
-
-	ctx->zoom = zoomLevels[ctx->zoomLevel];
-// 	float nx = float(panX)*ctx->zoom;
-// 	float ny = float(panY)*ctx->zoom;
-// 	clipCoords(nx, ny);
-// 	panX = int(nx);
-// 	panY = int(ny);
-	char t[256];
-	snprintf(t, 256, "Zoom %2.3gx", ctx->zoom);
-	setBanner(t);
-	redrawBuffer(true);
-	return BK_CMD_MARK_DIRTY;
+
+shared_ptr<DJVURendered> DJVUWorker::find(const DJVUView& v) {
+  std::lock_guard<std::mutex> lock(mutex);
+  return findLocked(v);
 }
 
+// Log errors and drop everything else; the loop checks job status itself.
+// ddjvu_message_wait can't be woken from outside, so waiting polls instead
+// and gives up as soon as the document is closed.
+bool DJVUWorker::pump(bool wait) {
+  while (wait && ddjvu_message_peek(context) == nullptr) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!running)
+        return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(pumpPollMs));
+  }
+  bool ok = true;
+  const ddjvu_message_t* msg;
+  while ((msg = ddjvu_message_peek(context))) {
+    if (msg->m_any.tag == DDJVU_ERROR) {
+      printf("ddjvu error: %s, %s, %s, %d\n", msg->m_error.message, msg->m_error.function,
+        msg->m_error.filename, msg->m_error.lineno);
+      ok = false;
+    }
+    ddjvu_message_pop(context);
+  }
+  return ok;
+}
+
+bool DJVUWorker::open() {
+  context = ddjvu_context_create(bookrName);
+  if (context == nullptr)
+    return false;
+  adjustDecodeCache();
+  document = ddjvu_document_create_by_filename(context, path.c_str(), TRUE);
+  if (document == nullptr)
+    return false;
+  while (!ddjvu_document_decoding_done(document)) {
+    pump(true);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!running) {
+      ddjvu_job_stop(ddjvu_document_job(document));
+      return false;
+    }
+  }
+  pump(false);
+  return !ddjvu_document_decoding_error(document);
+}
+
+// Follow the budget as other caches grow and shrink. Small changes are
+// ignored, resizing makes ddjvu walk its cache.
+void DJVUWorker::adjustDecodeCache() {
+  size_t want = MemBudget::allowance(MemBudget::DJVU_DECODE, minDecodeCache, maxDecodeCache);
+  size_t diff = want > decodeCacheSize ? want - decodeCacheSize : decodeCacheSize - want;
+  if (diff < (1 << 20))
+    return;
+  #ifdef DEBUG
+    printf("DJVUWorker: decode cache %zuK -> %zuK\n", decodeCacheSize >> 10, want >> 10);
+  #endif
+  ddjvu_cache_set_size(context, want);
+  decodeCacheSize = want;
+  MemBudget::report(MemBudget::DJVU_DECODE, want);
+  std::lock_guard<std::mutex> lock(statsMutex);
+  cacheStats.decodeCacheBytes = want;
+}
+
+void DJVUWorker::trimLocked() {
+  size_t allowed = MemBudget::allowance(MemBudget::DJVU_PAGES, 0, maxPageCache);
+  auto it = cache.end();
+  while (cache.size() > 1 && cacheBytes > allowed && it != cache.begin()) {
+    --it;
+    if ((*it)->view == wanted)
+      continue;
+    cacheBytes -= (*it)->bytes();
+    it = cache.erase(it);
+  }
+  MemBudget::report(MemBudget::DJVU_PAGES, cacheBytes);
+  std::lock_guard<std::mutex> lock(statsMutex);
+  cacheStats.pageCacheBytes = cacheBytes;
+}
+
+void DJVUWorker::close() {
+  MemBudget::report(MemBudget::DJVU_DECODE, 0);
+  MemBudget::report(MemBudget::DJVU_PAGES, 0);
+  if (document)
+    ddjvu_document_release(document);
+  document = nullptr;
+  if (context)
+    ddjvu_context_release(context);
+  context = nullptr;
+}
+
+// Only the wanted view and the next page in it are worth finishing; a new
+// zoom or rotation makes the old render useless.
+bool DJVUWorker::isStale(const DJVUView& job) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!running)
+    return true;
+  DJVUView next = wanted;
+  next.page++;
+  return !(job == wanted) && !(job == next);
+}
+
+bool DJVUWorker::nextJob(DJVUView& job) {
+  if (!hasWanted)
+    return false;
+  if (findLocked(wanted) == nullptr) {
+    job = wanted;
+    return true;
+  }
+  job = wanted;
+  job.page++;
+  if (job.page >= pages)
+    return false;
+  for (auto& r : cache)
+    if (r->view == job)
+      return false;
+  return true;
+}
+
+shared_ptr<DJVURendered> DJVUWorker::render(const DJVUView& v) {
+  ddjvu_page_t* page = ddjvu_page_create_by_pageno(document, v.page);
+  if (page == nullptr) {
+    // cached empty like a page that fails to decode, or the loop would
+    // ask for it again forever
+    printf("DJVUWorker: cannot create page %i\n", v.page);
+    shared_ptr<DJVURendered> r(new DJVURendered());
+    r->view = v;
+    r->w = r->h = 0;
+    r->mask = false;
+    return r;
+  }
 
-bool DJVU::hasZoomToFit() {
-	return true;
+  {
+    // done straight away means ddjvu still had the page's data
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (ddjvu_page_decoding_done(page))
+      cacheStats.decodeHits++;
+    else
+      cacheStats.decodeMisses++;
+  }
+
+  auto decodeBegin = std::chrono::steady_clock::now();
+  while (!ddjvu_page_decoding_done(page)) {
+    pump(true);
+    if (isStale(v)) {
+      #ifdef DEBUG
+        printf("DJVUWorker: dropping page %i\n", v.page);
+      #endif
+      ddjvu_job_stop(ddjvu_page_job(page));
+      ddjvu_page_release(page);
+      return nullptr;
+    }
+  }
+  pump(false);
+  StageTimer::record(StageTimer::DJVU_DECODE, std::chrono::duration<float, std::milli>(
+    std::chrono::steady_clock::now() - decodeBegin).count());
+  StageTimer::Scope renderTimer(StageTimer::DJVU_RENDER);
+
+  shared_ptr<DJVURendered> r(new DJVURendered());
+  r->view = v;
+
+  if (ddjvu_page_decoding_error(page)) {
+    // an empty page still tells the viewer to stop waiting
+    printf("DJVUWorker: cannot decode page %i\n", v.page);
+    r->w = r->h = 0;
+    ddjvu_page_release(page);
+    return r;
+  }
+
+  ddjvu_page_set_rotation(page, rotateLevels[v.rotateLevel]);
+  float pw = ddjvu_page_get_width(page);
+  float ph = ddjvu_page_get_height(page);
+  float scale;
+  if (v.fitHeight)
+    scale = DEFAULT_SCREEN_HEIGHT / ph;
+  else if (v.fitWidth)
+    scale = DEFAULT_SCREEN_WIDTH / pw;
+  else
+    scale = DEFAULT_SCREEN_WIDTH / pw * zoomLevels[v.zoomLevel];
+  scale = std::min(scale, std::min(maxTextureSize / pw, maxTextureSize / ph));
+
+  // JB2 only pages have no background or foreground layers to decode;
+  // the mask is all there is, at a quarter of the memory
+  r->mask = User::options.djvuMaskMode && ddjvu_page_get_type(page) == DDJVU_PAGETYPE_BITONAL;
+
+  // at high zoom a page could take most of the budget by itself; render it
+  // smaller, so minRenderedPages of them still fit
+  size_t pageBytes = MemBudget::allowance(MemBudget::DJVU_PAGES, minPageBytes * minRenderedPages,
+    maxPageCache) / minRenderedPages;
+  float bytesPerPixel = r->mask ? 1.0f : 4.0f;
+  if (pw * ph * scale * scale * bytesPerPixel > pageBytes) {
+    #ifdef DEBUG
+      printf("DJVUWorker: page %i limited to %zuK\n", v.page, pageBytes >> 10);
+    #endif
+    scale = sqrtf(pageBytes / (pw * ph * bytesPerPixel));
+  }
+
+  r->w = std::max(1, int(pw * scale));
+  r->h = std::max(1, int(ph * scale));
+  ddjvu_rect_t rect = { 0, 0, (unsigned int)r->w, (unsigned int)r->h };
+
+  if (r->mask) {
+    r->grey.resize(r->w * r->h);
+    ddjvu_format_t* format = ddjvu_format_create(DDJVU_FORMAT_GREY8, 0, nullptr);
+    ddjvu_format_set_row_order(format, 1);
+    ddjvu_format_set_y_direction(format, 1);
+    if (!ddjvu_page_render(page, DDJVU_RENDER_MASKONLY, &rect, &rect, format, r->w, (char*)&r->grey[0]))
+      std::fill(r->grey.begin(), r->grey.end(), 0xff);
+    ddjvu_format_release(format);
+  } else {
+    r->pixels.resize(r->w * r->h);
+    // same byte order as vita2d's RGBA8
+    static unsigned int masks[4] = { 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000 };
+    ddjvu_format_t* format = ddjvu_format_create(DDJVU_FORMAT_RGBMASK32, 4, masks);
+    ddjvu_format_set_row_order(format, 1);
+    ddjvu_format_set_y_direction(format, 1);
+    if (!ddjvu_page_render(page, DDJVU_RENDER_COLOR, &rect, &rect, format, r->w * 4, (char*)&r->pixels[0]))
+      std::fill(r->pixels.begin(), r->pixels.end(), 0xffffffff);
+    ddjvu_format_release(format);
+  }
+  ddjvu_page_release(page);
+  return r;
 }
 
-int DJVU::setZoomToFitWidth() {
-	if (ctx->page) {
-		ctx->zoom = 480.0f/ddjvu_page_get_width(ctx->page);
-		int newzl = ctx->zoomLevel;
-		if(zoomLevels[newzl] != ctx->zoom){
-		  newzl = 0;
-		  while (zoomLevels[newzl]<ctx->zoom){
-		    newzl++;
-		  }
-		  ctx->zoomLevel = newzl;
-		}
-	}
-	
-
-// 	float nx = float(panX)*ctx->zoom;
-// 	float ny = float(panY)*ctx->zoom;
-// 	clipCoords(nx, ny);
-// 	panX = int(nx);
-// 	panY = int(ny);
-	char t[256];
-	snprintf(t, 256, "Zoom %2.3gx", ctx->zoom);
-	setBanner(t);
-	redrawBuffer(true);
-	return BK_CMD_MARK_DIRTY;
+void DJVUWorker::loop() {
+  bool ok = open();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pages = ok ? ddjvu_document_get_pagenum(document) : 0;
+  }
+  if (!ok) {
+    printf("DJVUWorker: cannot open %s\n", path.c_str());
+    close();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (running) {
+    DJVUView job;
+    if (!nextJob(job)) {
+      cond.wait(lock);
+      continue;
+    }
+    lock.unlock();
+    adjustDecodeCache();
+    shared_ptr<DJVURendered> r = render(job);
+    lock.lock();
+    if (r == nullptr)
+      continue;
+    cache.push_front(r);
+    cacheBytes += r->bytes();
+    trimLocked();
+  }
+  cache.clear();
+  cacheBytes = 0;
+  lock.unlock();
+  close();
+}
+
+DJVU::DJVU(string& f) : m_worker(nullptr),
+  #ifdef __vita__
+  m_texture(nullptr),
+  #endif
+  filename(f), m_pages(-1), m_current_page(0), m_fitWidth(true), m_fitHeight(false),
+  zoomLevel(defaultZoomLevel), rotateLevel(0), m_pageW(0), m_pageH(0), m_pageShown(false),
+  m_resetPan(true), m_firstLook(false), m_paletteScheme(-1), panX(0), panY(0)
+{
+  m_worker = new DJVUWorker(filename);
 }
 
-int DJVU::setZoomToFitHeight() {
+DJVU::~DJVU() {
+  // only save a position that came from the file
+  if (m_pages > 0)
+    saveLastView();
+  delete m_worker;
+  #ifdef DEBUG
+    DJVUCacheStats s = getCacheStats();
+    printf("DJVU: pages %i hits %i misses, decode %i hits %i misses\n",
+      s.pageHits, s.pageMisses, s.decodeHits, s.decodeMisses);
+  #endif
+  #ifdef __vita__
+    if (m_texture != nullptr)
+      vita2d_free_texture(m_texture);
+  #endif
+}
+
+DJVU* DJVU::create(string& file) {
+  #ifdef DEBUG
+    printf("DJVU::create\n");
+  #endif
+  DJVU* b = new DJVU(file);
+  b->requestPage();
+  return b;
+}
 
-	if (ctx->page) {
-		ctx->zoom = 272.0f/ddjvu_page_get_height(ctx->page);
-		int newzl = ctx->zoomLevel;
-		if(zoomLevels[newzl] != ctx->zoom){
-		  newzl = 0;
-		  while (zoomLevels[newzl]<ctx->zoom){
-		    newzl++;
-		  }
-		  ctx->zoomLevel = newzl;
-		}
-	}
-// 	float nx = float(panX)*ctx->zoom;
-// 	float ny = float(panY)*ctx->zoom;
-// 	clipCoords(nx, ny);
-// 	panX = int(nx);
-// 	panY = int(ny);
-	char t[256];
-	snprintf(t, 256, "Zoom %2.3gx", ctx->zoom);
-	setBanner(t);
-	redrawBuffer(true);
-	return BK_CMD_MARK_DIRTY;
-}
-int DJVU::setZoomIn(int left, int right) {
-
-	float oldZoom = ctx->zoom;
-	ctx->zoom = oldZoom * 480.0f / (right - left);
-	if (ctx->zoom > 16.0f)
-	  ctx->zoom = 16.0f;
-	int newzl = ctx->zoomLevel;
-	if(zoomLevels[newzl] != ctx->zoom){
-	  newzl = 0;
-	  while (zoomLevels[newzl]<ctx->zoom){
-	    newzl++;
-	  }
-	  ctx->zoomLevel = newzl;
-	}
-	
-	float nx,ny;
-	nx = ((float)panX  + left - leftMargin ) * ctx->zoom/oldZoom;
-	ny = float( panY ) * ctx->zoom / oldZoom;
-	panX = int(nx);
-	panY = int(ny);
-
-	if(xpos_mode || alwaysSetXPos){
-	  int* currentPage;
-	  int* adjPage;
-	  if (ctx->pageno%2){ // current page is odd page
-	    currentPage = &xpos_odd;
-	    adjPage = &xpos_even;
-	  }
-	  else{ // current page is even page.
-	    currentPage = &xpos_even;
-	    adjPage = &xpos_odd;
-	  }
-	
-	  if(ctx->rotateLevel%2){ //vetical mode, take panY value
-	    *currentPage = panY;
-	    *adjPage = int(float( *adjPage ) * ctx->zoom / oldZoom);
-	  }
-	  else{ // normal or upsidedown mode, take panX value
-	    *currentPage = panX;
-	    *adjPage = int(((float)(*adjPage)  + left - leftMargin ) * ctx->zoom/oldZoom);
-	  }
-	}
-
-	resetPanXY = false;
-	char t[256];
-	snprintf(t, 256, "Zoom %2.3gx", ctx->zoom);
-	setBanner(t);
-	redrawBuffer(true);
-	return BK_CMD_MARK_DIRTY;
+bool DJVU::isDJVU(string& file) {
+  char header[4];
+  memset((void*)header, 0, 4);
+  #ifdef __vita__
+    int fd = sceIoOpen(file.c_str(), SCE_O_RDONLY, 0777);
+    if (fd < 0)
+      return false;
+    sceIoRead(fd, header, 4);
+    sceIoClose(fd);
+  #else
+    FILE* f = fopen(file.c_str(), "r");
+    if (!f)
+      return false;
+    fread(header, 4, 1, f);
+    fclose(f);
+  #endif
+  // "AT&T"
+  return header[0] == 0x41 && header[1] == 0x54 && header[2] == 0x26 && header[3] == 0x54;
+}
+
+DJVUView DJVU::currentView() {
+  DJVUView v = { m_current_page, zoomLevel, m_fitWidth, m_fitHeight, rotateLevel };
+  return v;
+}
+
+DJVUCacheStats DJVU::getCacheStats() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  return cacheStats;
+}
+
+void DJVU::requestPage() {
+  m_pageShown = false;
+  m_firstLook = true;
+  m_worker->request(currentView());
+}
+
+// Works for both kinds of page: bpp is 4 for RGBA, 1 for masks. Masks go
+// into a paletted texture so the GPU does the tinting.
+void DJVU::uploadPage(const void* pixels, int w, int h, bool mask) {
+  #ifdef __vita__
+    if (m_texture != nullptr)
+      vita2d_free_texture(m_texture);
+    m_texture = nullptr;
+    m_paletteScheme = -1;
+    if (w == 0 || h == 0)
+      return;
+    if (mask)
+      m_texture = vita2d_create_empty_texture_format(w, h, SCE_GXM_TEXTURE_FORMAT_P8_ABGR);
+    else
+      m_texture = vita2d_create_empty_texture(w, h);
+    if (m_texture == nullptr) {
+      printf("failed to create empty texture\n");
+      return;
+    }
+    int bpp = mask ? 1 : 4;
+    unsigned char* data = (unsigned char*)vita2d_texture_get_datap(m_texture);
+    unsigned int stride = vita2d_texture_get_stride(m_texture);
+    for (int y = 0; y < h; ++y)
+      memcpy(data + y * stride, (const unsigned char*)pixels + y * w * bpp, w * bpp);
+    if (mask)
+      updatePalette();
+  #endif
+}
+
+// Ramp from the scheme's text color (ink) to its background (paper).
+void DJVU::updatePalette() {
+  #ifdef __vita__
+    int scheme = User::options.currentScheme;
+    if (m_texture == nullptr || scheme == m_paletteScheme ||
+        vita2d_texture_get_format(m_texture) != SCE_GXM_TEXTURE_FORMAT_P8_ABGR)
+      return;
+    unsigned int fg = User::options.colorSchemes[scheme].txtFGColor;
+    unsigned int bg = User::options.colorSchemes[scheme].txtBGColor;
+    unsigned int* palette = (unsigned int*)vita2d_texture_get_palette(m_texture);
+    for (int i = 0; i < 256; ++i) {
+      unsigned int r = (((fg >> 16) & 0xff) * (255 - i) + ((bg >> 16) & 0xff) * i) / 255;
+      unsigned int g = (((fg >> 8) & 0xff) * (255 - i) + ((bg >> 8) & 0xff) * i) / 255;
+      unsigned int b = ((fg & 0xff) * (255 - i) + (bg & 0xff) * i) / 255;
+      palette[i] = RGBA8(r, g, b, 255);
+    }
+    m_paletteScheme = scheme;
+  #endif
 }
 
-bool DJVU::isBookmarkable() {
-	return true;
+void DJVU::clampPan() {
+  float minX = std::min(0, DEFAULT_SCREEN_WIDTH - m_pageW);
+  float minY = std::min(0, DEFAULT_SCREEN_HEIGHT - m_pageH);
+  // centre pages narrower than the screen
+  if (m_pageW < DEFAULT_SCREEN_WIDTH)
+    panX = (DEFAULT_SCREEN_WIDTH - m_pageW) / 2;
+  else
+    panX = std::max(minX, std::min(0.0f, panX));
+  panY = std::max(minY, std::min(0.0f, panY));
 }
 
-void DJVU::getBookmarkPosition(map<string, float>& m) {
-	m["page"] = ctx->pageno;
-	m["zoom"] = ctx->zoomLevel;
-	m["panX"] = panX;
-	m["panY"] = panY;
-	m["rotation"] = ctx->rotateLevel;
-	m["xpos_mode"] = xpos_mode;
-	m["xpos_even"] = xpos_even;
-	m["xpos_odd"] = xpos_odd;
+int DJVU::updateContent() {
+  if (m_pages < 0) {
+    m_pages = m_worker->pageCount();
+    if (m_pages < 0)
+      return 0;
+    if (m_pages == 0) {
+      setBanner((char*)"Cannot open document");
+      return BK_CMD_MARK_DIRTY;
+    }
+    // a bookmark may have asked for a page before the count was known
+    if (m_current_page >= m_pages) {
+      m_current_page = m_pages - 1;
+      requestPage();
+    }
+  }
 
+  if (m_pageShown)
+    return 0;
+
+  shared_ptr<DJVURendered> r = m_worker->find(currentView());
+  if (m_firstLook) {
+    // already rendered when asked for, or had to wait for the worker
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (r != nullptr)
+      cacheStats.pageHits++;
+    else
+      cacheStats.pageMisses++;
+    m_firstLook = false;
+  }
+  if (r == nullptr)
+    return 0;
+
+  if (r->mask)
+    uploadPage(r->grey.empty() ? nullptr : &r->grey[0], r->w, r->h, true);
+  else
+    uploadPage(r->pixels.empty() ? nullptr : &r->pixels[0], r->w, r->h, false);
+  m_pageW = r->w;
+  m_pageH = r->h;
+  m_pageShown = true;
+  if (m_resetPan) {
+    panX = 0;
+    panY = 0;
+    m_resetPan = false;
+  }
+  clampPan();
+
+  char t[256];
+  if (r->w == 0)
+    snprintf(t, 256, "Error in page %d", m_current_page + 1);
+  else
+    snprintf(t, 256, "Page %d of %d", m_current_page + 1, m_pages);
+  setBanner(t);
+  return BK_CMD_MARK_DIRTY;
 }
 
-int DJVU::setBookmarkPosition(map<string, float>& m) {
-	setCurrentPage(m["page"]);
-	setZoomLevel2(m["zoom"]);
-	setRotation2(m["rotation"]);
-	panX = m["panX"];
-	panY = m["panY"];
-	xpos_mode = m["xpos_mode"];
-	xpos_even = m["xpos_even"];
-	xpos_odd = m["xpos_odd"];
-	loadNewPage = true;
-	resetPanXY = false;
-	return BK_CMD_MARK_DIRTY;
+int DJVU::resume() {
+  // djvulibre reads the whole file up front for bundled documents; the
+  // rendered pages and texture are all still here
+  return BK_CMD_MARK_DIRTY;
+}
+
+void DJVU::renderContent() {
+  Screen::clear(0xefefef, FZ_COLOR_BUFFER);
+  #ifdef __vita__
+    // the color scheme may have changed since the mask was uploaded
+    updatePalette();
+    if (m_texture != nullptr)
+      vita2d_draw_texture(m_texture, panX, panY);
+  #endif
+}
+
+void DJVU::getFileName(string& s) {
+  s = filename;
+}
+
+void DJVU::getTitle(string& s) {
+  size_t slash = filename.find_last_of("/\\");
+  s = slash == string::npos ? filename : filename.substr(slash + 1);
+}
+
+void DJVU::getType(string& s) {
+  s = "DJVU";
 }
 
 bool DJVU::isPaginated() {
-	return true;
+  return true;
 }
 
 int DJVU::getTotalPages() {
-	return ddjvu_document_get_pagenum(ctx->document);
+  return std::max(m_pages, 1) - 1;
 }
 
 int DJVU::getCurrentPage() {
-	return ctx->pageno;
-}
-
-int DJVU::setCurrentPage(int position) {
-	ctx->djvupageno = ctx->pageno-1; 
-	ctx->pageno = position;
-	if (ctx->pageno < 1)
-		ctx->pageno = 1;
-	if (ctx->pageno > getTotalPages())
-		ctx->pageno = getTotalPages();
-	if (ctx->pageno-1 != ctx->djvupageno) {
-		loadNewPage = true;
-		resetPanXY = true;
-		char t[256];
-		snprintf(t, 256, "Loading page %d", ctx->pageno);
-		setBanner(t);
-		//panX = 0;
-		//panY = 0;
-		return BK_CMD_MARK_DIRTY;
-	}
-	return 0;
+  return m_current_page;
 }
 
-bool DJVU::isRotable() {
-	return true;
-}
+int DJVU::setCurrentPage(int page_number) {
+  if (page_number < 0 || (m_pages >= 0 && page_number >= m_pages)) {
+    setBanner((char*)"Invalid");
+    return 0;
+  }
+  if (page_number == m_current_page)
+    return 0;
 
-int DJVU::getRotation() {
-	return ctx->rotateLevel;
-}
-
-int DJVU::setRotation2(int z, bool bForce) {
-	int n = 4;
-	ctx->rotateLevel = z;
-
-	if (ctx->rotateLevel < 0)
-		ctx->rotateLevel = 3;
-	if (ctx->rotateLevel >= n)
-		ctx->rotateLevel = 0;
-
-	ctx->rotate = rotateLevels[ctx->rotateLevel];
-	return ctx->rotate;
-}
-
-int DJVU::setRotation(int z, bool bForce) {
-
-	if (z == ctx->rotateLevel)
-		return 0;
-
-	int panYc = panY + 136;
-	int panXc = panX + 240;
-
-	switch (z - ctx->rotateLevel) {
-	    case 1:  // clockwise
-		panY = panXc - 136;
-		panX = (int)((float)ddjvu_page_get_height(ctx->page) * ctx->zoom) - panYc - 240;
-
-		if(xpos_mode || alwaysSetXPos){
-		  int* currentPage;
-		  int* adjPage;
-		  if (ctx->pageno%2){ // current page is odd page
-		    currentPage = &xpos_odd;
-		    adjPage = &xpos_even;
-		  }
-		  else{ // current page is even page.
-		    currentPage = &xpos_even;
-		    adjPage = &xpos_odd;
-		  }
-		  
-		  if(z%2){ //vetical mode, take panY value
-		    *currentPage = panY;
-		    *adjPage = *adjPage+240-136;
-		  }
-		  else{ // normal or upsidedown mode, take panX value
-		    *currentPage = panX;
-		    *adjPage = (int)((float)ddjvu_page_get_height(ctx->page) * ctx->zoom) - (*adjPage + 136) - 240;
-		  }
-		}
-
-		break;
-	    case -1:  // counter clockwise
-		panX = panYc - 240;
-		panY = (int)((float)ddjvu_page_get_width(ctx->page) * ctx->zoom) - panXc - 136;
-
-		if(xpos_mode || alwaysSetXPos){
-		  int* currentPage;
-		  int* adjPage;
-		  if (ctx->pageno%2){ // current page is odd page
-		    currentPage = &xpos_odd;
-		    adjPage = &xpos_even;
-		  }
-		  else{ // current page is even page.
-		    currentPage = &xpos_even;
-		    adjPage = &xpos_odd;
-		  }
-		  
-		  if(z%2){ //vetical mode, take panY value
-		    *currentPage = panY;
-		    *adjPage = (int)((float)ddjvu_page_get_width(ctx->page) * ctx->zoom) - (*adjPage+240) - 136;
-		  }
-		  else{ // normal or upsidedown mode, take panX value
-		    *currentPage = panX;
-		    *adjPage = (*adjPage + 136) - 240;
-		  }
-		}
-
-		break;
-	    default: //error, shouldn't be here.
-		;
-	}
-
-	int n = 4;
-	ctx->rotateLevel = z;
-
-	if (ctx->rotateLevel < 0)
-		ctx->rotateLevel = 3;
-	if (ctx->rotateLevel >= n)
-		ctx->rotateLevel = 0;
-
-	ctx->rotate = rotateLevels[ctx->rotateLevel];
-
-
-// 	float nx = float(panX);
-// 	float ny = float(panY);
-// 	clipCoords(nx, ny);
-// 	panX = int(nx);
-// 	panY = int(ny);
-	char t[256];
-	snprintf(t, 256, "Rotate to %3.3g�", 90.0f * ctx->rotateLevel );
+  m_current_page = page_number;
+  m_resetPan = true;
+  requestPage();
+
+  char t[256];
+  snprintf(t, 256, "Loading page %d", m_current_page + 1);
   setBanner(t);
+  return BK_CMD_MARK_DIRTY;
+}
 
-	redrawBuffer();
-	return BK_CMD_MARK_DIRTY;
-}
-
-void DJVU::getTitle(string& s, int type) {
-  switch(type){
-  case 1:
-    s = "<No Title Info>";
-    break;
-  case 2:
-    s = longFileName;
-    break;
-  case 3:
-    s = "<No Title Info> [";
-    s += longFileName;
-    s += "]";
-    break;
-  case 4:
-    s = longFileName;
-    s += " [<No Title Info>]";
-    break;
-  default:
-    s = title;
-    break;
-  }
+bool DJVU::isZoomable() {
+  return true;
 }
 
-void DJVU::getType(string& s) {
-	s = "DJVU";
+void DJVU::getZoomLevels(vector<Document::ZoomLevel>& v) {
+  int n = sizeof(zoomLevels)/sizeof(float);
+  for (int i = 0; i < n; ++i)
+    v.push_back(Document::ZoomLevel(BKDOCUMENT_ZOOMTYPE_ABSOLUTE, "FIX ZOOM LABELS"));
 }
 
-void DJVU::getFileName(string& s) {
-	s = fileName;
+int DJVU::getCurrentZoomLevel() {
+  return zoomLevel;
 }
 
-int DJVU::prePan(int x, int y) {
- 	float nx = float(panX + x);
- 	float ny = float(panY + y);
- 	clipCoords(nx, ny);
- 	if (panX == int(nx) && panY == int(ny))
- 		return 0;
- 	panBuffer(int(nx), int(ny));
-//        panBuffer(panX+x, panY+y);
-	return BK_CMD_MARK_DIRTY;
+int DJVU::setZoomLevel(int z) {
+  int n = sizeof(zoomLevels)/sizeof(float);
+  z = std::max(0, std::min(z, n - 1));
+  if (z == zoomLevel && !m_fitWidth && !m_fitHeight)
+    return 0;
+
+  m_fitWidth = false;
+  m_fitHeight = false;
+  zoomLevel = z;
+  requestPage();
+
+  char t[256];
+  snprintf(t, 256, "Zooming %2.3gx...", zoomLevels[zoomLevel]);
+  setBanner(t);
+  return BK_CMD_MARK_DIRTY;
 }
 
-int DJVU::pan(int x, int y) {
+bool DJVU::hasZoomToFit() {
+  return true;
+}
 
-  int minValueX = 32 * BKUser::options.analogRateX / 100;
-  int minValueY = 32 * BKUser::options.analogRateY / 100;
+int DJVU::setZoomToFitWidth() {
+  m_fitWidth = true;
+  m_fitHeight = false;
+  zoomLevel = defaultZoomLevel;
+  requestPage();
+  return BK_CMD_MARK_DIRTY;
+}
 
-	if (x > -1 * minValueX && x < minValueX)
-		x = 0;
-	if (y > -1 * minValueY && y < minValueY)
-		y = 0;
-	if (x == 0 && y == 0)
-		return 0;
-	x >>= 2;
-	y >>= 2;
-	return prePan(x, y);
+int DJVU::setZoomToFitHeight() {
+  m_fitWidth = false;
+  m_fitHeight = true;
+  requestPage();
+  return BK_CMD_MARK_DIRTY;
+}
+
+int DJVU::pan(int x, int y) {
+  if (abs(x) <= FZ_ANALOG_THRESHOLD && abs(y) <= FZ_ANALOG_THRESHOLD)
+    return 0;
+  if (abs(x) > FZ_ANALOG_THRESHOLD)
+    panX -= x/10;
+  if (abs(y) > FZ_ANALOG_THRESHOLD)
+    panY -= y/10;
+  clampPan();
+  return BK_CMD_MARK_DIRTY;
 }
 
+#define D_PAD_SPEED 250
 int DJVU::screenUp() {
-    return prePan(0, -1 * BKUser::options.vScroll);
+  panY += D_PAD_SPEED;
+  clampPan();
+  return BK_CMD_MARK_DIRTY;
 }
 
 int DJVU::screenDown() {
-    return prePan(0, BKUser::options.vScroll);
+  panY -= D_PAD_SPEED;
+  clampPan();
+  return BK_CMD_MARK_DIRTY;
 }
 
 int DJVU::screenLeft() {
-    return prePan(-1 * BKUser::options.hScroll, 0);
+  panX += D_PAD_SPEED;
+  clampPan();
+  return BK_CMD_MARK_DIRTY;
 }
 
 int DJVU::screenRight() {
-    return prePan(BKUser::options.hScroll, 0);
+  panX -= D_PAD_SPEED;
+  clampPan();
+  return BK_CMD_MARK_DIRTY;
 }
 
-void DJVU::renderContent() {
-	FZScreen::color(0xffffffff);
-	FZScreen::matricesFor2D();
-	FZScreen::enable(FZ_TEXTURE_2D);
-	FZScreen::enable(FZ_BLEND);
-	FZScreen::blendFunc(FZ_ADD, FZ_SRC_ALPHA, FZ_ONE_MINUS_SRC_ALPHA);
-
-	FZScreen::copyImage(FZ_PSM_8888, 0, 0, 480, 272, 480, bounceBuffer, 0, 0, 512, (void*)(0x04000000+(unsigned int)FZScreen::framebuffer()));
-
-#ifdef PSP
-	//int tfm = sceKernelTotalFreeMemSize();
-	//int mfm = sceKernelMaxFreeMemSize();
-	//printf("tfm %d, mfm %d\n", tfm, mfm);
-#endif
+bool DJVU::isRotable() {
+  return true;
 }
 
-void DJVU::redrawBuffer(bool setSpeed) {
-	if(setSpeed)
-	  FZScreen::setSpeed(BKUser::options.pspMenuSpeed);
-
-	if (ctx->pageno-1 != ctx->djvupageno) {
-		if (ctx->page)
-			ddjvu_page_release(ctx->page);
-		ctx->djvupageno = ctx->pageno-1;
-		ctx->page = ddjvu_page_create_by_pageno(ctx->document, ctx->djvupageno);	
-		//djvuHandle(ctx->context, TRUE);
-	}
-	if(ctx->page == NULL){
-		if(setSpeed)
-		  FZScreen::setSpeed(BKUser::options.pspSpeed);
-		return;
-	}
-	ddjvu_page_set_rotation(ctx->page, ctx->rotate);
-
-	char* bufferStart = bounceBuffer;
-
-	ddjvu_rect_t zoomrect;
-	zoomrect.x = zoomrect.y = 0;
-	zoomrect.w = (unsigned int)((float)ddjvu_page_get_width(ctx->page) * ctx->zoom);
-	zoomrect.h = (unsigned int)((float)ddjvu_page_get_height(ctx->page) * ctx->zoom);
-	
-	if (loadNewPage && resetPanXY) {
-
-		if(xpos_mode){
-		  int* currentPage;
-		  if (ctx->pageno%2){ // current page is odd page
-		    currentPage = &xpos_odd;
-		  }
-		  else{ // current page is even page.
-		    currentPage = &xpos_even;
-		  }
-		  
-		  if(ctx->rotateLevel%2){ //vetical mode, set panY value
-		    panY = *currentPage;
-		  }
-		  else{ // normal or upsidedown mode, set panX value
-		    panX = *currentPage;
-		  }
-		}
-
-		// set panX or panY according to rotation
-		switch (ctx->rotateLevel){
-		    case 0: //up
-			panY = 0;
-			break;
-		    case 1: //right
-			panX =  zoomrect.w - 480;
-			break;
-		    case 2: //down
-			panY =  zoomrect.h - 272;
-			break;
-		    case 3: //left
-			panX = 0;
-			break;
-		}
-	}
-	
- 	float nx = float(panX);
- 	float ny = float(panY);
- 	clipCoords(nx, ny);
- 	panX = int(nx);
- 	panY = int(ny);
-
-	if(xpos_mode || alwaysSetXPos){
-	  int* currentPage;
-	  if (ctx->pageno%2){ // current page is odd page
-	    currentPage = &xpos_odd;
-	  }
-	  else{ // current page is even page.
-	    currentPage = &xpos_even;
-	  }
-	  
-	  if(ctx->rotateLevel%2){ //vetical mode, take panY value
-	    *currentPage = panY;
-	  }
-	  else{ // normal or upsidedown mode, take panX value
-	    *currentPage = panX;
-	  }
-	}
-
-	
-	ddjvu_rect_t screenrect;
-	screenrect.x = panX;
-	screenrect.y = panY;
-	screenrect.w = 480;
-	screenrect.h = 272;
-	leftMargin = 0;
-	/* while zoomrect is smaller than screenrect */
-	if(screenrect.w > zoomrect.w) {
-		bufferStart += (screenrect.w - zoomrect.w) / 2 * 4;
-		leftMargin = (screenrect.w - zoomrect.w) / 2;
-		screenrect.w = zoomrect.w;
-		
-	} 
-
-	if(screenrect.h > zoomrect.h) {
-		bufferStart += (screenrect.h - zoomrect.h) / 2 * 480 * 4;
-		screenrect.h = zoomrect.h;
-		
-	} 
-
-	if(bufferStart != bounceBuffer) {
-		unsigned int *d = (unsigned int*)bounceBuffer;
-		//const unsigned int c = BKUser::options.pdfBGColor;
-		const unsigned int c = BKUser::options.colorSchemes[BKUser::options.currentScheme].txtBGColor;
-		for (int i = 0; i < 480*272; i++) {
-			*d++ = c;
-		}
-	}
-	ddjvu_format_t* format = ddjvu_format_create(DDJVU_FORMAT_RGB32, 0, 0);
-	ddjvu_format_set_row_order(format, 1);
-	ddjvu_format_set_y_direction(format, 1);
-	ddjvu_page_render( ctx->page,
-			DDJVU_RENDER_COLOR,
-			&zoomrect,
-			&screenrect,
-			format,
-			480*4,
-			bufferStart);
-	ddjvu_format_release(format);
-	setThumbnail(zoomrect.w, zoomrect.h, screenrect.w, screenrect.h, screenrect.x, screenrect.y);
-	if(setSpeed)
-	  FZScreen::setSpeed(BKUser::options.pspSpeed);
-
-}
-
-void DJVU::panBuffer(int nx, int ny) {
-
-	if(xpos_mode || alwaysSetXPos){
-	  int* currentPage;
-	  if (ctx->pageno%2){ // current page is odd page
-	    currentPage = &xpos_odd;
-	  }
-	  else{ // current page is even page.
-	    currentPage = &xpos_even;
-	  }
-	  
-	  if(ctx->rotateLevel%2){ //vetical mode, take panY value
-	    *currentPage = ny;
-	  }
-	  else{ // normal or upsidedown mode, take panX value
-	    *currentPage = nx;
-	  }
-	}
-
-	panX = nx;
-	panY = ny;
-	redrawBuffer(true);
+int DJVU::getRotation() {
+  return rotateLevel;
+}
+
+int DJVU::setRotation(int r, bool bForce) {
+  if (r == rotateLevel && !bForce)
+    return 0;
+  if (r < 0)
+    r = 3;
+  if (r >= 4)
+    r = 0;
+  rotateLevel = r;
+  m_resetPan = true;
+  requestPage();
+
+  char t[256];
+  snprintf(t, 256, "Rotate to %d°", 90 * rotateLevel);
+  setBanner(t);
+  return BK_CMD_MARK_DIRTY;
 }
 
-int DJVU::resume() {
-	// mupdf leaves open file descriptors around. they don't survive a suspend.
-	return 0;
+bool DJVU::isBookmarkable() {
+  return true;
 }
 
-int DJVU::updateContent() {
-	if (loadNewPage) {
-		//pageError = pdfLoadPage(ctx) != 0;
-		redrawBuffer(true);
-		loadNewPage = false;
-		resetPanXY = false;
-		char t[256];
-		snprintf(t, 256, "Page %d of %d", ctx->pageno, getTotalPages());
-		setBanner(t);
-		return BK_CMD_MARK_DIRTY;
-	}
-
-	return 0;
+void DJVU::getBookmarkPosition(map<string, float>& m) {
+  m["page"] = m_current_page;
+  m["panX"] = panX;
+  m["panY"] = panY;
+  m["zoom"] = zoomLevel;
+  m["fitWidth"] = m_fitWidth;
+  m["fitHeight"] = m_fitHeight;
+  m["rotation"] = rotateLevel;
 }
 
-bool DJVU::isDJVU(string& file) {
-	char header[4];
-	memset((void*)header, 0, 4);
-	FILE* f = fopen(file.c_str(), "r");
-	if (!f)
-	  return false;
-	fread(header, 4, 1, f);
-	fclose(f);
-	return header[0] == 0x41 && header[1] == 0x54 && header[2] == 0x26 && header[3] == 0x54;
-}
-
-float DJVU::getCurrentZoom(){
-  if(ctx)
-    return ctx->zoom;
-  return 0.0f;
-}
-void DJVU::setZoom(float z){
-  if(ctx && z>0.0f){
-    ctx->zoom = z;
-    int newzl = ctx->zoomLevel;
-    if(zoomLevels[newzl] != ctx->zoom){
-      newzl = 0;
-      while (zoomLevels[newzl]<ctx->zoom){
-	newzl++;
-      }
-      ctx->zoomLevel = newzl;
-    }
-  }
+int DJVU::setBookmarkPosition(map<string, float>& m) {
+  m_current_page = std::max(0, (int)m["page"]);
+  int n = sizeof(zoomLevels)/sizeof(float);
+  zoomLevel = std::max(0, std::min((int)get_or(m, "zoom", defaultZoomLevel), n - 1));
+  m_fitWidth = get_or(m, "fitWidth", true);
+  m_fitHeight = get_or(m, "fitHeight", false);
+  rotateLevel = (int)get_or(m, "rotation", 0) & 3;
+  panX = m["panX"];
+  panY = m["panY"];
+  m_resetPan = false;
+  requestPage();
+  return BK_CMD_MARK_DIRTY;
 }
 
-}
\ No newline at end of file
+}
@@ -1,5 +1,5 @@
 /*
- * bkdjvu: djvu extension for bookr
+ * DJVU: djvu extension for bookr
  * Copyright (C) 2007 Yang.Hu (findreams at gmail dot com)
  *
  * This program is free software; you can redistribute it and/or modify
@@ -16,90 +16,135 @@
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
- 
+
 #ifndef BKDJVU_H
 #define BKDJVU_H
 
+#ifdef __vita__
+  #include <vita2d.h>
+#endif
+
 #include <string>
 
 #include "../graphics/screen.hpp"
-#include "../graphics/font.hpp"
 #include "../document.hpp"
 
 using std::string;
 
 namespace bookr {
 
-struct DJVUContext;
+class DJVUWorker;
+
+struct DJVUCacheStats {
+  // rendered pages, as seen by the viewer when it asks for one
+  int pageHits;
+  int pageMisses;
+  // page data still in ddjvu's decode cache, or decoded again
+  int decodeHits;
+  int decodeMisses;
+  size_t pageCacheBytes;
+  size_t decodeCacheBytes;
+};
 
+// What the viewer wants on screen; pages are rendered per view.
+struct DJVUView {
+  int page;         // 0 based
+  int zoomLevel;    // multiplier of fit to width, unless fitting
+  bool fitWidth;
+  bool fitHeight;
+  int rotateLevel;
+  bool operator==(const DJVUView& o) const {
+    return page == o.page && zoomLevel == o.zoomLevel && fitWidth == o.fitWidth &&
+      fitHeight == o.fitHeight && rotateLevel == o.rotateLevel;
+  }
+};
+
+/*! \brief DjVu viewer.
+ *
+ *  All of djvulibre runs on a worker thread that drives the ddjvu message
+ *  queue, so opening a file or turning a page never blocks input. Pages
+ *  are rendered whole at screen resolution and kept in a small cache;
+ *  the viewer picks them up in updateContent and pans over the texture.
+ */
 class DJVU : public Document {
-	DJVUContext* ctx;
-
-	string fileName;
-
-	int panX;
-	int panY;
-	bool loadNewPage;
-	bool resetPanXY;
-	bool pageError;
-	int leftMargin;
-	void panBuffer(int nx, int ny);
-	void clipCoords(float& nx, float& ny);
-	void redrawBuffer(bool setSpeed = false);
-	int prePan(int x, int y);
-
-	string title;
-
-	protected:
-	DJVU(string& f);
-	~DJVU();
-
-	public:
-	virtual int updateContent();
-	virtual int resume();
-	virtual void renderContent();
-
-	virtual void getFileName(string&);
-	virtual void getTitle(string&, int type = 0);
-	virtual void getType(string&);
-
-	virtual bool isPaginated();
-	virtual int getTotalPages();
-	virtual int getCurrentPage();
-	virtual int setCurrentPage(int);
-
-	virtual bool isZoomable();
-	virtual void getZoomLevels(vector<Document::ZoomLevel>& v);
-	virtual int getCurrentZoomLevel();
-	virtual int setZoomLevel2(int);
-	virtual int setZoomLevel(int);
-	virtual bool hasZoomToFit();
-	virtual int setZoomToFitWidth();
-	virtual int setZoomToFitHeight();
-	virtual int setZoomIn(int, int);
-	virtual void setZoom(float z);
-
-	virtual int pan(int, int);
-
-	virtual int screenUp();
-	virtual int screenDown();
-	virtual int screenLeft();
-	virtual int screenRight();
-
-	virtual bool isRotable();
-	virtual int getRotation();
-	virtual int setRotation2(int, bool bForce=false);
-	virtual int setRotation(int, bool bForce=false);
-
-	virtual bool isBookmarkable();
-	virtual void getBookmarkPosition(map<string, float>&);
-	virtual int setBookmarkPosition(map<string, float>&);
-	virtual float getCurrentZoom();
-
-	static DJVU* create(string& file,string& longfilename);
-	static bool isDJVU(string& file);
+private:
+  DJVUWorker* m_worker;
+  #ifdef __vita__
+  vita2d_texture *m_texture;
+  #endif
+
+  string filename;
+  int m_pages;            // -1 while the worker is still opening the file
+  int m_current_page;
+  bool m_fitWidth;
+  bool m_fitHeight;
+  int zoomLevel;
+  int rotateLevel;
+
+  // size of the page texture, and whether it shows the current view
+  int m_pageW;
+  int m_pageH;
+  bool m_pageShown;
+  bool m_resetPan;
+  bool m_firstLook;
+  // color scheme the mask palette was built for
+  int m_paletteScheme;
+
+  float panX;
+  float panY;
+
+  DJVUView currentView();
+  void requestPage();
+  void uploadPage(const void* pixels, int w, int h, bool mask);
+  void updatePalette();
+  void clampPan();
+
+protected:
+  DJVU(string& f);
+  ~DJVU();
+
+public:
+  virtual int updateContent();
+  virtual int resume();
+  virtual void renderContent();
+
+  virtual void getFileName(string&);
+  virtual void getTitle(string&);
+  virtual void getType(string&);
+
+  virtual bool isPaginated();
+  virtual int getTotalPages();
+  virtual int getCurrentPage();
+  virtual int setCurrentPage(int);
+
+  virtual bool isZoomable();
+  virtual void getZoomLevels(vector<Document::ZoomLevel>& v);
+  virtual int getCurrentZoomLevel();
+  virtual int setZoomLevel(int);
+  virtual bool hasZoomToFit();
+  virtual int setZoomToFitWidth();
+  virtual int setZoomToFitHeight();
+
+  virtual int pan(int, int);
+
+  virtual int screenUp();
+  virtual int screenDown();
+  virtual int screenLeft();
+  virtual int screenRight();
+
+  virtual bool isRotable();
+  virtual int getRotation();
+  virtual int setRotation(int, bool bForce=false);
+
+  virtual bool isBookmarkable();
+  virtual void getBookmarkPosition(map<string, float>&);
+  virtual int setBookmarkPosition(map<string, float>&);
+
+  static DJVU* create(string& file);
+  static bool isDJVU(string& file);
+  static DJVUCacheStats getCacheStats();
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -11,29 +11,56 @@
 */
 
 #include <cmath>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <list>
 #include <algorithm>
 #include <vector>
 
 #include "fancytext.hpp"
+#include "linebreak.hpp"
 
 using std::list;
 
 namespace bookr {
 
-FancyText::FancyText() : lines(0), nLines(0), topLine(0), maxY(0), font(0), rotation(0), runs(0), nRuns(0), holdScroll(false) {
+// views whose layouts are kept; rotating back and forth needs two
+#define TEXT_LAYOUTS 3
+// a window starts this big and doubles until the pages fit
+#define WINDOW_CHUNK (16 * 1024)
+// txtSize the system font draws at scale 1, and its line pitch there
+#define TEXT_BASE_SIZE 11.0f
+#define TEXT_LINE_PITCH 20
+// first baseline from the top of the view
+#define TEXT_TOP 40
+// page textures: the one on screen and the ones either side of it
+#define PAGE_TEXTURES 3
+
+FancyText::FancyText() : topLine(0), maxY(0), font(0), rotation(0), linesPerPage(25), viewWidth(0),
+  window(0), windowCapacity(0), windowFirstLine(0), windowFirstDisplay(0), pendingLine(-1), pendingOffset(0),
+  placeTop(-1), placeLine(0), placeOffset(0), layoutSerial(0),
+  runs(0), nRuns(0), runsCapacity(0), source(0), index(0), hardLines(false), holdScroll(false) {
   lastFontSize  = User::options.txtSize;
   lastFontFace  = User::options.txtFont;
   lastHeightPct = User::options.txtHeightPct;
   lastWrapCR    = User::options.txtWrapCR;
+  lastEncoding  = User::options.txtEncoding;
+  lastHyphenate = User::options.txtHyphenate;
 }
 
 FancyText::~FancyText() {
+  dropPages();
+  // index threads read from the source
+  for (list<TextLineIndex*>::iterator it = layouts.begin(); it != layouts.end(); ++it)
+    delete *it;
+  if (source)
+    delete source;
+  if (window)
+    free(window);
   if (runs)
-    delete[] runs;
-  if (lines)
-    delete[] lines;
+    free(runs);
   if (font)
     font->release();
 }
@@ -42,399 +69,264 @@ static inline bool isBlank(int c) {
     return c == 32 || c == 10 || c == 9;
 }
 
-struct RunsIterator {
-    Run* runs;
-    int currentRun;
-    int currentChar;
-    int currentWidth;
-    int maxRuns;
-    int lineBreakMark;
-    int globalPos;
-    bool end() {
-      return currentRun >= maxRuns ||
-        ((currentRun == maxRuns - 1) && currentChar >= runs[currentRun].n);
-    }
-    inline unsigned char forward() {
-      if (end()) return 0;
-      if (currentChar >= runs[currentRun].n) {
-        lineBreakMark += runs[currentRun].lineBreak ? 1 : 0;
-        ++currentRun;
-        currentChar = 0;
-        return forward();
-      }
-      unsigned char c = runs[currentRun].text[currentChar];
-      ++currentChar;
-      ++globalPos;
-      return c;
-    }
-    inline unsigned char backward() {
-      if (currentRun <= 0 && currentChar < 0) return 0;
-      if (currentChar < 0) {
-        --currentRun;
-        currentChar = runs[currentRun].n - 1;
-        return backward();
-      }
-      unsigned char c = runs[currentRun].text[currentChar];
-      --currentChar;
-      --globalPos;
-      return c;
-    }
-    RunsIterator(Run* r, int cr, int cc, int mr) : 	runs(r), currentRun(cr), currentChar(cc), maxRuns(mr), lineBreakMark(false), globalPos(0) { }
-    RunsIterator(const RunsIterator& s) :
-      runs(s.runs),
-      currentRun(s.currentRun),
-      currentChar(s.currentRun),
-      maxRuns(s.currentRun),
-      lineBreakMark(s.lineBreakMark),
-      globalPos(s.globalPos) { }
-};
-
-void FancyText::reflow(int width) {
-    if (lines)
-      delete[] lines;
-    list<Line> tempLines;
-
-    int lineFirstRun = 0;
-    int lineFirstRunOffset = 0;
-    int lineSpaces = 0;
-    int lineStartGlobalPos = 0;
-    int currentWidth = 0;
-    float spaceWidth = 0.0f;
-    RunsIterator rit(runs, 0, 0, nRuns);
-    RunsIterator lastSpace = rit;
+// text is measured and drawn with the system font at this scale
+static float textScale() {
+    return User::options.txtSize / TEXT_BASE_SIZE;
+}
 
+static int linePitch() {
+    return std::max(1, (int)(TEXT_LINE_PITCH * textScale() + 0.5f));
+}
+
+void FancyText::fitLines(int height) {
     #ifdef PSP
-      FZCharMetrics* fontChars = font->getMetrics();
-      const int spaceWidthC = fontChars[32].xadvance;
-      const float spaceWidthCF = float(spaceWidthC);
-    #elif defined(__vita__) || defined(MAC) || defined(WIN32) || defined(SWITCH)
-      const int spaceWidthC = 10;
-      const float spaceWidthCF = 10;
+      linesPerPage = (height - 10) / (font->getLineHeight()*(User::options.txtHeightPct/100.0));
+    #elif defined(__vita__)
+      linesPerPage = std::max(1, (height - TEXT_TOP) / linePitch());
     #endif
+}
 
-    while (!rit.end()) {
-      if (currentWidth > width || rit.lineBreakMark > 0) {
-        spaceWidth = spaceWidthCF;
-        int tl = rit.lineBreakMark;
-        if (rit.lineBreakMark > 0) {
-          rit.lineBreakMark = 0;
-        } else if (lineSpaces > 0) {
-          rit = lastSpace;
-          --lineSpaces;
-          if (lineSpaces > 0)
-            spaceWidth = spaceWidthCF + (float(width - rit.currentWidth) / float(lineSpaces));
-          else
-            spaceWidth = spaceWidthCF;
-        } else {
-          rit.backward();			// consume the overflowing char
-        }
-        --tl;
-        //printf("line n %d\n", rit.globalPos - lineStartGlobalPos);
-        tempLines.push_back(Line(lineFirstRun, lineFirstRunOffset, rit.globalPos - lineStartGlobalPos, spaceWidth));
-        while (tl > 0) {
-          tempLines.push_back(Line(lineFirstRun, lineFirstRunOffset, 0, spaceWidth));
-          --tl;
-        }
-        lineFirstRun = rit.currentRun;
-        lineFirstRunOffset = rit.currentChar;
-        lineStartGlobalPos = rit.globalPos;
-        lineSpaces = 0;
-        currentWidth = 0;
-      }
-      int c = rit.forward();
-      if (isBlank(c)) {
-        lastSpace = rit;
-        ++lineSpaces;
-      }
-      #ifdef PSP
-        currentWidth += fontChars[c].xadvance;
-      #elif defined(__vita__)
-        currentWidth += 10;
-      #endif
-      rit.currentWidth = currentWidth;
+// Wraps runs from firstRun on until there are wantLines display lines.
+void FancyText::layoutRuns(int firstRun, int wantLines) {
+    GlyphAdvances* advances = GlyphAdvances::forScale(textScale());
+    std::vector<WrappedLine> wrapped;
+    for (int i = firstRun; i < nRuns && (int)lines.size() < wantLines; ++i) {
+      wrapped.clear();
+      TextLayout::wrap(runs[i].text, runs[i].n, viewWidth, advances, breakBits.data() + runs[i].breaks,
+        User::options.txtHyphenate, &wrapped);
+      for (size_t k = 0; k < wrapped.size(); ++k)
+        lines.push_back(Line(i, wrapped[k].start, wrapped[k].n, wrapped[k].spaceWidth, wrapped[k].hyphen));
     }
+}
 
-    nLines = tempLines.size();
-    lines = new Line[nLines];
-    list<Line>::iterator it(tempLines.begin());
-    int i = 0;
-    while (it != tempLines.end()) {
-      const Line& l = *it;
-      lines[i] = l;
-      ++i;
-      ++it;
+void FancyText::resizeView(int width, int height) {
+    viewWidth = width - 10 - 10;
+    ++layoutSerial;
+    fitLines(height);
+    maxY = height - 10;
+    if (source) {
+      selectLayout();
+    } else {
+      lines.clear();
+      layoutRuns(0, INT_MAX);
     }
 }
 
-void FancyText::resizeView(int width, int height) {
-    reflow(width - 10 - 10);
+int FancyText::wrapCR() {
+    return hardLines ? 0 : User::options.txtWrapCR;
+}
 
-    #ifdef PSP
-      linesPerPage = (height - 10) / (font->getLineHeight()*(User::options.txtHeightPct/100.0));
-    #elif defined(__vita__)
-      linesPerPage = 25;
+void FancyText::openSource(TextSource* s) {
+    // the index comes with the first view, it depends on the width
+    source = s;
+}
+
+string FancyText::layoutCachePath(const TextLayoutKey& key) {
+    string file;
+    getFileName(file);
+    char name[64];
+    snprintf(name, sizeof(name), "layout-%016llx.idx",
+      (unsigned long long)TextLayout::fnv1a(file.data(), file.size(), key.hash()));
+    #ifdef __vita__
+      return Screen::basePath() + "data/Bookr/" + name;
+    #else
+      return Screen::basePath() + "/" + name;
     #endif
+}
 
-    maxY = height - 10;
-    totalPages = (nLines / linesPerPage) + 1;
+// Switches to the layout for the current view, reusing one built before,
+// and keeps the same text at the top of the page.
+void FancyText::selectLayout() {
+    TextLayoutKey key = { viewWidth, wrapCR(), User::options.txtSize, User::options.txtFont, textScale(),
+      User::options.txtHyphenate };
+    int line = 0;
+    int offset = 0;
+    topPlace(line, offset);
+    if (pendingLine < 0 && topLine == placeTop && line == placeLine)
+      offset = placeOffset;
+
+    list<TextLineIndex*>::iterator it = layouts.begin();
+    while (it != layouts.end() && !((*it)->layoutKey() == key))
+      ++it;
+    if (it != layouts.end()) {
+      layouts.splice(layouts.begin(), layouts, it);
+    } else {
+      TextLineIndex* layout = new TextLineIndex(source, key, layoutCachePath(key));
+      layout->start();
+      layouts.push_front(layout);
+      if (layouts.size() > TEXT_LAYOUTS) {
+        delete layouts.back();
+        layouts.pop_back();
+      }
+    }
+    index = layouts.front();
+
+    lines.clear();
+    topLine = 0;
+    setPlace(line, offset);
+    ensureWindow();
+    placeTop = topLine;
+    placeLine = line;
+    placeOffset = offset;
 }
 
-// a lot of ebook formats use HTML as a display format, on top of a
-// container format. so it makes sense to put the parser/tokenizer in
-// the base class
+int FancyText::lineCount() {
+    return index ? index->totalDisplayLines() : (int)lines.size();
+}
 
-struct StrIt {
-    char* p;
-    int i;
-    int n;
-    StrIt(char* _p, int _i, int _n) : p(_p), i(_i), n(_n) { }
-    bool end() {
-      return i >= n;
+// The source line at the top of the page and the byte in it where the
+// page starts. These don't depend on the layout.
+void FancyText::topPlace(int& line, int& offset) {
+    if (pendingLine >= 0) {
+      line = pendingLine;
+      offset = pendingOffset;
+      return;
     }
-    bool matches(const char* s) {				// does NOT advance the iteration
-      char* q = p;
-      int j = i;
-      while (*s != 0 && j < n) {
-        char c = *s >= 'A' && *s <= 'Z' ? *s | 0x20 : *s;		// tolower for ascii
-        if (c != *q)
-          return false;
-        ++q;
-        ++s;
-        ++j;
-      }
-      return true;
+    int i = topLine - windowFirstDisplay;
+    if (i < 0 || i >= (int)lines.size()) {
+      line = 0;
+      offset = 0;
+      return;
     }
-    void skipTo(const char* s) {
-      while (!matches(s)) {
-        forward();
-      }
-      if (!end()) {
-        int l = strlen(s);
-        p += l;
-        i += l;
-      }
+    line = windowFirstLine + lines[i].firstRun;
+    offset = lines[i].firstRunOffset;
+}
+
+// Display line showing byte offset of source line line.
+int FancyText::displayLineAt(int line, int offset) {
+    if (index == NULL) {
+      int d = 0;
+      for (int i = 0; i < (int)lines.size(); ++i)
+        if (lines[i].firstRun < line || (lines[i].firstRun == line && lines[i].firstRunOffset <= offset))
+          d = i;
+      return d;
     }
-    unsigned char forward() {
-      unsigned char c = 0;
-      if (!end()) {
-        c = (unsigned char)*p;
-        ++p;
-        ++i;
-      }
-      return c;
+    int d = index->displayForLine(line);
+    if (offset <= 0)
+      return d;
+    loadWindow(d);
+    for (int i = 0; i < (int)lines.size() && windowFirstLine + lines[i].firstRun == line; ++i)
+      if (lines[i].firstRunOffset <= offset)
+        d = windowFirstDisplay + i;
+    return d;
+}
+
+int FancyText::setPlace(int line, int offset) {
+    // a big file may still be indexing; updateContent goes there later
+    if (index != NULL && !index->complete() && line >= index->totalLines()) {
+      pendingLine = line;
+      pendingOffset = offset;
+      return BK_CMD_MARK_DIRTY;
     }
-};
-
-char* FancyText::parseHTML(FancyText* r, char* in, int n) {
-    // detokenize html text
-    // <head*>*</head> --> strip
-    // <p*> --> run break, EXTRALF
-    // <br*> --> run break, LF
-    // <*> --> strip
-    // ascii < 32 --> strip
-    // &*; --> to do...
-
-    list<Run> tempRuns;
-    Run run;
-
-    StrIt it(in, 0, n);
-
-    char* out = (char*)malloc(n);
-    memset(out, 0, n);
-    char* q = out;
-    char* lastQ = out;
-    int i = 0;
-    int li = 0;
-
-    run.lineBreak = true;
-
-    bool lastBlank = false;
-    while (!it.end()) {
-      if (it.matches("<head")) {			// skip html header
-        it.skipTo("</head>");
-        continue;
-      }
-      if (it.matches("<p")) {
-        it.skipTo(">");
-        // close the previous run
-        run.text = lastQ;
-        run.n = i - li;
-        //printf("p %d\n", run.n);
-        li = i;
-        lastQ = q;
-        tempRuns.push_back(run);
-
-        // the continuation for the next run
-        run.lineBreak = true;
-        continue;
-      }
-      if (it.matches("<h") ) {
-        it.skipTo(">");
-        // close the previous run
-        run.text = lastQ;
-        run.n = i - li;
-        li = i;
-        lastQ = q;
-        tempRuns.push_back(run);
-
-        // the continuation for the next run
-        run.lineBreak = true;
-        /**q = '>'; ++q;
-        *q = '>'; ++q;
-        *q = '>'; ++q;
-        *q = ' '; ++q;
-        i += 4;*/
-        continue;
-      }
-      if (it.matches("<br")) {
-        it.skipTo(">");
-        // close the previous run
-        run.text = lastQ;
-        run.n = i - li;
-        //printf("br %d\n", run.n);
-        li = i;
-        lastQ = q;
-        tempRuns.push_back(run);
-
-        // the continuation for the next run
-        run.lineBreak = true;
-        continue;
-      }
-      if (it.matches("<li") || it.matches("<dt") || it.matches("<dl")) {
-        it.skipTo(">");
-        // close the previous run
-        run.text = lastQ;
-        run.n = i - li;
-        li = i;
-        lastQ = q;
-        tempRuns.push_back(run);
-
-        // the continuation for the next run
-        run.lineBreak = true;
-        *q = '*'; ++q;
-        *q = ' '; ++q;
-        i += 2;
-        continue;
-      }
-      if (it.matches("<")) {				// any other tag - ignore it
-        it.skipTo(">");
-        continue;
-      }
-      unsigned char c = it.forward();
-      if (!isBlank(c) && c < 32)			// skip non-blanks, non-printables
-        continue;
-      if (isBlank(c) && !lastBlank) {		// consolidate 1 to N blanks into a single space
-        *q = 32;
-        ++q;
-        ++i;
-        lastBlank = true;
-      }
-      if (c > 32) {						// passthru any other char
-        *q = c;
-        ++q;
-        ++i;
-        lastBlank = false;
+    return setLine(displayLineAt(line, offset));
+}
+
+// Only the page on screen and one on each side are read and laid out,
+// starting from the source line that holds firstDisplay.
+void FancyText::loadWindow(int firstDisplay) {
+    if (firstDisplay < 0)
+      firstDisplay = 0;
+    TextLineIndex::Checkpoint at = index->lineForDisplay(firstDisplay);
+    int want = firstDisplay - at.display + 4 * linesPerPage;
+    int length = WINDOW_CHUNK;
+    lines.clear();
+    for (;;) {
+      if (length > windowCapacity) {
+        char* w = (char*)realloc(window, length);
+        if (w == NULL) {
+          printf("FancyText: cannot allocate %d bytes\n", length);
+          return;
+        }
+        window = w;
+        windowCapacity = length;
       }
+      int r = source->read(at.offset, window, length);
+      if (r < 0)
+        r = 0;
+      // a short read is the end; converted sources only learn their size
+      // by getting there
+      bool atEnd = r < length;
+      // each source line is one display line at least
+      parseLines(window, r, at.offset, at.line, want, atEnd);
+      lines.clear();
+      layoutRuns(0, want);
+      if (atEnd || (int)lines.size() >= want)
+        break;
+      length *= 2;
     }
-    // last run
-    run.text = lastQ;
-    run.n = i - li;
-    tempRuns.push_back(run);
-
-    // create fast fixed size run array	
-    r->runs = new Run[tempRuns.size()];
-    r->nRuns = tempRuns.size();
-    list<Run>::iterator jt(tempRuns.begin());
-    i = 0;
-    while (jt != tempRuns.end()) {
-      const Run& l = *jt;
-      r->runs[i] = l;
-      ++i;
-      ++jt;
+    windowFirstLine = at.line;
+    windowFirstDisplay = at.display;
+}
+
+// Keeps the page and the next one in the window, so the next page can be
+// drawn ahead of time.
+void FancyText::ensureWindow() {
+    if (source == NULL)
+      return;
+    int last = std::min(topLine + 2 * linesPerPage, lineCount());
+    if (lines.empty() || topLine < windowFirstDisplay || last > windowFirstDisplay + (int)lines.size())
+      loadWindow(topLine - linesPerPage);
+}
+
+// Runs live in one array that only grows; every parse reuses it.
+Run* FancyText::addRun() {
+    if (nRuns == runsCapacity) {
+      int capacity = runsCapacity > 0 ? runsCapacity * 2 : 128;
+      Run* r = (Run*)realloc(runs, capacity * sizeof(Run));
+      if (r == NULL)
+        throw "Out of memory for text runs";
+      runs = r;
+      runsCapacity = capacity;
     }
-
-    free(in);
-
-    return out;
-}
-
-static vector<string> sRuns;
-static int pageNumber = 0;
-static int maxPageNumber = 0;
-static int linesPerPage = 25;
-char* FancyText::parseText(FancyText* r, char* b, int length) {
-    sRuns.clear();
-    pageNumber = 0;
-    maxPageNumber = 0;
-
-    // tokenize text file
-    list<Run> tempRuns;
-    int li = 0;
-    string ss(b);
-    Run run;
-    // int lastbreak = 0;
-    for (int i = 0; i < length; ++i) {
-      if (b[i] == '\n') {
-        bool bBreak = true;
-        if( User::options.txtWrapCR > 0 )
-        {
-          // if( i-lastbreak < 100 )
-          // {
-          // 	b[i] = 'X';
-          // 	bBreak = false;
-          // } else
-          // 	lastbreak = i;
-          bBreak = true;
-          for( int j = 1 ; j <= User::options.txtWrapCR+1 ; j++ )
-          {
-            if( i+j >= length || b[i+j] != 10 )
-              bBreak = false;
-          }
-          if( !bBreak )
-          {
-            for( int j = 1 ; j <= User::options.txtWrapCR+1 ; j++ )
-            {
-              if( i+j < length && b[i+j] == 10 )
-                b[i+j] = 32;
-            }
-          }
-        }
-        if( bBreak )
-        {
-          run.text = &b[li];
-          string s = ss.substr(li, (i - li + 1));
-          // psp2shell_print("string %i to  %i cstr: %s\n", li, (i - li), s.c_str());
-          // sceKernelDelayThread(2*1000000);
-          run.n = i - li;
-          li = i+1;
-          run.lineBreak = true;
-          tempRuns.push_back(run);
-          sRuns.push_back(s);
-          
-        }
+    return &runs[nRuns++];
+}
+
+void FancyText::findBreaks(Run* run) {
+    run->breaks = (int)breakBits.size();
+    breakBits.resize(breakBits.size() + LINE_BREAK_WORDS(run->n));
+    LineBreaks::find(run->text, run->n, breakBits.data() + run->breaks);
+}
+
+// line runs point into b; newlines joined by txtWrapCR become spaces
+void FancyText::addLine(char* b, int64_t base, int64_t start, int64_t end) {
+    Run* run = addRun();
+    memset(run, 0, sizeof(Run));
+    run->text = b + (start - base);
+    run->n = (int)(end - start);
+    run->lineBreak = true;
+    if (wrapCR() > 0) {
+      char* e = run->text + run->n;
+      for (char* q = run->text; (q = (char*)memchr(q, '\n', e - q)) != NULL; ++q)
+        *q = ' ';
+    }
+    findBreaks(run);
+}
+
+// One pass over the bytes, no copies: runs point straight into b. Unless
+// atEnd, the text after the last complete line is left out.
+void FancyText::parseLines(char* b, int length, int64_t offset, int firstLine, int maxLines, bool atEnd) {
+    nRuns = 0;
+    breakBits.clear();
+    TextLineScanner scanner(wrapCR(), offset, firstLine);
+    int64_t start = offset;
+    int used = 0;
+    bool newLine;
+    while (used < length && nRuns < maxLines) {
+      used += scanner.feed(b + used, length - used, newLine);
+      if (newLine) {
+        addLine(b, offset, start, scanner.brokeOnNewline ? scanner.lineStart - 1 : scanner.lineStart);
+        start = scanner.lineStart;
       }
     }
-    
-    // last run
-    run.text = &b[li];
-    run.n = length - li;
-    run.lineBreak = true;
-    tempRuns.push_back(run);
-
-    // create fast fixed size run array	
-    r->runs = new Run[tempRuns.size()];
-    r->nRuns = tempRuns.size();
-    list<Run>::iterator it(tempRuns.begin());
-    int i = 0;
-    while (it != tempRuns.end()) {
-      const Run& l = *it;
-      r->runs[i] = l;
-      //psp2shell_print("run[%i] - %s\n", i, (*it).text);
-      ++i;
-      ++it;
+    if (!atEnd)
+      return;
+    while (nRuns < maxLines && scanner.finish()) {
+      addLine(b, offset, start, scanner.lineStart - 1);
+      start = scanner.lineStart;
     }
-
-    return b;
+    // last line
+    if (nRuns < maxLines)
+      addLine(b, offset, start, offset + length);
 }
 
 // extern "C" {
@@ -459,11 +351,26 @@ void FancyText::resetFonts() {
 }
 
 int FancyText::updateContent() {
-    if (lastFontSize != User::options.txtSize
-    || lastFontFace != User::options.txtFont 
+    if (lastFontFace != User::options.txtFont 
     || lastHeightPct != User::options.txtHeightPct // should be able to just resize view here
-    || lastWrapCR != User::options.txtWrapCR )
+    || lastWrapCR != User::options.txtWrapCR
+    || lastEncoding != User::options.txtEncoding
+    || lastHyphenate != User::options.txtHyphenate )
       return BK_CMD_RELOAD;
+    // a new size only needs the layout for it, nothing is reloaded
+    if (lastFontSize != User::options.txtSize) {
+      lastFontSize = User::options.txtSize;
+      ++layoutSerial;
+      fitLines(maxY + 10);
+      if (source)
+        selectLayout();
+      return BK_CMD_MARK_DIRTY;
+    }
+    // the bookmarked line has been indexed
+    if (pendingLine >= 0 && (index->complete() || pendingLine < index->totalLines())) {
+      setPlace(pendingLine, pendingOffset);
+      return BK_CMD_MARK_DIRTY;
+    }
     return 0;
 }
 
@@ -489,29 +396,147 @@ static int strpos(string haystack, char needle, int nth)
     return -1;
 }
 
-void FancyText::renderContent() {
+// Whether the lines of the page at top are all in the window.
+bool FancyText::pageLoaded(int top) {
+    int last = std::min(top + linesPerPage, lineCount());
+    return top >= windowFirstDisplay && top < last && last <= windowFirstDisplay + (int)lines.size();
+}
+
+void FancyText::drawLines(int top) {
     #ifdef __vita__
-      // psp2shell_print("sruns size: %i", );
-      if (maxPageNumber == 0)
-        maxPageNumber = (int) floor( (float)sRuns.size() / float(linesPerPage) );
-
-      int condition;
-      if (pageNumber >= maxPageNumber)
-        condition = (int)sRuns.size();
-      else
-        condition = ((pageNumber+1) * linesPerPage);
-      
-      // psp2shell_print("currentpage :   %i\n", pageNumber);
-      // psp2shell_print("maxPageNumber : %i\n", maxPageNumber);
-      // psp2shell_print("condition :     %i\n", condition);
-
-      for (int i = (pageNumber * linesPerPage); i < condition; i++) {
-        Screen::drawText(20, 40 + (20 * (i % linesPerPage)), RGBA8(0, 0, 0, 255), 1.0f, sRuns[i].c_str());
+      char text[512];
+      const float scale = textScale();
+      const int pitch = linePitch();
+      GlyphAdvances* advances = GlyphAdvances::forScale(scale);
+      const float space = advances->advance(' ');
+      int first = std::max(top, windowFirstDisplay);
+      int last = std::min(top + linesPerPage, windowFirstDisplay + (int)lines.size());
+      for (int i = first; i < last; i++) {
+        const Line& line = lines[i - windowFirstDisplay];
+        if (line.totalChars <= 0)
+          continue;
+        const char* t = runs[line.firstRun].text + line.firstRunOffset;
+        // room for the hyphen of a broken word
+        int n = std::min(line.totalChars, (int)sizeof(text) - 2);
+        int y = TEXT_TOP + pitch * (i - top);
+        if (!User::options.txtJustify || line.spaceWidth <= space) {
+          memcpy(text, t, n);
+          if (line.hyphen)
+            text[n++] = '-';
+          text[n] = 0;
+          Screen::drawText(20, y, RGBA8(0, 0, 0, 255), scale, text);
+          continue;
+        }
+        // justified: word by word, blanks as wide as the layout made them
+        float x = 20;
+        for (int k = 0; k < n; ) {
+          if (isBlank((unsigned char)t[k])) {
+            x += line.spaceWidth;
+            ++k;
+            continue;
+          }
+          int e = k;
+          while (e < n && !isBlank((unsigned char)t[e]))
+            ++e;
+          int m = e - k;
+          memcpy(text, t + k, m);
+          if (e == n && line.hyphen)
+            text[m++] = '-';
+          text[m] = 0;
+          Screen::drawText((int)x, y, RGBA8(0, 0, 0, 255), scale, text);
+          x += TextLayout::width(t + k, e - k, advances);
+          k = e;
+        }
       }
-
-      
-      
     #endif
+}
+
+void FancyText::dropPages() {
+    for (size_t i = 0; i < pages.size(); ++i)
+      Screen::freeRenderTarget(pages[i].texture);
+    pages.clear();
+}
+
+int FancyText::pageLines(int top) {
+    int first = std::max(top, windowFirstDisplay);
+    int last = std::min(top + linesPerPage, windowFirstDisplay + (int)lines.size());
+    return std::max(0, last - first);
+}
+
+// The texture holding the page at top as it would be drawn now, if any.
+FancyText::PageTexture* FancyText::findPage(int top) {
+    int nLines = pageLines(top);
+    unsigned int background = Screen::getClearColor();
+    for (size_t i = 0; i < pages.size(); ++i) {
+      PageTexture* p = &pages[i];
+      if (p->top == top && p->layout == layoutSerial && p->nLines == nLines &&
+        p->justify == User::options.txtJustify && p->background == background)
+        return p;
+    }
+    return nullptr;
+}
+
+// The texture of the page at top, drawn now unless it is already done;
+// it replaces the page farthest from the one on screen. NULL when there
+// are no render targets.
+FancyText::PageTexture* FancyText::pageTexture(int top) {
+    PageTexture* victim = findPage(top);
+    if (victim != nullptr)
+      return victim;
+    int farthest = -1;
+    for (size_t i = 0; i < pages.size(); ++i) {
+      bool stale = pages[i].top < 0 || pages[i].layout != layoutSerial;
+      int d = stale ? INT_MAX : std::abs(pages[i].top - topLine);
+      if (d > farthest) {
+        farthest = d;
+        victim = &pages[i];
+      }
+    }
+    if (pages.size() < PAGE_TEXTURES) {
+      Texture* texture = Screen::createRenderTarget();
+      if (texture != nullptr) {
+        PageTexture p = { texture, -1, 0, 0, false, 0 };
+        pages.push_back(p);
+        victim = &pages.back();
+      }
+    }
+    if (victim == nullptr)
+      return nullptr;
+
+    victim->top = top;
+    victim->layout = layoutSerial;
+    victim->nLines = pageLines(top);
+    victim->justify = User::options.txtJustify;
+    victim->background = Screen::getClearColor();
+    Screen::startRenderTarget(victim->texture, victim->background);
+    drawLines(top);
+    Screen::endRenderTarget();
+    return victim;
+}
+
+// The page is drawn into a texture before the first frame that shows it,
+// and each frame after that only draws the texture. Each frame also readies
+// one page either side, so turning a page finds it done.
+void FancyText::prepare() {
+    if (pageTexture(topLine) == nullptr)
+      return;
+    int ahead[2] = { topLine + linesPerPage, topLine - linesPerPage };
+    for (int k = 0; k < 2; ++k) {
+      if (pageLoaded(ahead[k]) && findPage(ahead[k]) == nullptr) {
+        pageTexture(ahead[k]);
+        break;
+      }
+    }
+}
+
+void FancyText::renderContent() {
+    // drawing into a texture now would split the frame's scene
+    PageTexture* page = findPage(topLine);
+    if (page == nullptr) {
+      drawLines(topLine);
+      return;
+    }
+    Screen::drawTextureScale(page->texture, 0, 0, 1.0f, 1.0f);
 
     //bool txtJustify; ??
 
@@ -556,13 +581,16 @@ void FancyText::renderContent() {
 }
 
 int FancyText::setLine(int l) {
+    // moving on drops a place still waiting for the index
+    pendingLine = -1;
     int oldP = getCurrentPage();
     int oldTL = topLine;
     topLine = l;
-    if (topLine >= nLines)
-      topLine = nLines - 1;
+    if (topLine >= lineCount())
+      topLine = lineCount() - 1;
     if (topLine < 0)
       topLine = 0;
+    ensureWindow();
     int cp = getCurrentPage();
     if (cp != oldP) {
       char t[256];
@@ -572,27 +600,12 @@ int FancyText::setLine(int l) {
     return oldTL != topLine ? BK_CMD_MARK_DIRTY : 0;
 }
 
-int FancyText::runForLine(int l) {
-    if (l >= nLines || l < 0)
-      return 0;
-    return lines[l].firstRun;
-}
-
-int FancyText::lineForRun(int r) {
-    int l = 0;
-    for (; l < nLines; l++) {
-      if (lines[l].firstRun >= r)
-        break;
-    }
-    return l;
-}
-
 bool FancyText::isPaginated() {
     return true;
 }
 
 int FancyText::getTotalPages() {
-    return totalPages;
+    return std::max(1, (lineCount() + linesPerPage - 1) / linesPerPage);
 }
 
 int FancyText::getCurrentPage() {
@@ -602,8 +615,8 @@ int FancyText::getCurrentPage() {
 int FancyText::setCurrentPage(int p) {
     if (p <= 0)
       p = 1;
-    if (p > totalPages)
-      p = totalPages;
+    if (p > getTotalPages())
+      p = getTotalPages();
     --p;
     return setLine(p * linesPerPage);
 }
@@ -623,14 +636,10 @@ int FancyText::pan(int x, int y) {
 }
 
 int FancyText::screenUp() {
-    if (pageNumber > 0)
-      pageNumber--;
     return setCurrentPage(getCurrentPage() - 1);
 }
 
 int FancyText::screenDown() {
-    if (pageNumber < maxPageNumber)
-      pageNumber++;
     return setCurrentPage(getCurrentPage() + 1);
 }
 
@@ -654,17 +663,21 @@ int FancyText::setRotation(int r, bool bForce) {
     if (r == rotation && !bForce)
       return 0;
     rotation = r;
-    int run = runForLine(topLine);
     if (rotation < 0)
       rotation = 3;
     if (rotation >= 4)
       rotation = 0;
+    // resizeView keeps the place, and a view seen before keeps its layout;
+    // the sizes must match create's so rotating back finds it
+    #ifdef PSP
+      const int w = 480, h = 272;
+    #else
+      const int w = 960, h = 544;
+    #endif
     if (rotation == 0 || rotation == 2) {
-      resizeView(480, 272);
-      setLine(lineForRun(run));
+      resizeView(w, h);
     } else {
-      resizeView(272, 480);
-      setLine(lineForRun(run));
+      resizeView(h, w);
     }
     return BK_CMD_MARK_DIRTY;
 }
@@ -674,14 +687,19 @@ bool FancyText::isBookmarkable() {
 }
 
 void FancyText::getBookmarkPosition(map<string, float>& m) {
-    m["topLineFirstRun"] = runForLine(topLine);
+    int line, offset;
+    topPlace(line, offset);
+    // a run is a source line, the key predates streaming
+    m["topLineFirstRun"] = line;
+    m["topLineOffset"] = offset;
     m["zoom"] = 0;
     m["rotation"] = rotation;
 }
 
 int FancyText::setBookmarkPosition(map<string, float>& m) {
     setRotation(m["rotation"]);
-    setLine(lineForRun(m["topLineFirstRun"]));
+    // bookmarks without topLineOffset start at the top of the line
+    setPlace((int)m["topLineFirstRun"], (int)m["topLineOffset"]);
     return BK_CMD_MARK_DIRTY;
 }
 
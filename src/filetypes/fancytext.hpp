@@ -13,11 +13,14 @@
 #ifndef BKFANCYTEXT_H
 #define BKFANCYTEXT_H
 
+#include <list>
 #include <string>
 #include <vector>
 
 #include "../graphics/screen.hpp"
 #include "../document.hpp"
+#include "textsource.hpp"
+#include "textindex.hpp"
 
 using std::string;
 
@@ -25,24 +28,13 @@ using std::string;
 #define BKFT_CONT_LF			1
 #define BKFT_CONT_EXTRALF		2
 
-#define BKFT_STYLE_PLAIN		0
-#define BKFT_STYLE_BOLD			1
-//#define BKFT_STYLE_ITALIC		2
-//#define BKFT_STYLE_BOLD_ITALIC	3
-
-#define BKFT_FONT_SANS			0
-//#define BKFT_FONT_FIXED			1
-
 namespace bookr {
 
 struct Run {
   char* text;
   bool lineBreak;
   int n;
-  int style;
-  int font;
-  int bgcolor;
-  int fgcolor;
+  int breaks;   // first word of its break bits in FancyText::breakBits
 };
 
 struct Line {
@@ -50,14 +42,16 @@ struct Line {
   int firstRunOffset;
   int totalChars;
   float spaceWidth;
-  Line(int fr, int fro, int tc, float sw) : firstRun(fr), firstRunOffset(fro), totalChars(tc), spaceWidth(sw) { }
+  bool hyphen;
+  Line(int fr, int fro, int tc, float sw, bool h) : firstRun(fr), firstRunOffset(fro), totalChars(tc), spaceWidth(sw),
+    hyphen(h) { }
   Line() { }
 };
 
 class FancyText : public Document {
   private:
-  Line* lines;
-  int nLines;
+  // display lines of the window; topLine counts display lines
+  std::vector<Line> lines;
   int topLine;
   int maxY;
   Font* font;
@@ -66,37 +60,96 @@ class FancyText : public Document {
   string lastFontFace;
   int	lastHeightPct;
   int lastWrapCR;
+  int lastEncoding;
+  bool lastHyphenate;
 
   int linesPerPage;
-  int totalPages;
-  void reflow(int width);
+  int viewWidth;
+  void layoutRuns(int firstRun, int wantLines);
+  // linesPerPage for a view height at the current text size
+  void fitLines(int height);
+
+  // bytes of the lines around the current page; runs point in here
+  char* window;
+  int windowCapacity;
+  int windowFirstLine;
+  int windowFirstDisplay;
+  // bookmarked place the index has not reached yet
+  int pendingLine;
+  int pendingOffset;
+
+  // a layout per view, most recent first; index is the front one
+  std::list<TextLineIndex*> layouts;
+  // where the last switch put the page, so going back and forth without
+  // reading on doesn't creep back a line each time
+  int placeTop;
+  int placeLine;
+  int placeOffset;
+  void selectLayout();
+  string layoutCachePath(const TextLayoutKey& key);
+
+  void loadWindow(int firstDisplay);
+  void ensureWindow();
+  int lineCount();
+  int displayLineAt(int line, int offset);
+  void topPlace(int& line, int& offset);
+  int setPlace(int line, int offset);
+
+  // a page drawn into a texture once, so each frame draws it as one quad
+  struct PageTexture {
+    Texture* texture;
+    int top;            // first display line; -1 when empty
+    int layout;         // layoutSerial it was drawn with
+    int nLines;         // lines it had; the last page grows while indexing
+    bool justify;
+    unsigned int background;
+  };
+  std::vector<PageTexture> pages;
+  // bumped whenever the display lines change meaning
+  int layoutSerial;
+  bool pageLoaded(int top);
+  int pageLines(int top);
+  void drawLines(int top);
+  PageTexture* findPage(int top);
+  PageTexture* pageTexture(int top);
+  void dropPages();
 
   protected:
   Run* runs;
   int nRuns;
+  int runsCapacity;
+  // where lines may break in each run, found as the runs are parsed
+  std::vector<uint32_t> breakBits;
+  Run* addRun();
+  void findBreaks(Run* run);
+  void addLine(char* b, int64_t base, int64_t start, int64_t end);
   FancyText();
   ~FancyText();
 
+  // streamed text: the document reads the lines around the current page
+  // from source and an index built in the background finds them
+  TextSource* source;
+  TextLineIndex* index;
+  // every newline of the source breaks, whatever txtWrapCR says; for
+  // text converted from markup
+  bool hardLines;
+  void openSource(TextSource* s);
+  int wrapCR();
+
   void resizeView(int widht, int height);
   void resetFonts();
   int setLine(int l);
-  int runForLine(int l);
-  int lineForRun(int r);
 
   bool holdScroll;
 
-  // a lot of ebook formats use HTML as a display format, on top of a
-  // container format. so it makes sense to put the parser/tokenizer in
-  // the base class
-  static char* parseHTML(FancyText* r, char* in, int n);
-
-  // same with plain text
-  static char* parseText(FancyText* r, char* b, int length);
+  // b holds the text at offset, starting with line firstLine
+  void parseLines(char* b, int length, int64_t offset, int firstLine, int maxLines, bool atEnd);
 
   public:
   virtual int updateContent();
   virtual int resume();
   virtual void renderContent();
+  virtual void prepare();
 
   virtual void getFileName(string&) = 0;
   virtual void getTitle(string&) = 0;
@@ -0,0 +1,659 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TEXT_SCAN_NEON
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#define TEXT_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "htmltext.hpp"
+#include "blockcache.hpp"
+
+namespace bookr {
+
+// The tags that do something. Anything else is dropped, its text kept.
+enum {
+  TAG_UNKNOWN,
+  TAG_HEAD, TAG_SCRIPT, TAG_STYLE, TAG_TITLE,
+  TAG_P, TAG_DIV, TAG_H1, TAG_H2, TAG_H3, TAG_H4, TAG_H5, TAG_H6, TAG_LI, TAG_DT, TAG_DD, TAG_DL,
+  TAG_UL, TAG_OL, TAG_TR, TAG_TABLE, TAG_BLOCKQUOTE, TAG_HR, TAG_PRE, TAG_CENTER, TAG_SECTION,
+  TAG_BODY, TAG_TD, TAG_TH,
+  TAG_BR, TAG_PAGEBREAK
+};
+
+static const char* tagNames[] = {
+  "",
+  "head", "script", "style", "title",
+  "p", "div", "h1", "h2", "h3", "h4", "h5", "h6", "li", "dt", "dd", "dl",
+  "ul", "ol", "tr", "table", "blockquote", "hr", "pre", "center", "section",
+  "body", "td", "th",
+  "br", "mbp:pagebreak"
+};
+
+#define TAG_COUNT ((int)(sizeof(tagNames) / sizeof(tagNames[0])))
+
+// First two letters and length, times a constant found by search that
+// sends every tag above to its own slot of 64.
+#define TAG_HASH_MULTIPLIER 0x2659d491u
+#define TAG_HASH_BITS 6
+
+static inline int tagHash(const char* name, int n) {
+  uint32_t key = ((uint32_t)(unsigned char)name[0] << 16) | ((n > 1 ? (unsigned char)name[1] : 0) << 8) | n;
+  return (int)((key * TAG_HASH_MULTIPLIER) >> (32 - TAG_HASH_BITS));
+}
+
+static int tagSlots[1 << TAG_HASH_BITS];
+
+static bool fillTagSlots() {
+  for (int t = 1; t < TAG_COUNT; ++t) {
+    int h = tagHash(tagNames[t], strlen(tagNames[t]));
+    #ifdef DEBUG
+      if (tagSlots[h] != 0)
+        printf("HtmlTokenizer: %s and %s share a hash slot\n", tagNames[t], tagNames[tagSlots[h]]);
+    #endif
+    tagSlots[h] = t;
+  }
+  return true;
+}
+
+static int tagId(const char* name, int n) {
+  static bool filled = fillTagSlots();
+  (void)filled;
+  if (n == 0)
+    return TAG_UNKNOWN;
+  int t = tagSlots[tagHash(name, n)];
+  return t != TAG_UNKNOWN && strcmp(tagNames[t], name) == 0 ? t : TAG_UNKNOWN;
+}
+
+// The entities of HTML 4, sorted by name.
+struct Entity {
+  const char* name;
+  uint32_t c;
+};
+
+static const Entity entities[] = {
+  { "AElig", 0x00c6 }, { "Aacute", 0x00c1 }, { "Acirc", 0x00c2 }, { "Agrave", 0x00c0 },
+  { "Alpha", 0x0391 }, { "Aring", 0x00c5 }, { "Atilde", 0x00c3 }, { "Auml", 0x00c4 },
+  { "Beta", 0x0392 }, { "Ccedil", 0x00c7 }, { "Chi", 0x03a7 }, { "Dagger", 0x2021 },
+  { "Delta", 0x0394 }, { "ETH", 0x00d0 }, { "Eacute", 0x00c9 }, { "Ecirc", 0x00ca },
+  { "Egrave", 0x00c8 }, { "Epsilon", 0x0395 }, { "Eta", 0x0397 }, { "Euml", 0x00cb },
+  { "Gamma", 0x0393 }, { "Iacute", 0x00cd }, { "Icirc", 0x00ce }, { "Igrave", 0x00cc },
+  { "Iota", 0x0399 }, { "Iuml", 0x00cf }, { "Kappa", 0x039a }, { "Lambda", 0x039b },
+  { "Mu", 0x039c }, { "Ntilde", 0x00d1 }, { "Nu", 0x039d }, { "OElig", 0x0152 },
+  { "Oacute", 0x00d3 }, { "Ocirc", 0x00d4 }, { "Ograve", 0x00d2 }, { "Omega", 0x03a9 },
+  { "Omicron", 0x039f }, { "Oslash", 0x00d8 }, { "Otilde", 0x00d5 }, { "Ouml", 0x00d6 },
+  { "Phi", 0x03a6 }, { "Pi", 0x03a0 }, { "Prime", 0x2033 }, { "Psi", 0x03a8 }, { "Rho", 0x03a1 },
+  { "Scaron", 0x0160 }, { "Sigma", 0x03a3 }, { "THORN", 0x00de }, { "Tau", 0x03a4 },
+  { "Theta", 0x0398 }, { "Uacute", 0x00da }, { "Ucirc", 0x00db }, { "Ugrave", 0x00d9 },
+  { "Upsilon", 0x03a5 }, { "Uuml", 0x00dc }, { "Xi", 0x039e }, { "Yacute", 0x00dd },
+  { "Yuml", 0x0178 }, { "Zeta", 0x0396 }, { "aacute", 0x00e1 }, { "acirc", 0x00e2 },
+  { "acute", 0x00b4 }, { "aelig", 0x00e6 }, { "agrave", 0x00e0 }, { "alefsym", 0x2135 },
+  { "alpha", 0x03b1 }, { "amp", 0x0026 }, { "and", 0x2227 }, { "ang", 0x2220 },
+  { "aring", 0x00e5 }, { "asymp", 0x2248 }, { "atilde", 0x00e3 }, { "auml", 0x00e4 },
+  { "bdquo", 0x201e }, { "beta", 0x03b2 }, { "brvbar", 0x00a6 }, { "bull", 0x2022 },
+  { "cap", 0x2229 }, { "ccedil", 0x00e7 }, { "cedil", 0x00b8 }, { "cent", 0x00a2 },
+  { "chi", 0x03c7 }, { "circ", 0x02c6 }, { "clubs", 0x2663 }, { "cong", 0x2245 },
+  { "copy", 0x00a9 }, { "crarr", 0x21b5 }, { "cup", 0x222a }, { "curren", 0x00a4 },
+  { "dArr", 0x21d3 }, { "dagger", 0x2020 }, { "darr", 0x2193 }, { "deg", 0x00b0 },
+  { "delta", 0x03b4 }, { "diams", 0x2666 }, { "divide", 0x00f7 }, { "eacute", 0x00e9 },
+  { "ecirc", 0x00ea }, { "egrave", 0x00e8 }, { "empty", 0x2205 }, { "emsp", 0x2003 },
+  { "ensp", 0x2002 }, { "epsilon", 0x03b5 }, { "equiv", 0x2261 }, { "eta", 0x03b7 },
+  { "eth", 0x00f0 }, { "euml", 0x00eb }, { "euro", 0x20ac }, { "exist", 0x2203 },
+  { "fnof", 0x0192 }, { "forall", 0x2200 }, { "frac12", 0x00bd }, { "frac14", 0x00bc },
+  { "frac34", 0x00be }, { "frasl", 0x2044 }, { "gamma", 0x03b3 }, { "ge", 0x2265 },
+  { "gt", 0x003e }, { "hArr", 0x21d4 }, { "harr", 0x2194 }, { "hearts", 0x2665 },
+  { "hellip", 0x2026 }, { "iacute", 0x00ed }, { "icirc", 0x00ee }, { "iexcl", 0x00a1 },
+  { "igrave", 0x00ec }, { "image", 0x2111 }, { "infin", 0x221e }, { "int", 0x222b },
+  { "iota", 0x03b9 }, { "iquest", 0x00bf }, { "isin", 0x2208 }, { "iuml", 0x00ef },
+  { "kappa", 0x03ba }, { "lArr", 0x21d0 }, { "lambda", 0x03bb }, { "lang", 0x2329 },
+  { "laquo", 0x00ab }, { "larr", 0x2190 }, { "lceil", 0x2308 }, { "ldquo", 0x201c },
+  { "le", 0x2264 }, { "lfloor", 0x230a }, { "lowast", 0x2217 }, { "loz", 0x25ca },
+  { "lrm", 0x200e }, { "lsaquo", 0x2039 }, { "lsquo", 0x2018 }, { "lt", 0x003c },
+  { "macr", 0x00af }, { "mdash", 0x2014 }, { "micro", 0x00b5 }, { "middot", 0x00b7 },
+  { "minus", 0x2212 }, { "mu", 0x03bc }, { "nabla", 0x2207 }, { "nbsp", 0x00a0 },
+  { "ndash", 0x2013 }, { "ne", 0x2260 }, { "ni", 0x220b }, { "not", 0x00ac }, { "notin", 0x2209 },
+  { "nsub", 0x2284 }, { "ntilde", 0x00f1 }, { "nu", 0x03bd }, { "oacute", 0x00f3 },
+  { "ocirc", 0x00f4 }, { "oelig", 0x0153 }, { "ograve", 0x00f2 }, { "oline", 0x203e },
+  { "omega", 0x03c9 }, { "omicron", 0x03bf }, { "oplus", 0x2295 }, { "or", 0x2228 },
+  { "ordf", 0x00aa }, { "ordm", 0x00ba }, { "oslash", 0x00f8 }, { "otilde", 0x00f5 },
+  { "otimes", 0x2297 }, { "ouml", 0x00f6 }, { "para", 0x00b6 }, { "part", 0x2202 },
+  { "permil", 0x2030 }, { "perp", 0x22a5 }, { "phi", 0x03c6 }, { "pi", 0x03c0 }, { "piv", 0x03d6 },
+  { "plusmn", 0x00b1 }, { "pound", 0x00a3 }, { "prime", 0x2032 }, { "prod", 0x220f },
+  { "prop", 0x221d }, { "psi", 0x03c8 }, { "quot", 0x0022 }, { "rArr", 0x21d2 },
+  { "radic", 0x221a }, { "rang", 0x232a }, { "raquo", 0x00bb }, { "rarr", 0x2192 },
+  { "rceil", 0x2309 }, { "rdquo", 0x201d }, { "real", 0x211c }, { "reg", 0x00ae },
+  { "rfloor", 0x230b }, { "rho", 0x03c1 }, { "rlm", 0x200f }, { "rsaquo", 0x203a },
+  { "rsquo", 0x2019 }, { "sbquo", 0x201a }, { "scaron", 0x0161 }, { "sdot", 0x22c5 },
+  { "sect", 0x00a7 }, { "shy", 0x00ad }, { "sigma", 0x03c3 }, { "sigmaf", 0x03c2 },
+  { "sim", 0x223c }, { "spades", 0x2660 }, { "sub", 0x2282 }, { "sube", 0x2286 },
+  { "sum", 0x2211 }, { "sup", 0x2283 }, { "sup1", 0x00b9 }, { "sup2", 0x00b2 }, { "sup3", 0x00b3 },
+  { "supe", 0x2287 }, { "szlig", 0x00df }, { "tau", 0x03c4 }, { "there4", 0x2234 },
+  { "theta", 0x03b8 }, { "thetasym", 0x03d1 }, { "thinsp", 0x2009 }, { "thorn", 0x00fe },
+  { "tilde", 0x02dc }, { "times", 0x00d7 }, { "trade", 0x2122 }, { "uArr", 0x21d1 },
+  { "uacute", 0x00fa }, { "uarr", 0x2191 }, { "ucirc", 0x00fb }, { "ugrave", 0x00f9 },
+  { "uml", 0x00a8 }, { "upsih", 0x03d2 }, { "upsilon", 0x03c5 }, { "uuml", 0x00fc },
+  { "weierp", 0x2118 }, { "xi", 0x03be }, { "yacute", 0x00fd }, { "yen", 0x00a5 },
+  { "yuml", 0x00ff }, { "zeta", 0x03b6 }, { "zwj", 0x200d }, { "zwnj", 0x200c },
+};
+
+static uint32_t namedEntity(const char* name) {
+  int lo = 0;
+  int hi = (int)(sizeof(entities) / sizeof(entities[0])) - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    int c = strcmp(entities[mid].name, name);
+    if (c == 0)
+      return entities[mid].c;
+    if (c < 0)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+  return 0;
+}
+
+enum {
+  STATE_TEXT,
+  STATE_TAG_START,    // just after '<'
+  STATE_TAG_NAME,
+  STATE_DECLARATION,  // after "<!", a comment if "--" follows
+  STATE_ATTRIBUTES,
+  STATE_QUOTED,
+  STATE_COMMENT,
+  STATE_ENTITY
+};
+
+static inline bool isSpace(unsigned char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static inline bool isNameChar(unsigned char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == ':' || c == '-';
+}
+
+// Length of the text at p that can be copied as it is: up to the next
+// '<', '&' or control character, or the second of two spaces.
+static inline int textSpan(const unsigned char* p, int n) {
+  int i = 0;
+  #if defined(TEXT_SCAN_SSE2)
+    const __m128i lt = _mm_set1_epi8('<');
+    const __m128i amp = _mm_set1_epi8('&');
+    const __m128i control = _mm_set1_epi8(0x1f);
+    const __m128i space = _mm_set1_epi8(' ');
+    int previous = 0;
+    for (; i + 16 <= n; i += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+      __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, amp)),
+        _mm_cmpeq_epi8(_mm_max_epu8(v, control), control));
+      int spaces = _mm_movemask_epi8(_mm_cmpeq_epi8(v, space));
+      int stop = _mm_movemask_epi8(special) | (spaces & ((spaces << 1) | previous) & 0xffff);
+      if (stop != 0)
+        return i + __builtin_ctz(stop);
+      previous = spaces >> 15;
+    }
+  #elif defined(TEXT_SCAN_NEON)
+    const uint8x16_t lt = vdupq_n_u8('<');
+    const uint8x16_t amp = vdupq_n_u8('&');
+    const uint8x16_t control = vdupq_n_u8(0x1f);
+    const uint8x16_t space = vdupq_n_u8(' ');
+    for (; i + 16 <= n; i += 16) {
+      uint8x16_t v = vld1q_u8(p + i);
+      uint8x16_t spaces = vceqq_u8(v, space);
+      // a space next to a space, within the sixteen bytes or across
+      uint8x16_t pairs = vandq_u8(spaces, vextq_u8(vdupq_n_u8(i > 0 && p[i - 1] == ' ' ? 0xff : 0), spaces, 15));
+      uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(v, lt), vceqq_u8(v, amp)), vorrq_u8(vcleq_u8(v, control), pairs));
+      uint64x2_t any = vreinterpretq_u64_u8(special);
+      if ((vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1)) != 0)
+        break;    // the loop below finds the byte
+    }
+  #endif
+  for (; i < n; ++i) {
+    unsigned char c = p[i];
+    if (c == '<' || c == '&' || c <= 0x1f || (c == ' ' && i > 0 && p[i - 1] == ' '))
+      return i;
+  }
+  return n;
+}
+
+HtmlTokenizer::HtmlTokenizer() : state(STATE_TEXT), skipping(0), closing(false), lastBlank(true), quote(0), dashes(0),
+  name(), nameLength(0), attributes(), attributesLength(0), entity(), entityLength(0), pendingBreaks(0), written(0),
+  lineStart(0), out(nullptr) {
+}
+
+void HtmlTokenizer::put(const char* p, int n) {
+  // breaks go out with the text after them, so the last ones are dropped
+  for (; pendingBreaks > 0; --pendingBreaks) {
+    *out++ = '\n';
+    ++written;
+  }
+  memcpy(out, p, n);
+  out += n;
+  written += n;
+  lastBlank = p[n - 1] == ' ';
+}
+
+void HtmlTokenizer::putCodePoint(uint32_t c) {
+  char s[4];
+  int n;
+  if (c < 0x80) {
+    s[0] = c;
+    n = 1;
+  } else if (c < 0x800) {
+    s[0] = 0xc0 | (c >> 6);
+    s[1] = 0x80 | (c & 0x3f);
+    n = 2;
+  } else if (c < 0x10000) {
+    s[0] = 0xe0 | (c >> 12);
+    s[1] = 0x80 | ((c >> 6) & 0x3f);
+    s[2] = 0x80 | (c & 0x3f);
+    n = 3;
+  } else {
+    s[0] = 0xf0 | (c >> 18);
+    s[1] = 0x80 | ((c >> 12) & 0x3f);
+    s[2] = 0x80 | ((c >> 6) & 0x3f);
+    s[3] = 0x80 | (c & 0x3f);
+    n = 4;
+  }
+  put(s, n);
+}
+
+// runs of blanks read as one space
+void HtmlTokenizer::blank() {
+  if (!lastBlank && skipping == 0)
+    put(" ", 1);
+}
+
+// Block tags next to each other only break once; <br> always does,
+// except before any text.
+void HtmlTokenizer::lineBreak(bool forced) {
+  if (written > lineStart || (forced && written > 0)) {
+    lineStart = written;
+    pendingBreaks = std::min(pendingBreaks + 1, HTML_BREAKS_MAX);
+  }
+  lastBlank = true;
+}
+
+void HtmlTokenizer::endTag() {
+  state = STATE_TEXT;
+  name[nameLength] = 0;
+  int tag = tagId(name, nameLength);
+  if (skipping != 0) {
+    if (closing && tag == skipping)
+      skipping = 0;
+    return;
+  }
+  bool selfClosing = attributesLength > 0 && attributes[attributesLength - 1] == '/';
+  switch (tag) {
+    case TAG_HEAD: case TAG_SCRIPT: case TAG_STYLE: case TAG_TITLE:
+      if (!closing && !selfClosing)
+        skipping = tag;
+      break;
+    case TAG_BR: case TAG_PAGEBREAK:
+      if (!closing)
+        lineBreak(true);
+      break;
+    case TAG_LI:
+      lineBreak(false);
+      if (!closing)
+        put("* ", 2);
+      break;
+    case TAG_TD: case TAG_TH:
+      blank();
+      break;
+    case TAG_UNKNOWN:
+      break;
+    default:
+      // every other tag in the table is a block
+      lineBreak(false);
+      break;
+  }
+}
+
+// name is what followed the '&'; unknown entities stay as they were
+void HtmlTokenizer::endEntity(bool terminated) {
+  state = STATE_TEXT;
+  entity[entityLength] = 0;
+  uint32_t c = 0;
+  if (terminated && entityLength > 1 && entity[0] == '#') {
+    bool hex = entity[1] == 'x' || entity[1] == 'X';
+    char* end;
+    unsigned long v = strtoul(entity + (hex ? 2 : 1), &end, hex ? 16 : 10);
+    if (*end == 0 && end != entity + (hex ? 2 : 1) && v > 0 && v < 0x110000 && (v < 0xd800 || v > 0xdfff))
+      c = (uint32_t)v;
+  } else if (terminated && entityLength > 0) {
+    c = namedEntity(entity);
+  }
+  if (skipping != 0)
+    return;
+  if (c != 0) {
+    putCodePoint(c);
+    return;
+  }
+  put("&", 1);
+  if (entityLength > 0)
+    put(entity, entityLength);
+  if (terminated)
+    put(";", 1);
+}
+
+int HtmlTokenizer::feed(const char* in, int n, char* o) {
+  const unsigned char* p = (const unsigned char*)in;
+  out = o;
+  int i = 0;
+  while (i < n) {
+    unsigned char c = p[i];
+    switch (state) {
+      case STATE_TEXT: {
+        if (skipping != 0) {
+          const void* lt = memchr(p + i, '<', n - i);
+          if (lt == nullptr)
+            return (int)(out - o);
+          i = (int)((const unsigned char*)lt - p) + 1;
+          state = STATE_TAG_START;
+          continue;
+        }
+        if (lastBlank && c == ' ') {
+          while (i < n && p[i] == ' ')
+            ++i;
+          continue;
+        }
+        int m = textSpan(p + i, n - i);
+        if (m > 0) {
+          put(in + i, m);
+          i += m;
+          continue;
+        }
+        ++i;
+        if (c == '<') {
+          state = STATE_TAG_START;
+        } else if (c == '&') {
+          state = STATE_ENTITY;
+          entityLength = 0;
+        } else if (isSpace(c)) {
+          blank();
+        }
+        // other control characters are dropped
+        break;
+      }
+      case STATE_TAG_START:
+        closing = false;
+        nameLength = 0;
+        attributesLength = 0;
+        if (skipping != 0 && c != '/') {
+          // only the end tag matters in a script, whatever else it has
+          state = STATE_TEXT;
+        } else if (c == '/') {
+          closing = true;
+          state = STATE_TAG_NAME;
+          ++i;
+        } else if (c == '!') {
+          state = STATE_DECLARATION;
+          dashes = 0;
+          ++i;
+        } else if (c == '?') {
+          state = STATE_ATTRIBUTES;
+          ++i;
+        } else if (isNameChar(c) && !(c >= '0' && c <= '9')) {
+          state = STATE_TAG_NAME;
+        } else {
+          // "a < b": not a tag after all
+          state = STATE_TEXT;
+          if (skipping == 0)
+            put("<", 1);
+        }
+        break;
+      case STATE_TAG_NAME:
+        if (isNameChar(c)) {
+          if (nameLength < HTML_TAG_NAME_MAX)
+            name[nameLength++] = c | (c >= 'A' && c <= 'Z' ? 0x20 : 0);
+          else
+            nameLength = HTML_TAG_NAME_MAX + 1;   // too long for any known tag
+          ++i;
+        } else {
+          if (nameLength > HTML_TAG_NAME_MAX)
+            nameLength = 0;
+          state = STATE_ATTRIBUTES;
+        }
+        break;
+      case STATE_DECLARATION:
+        if (c == '-' && dashes < 2) {
+          if (++dashes == 2)
+            state = STATE_COMMENT;
+          ++i;
+        } else {
+          state = STATE_ATTRIBUTES;    // <!DOCTYPE ...>
+        }
+        break;
+      case STATE_ATTRIBUTES: {
+        // up to the '>', minding quoted values
+        int j = i;
+        while (j < n && p[j] != '>' && p[j] != '"' && p[j] != '\'')
+          ++j;
+        int keep = std::min(j - i, HTML_ATTRIBUTES_MAX - attributesLength);
+        memcpy(attributes + attributesLength, in + i, keep);
+        attributesLength += keep;
+        while (attributesLength > 0 && isSpace(attributes[attributesLength - 1]))
+          --attributesLength;
+        if (j == n)
+          return (int)(out - o);
+        if (p[j] == '>') {
+          i = j + 1;
+          endTag();
+        } else {
+          quote = p[j];
+          if (attributesLength < HTML_ATTRIBUTES_MAX)
+            attributes[attributesLength++] = quote;
+          state = STATE_QUOTED;
+          i = j + 1;
+        }
+        break;
+      }
+      case STATE_QUOTED: {
+        const void* q = memchr(p + i, quote, n - i);
+        int j = q != nullptr ? (int)((const unsigned char*)q - p) + 1 : n;
+        int keep = std::min(j - i, HTML_ATTRIBUTES_MAX - attributesLength);
+        memcpy(attributes + attributesLength, in + i, keep);
+        attributesLength += keep;
+        if (q != nullptr)
+          state = STATE_ATTRIBUTES;
+        i = j;
+        break;
+      }
+      case STATE_COMMENT:
+        ++i;
+        if (c == '>' && dashes >= 2)
+          state = STATE_TEXT;
+        else
+          dashes = c == '-' ? dashes + 1 : 0;
+        break;
+      case STATE_ENTITY:
+        if (c == ';') {
+          ++i;
+          endEntity(true);
+        } else if ((isNameChar(c) || c == '#') && c != ':' && c != '-' && entityLength < (int)sizeof(entity) - 1) {
+          entity[entityLength++] = c;
+          ++i;
+        } else {
+          endEntity(false);
+        }
+        break;
+    }
+  }
+  return (int)(out - o);
+}
+
+int HtmlTokenizer::finish(char* o) {
+  out = o;
+  if (state == STATE_ENTITY)
+    endEntity(false);
+  return (int)(out - o);
+}
+
+
+#define HT_BLOCK (64 * 1024)
+#define HT_CACHE_BLOCKS 4
+
+/*! \brief The text of an HTML source, one line per line break.
+ *
+ *  Works like TextEncoding::transcode: the HTML is converted in blocks of
+ *  HT_BLOCK bytes, front to back, keeping where each block starts in both
+ *  texts. The tokenizer carries state from one block to the next, so a
+ *  copy of it is kept for every block too; converting a block again
+ *  starts from that copy.
+ */
+class HtmlTextSource : public TextSource {
+  struct Span {
+    int64_t in;
+    int64_t out;
+  };
+
+  TextSource* html;
+  std::mutex mutex;
+  // starts of the blocks converted so far, plus the next one until
+  // complete, and the tokenizer at each
+  std::vector<Span> spans;
+  std::vector<HtmlTokenizer> states;
+  bool complete;
+  std::atomic<bool> known;
+  int64_t length;
+  char* input;
+  // converted blocks, keyed by block number
+  BlockCache cache;
+
+  BlockCache::Block* convertBlock(int k) {
+    BlockCache::Block* c = cache.find(k);
+    if (c != nullptr)
+      return c;
+    c = cache.victim();
+    int r = html->read(spans[k].in, input, HT_BLOCK);
+    if (r < 0)
+      return nullptr;
+    bool atEnd = r < HT_BLOCK;
+    HtmlTokenizer tokenizer = states[k];
+    int len = tokenizer.feed(input, r, c->data);
+    if (atEnd)
+      len += tokenizer.finish(c->data + len);
+    cache.store(c, k, len);
+    if (k + 1 == (int)spans.size() && !complete) {
+      if (atEnd) {
+        length = spans[k].out + len;
+        complete = true;
+        known = true;
+      } else {
+        Span next = { spans[k].in + r, spans[k].out + len };
+        spans.push_back(next);
+        states.push_back(tokenizer);
+      }
+    }
+    return c;
+  }
+
+public:
+  HtmlTextSource(TextSource* h) : html(h), complete(false), known(false), length(0) {
+    Span first = { 0, 0 };
+    spans.push_back(first);
+    states.push_back(HtmlTokenizer());
+    input = (char*)malloc(HT_BLOCK);
+    // feed and finish can each write HTML_TOKEN_SLACK more than read,
+    // and breaks held over from the block before come first
+    cache.allocate(HT_CACHE_BLOCKS, HT_BLOCK + 2 * HTML_TOKEN_SLACK + HTML_BREAKS_MAX);
+  }
+
+  ~HtmlTextSource() {
+    free(input);
+    delete html;
+  }
+
+  bool ready() {
+    return input != nullptr && cache.ready();
+  }
+
+  virtual bool sizeKnown() {
+    return known;
+  }
+
+  // the HTML decides the text; what can differ between opens of the same
+  // file is how it is decoded
+  virtual TextSource* file() {
+    return html->file();
+  }
+
+  virtual std::vector<int64_t> state() {
+    return html->state();
+  }
+
+  virtual bool restore(const std::vector<int64_t>& saved) {
+    return html->restore(saved);
+  }
+
+  virtual int64_t size() {
+    for (;;) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (complete)
+        return length;
+      if (convertBlock((int)spans.size() - 1) == nullptr)
+        return spans.back().out;
+    }
+  }
+
+  virtual int read(int64_t offset, char* out, int n) {
+    if (offset < 0 || n <= 0)
+      return 0;
+    std::lock_guard<std::mutex> lock(mutex);
+    int done = 0;
+    while (done < n) {
+      int64_t pos = offset + done;
+      while (!complete && pos >= spans.back().out)
+        if (convertBlock((int)spans.size() - 1) == nullptr)
+          return done > 0 ? done : -1;
+      if (complete && pos >= length)
+        break;
+      // the last block starting at or before pos; blocks that gave no
+      // text start where the next one does
+      int k = (int)(std::upper_bound(spans.begin(), spans.end(), pos,
+        [](int64_t v, const Span& s) { return v < s.out; }) - spans.begin()) - 1;
+      BlockCache::Block* c = convertBlock(k);
+      if (c == nullptr)
+        return done > 0 ? done : -1;
+      int inBlock = (int)(pos - spans[k].out);
+      int avail = c->len - inBlock;
+      if (avail <= 0)
+        break;
+      int m = std::min(n - done, avail);
+      memcpy(out + done, c->data + inBlock, m);
+      done += m;
+    }
+    return done;
+  }
+};
+
+TextSource* HtmlText::lines(TextSource* html) {
+  HtmlTextSource* s = new HtmlTextSource(html);
+  if (!s->ready()) {
+    printf("HtmlText: cannot allocate conversion buffers\n");
+    delete s;
+    return NULL;
+  }
+  return s;
+}
+
+}
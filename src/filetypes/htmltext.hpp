@@ -0,0 +1,93 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKHTMLTEXT_H
+#define BKHTMLTEXT_H
+
+#include <cstdint>
+
+#include "textsource.hpp"
+
+// a call to HtmlTokenizer::feed writes at most this much more than it reads
+#define HTML_TOKEN_SLACK 64
+#define HTML_TAG_NAME_MAX 15
+#define HTML_ATTRIBUTES_MAX 256
+// line breaks in a row kept; more are a blank line too
+#define HTML_BREAKS_MAX 2
+
+namespace bookr {
+
+/*! \brief Turns HTML into plain UTF-8 text, a line per line break.
+ *
+ *  A state machine that can be fed any number of bytes at a time, so
+ *  containers can hand over their records as they decode them. Text is
+ *  copied a span at a time, vector compares finding the next '<', '&' or
+ *  blank to collapse. Tag names go through a perfect hash. Block tags
+ *  break lines, head, script and style are dropped, other tags are
+ *  ignored and entities are decoded.
+ */
+class HtmlTokenizer {
+  int state;
+  int skipping;       // tag whose contents are dropped, or 0
+  bool closing;
+  bool lastBlank;
+  char quote;
+  int dashes;
+  char name[HTML_TAG_NAME_MAX + 1];
+  int nameLength;
+  char attributes[HTML_ATTRIBUTES_MAX + 1];
+  int attributesLength;
+  char entity[12];
+  int entityLength;
+
+  int pendingBreaks;
+  int64_t written;    // bytes written since the tokenizer started
+  int64_t lineStart;  // written when the current line started
+
+  char* out;
+
+  void put(const char* p, int n);
+  void putCodePoint(uint32_t c);
+  void blank();
+  void lineBreak(bool forced);
+  void endTag();
+  void endEntity(bool terminated);
+
+public:
+  HtmlTokenizer();
+
+  /**
+   * Converts n bytes of HTML. Text goes to out, which needs room for
+   * n + HTML_TOKEN_SLACK bytes; line breaks are written as '\n', up to
+   * HTML_BREAKS_MAX in a row. Returns the bytes written.
+   */
+  int feed(const char* in, int n, char* out);
+
+  /**
+   * End of the document: writes what is still pending, at most
+   * HTML_TOKEN_SLACK bytes.
+   */
+  int finish(char* out);
+};
+
+namespace HtmlText {
+  /**
+   * Source reading the HTML in html as plain UTF-8 text, a line for each
+   * line break, for FancyText::openSource. Converts
+   * on demand like TextEncoding::transcode; takes html over.
+   */
+  TextSource* lines(TextSource* html);
+}
+
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TEXT_SCAN_NEON
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#define TEXT_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "linebreak.hpp"
+#include "textlayout.hpp"
+
+namespace bookr {
+
+// linebreakdata.cpp
+extern const uint8_t lineBreakIndex[];
+extern const uint8_t lineBreakBlocks[];
+extern const uint32_t lineBreakPairs[];
+extern const uint32_t hyphenNodes[];
+extern const uint16_t hyphenPatterns[];
+extern const uint8_t hyphenValues[];
+
+// UAX #14 classes as folded by the table generator: letters of every
+// script are AL, CJK ideographs, kana and hangul ID, and the mandatory
+// breaks are blanks here since lines were already split at them.
+enum {
+  LB_AL, LB_ID, LB_CM, LB_SP, LB_BA, LB_HY, LB_BB, LB_OP, LB_CL, LB_CP, LB_QU, LB_GL,
+  LB_NS, LB_EX, LB_SY, LB_IS, LB_PR, LB_PO, LB_NU, LB_IN, LB_ZW, LB_WJ, LB_RI
+};
+
+#define LB_BLOCK_SHIFT 6
+#define LB_LIMIT 0x40000
+
+static inline int classOf(uint32_t c) {
+  if (c >= LB_LIMIT)
+    return LB_AL;
+  return lineBreakBlocks[(lineBreakIndex[c >> LB_BLOCK_SHIFT] << LB_BLOCK_SHIFT) | (c & ((1 << LB_BLOCK_SHIFT) - 1))];
+}
+
+// letters, digits and blanks; nothing breaks between them
+static inline bool isQuiet(unsigned char b) {
+  return (unsigned)((b | 0x20) - 'a') < 26 || (unsigned)(b - '0') < 10 || b == ' ';
+}
+
+// Length of the run of quiet bytes at the start of p, sixteen at a time
+// where there is SIMD.
+static inline int quietSpan(const unsigned char* p, int n) {
+  int i = 0;
+  #if defined(TEXT_SCAN_SSE2)
+    // unsigned x < k as a signed compare of both sides flipped by 0x80
+    const __m128i flip = _mm_set1_epi8((char)0x80);
+    const __m128i lower = _mm_set1_epi8(0x20);
+    const __m128i a = _mm_set1_epi8('a');
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i letters = _mm_set1_epi8((char)(0x80 + 26));
+    const __m128i digits = _mm_set1_epi8((char)(0x80 + 10));
+    const __m128i blank = _mm_set1_epi8(' ');
+    for (; i + 16 <= n; i += 16) {
+      __m128i x = _mm_loadu_si128((const __m128i*)(p + i));
+      __m128i letter = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(_mm_or_si128(x, lower), a), flip), letters);
+      __m128i digit = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(x, zero), flip), digits);
+      __m128i quiet = _mm_or_si128(_mm_or_si128(letter, digit), _mm_cmpeq_epi8(x, blank));
+      int mask = _mm_movemask_epi8(quiet) ^ 0xffff;
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+  #elif defined(TEXT_SCAN_NEON)
+    const uint8x16_t lower = vdupq_n_u8(0x20);
+    const uint8x16_t a = vdupq_n_u8('a');
+    const uint8x16_t zero = vdupq_n_u8('0');
+    const uint8x16_t blank = vdupq_n_u8(' ');
+    for (; i + 16 <= n; i += 16) {
+      uint8x16_t x = vld1q_u8(p + i);
+      uint8x16_t quiet = vorrq_u8(vorrq_u8(vcltq_u8(vsubq_u8(vorrq_u8(x, lower), a), vdupq_n_u8(26)),
+        vcltq_u8(vsubq_u8(x, zero), vdupq_n_u8(10))), vceqq_u8(x, blank));
+      uint64x2_t all = vreinterpretq_u64_u8(vmvnq_u8(quiet));
+      if ((vgetq_lane_u64(all, 0) | vgetq_lane_u64(all, 1)) != 0)
+        break;    // the loop below finds the lane
+    }
+  #endif
+  for (; i < n; ++i)
+    if (!isQuiet(p[i]))
+      return i;
+  return n;
+}
+
+void LineBreaks::find(const char* text, int n, uint32_t* bits) {
+  const unsigned char* p = (const unsigned char*)text;
+  memset(bits, 0, LINE_BREAK_WORDS(n) * sizeof(uint32_t));
+  // class of the last character that wasn't a mark; nothing breaks right
+  // after a blank, wrap does that
+  int prev = LB_SP;
+  int i = 0;
+  while (i < n) {
+    unsigned char b = p[i];
+    int cls;
+    int len = 1;
+    if (b < 0x80) {
+      if ((prev == LB_AL || prev == LB_NU || prev == LB_SP) && isQuiet(b)) {
+        // the bulk of Latin text: no breaks inside words, and the ones
+        // after blanks are wrap's
+        int e = i + 1 + quietSpan(p + i + 1, n - i - 1);
+        prev = classOf(p[e - 1]);
+        i = e;
+        continue;
+      }
+      cls = classOf(b);
+    } else {
+      cls = classOf(TextLayout::decode(p + i, n - i, len));
+    }
+    if (cls == LB_SP) {
+      prev = LB_SP;
+    } else if (cls == LB_CM) {
+      // marks go with what they follow, or are letters after a blank
+      if (prev == LB_SP)
+        prev = LB_AL;
+    } else {
+      if (prev != LB_SP && (lineBreakPairs[prev] >> cls & 1))
+        bits[i >> 5] |= 1u << (i & 31);
+      prev = cls;
+    }
+    i += len;
+  }
+}
+
+int LineBreaks::lastBit(const uint32_t* bits, int from, int to) {
+  if (from >= to)
+    return -1;
+  for (int w = (to - 1) >> 5; w >= from >> 5; --w) {
+    uint32_t v = bits[w];
+    if (w == (to - 1) >> 5 && ((to - 1) & 31) != 31)
+      v &= (2u << ((to - 1) & 31)) - 1;
+    if (w == from >> 5)
+      v &= ~((1u << (from & 31)) - 1);
+    if (v != 0)
+      return (w << 5) + 31 - __builtin_clz(v);
+  }
+  return -1;
+}
+
+#define HYPHEN_MAX_WORD 31
+#define HYPHEN_BOUNDARY 27
+
+uint32_t LineBreaks::hyphenate(const char* text, int n) {
+  if (n < 5 || n > HYPHEN_MAX_WORD)
+    return 0;
+  // the word between boundary marks, letters as 1-26
+  unsigned char word[HYPHEN_MAX_WORD + 2];
+  word[0] = HYPHEN_BOUNDARY;
+  for (int k = 0; k < n; ++k) {
+    unsigned c = (unsigned)((text[k] | 0x20) - 'a');
+    if (c >= 26)
+      return 0;
+    word[k + 1] = c + 1;
+  }
+  word[n + 1] = HYPHEN_BOUNDARY;
+  int m = n + 2;
+
+  // every pattern that matches anywhere votes on the positions it covers
+  unsigned char values[HYPHEN_MAX_WORD + 3];
+  memset(values, 0, sizeof(values));
+  for (int s = 0; s < m; ++s) {
+    uint32_t node = hyphenNodes[0];
+    for (int j = s; j < m; ++j) {
+      int count = (node >> 5) & 31;
+      int first = node >> 10;
+      int k = 0;
+      // children are sorted by letter
+      while (k < count && (int)(hyphenNodes[first + k] & 31) < word[j])
+        ++k;
+      if (k == count || (int)(hyphenNodes[first + k] & 31) != word[j])
+        break;
+      node = hyphenNodes[first + k];
+      int pattern = hyphenPatterns[first + k];
+      if (pattern != 0) {
+        const uint8_t* v = hyphenValues + pattern;
+        for (int q = 0; q < v[1]; ++q)
+          values[s + v[0] + q] = std::max(values[s + v[0] + q], v[2 + q]);
+      }
+    }
+  }
+
+  // position k + 1 of the bounded word is before letter k
+  uint32_t points = 0;
+  for (int k = 2; k <= n - 3; ++k)
+    if (values[k + 1] & 1)
+      points |= 1u << k;
+  return points;
+}
+
+}
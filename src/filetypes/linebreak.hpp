@@ -0,0 +1,57 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKLINEBREAK_H
+#define BKLINEBREAK_H
+
+#include <cstdint>
+
+namespace bookr {
+
+// words of break bits for n bytes of text
+#define LINE_BREAK_WORDS(n) (((n) + 31) / 32)
+
+/*! \brief Where lines may break inside a run of text.
+ *
+ *  Break opportunities follow UAX #14, with its classes folded into a
+ *  few and the pair rules simplified: CJK breaks between ideographs but
+ *  not before closing punctuation or small kana, a hyphen lets the word
+ *  after it move down, digits stay with their signs. Blanks are left to
+ *  TextLayout::wrap, which breaks after them anyway.
+ *
+ *  Hyphenation uses Liang's algorithm with the TeX en-us patterns. It is
+ *  only asked for the one word that doesn't fit, so it costs nothing for
+ *  the lines that wrap at a blank.
+ */
+namespace LineBreaks {
+  /**
+   * Sets bit k of bits when a line may start at byte k of text, n bytes
+   * of UTF-8. bits holds LINE_BREAK_WORDS(n) words.
+   */
+  void find(const char* text, int n, uint32_t* bits);
+
+  /**
+   * Highest set bit in [from, to), or -1.
+   */
+  int lastBit(const uint32_t* bits, int from, int to);
+
+  /**
+   * Hyphenation points of the ASCII word of n letters at text, at least
+   * 2 letters from its start and 3 from its end. Bit k of the result
+   * allows a hyphen before letter k; words over 31 letters give none.
+   */
+  uint32_t hyphenate(const char* text, int n);
+}
+
+}
+
+#endif
@@ -0,0 +1,5331 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+// Generated by tools/gen_linebreakdata.py, do not edit. Line break classes
+// come from the Unicode 14 LineBreak.txt, folded into the classes
+// linebreak.cpp knows; the hyphenation patterns and exceptions are the
+// TeX en-us set (hyph-en-us.tex).
+
+#include <cstdint>
+
+namespace bookr {
+
+// class block of every 64 code points below U+40000
+extern const uint8_t lineBreakIndex[4096] = {
+  0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 5, 6, 3, 3,
+  3, 3, 7, 3, 3, 3, 8, 9, 10, 11, 3, 12, 13, 14, 15, 16,
+  17, 18, 19, 20, 21, 22, 23, 24, 23, 25, 23, 26, 23, 27, 28, 29,
+  30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 3, 40, 41, 42, 43, 44,
+  3, 45, 40, 3, 46, 46, 46, 46, 3, 3, 3, 3, 3, 47, 3, 3,
+  48, 3, 3, 3, 3, 3, 3, 3, 3, 3, 49, 50, 51, 52, 3, 53,
+  54, 3, 55, 3, 56, 57, 3, 40, 58, 59, 60, 61, 62, 63, 64, 65,
+  66, 67, 3, 68, 3, 3, 3, 5, 3, 3, 3, 3, 3, 3, 3, 69,
+  70, 71, 72, 73, 74, 3, 3, 3, 75, 3, 3, 76, 77, 3, 3, 78,
+  3, 3, 3, 3, 3, 3, 3, 3, 79, 80, 81, 82, 83, 84, 3, 85,
+  3, 3, 3, 3, 3, 3, 86, 87, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 88, 3, 89, 3, 90, 91, 92, 93, 94, 46, 46, 46, 95,
+  96, 97, 98, 99, 100, 46, 101, 102, 103, 104, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 3, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  105, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 106, 107, 3, 3, 3, 3, 108, 109, 110, 111, 3, 3, 3, 3,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 3, 122, 3, 3, 3, 123,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 124, 125,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 46, 46, 46, 46, 46, 46, 46, 46, 126, 3, 3, 3,
+  3, 3, 3, 3, 127, 3, 3, 128, 129, 130, 3, 131, 132, 133, 134, 135,
+  3, 3, 3, 3, 136, 3, 3, 137, 3, 3, 3, 138, 3, 139, 140, 141,
+  3, 3, 142, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 143, 3, 3, 140, 3, 3, 3, 144, 145, 3, 146, 147, 3, 3, 3,
+  3, 3, 3, 3, 148, 3, 3, 3, 3, 3, 149, 3, 3, 150, 151, 3,
+  152, 153, 154, 155, 156, 157, 158, 159, 160, 3, 161, 162, 34, 163, 3, 3,
+  164, 165, 166, 167, 3, 3, 168, 169, 166, 170, 171, 172, 173, 3, 3, 3,
+  174, 3, 3, 142, 175, 176, 3, 177, 178, 179, 180, 3, 3, 3, 3, 3,
+  181, 182, 183, 3, 184, 185, 186, 3, 3, 3, 3, 187, 3, 3, 3, 188,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 189, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 190, 191, 3, 3, 192, 3, 3,
+  193, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 194, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 195, 3, 196, 197, 198, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 199, 3, 3, 200, 201, 202,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 203,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 3, 3, 3, 3,
+  3, 3, 3, 3, 204, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  46, 46, 46, 46, 205, 206, 46, 46, 46, 46, 46, 207, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 208, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 209, 210, 3, 3,
+  3, 3, 3, 3, 3, 211, 212, 3, 3, 213, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 214,
+  3, 3, 3, 3, 3, 3, 3, 3, 215, 216, 217, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  218, 3, 3, 3, 219, 172, 3, 3, 3, 3, 220, 221, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 222, 3, 223, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 224, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  46, 46, 46, 46, 225, 226, 227, 228, 46, 46, 46, 46, 46, 46, 229, 230,
+  46, 46, 231, 46, 232, 233, 46, 234, 46, 235, 46, 46, 3, 236, 3, 237,
+  238, 239, 240, 46, 241, 46, 46, 46, 3, 242, 46, 46, 3, 3, 3, 243,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 244,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 244,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 244
+};
+
+// 245 distinct blocks of 64 classes
+extern const uint8_t lineBreakBlocks[15680] = {
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  3, 13, 10, 0, 16, 17, 0, 10, 7, 9, 0, 16, 15, 5, 15, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 15, 15, 0, 0, 0, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 16, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 4, 8, 0, 2,
+  2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  11, 7, 17, 16, 16, 16, 0, 0, 0, 0, 0, 10, 0, 4, 0, 0, 17, 16, 0, 0, 6, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 11, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 11, 11, 11, 11,
+  11, 11, 11, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0,
+  0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 4, 0, 0, 0, 0, 16, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2,
+  0, 2, 2, 0, 2, 2, 13, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 15, 15, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2, 13, 13, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 17, 18, 18, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+  2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 2, 2, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 15, 13, 0, 0, 0, 2, 16, 16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 17, 17, 0, 0, 0, 0, 0, 17, 0, 16, 0, 0, 2, 0,
+  2, 2, 2, 0, 0, 0, 0, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 2, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+  2, 2, 2, 0, 0, 0, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 4, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 6, 6, 6, 6, 0, 6, 6, 11, 6, 6, 4, 11, 13, 13, 13, 13, 13, 11, 0, 13, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 2, 0, 2, 7, 8, 7, 8, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4,
+  2, 2, 2, 2, 2, 4, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 4, 4,
+  0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 4, 6, 0, 0, 0, 0, 0, 11, 11, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+  0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 12, 0, 4, 0, 4, 16, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13, 13, 4, 4, 6, 0, 13, 13, 0, 2, 2, 2, 11, 2, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 13, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 4, 0, 4, 4, 4,
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0,
+  2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 4, 4, 4, 4, 4,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 11, 4, 4, 4, 20, 2, 2, 2, 2, 4, 11, 4, 4, 4, 0, 0, 0, 10, 10, 7, 10, 10, 10, 7, 10,
+  0, 0, 0, 0, 19, 19, 19, 4, 3, 3, 2, 2, 2, 2, 2, 11, 17, 17, 17, 17, 17, 17, 17, 17, 0, 10, 10, 0, 12, 12, 0, 0,
+  0, 0, 0, 0, 15, 7, 8, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4, 4, 4, 0, 4, 4, 4,
+  21, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  16, 16, 16, 16, 16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 16, 16, 16, 16, 17, 16, 16, 17, 16,
+  17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 17, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+  1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10,
+  10, 0, 13, 13, 1, 0, 0, 0, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 7, 8, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 13, 4, 4, 4, 0, 13, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 7, 4, 0, 0, 10, 10, 0, 0,
+  10, 10, 7, 8, 7, 8, 7, 8, 7, 8, 4, 4, 4, 4, 13, 0, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0,
+  4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 0, 4, 4, 0, 0, 0, 13, 13, 7, 8, 7, 8, 7, 8, 7, 8, 4, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  4, 8, 8, 1, 1, 12, 1, 1, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 1, 1, 7, 8, 7, 8, 7, 8, 7, 8, 12, 7, 8, 8,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 12, 12, 1, 1, 1,
+  0, 12, 1, 12, 1, 12, 1, 12, 1, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 12, 1, 12, 1, 12, 1, 1, 1, 1, 1, 1, 12, 1, 1, 1, 1, 1, 1, 12, 12, 0, 0, 2, 2, 12, 12, 12, 12, 1,
+  12, 12, 1, 12, 1, 12, 1, 12, 1, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 12, 1, 12, 1, 12, 1, 1, 1, 1, 1, 1, 12, 1, 1, 1, 1, 1, 1, 12, 12, 1, 1, 1, 1, 12, 12, 12, 12, 1,
+  0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 2,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+  2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 4, 4, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 8, 8, 15, 15, 13, 13, 7, 8, 19, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 7, 8, 7, 8, 7, 8, 7, 8, 7, 8, 7,
+  8, 7, 8, 7, 8, 1, 1, 7, 8, 1, 1, 1, 1, 1, 1, 1, 8, 1, 8, 0, 12, 12, 13, 13, 1, 7, 8, 7, 8, 7, 8, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 1, 16, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+  0, 13, 1, 1, 16, 17, 1, 1, 7, 8, 1, 1, 8, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 12, 12, 1, 1, 1, 13,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 1, 8, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 1, 8, 1, 7,
+  8, 8, 7, 8, 8, 12, 1, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 12, 12,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+  0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+  17, 16, 1, 1, 1, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 0, 0, 0,
+  4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 4, 4,
+  4, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  4, 4, 4, 4, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 0, 0, 0, 0, 4, 4, 0, 4, 2, 2, 2, 2, 0, 2, 2, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 6, 0, 4, 4, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 0, 4, 4, 0, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 4, 4, 4, 4, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 4, 4, 0, 0, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 6, 4, 4, 13, 13, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 2, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 4, 4, 4, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 2, 2, 2, 0,
+  2, 0, 2, 2, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+  2, 0, 6, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 6,
+  0, 4, 4, 4, 4, 6, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 0, 6, 6,
+  6, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 2,
+  2, 2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17,
+  17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 8, 8, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 8, 0, 0, 0, 7, 8, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 8, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 7, 8, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  12, 12, 12, 12, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 4,
+  2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2,
+  2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 16,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 12, 12, 12, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0
+};
+
+// bit b of entry a: a break may fall between classes a and b
+extern const uint32_t lineBreakPairs[23] = {
+  0x40004e, 0x4500cf, 0x4700cf, 0x4700cf, 0x4708cf, 0x4308cf,
+  0x000000, 0x000000, 0x4400cf, 0x4000ce, 0x000000, 0x000000,
+  0x4700cf, 0x4700cf, 0x4300cf, 0x4300ce, 0x43004c, 0x43004e,
+  0x40004e, 0x4700cf, 0x7fffff, 0x000000, 0x0700cf
+};
+
+// pattern trie, breadth first: letter | children << 5 | first child << 10,
+// letters a-z are 1-26 and the word boundary 27
+extern const uint32_t hyphenNodes[15794] = {
+  0x00000760, 0x00007321, 0x0000d6a2, 0x00012a03, 0x00016ae4, 0x0001c725, 0x00022a26, 0x00026e47,
+  0x0002b648, 0x0002ff49, 0x0003648a, 0x000375eb, 0x0003b2ec, 0x00040e4d, 0x0004572e, 0x0004bb0f,
+  0x00051a70, 0x00056431, 0x00056af2, 0x0005c6f3, 0x000622d4, 0x00067ad5, 0x0006d0d6, 0x0006e9d7,
+  0x00072158, 0x00074a39, 0x00078d3a, 0x0007b35b, 0x00081902, 0x000838e3, 0x00085504, 0x00087425,
+  0x00087826, 0x00087d07, 0x00089c88, 0x0008aca9, 0x0008c00a, 0x0008c02b, 0x0008c50c, 0x0008e4ad,
+  0x0008f96e, 0x0009240f, 0x00092510, 0x00094431, 0x000949b2, 0x00097d73, 0x0009a954, 0x0009d0f5,
+  0x0009ec96, 0x0009fc97, 0x000a0c38, 0x000a1079, 0x000a1c5a, 0x000a2521, 0x000a4842, 0x000a5004,
+  0x000a5165, 0x000a7c06, 0x000a7c08, 0x000a7d09, 0x000a9c0a, 0x000a9c0b, 0x000a9cac, 0x000ab00d,
+  0x000ab02e, 0x000ab54f, 0x000adc10, 0x000adc52, 0x000ae433, 0x000ae874, 0x000af515, 0x000b1416,
+  0x000b1417, 0x000b1459, 0x000b1d81, 0x000b4c63, 0x000b5945, 0x000b80c8, 0x000b99a9, 0x000bcc2b,
+  0x000bd08c, 0x000be00e, 0x000be1af, 0x000c1411, 0x000c14b2, 0x000c2813, 0x000c28b4, 0x000c3d55,
+  0x000c6419, 0x000c643a, 0x000c6961, 0x000c9402, 0x000c9403, 0x000c9404, 0x000c9625, 0x000cd806,
+  0x000cd887, 0x000ce808, 0x000ce9e9, 0x000d240a, 0x000d240b, 0x000d24ac, 0x000d380d, 0x000d380e,
+  0x000d39ef, 0x000d7410, 0x000d74d2, 0x000d8c73, 0x000d9834, 0x000d9d15, 0x000dbc16, 0x000dbc17,
+  0x000dbc59, 0x000dc561, 0x000df062, 0x000dfd23, 0x000e20e4, 0x000e3d45, 0x000e64a6, 0x000e78e7,
+  0x000e9428, 0x000e98e9, 0x000eb42a, 0x000eb84b, 0x000ec12c, 0x000ee52d, 0x000f098e, 0x000f394f,
+  0x000f6130, 0x000f8431, 0x000f89b2, 0x000fbdb3, 0x000ff154, 0x001018b5, 0x00102cb6, 0x00104097,
+  0x00105038, 0x00105479, 0x00106121, 0x00108402, 0x00108404, 0x00108545, 0x0010ac86, 0x0010bc08,
+  0x0010bce9, 0x0010d88c, 0x0010e80d, 0x0010e80e, 0x0010e86f, 0x0010f410, 0x0010f492, 0x00110413,
+  0x00110454, 0x00110cf5, 0x00112819, 0x00112901, 0x00114802, 0x00114804, 0x00114945, 0x00117067,
+  0x00117c68, 0x001189a9, 0x0011bc8c, 0x0011cc2d, 0x0011d08e, 0x0011e14f, 0x00120810, 0x001208b2,
+  0x00121c33, 0x00122034, 0x001224d5, 0x00123c17, 0x00123c59, 0x00124581, 0x00127402, 0x00127585,
+  0x0012a406, 0x0012a408, 0x0012a589, 0x0012d40b, 0x0012d44c, 0x0012dc2d, 0x0012e00e, 0x0012e14f,
+  0x00130810, 0x00130852, 0x00131033, 0x00131474, 0x001320b5, 0x00133437, 0x00133859, 0x001340c1,
+  0x001358c2, 0x00137143, 0x00139904, 0x0013b8e5, 0x0013d4c6, 0x0013ed07, 0x00140c08, 0x00140c09,
+  0x00140c0a, 0x00140c0b, 0x00140d4c, 0x001434cd, 0x00144dee, 0x0014894f, 0x0014b0b0, 0x0014c431,
+  0x0014c912, 0x0014e9f3, 0x00152534, 0x00154815, 0x00154876, 0x00155417, 0x00155438, 0x00155819,
+  0x0015587a, 0x00156441, 0x00156c65, 0x0015782f, 0x00157c35, 0x001580a1, 0x00159402, 0x00159505,
+  0x0015b406, 0x0015b408, 0x0015b4e9, 0x0015d00b, 0x0015d04c, 0x0015d80d, 0x0015d84e, 0x0015e06f,
+  0x0015ec32, 0x0015f073, 0x0015fc14, 0x0015fc17, 0x0015fd41, 0x00162422, 0x00162843, 0x00163064,
+  0x00163d65, 0x00166826, 0x00166c67, 0x00167808, 0x00167a09, 0x0016b80a, 0x0016b82b, 0x0016bc8c,
+  0x0016cc6d, 0x0016d80e, 0x0016d9cf, 0x001710b0, 0x00172412, 0x00172473, 0x001730d4, 0x00174975,
+  0x00177436, 0x00177817, 0x001778b9, 0x00178d61, 0x0017b842, 0x0017c003, 0x0017c165, 0x0017ec06,
+  0x0017ec08, 0x0017ed49, 0x0018140b, 0x0018140c, 0x0018142d, 0x0018186e, 0x001825af, 0x001858f0,
+  0x00187412, 0x00187453, 0x00187c14, 0x00187cb5, 0x00189017, 0x00189181, 0x0018c002, 0x0018c0e3,
+  0x0018dca4, 0x0018f225, 0x00193406, 0x00193527, 0x00195848, 0x00196189, 0x0019900a, 0x0019906b,
+  0x00199c0c, 0x00199c2d, 0x0019a04e, 0x0019aa0f, 0x0019e850, 0x0019f011, 0x0019f032, 0x0019f533,
+  0x001a18d4, 0x001a3135, 0x001a5416, 0x001a5417, 0x001a5459, 0x001a5c3a, 0x001a60a1, 0x001a74a2,
+  0x001a8903, 0x001aa884, 0x001ab8a5, 0x001acc26, 0x001ad107, 0x001af028, 0x001af509, 0x001b140a,
+  0x001b144b, 0x001b1d8c, 0x001b4ced, 0x001b698e, 0x001b98af, 0x001bad10, 0x001bcc11, 0x001bcdb2,
+  0x001c00f3, 0x001c1cb4, 0x001c30d5, 0x001c4876, 0x001c54b7, 0x001c6839, 0x001c6d61, 0x001c9802,
+  0x001c9804, 0x001c9965, 0x001cc406, 0x001cc407, 0x001cc548, 0x001ced29, 0x001d100b, 0x001d108c,
+  0x001d200d, 0x001d200e, 0x001d218f, 0x001d5070, 0x001d5c92, 0x001d6c73, 0x001d78d4, 0x001d9135,
+  0x001db417, 0x001db455, 0x001dbdc1, 0x001df462, 0x001e0083, 0x001e1044, 0x001e1a45, 0x001e6046,
+  0x001e68a7, 0x001e7c48, 0x001e85e9, 0x001ec00a, 0x001ec04b, 0x001ec86c, 0x001ed48d, 0x001ee4ae,
+  0x001ef9ef, 0x001f3490, 0x001f4492, 0x001f5513, 0x001f74b4, 0x001f8915, 0x001fa876, 0x001fb417,
+  0x001fb479, 0x001fc141, 0x001fe802, 0x001fe8e3, 0x00200404, 0x00200605, 0x00204406, 0x00204407,
+  0x002044a8, 0x002059a9, 0x00208c4b, 0x0020946c, 0x0020a08d, 0x0020b00e, 0x0020b10f, 0x0020d0d0,
+  0x0020e831, 0x0020ec12, 0x0020ed53, 0x00211554, 0x00213d15, 0x00215c16, 0x00215c37, 0x00216099,
+  0x00217221, 0x0021b402, 0x0021b423, 0x0021b804, 0x0021ba25, 0x0021fc06, 0x0021fc07, 0x0021fce8,
+  0x00221a29, 0x00225c6c, 0x0022682d, 0x00226c0e, 0x00226d8f, 0x00229c10, 0x00229cb2, 0x0022b073,
+  0x0022bc74, 0x0022c975, 0x0022f416, 0x0022f477, 0x00230079, 0x00230c3a, 0x002310c1, 0x00232862,
+  0x002334c3, 0x00234cc4, 0x00236445, 0x00236c46, 0x00237447, 0x00237ca9, 0x0023900a, 0x0023900b,
+  0x002391ac, 0x0023c4ad, 0x0023d90e, 0x0023f86f, 0x002404b0, 0x002419d2, 0x00245133, 0x002474d4,
+  0x00248c35, 0x00249016, 0x00249038, 0x0024943a, 0x00249941, 0x0024c105, 0x0024e1a9, 0x002514ef,
+  0x00253016, 0x00253019, 0x00253141, 0x00255802, 0x002558e5, 0x00257428, 0x002578c9, 0x0025900b,
+  0x0025904c, 0x0025982e, 0x00259c4f, 0x0025a410, 0x0025a452, 0x0025ac93, 0x0025bc14, 0x0025bc19,
+  0x0025bca1, 0x0025d003, 0x0025d065, 0x0025dc48, 0x0025e489, 0x0025f42f, 0x0025f850, 0x00260034,
+  0x00260435, 0x00260818, 0x00260861, 0x00261402, 0x00261463, 0x00262004, 0x00262085, 0x00263027,
+  0x00263408, 0x00263409, 0x0026348c, 0x0026446d, 0x002650ae, 0x002664af, 0x002678b0, 0x00268c92,
+  0x00269cf3, 0x0026b854, 0x0026c017, 0x0026c041, 0x0026c802, 0x0026c885, 0x0026d849, 0x0026e00c,
+  0x0026e00d, 0x0026e04f, 0x0026e834, 0x0026ec3a, 0x0026f1e1, 0x00272ce2, 0x00274923, 0x00276ce4,
+  0x00278a25, 0x0027cce6, 0x0027e8e7, 0x002804c8, 0x00281d29, 0x0028408a, 0x002850ab, 0x002864ac,
+  0x002878cd, 0x002890ae, 0x0028a5cf, 0x0028dd70, 0x00290831, 0x00290cf2, 0x00292a13, 0x00296914,
+  0x002988b5, 0x00299cb6, 0x0029b0d7, 0x0029c858, 0x0029d059, 0x0029d83a, 0x0029dc41, 0x0029e425,
+  0x0029e849, 0x0029f02c, 0x0029f42f, 0x0029f832, 0x0029fc35, 0x002a001b, 0x002a0021, 0x002a0445,
+  0x002a0c28, 0x002a1069, 0x002a1c32, 0x002a2034, 0x002a2455, 0x002a2c24, 0x002a3025, 0x002a34c9,
+  0x002a4c2c, 0x002a502f, 0x002a5432, 0x002a5833, 0x002a5c55, 0x002a6432, 0x002a6806, 0x002a6841,
+  0x002a7065, 0x002a7c09, 0x002a7c0c, 0x002a7c0e, 0x002a7c4f, 0x002a8455, 0x002a8c19, 0x002a8c01,
+  0x002a8c05, 0x002a8c0c, 0x002a8c0f, 0x002a8c01, 0x002a8c23, 0x002a902c, 0x002a944e, 0x002a9c34,
+  0x002aa025, 0x002aa461, 0x002ab024, 0x002ab445, 0x002abc49, 0x002ac44c, 0x002acc0d, 0x002acc2f,
+  0x002ad099, 0x002ae0a1, 0x002af425, 0x002af889, 0x002b084f, 0x002b1030, 0x002b1481, 0x002b2484,
+  0x002b3485, 0x002b4447, 0x002b4d49, 0x002b742b, 0x002b782e, 0x002b7c2f, 0x002b80d3, 0x002b98b4,
+  0x002bac75, 0x002bb841, 0x002bc025, 0x002bc448, 0x002bcc69, 0x002bd80c, 0x002bd88f, 0x002be833,
+  0x002bec15, 0x002bec35, 0x002bf141, 0x002c1822, 0x002c1c23, 0x002c2044, 0x002c2885, 0x002c3846,
+  0x002c40c9, 0x002c582d, 0x002c5c6f, 0x002c6810, 0x002c6811, 0x002c6832, 0x002c6c53, 0x002c7441,
+  0x002c7c28, 0x002c8089, 0x002c902b, 0x002c940c, 0x002c942f, 0x002c9830, 0x002c9c33, 0x002ca054,
+  0x002ca835, 0x002cac1b, 0x002cac81, 0x002cbcc5, 0x002cd448, 0x002cdce9, 0x002cf88f, 0x002d0832,
+  0x002d0c33, 0x002d1074, 0x002d1c95, 0x002d2c19, 0x002d2c02, 0x002d2c47, 0x002d340c, 0x002d342e,
+  0x002d3812, 0x002d3833, 0x002d3c54, 0x002d4441, 0x002d4c45, 0x002d5449, 0x002d5c4f, 0x002d6421,
+  0x002d6809, 0x002d682c, 0x002d6c13, 0x002d6c49, 0x002d7421, 0x002d7805, 0x002d7813, 0x002d7829,
+  0x002d7c3a, 0x002d8024, 0x002d8427, 0x002d882c, 0x002d8c6e, 0x002d9852, 0x002da033, 0x002da414,
+  0x002da41a, 0x002da41b, 0x002da425, 0x002da829, 0x002dac41, 0x002db464, 0x002dc047, 0x002dc84c,
+  0x002dd00d, 0x002dd04e, 0x002dd853, 0x002de074, 0x002dec17, 0x002dec39, 0x002df01b, 0x002df002,
+  0x002df004, 0x002df045, 0x002df806, 0x002df82c, 0x002dfc6e, 0x002e084f, 0x002e1094, 0x002e2021,
+  0x002e2465, 0x002e3029, 0x002e340f, 0x002e3435, 0x002e3825, 0x002e3c24, 0x002e4005, 0x002e402c,
+  0x002e442d, 0x002e482e, 0x002e4c0f, 0x002e4cb2, 0x002e6013, 0x002e6074, 0x002e6c35, 0x002e7029,
+  0x002e742f, 0x002e782f, 0x002e7c0c, 0x002e7c0f, 0x002e7c12, 0x002e7c26, 0x002e8027, 0x002e842c,
+  0x002e882d, 0x002e8c2e, 0x002e9032, 0x002e9473, 0x002ea074, 0x002eac13, 0x002eac1b, 0x002eac42,
+  0x002eb423, 0x002eb824, 0x002ebc07, 0x002ebc08, 0x002ebc6c, 0x002ec8ae, 0x002edc30, 0x002ee032,
+  0x002ee453, 0x002eec54, 0x002ef436, 0x002ef828, 0x002efc29, 0x002f006f, 0x002f0c44, 0x002f1409,
+  0x002f144c, 0x002f1c8e, 0x002f2c10, 0x002f2c32, 0x002f3073, 0x002f3c34, 0x002f4017, 0x002f401b,
+  0x002f4041, 0x002f48c5, 0x002f6089, 0x002f700f, 0x002f7034, 0x002f741b, 0x002f7441, 0x002f7c03,
+  0x002f7c25, 0x002f8026, 0x002f8409, 0x002f844c, 0x002f8c0d, 0x002f8c8e, 0x002f9c2f, 0x002fa070,
+  0x002fac33, 0x002fb034, 0x002fb41a, 0x002fb409, 0x002fb421, 0x002fb825, 0x002fbc49, 0x002fc419,
+  0x002fc421, 0x002fc805, 0x002fc827, 0x002fcc29, 0x002fd04c, 0x002fd82d, 0x002fdc8e, 0x002fec70,
+  0x002ff852, 0x00300033, 0x00300436, 0x00300837, 0x00300c5a, 0x00301441, 0x00301c85, 0x00302c89,
+  0x00303c4f, 0x00304435, 0x00304841, 0x00305025, 0x00305449, 0x00305c35, 0x00306017, 0x00306004,
+  0x00306006, 0x00306029, 0x0030644c, 0x00306c6d, 0x0030780e, 0x00307850, 0x00308052, 0x00308833,
+  0x00308c54, 0x00309405, 0x00309402, 0x00309423, 0x00309806, 0x00309807, 0x0030980d, 0x0030982e,
+  0x00309c72, 0x0030a854, 0x0030b036, 0x0030b419, 0x0030b41b, 0x0030b421, 0x0030b842, 0x0030c063,
+  0x0030cc04, 0x0030cc25, 0x0030d029, 0x0030d44c, 0x0030dc6d, 0x0030e88e, 0x0030f870, 0x00310411,
+  0x00310492, 0x003114b3, 0x00312834, 0x00312c36, 0x00313019, 0x0031301b, 0x00313001, 0x00313025,
+  0x00313409, 0x00313419, 0x00313421, 0x00313863, 0x00314404, 0x00314425, 0x00314806, 0x00314827,
+  0x00314c2c, 0x0031506e, 0x00315c2f, 0x00316030, 0x00316452, 0x00316c53, 0x00317434, 0x00317816,
+  0x0031781b, 0x00317801, 0x00317865, 0x0031840f, 0x00318415, 0x00318419, 0x00318424, 0x00318805,
+  0x00318806, 0x00318807, 0x0031886c, 0x0031942d, 0x0031984e, 0x0031a02f, 0x0031a430, 0x0031a812,
+  0x0031a813, 0x0031a835, 0x0031ac16, 0x0031ac18, 0x0031ac1b, 0x0031ac41, 0x0031b445, 0x0031bc49,
+  0x0031c44f, 0x0031cc35, 0x0031d019, 0x0031d010, 0x0031d017, 0x0031d019, 0x0031d008, 0x0031d001,
+  0x0031d063, 0x0031dc25, 0x0031e007, 0x0031e02c, 0x0031e42d, 0x0031e80e, 0x0031e830, 0x0031ec0e,
+  0x0031ec53, 0x0031f402, 0x0031f423, 0x0031f824, 0x0031fc27, 0x0032004c, 0x0032082d, 0x00320c2e,
+  0x003210d2, 0x00322873, 0x00323494, 0x00324476, 0x00325045, 0x00325829, 0x00325c12, 0x00325c41,
+  0x00326423, 0x00326825, 0x00326c89, 0x00327c4c, 0x0032848f, 0x00329432, 0x00329854, 0x0032a035,
+  0x0032a401, 0x0032a404, 0x0032a445, 0x0032acc9, 0x0032c44f, 0x0032cc32, 0x0032d035, 0x0032d403,
+  0x0032d424, 0x0032d806, 0x0032d84c, 0x0032e00d, 0x0032e02e, 0x0032e410, 0x0032e433, 0x0032e834,
+  0x0032ec18, 0x0032ec25, 0x0032f006, 0x0032f089, 0x0033002f, 0x00330435, 0x00330821, 0x00330c25,
+  0x00331089, 0x0033200e, 0x0033204f, 0x00332855, 0x00333019, 0x00333025, 0x00333403, 0x00333404,
+  0x00333427, 0x0033382d, 0x00333c6e, 0x00334832, 0x00334c74, 0x00335835, 0x00335c29, 0x0033602c,
+  0x003364c1, 0x00337d05, 0x00339c06, 0x00339d29, 0x0033c04c, 0x0033c86f, 0x0033d433, 0x0033d834,
+  0x0033dc55, 0x0033e461, 0x0033f002, 0x0033f045, 0x0033f8c9, 0x0034102e, 0x0034144f, 0x00341c30,
+  0x00342055, 0x00342819, 0x00342841, 0x00343023, 0x00343424, 0x003438e5, 0x00345509, 0x0034740e,
+  0x0034746f, 0x00348033, 0x00348454, 0x00348c55, 0x00349439, 0x0034981a, 0x00349806, 0x00349807,
+  0x00349809, 0x0034980c, 0x00349830, 0x00349c52, 0x0034a413, 0x0034a434, 0x0034a835, 0x0034ac17,
+  0x0034ac41, 0x0034b465, 0x0034c028, 0x0034c42c, 0x0034c80f, 0x0034c852, 0x0034d033, 0x0034d434,
+  0x0034d835, 0x0034dc35, 0x0034e081, 0x0034f022, 0x0034f423, 0x0034f945, 0x00352008, 0x00352109,
+  0x0035400d, 0x0035404e, 0x0035488f, 0x00355833, 0x00355c74, 0x00356835, 0x00356c37, 0x00357021,
+  0x00357463, 0x00358065, 0x00358c48, 0x003594e9, 0x0035b02b, 0x0035b42d, 0x0035b84f, 0x0035c070,
+  0x0035cc33, 0x0035d094, 0x0035e035, 0x0035e417, 0x0035e421, 0x0035e845, 0x0035f028, 0x0035f4a9,
+  0x0036080e, 0x0036082f, 0x00360c92, 0x00361c35, 0x00362039, 0x0036241a, 0x0036240e, 0x00362410,
+  0x00362432, 0x00362813, 0x00362874, 0x00363441, 0x00363c85, 0x00364c89, 0x00365c2f, 0x00366015,
+  0x00366021, 0x00366425, 0x00366808, 0x00366869, 0x00367410, 0x00367403, 0x00367425, 0x00367813,
+  0x00367842, 0x00368023, 0x00368407, 0x00368429, 0x0036882c, 0x00368c4d, 0x00369432, 0x00369874,
+  0x0036a435, 0x0036a841, 0x0036b002, 0x0036b043, 0x0036b804, 0x0036b82c, 0x0036bc2d, 0x0036c02e,
+  0x0036c432, 0x0036c816, 0x0036c81b, 0x0036c825, 0x0036cc69, 0x0036d82c, 0x0036dc19, 0x0036dc01,
+  0x0036dcc3, 0x0036f424, 0x0036f827, 0x0036fc6c, 0x003708ae, 0x00371c33, 0x00372025, 0x00372429,
+  0x0037282f, 0x00372c19, 0x00372c4e, 0x00373492, 0x00374413, 0x00374421, 0x00374845, 0x00375029,
+  0x0037542f, 0x0037580f, 0x00375819, 0x00375825, 0x00375c07, 0x00375c2d, 0x0037602e, 0x00376432,
+  0x00376853, 0x00377034, 0x00377406, 0x0037746c, 0x0037804d, 0x0037884e, 0x00379032, 0x00379433,
+  0x00379854, 0x0037a01a, 0x0037a004, 0x0037a025, 0x0037a44c, 0x0037ac8e, 0x0037bc2f, 0x0037c032,
+  0x0037c433, 0x0037c874, 0x0037d416, 0x0037d41b, 0x0037d425, 0x0037d82c, 0x0037dc0f, 0x0037dc29,
+  0x0037e02f, 0x0037e434, 0x0037e821, 0x0037ec43, 0x0037f445, 0x0037fc0c, 0x0037fc2d, 0x0038006e,
+  0x00380c0f, 0x00380c32, 0x00381033, 0x00381415, 0x00381416, 0x0038141a, 0x0038141b, 0x00381441,
+  0x00381c05, 0x00381c49, 0x0038242f, 0x00382819, 0x00382821, 0x00382c25, 0x00383049, 0x0038382f,
+  0x00383c02, 0x00383c05, 0x00383c07, 0x00383c29, 0x0038406e, 0x00384c0f, 0x00384c52, 0x00385433,
+  0x00385816, 0x0038581b, 0x003858a1, 0x00386c45, 0x00387429, 0x0038780f, 0x00387835, 0x00387c34,
+  0x00388008, 0x00388021, 0x00388405, 0x00388429, 0x0038880e, 0x00388813, 0x00388814, 0x0038880e,
+  0x00388832, 0x00388c22, 0x00389023, 0x00389445, 0x00389c27, 0x0038a02c, 0x0038a40d, 0x0038a4ce,
+  0x0038bc50, 0x0038c4b2, 0x0038d833, 0x0038dc35, 0x0038e03a, 0x0038e441, 0x0038ec23, 0x0038f024,
+  0x0038f46c, 0x0039002d, 0x0039042e, 0x0039082f, 0x00390c10, 0x00390cd2, 0x00392433, 0x00392834,
+  0x00392c15, 0x00392c21, 0x00393023, 0x00393427, 0x0039380c, 0x0039382d, 0x00393c2e, 0x0039402f,
+  0x00394410, 0x00394492, 0x00395453, 0x00395c34, 0x00396016, 0x00396021, 0x0039642f, 0x00396825,
+  0x00396c44, 0x00397427, 0x0039784c, 0x0039804d, 0x0039884e, 0x0039904f, 0x00399892, 0x0039a853,
+  0x0039b035, 0x0039b436, 0x0039b825, 0x0039bc4f, 0x0039c408, 0x0039c421, 0x0039c845, 0x0039d019,
+  0x0039d007, 0x0039d02d, 0x0039d44e, 0x0039dc33, 0x0039e014, 0x0039e021, 0x0039e450, 0x0039ec13,
+  0x0039ec0c, 0x0039ec2d, 0x0039f06e, 0x0039fc30, 0x003a0033, 0x003a0474, 0x003a1025, 0x003a1469,
+  0x003a202c, 0x003a240f, 0x003a2432, 0x003a2835, 0x003a2ca1, 0x003a4023, 0x003a4425, 0x003a4808,
+  0x003a4869, 0x003a542c, 0x003a582f, 0x003a5c52, 0x003a6454, 0x003a6c95, 0x003a7c41, 0x003a8404,
+  0x003a8445, 0x003a8ca9, 0x003aa02c, 0x003aa44f, 0x003aac12, 0x003aac35, 0x003ab024, 0x003ab427,
+  0x003ab82c, 0x003abc8e, 0x003acc32, 0x003ad053, 0x003ad814, 0x003ad825, 0x003adc46, 0x003ae449,
+  0x003aec0c, 0x003aec14, 0x003aec1b, 0x003aec21, 0x003af025, 0x003af428, 0x003af889, 0x003b080c,
+  0x003b084f, 0x003b1032, 0x003b1455, 0x003b1c81, 0x003b2c65, 0x003b3806, 0x003b38c9, 0x003b502c,
+  0x003b540e, 0x003b542f, 0x003b5834, 0x003b5c35, 0x003b6016, 0x003b6041, 0x003b6845, 0x003b7089,
+  0x003b802e, 0x003b842f, 0x003b8835, 0x003b8c41, 0x003b9423, 0x003b9824, 0x003b9c65, 0x003ba8c7,
+  0x003bc0a9, 0x003bd40b, 0x003bd40c, 0x003bd40e, 0x003bd46f, 0x003be053, 0x003be854, 0x003bf035,
+  0x003bf419, 0x003bf41b, 0x003bf447, 0x003bfc0c, 0x003bfc0d, 0x003bfc6e, 0x003c0830, 0x003c0c32,
+  0x003c1013, 0x003c1074, 0x003c1c35, 0x003c201b, 0x003c2005, 0x003c2028, 0x003c2429, 0x003c2832,
+  0x003c2c35, 0x003c3075, 0x003c3c41, 0x003c4424, 0x003c4885, 0x003c5827, 0x003c5c89, 0x003c6c2d,
+  0x003c704f, 0x003c7835, 0x003c7c61, 0x003c8823, 0x003c8c25, 0x003c9006, 0x003c9048, 0x003c9889,
+  0x003ca80b, 0x003ca82c, 0x003cac2d, 0x003cb02f, 0x003cb450, 0x003cbc53, 0x003cc4b4, 0x003cd835,
+  0x003cdc1b, 0x003cdcc1, 0x003cf445, 0x003cfc08, 0x003cfce9, 0x003d184f, 0x003d2052, 0x003d2814,
+  0x003d2875, 0x003d343a, 0x003d3865, 0x003d4469, 0x003d504f, 0x003d580f, 0x003d5821, 0x003d5c09,
+  0x003d5c2f, 0x003d6023, 0x003d6410, 0x003d6432, 0x003d6833, 0x003d6c17, 0x003d6c10, 0x003d6c24,
+  0x003d7002, 0x003d7007, 0x003d7029, 0x003d740c, 0x003d741b, 0x003d7404, 0x003d7405, 0x003d7407,
+  0x003d742c, 0x003d782e, 0x003d7c12, 0x003d7c33, 0x003d8034, 0x003d8403, 0x003d844c, 0x003d8c0d,
+  0x003d8c8e, 0x003d9c10, 0x003d9c33, 0x003da01b, 0x003da025, 0x003da419, 0x003da425, 0x003da80f,
+  0x003da812, 0x003da833, 0x003dac15, 0x003dac2f, 0x003db003, 0x003db00c, 0x003db019, 0x003db042,
+  0x003db823, 0x003dbc44, 0x003dc427, 0x003dc82d, 0x003dcc6e, 0x003dd852, 0x003de033, 0x003de474,
+  0x003df036, 0x003df429, 0x003df805, 0x003df809, 0x003df825, 0x003dfc29, 0x003e0032, 0x003e0401,
+  0x003e0422, 0x003e0826, 0x003e0c47, 0x003e142d, 0x003e188e, 0x003e2850, 0x003e30b2, 0x003e4473,
+  0x003e5056, 0x003e5839, 0x003e5c12, 0x003e5c21, 0x003e6025, 0x003e640f, 0x003e64a1, 0x003e7822,
+  0x003e7cc3, 0x003e9464, 0x003ea066, 0x003eac67, 0x003eb80b, 0x003eb80c, 0x003eb88d, 0x003ec88e,
+  0x003ed82f, 0x003edc11, 0x003edc33, 0x003ee054, 0x003ee836, 0x003eec1a, 0x003eec41, 0x003ef421,
+  0x003ef8c5, 0x003f1029, 0x003f146f, 0x003f2025, 0x003f2429, 0x003f284f, 0x003f3022, 0x003f3423,
+  0x003f3806, 0x003f3867, 0x003f442d, 0x003f484e, 0x003f502f, 0x003f5470, 0x003f6072, 0x003f6c93,
+  0x003f7c34, 0x003f8055, 0x003f8816, 0x003f881b, 0x003f8821, 0x003f8c48, 0x003f9449, 0x003f9c0c,
+  0x003f9c12, 0x003f9c03, 0x003f9c05, 0x003f9c29, 0x003fa041, 0x003fa845, 0x003fb028, 0x003fb449,
+  0x003fbc12, 0x003fbc35, 0x003fc001, 0x003fc022, 0x003fc443, 0x003fcc25, 0x003fd006, 0x003fd029,
+  0x003fd46d, 0x003fe02f, 0x003fe410, 0x003fe453, 0x003fec14, 0x003fec45, 0x003ff401, 0x003ff402,
+  0x003ff42d, 0x003ff82e, 0x003ffc33, 0x00400002, 0x00400063, 0x00400c47, 0x00401408, 0x00401429,
+  0x0040188c, 0x0040282e, 0x00402c10, 0x00402c72, 0x00403873, 0x00404474, 0x00405021, 0x00405469,
+  0x00406064, 0x00406c07, 0x00406c4c, 0x0040742d, 0x004078ce, 0x0040902f, 0x00409432, 0x00409833,
+  0x00409c94, 0x0040ac16, 0x0040ac1b, 0x0040ac01, 0x0040ac44, 0x0040b407, 0x0040b44c, 0x0040bcce,
+  0x0040d42f, 0x0040d873, 0x0040e434, 0x0040e81a, 0x0040e81b, 0x0040e821, 0x0040ec01, 0x0040ec29,
+  0x0040f00f, 0x0040f023, 0x0040f404, 0x0040f427, 0x0040f829, 0x0040fc0b, 0x0040fc2c, 0x0041002d,
+  0x004104ae, 0x00411832, 0x00411c53, 0x00412434, 0x00412855, 0x00413016, 0x00413021, 0x00413425,
+  0x00413828, 0x00413ca9, 0x0041508f, 0x00416034, 0x00416419, 0x00416408, 0x00416409, 0x0041644c,
+  0x00416c0d, 0x00416c0e, 0x00416c10, 0x00416c15, 0x00416c22, 0x00417063, 0x00417c27, 0x0041800b,
+  0x0041804c, 0x0041882d, 0x00418c6e, 0x004198b2, 0x0041ac53, 0x0041b454, 0x0041bc55, 0x0041c436,
+  0x0041c821, 0x0041cc25, 0x0041d068, 0x0041dc49, 0x0041e42f, 0x0041e812, 0x0041e815, 0x0041e841,
+  0x0041f025, 0x0041f489, 0x00420455, 0x00420c37, 0x00421021, 0x00421422, 0x00421823, 0x00421c04,
+  0x00421c47, 0x0042244c, 0x00422c4d, 0x0042342e, 0x0042380f, 0x00423830, 0x00423c11, 0x00423c92,
+  0x00424c93, 0x00425c34, 0x00426036, 0x00426417, 0x0042641b, 0x00426421, 0x00426865, 0x00427428,
+  0x00427869, 0x0042842c, 0x0042882f, 0x00428c33, 0x00429035, 0x00429419, 0x00429421, 0x00429805,
+  0x00429841, 0x0042a042, 0x0042a824, 0x0042ac25, 0x0042b026, 0x0042b427, 0x0042b80b, 0x0042b82d,
+  0x0042bc4e, 0x0042c40f, 0x0042c453, 0x0042cc94, 0x0042dc45, 0x0042e429, 0x0042e80c, 0x0042e825,
+  0x0042ec05, 0x0042ec49, 0x0042f422, 0x0042f823, 0x0042fc04, 0x0042fc05, 0x0042fc27, 0x00430029,
+  0x0043044c, 0x00430c6d, 0x0043184e, 0x00432030, 0x00432432, 0x00432873, 0x00433434, 0x00433835,
+  0x00433c36, 0x00434037, 0x00434409, 0x00434432, 0x00434815, 0x00434841, 0x00435003, 0x00435025,
+  0x00435449, 0x00435c0c, 0x00435c0d, 0x00435c2f, 0x00436050, 0x00436834, 0x00436c21, 0x00437025,
+  0x004374a9, 0x00438832, 0x00438c13, 0x00438c35, 0x00439001, 0x00439004, 0x00439025, 0x00439426,
+  0x00439849, 0x0043a04d, 0x0043a80e, 0x0043a80f, 0x0043a834, 0x0043ac0d, 0x0043ac10, 0x0043ac01,
+  0x0043ac04, 0x0043ac2c, 0x0043b032, 0x0043b453, 0x0043bc34, 0x0043c041, 0x0043c825, 0x0043cc29,
+  0x0043d012, 0x0043d035, 0x0043d405, 0x0043d428, 0x0043d849, 0x0043e02c, 0x0043e42f, 0x0043e872,
+  0x0043f434, 0x0043f855, 0x00440024, 0x00440449, 0x00440c2f, 0x00441035, 0x0044140c, 0x0044142e,
+  0x00441812, 0x00441834, 0x00441c16, 0x00441c29, 0x00442041, 0x00442865, 0x00443469, 0x0044402c,
+  0x0044442e, 0x00444832, 0x00444c35, 0x00445039, 0x00445421, 0x00445823, 0x00445c24, 0x00446026,
+  0x00446407, 0x0044642c, 0x0044684e, 0x00447073, 0x00447c34, 0x00448025, 0x00448429, 0x00448841,
+  0x00449024, 0x00449465, 0x0044a026, 0x0044a549, 0x0044cc2c, 0x0044d04f, 0x0044d830, 0x0044dc14,
+  0x0044dc95, 0x0044ec16, 0x0044ec19, 0x0044ec61, 0x0044f842, 0x00450065, 0x00450c89, 0x00451c2d,
+  0x0045204f, 0x00452850, 0x00453041, 0x00453823, 0x00453c24, 0x00454045, 0x00454827, 0x00454c89,
+  0x00455c2b, 0x0045604f, 0x00456853, 0x00457054, 0x00457835, 0x00457c36, 0x00458044, 0x0045880b,
+  0x00458830, 0x00458c32, 0x00459033, 0x00459401, 0x00459445, 0x00459c48, 0x0045a449, 0x0045ac4f,
+  0x0045b412, 0x0045b415, 0x0045b419, 0x0045b481, 0x0045c485, 0x0045d427, 0x0045d8e9, 0x0045f42d,
+  0x0045f82e, 0x0045fc4f, 0x00460430, 0x00460832, 0x00460c53, 0x00461454, 0x00461c35, 0x00462019,
+  0x00462021, 0x00462463, 0x00463069, 0x00463c0c, 0x00463c0f, 0x00463c50, 0x00464454, 0x00464c21,
+  0x00465065, 0x00465c48, 0x00466469, 0x0046702f, 0x00467422, 0x00467823, 0x00467c25, 0x0046800c,
+  0x0046804e, 0x00468816, 0x00468845, 0x00469049, 0x0046982f, 0x00469c24, 0x0046a045, 0x0046a809,
+  0x0046a82e, 0x0046ac0f, 0x0046ac01, 0x0046ac63, 0x0046b804, 0x0046b827, 0x0046bc29, 0x0046c00c,
+  0x0046c08e, 0x0046d030, 0x0046d492, 0x0046e474, 0x0046f016, 0x0046f019, 0x0046f021, 0x0046f403,
+  0x0046f444, 0x0046fc25, 0x0047000b, 0x0047004c, 0x0047086e, 0x0047142f, 0x00471912, 0x00473854,
+  0x0047401b, 0x00474021, 0x00474465, 0x004750a9, 0x0047640c, 0x0047646f, 0x00477013, 0x00477014,
+  0x00477015, 0x00477019, 0x0047701b, 0x00477021, 0x00477443, 0x00477c64, 0x00478845, 0x00479027,
+  0x0047942c, 0x0047986e, 0x0047a42f, 0x0047a854, 0x0047b041, 0x0047b889, 0x0047c82f, 0x0047cc35,
+  0x0047d003, 0x0047d024, 0x0047d445, 0x0047dc07, 0x0047dc29, 0x0047e02c, 0x0047e42e, 0x0047e810,
+  0x0047e832, 0x0047ec33, 0x0047f034, 0x0047f435, 0x0047f821, 0x0047fca5, 0x0048102f, 0x00481421,
+  0x00481905, 0x00483869, 0x004844af, 0x00485805, 0x00485808, 0x00485829, 0x00485c21, 0x00486005,
+  0x00486008, 0x00486029, 0x00486435, 0x00486817, 0x00486802, 0x00486805, 0x00486806, 0x0048682c,
+  0x00486c0d, 0x00486c0e, 0x00486c32, 0x00487013, 0x00487074, 0x00487c21, 0x00488065, 0x00488c22,
+  0x00489043, 0x00489846, 0x0048a009, 0x0048a02c, 0x0048a44d, 0x0048ac8e, 0x0048bc50, 0x0048c472,
+  0x0048d013, 0x0048d034, 0x0048d435, 0x0048d856, 0x0048e03a, 0x0048e441, 0x0048ec49, 0x0048f40f,
+  0x0048f425, 0x0048f848, 0x00490049, 0x00490835, 0x00490c21, 0x00491069, 0x00491ca1, 0x00493022,
+  0x00493443, 0x00493c44, 0x00494486, 0x00495427, 0x00495829, 0x00495c4c, 0x0049642e, 0x0049680f,
+  0x00496870, 0x00497472, 0x00498093, 0x00499074, 0x00499c35, 0x0049a096, 0x0049b037, 0x0049b41b,
+  0x0049b415, 0x0049b419, 0x0049b445, 0x0049bc89, 0x0049cc0c, 0x0049cc2f, 0x0049d015, 0x0049d021,
+  0x0049d41b, 0x0049d441, 0x0049dc22, 0x0049e083, 0x0049f024, 0x0049f465, 0x004a0047, 0x004a082c,
+  0x004a0c8d, 0x004a1c8e, 0x004a2c0f, 0x004a2c50, 0x004a3411, 0x004a3493, 0x004a4494, 0x004a5456,
+  0x004a5c25, 0x004a604c, 0x004a6825, 0x004a6c49, 0x004a740f, 0x004a7421, 0x004a7845, 0x004a8069,
+  0x004a8c19, 0x004a8c21, 0x004a9085, 0x004aa089, 0x004ab02f, 0x004ab415, 0x004ab422, 0x004ab823,
+  0x004abc05, 0x004abc46, 0x004ac42b, 0x004ac82c, 0x004acc6d, 0x004ad88e, 0x004ae84f, 0x004af050,
+  0x004af852, 0x004b0053, 0x004b0854, 0x004b1056, 0x004b1818, 0x004b1885, 0x004b2808, 0x004b2829,
+  0x004b2c0f, 0x004b2c85, 0x004b3c49, 0x004b444f, 0x004b4c39, 0x004b5021, 0x004b5403, 0x004b5485,
+  0x004b6428, 0x004b6829, 0x004b6c2f, 0x004b7010, 0x004b7017, 0x004b7041, 0x004b7865, 0x004b84e9,
+  0x004ba052, 0x004ba833, 0x004bac01, 0x004bac45, 0x004bb427, 0x004bb829, 0x004bbc2d, 0x004bc04e,
+  0x004bc833, 0x004bcc34, 0x004bd0a5, 0x004be449, 0x004bec0f, 0x004bec03, 0x004bec2e, 0x004bf014,
+  0x004bf002, 0x004bf063, 0x004bfc09, 0x004bfc8c, 0x004c0c4e, 0x004c1410, 0x004c1474, 0x004c2015,
+  0x004c2036, 0x004c2417, 0x004c2461, 0x004c3065, 0x004c3c28, 0x004c4049, 0x004c484c, 0x004c506f,
+  0x004c5c15, 0x004c5c41, 0x004c6443, 0x004c6c44, 0x004c7427, 0x004c7809, 0x004c786c, 0x004c844d,
+  0x004c8cee, 0x004ca830, 0x004cac92, 0x004cbc53, 0x004cc435, 0x004cc836, 0x004ccc37, 0x004cd018,
+  0x004cd01b, 0x004cd045, 0x004cd889, 0x004ce86f, 0x004cf417, 0x004cf41b, 0x004cf402, 0x004cf423,
+  0x004cf844, 0x004d0027, 0x004d044c, 0x004d0c6e, 0x004d182f, 0x004d1c32, 0x004d2013, 0x004d2034,
+  0x004d2415, 0x004d2416, 0x004d241a, 0x004d2425, 0x004d2829, 0x004d2c21, 0x004d3005, 0x004d3029,
+  0x004d3441, 0x004d3c45, 0x004d4429, 0x004d482f, 0x004d4c23, 0x004d5026, 0x004d548c, 0x004d640d,
+  0x004d646e, 0x004d7030, 0x004d7452, 0x004d7c36, 0x004d8041, 0x004d8865, 0x004d9448, 0x004d9c69,
+  0x004da82c, 0x004dac6f, 0x004db835, 0x004dbc21, 0x004dc003, 0x004dc085, 0x004dd049, 0x004dd82c,
+  0x004ddc0e, 0x004ddc30, 0x004de014, 0x004de035, 0x004de417, 0x004de4c1, 0x004dfc65, 0x004e0828,
+  0x004e0ce9, 0x004e282c, 0x004e2caf, 0x004e4072, 0x004e4c17, 0x004e4c19, 0x004e4c1b, 0x004e4c21,
+  0x004e5002, 0x004e5007, 0x004e5049, 0x004e580c, 0x004e582d, 0x004e5c0e, 0x004e5c12, 0x004e5c0f,
+  0x004e5c03, 0x004e5c0c, 0x004e5c2e, 0x004e6032, 0x004e6442, 0x004e6c23, 0x004e7024, 0x004e7406,
+  0x004e7429, 0x004e78cc, 0x004e902d, 0x004e944e, 0x004e9c50, 0x004ea492, 0x004eb453, 0x004ebc54,
+  0x004ec435, 0x004ec816, 0x004ec817, 0x004ec838, 0x004ecc1b, 0x004ecc28, 0x004ed041, 0x004ed843,
+  0x004ee024, 0x004ee405, 0x004ee447, 0x004eec6c, 0x004ef82d, 0x004efcae, 0x004f100f, 0x004f1030,
+  0x004f14b2, 0x004f2853, 0x004f3034, 0x004f3415, 0x004f3418, 0x004f3419, 0x004f341b, 0x004f3421,
+  0x004f3865, 0x004f4469, 0x004f500c, 0x004f506f, 0x004f5c13, 0x004f5c1b, 0x004f5c41, 0x004f6402,
+  0x004f6463, 0x004f7024, 0x004f7425, 0x004f7826, 0x004f7c27, 0x004f802c, 0x004f844d, 0x004f8c6e,
+  0x004f984f, 0x004fa011, 0x004fa0d3, 0x004fb834, 0x004fbc15, 0x004fbc36, 0x004fc05a, 0x004fc821,
+  0x004fcc85, 0x004fdc0f, 0x004fdc05, 0x004fdc02, 0x004fdc23, 0x004fe024, 0x004fe406, 0x004fe427,
+  0x004fe829, 0x004fec6d, 0x004ff86e, 0x00500452, 0x00500c13, 0x00500c55, 0x00501437, 0x00501881,
+  0x00502845, 0x00503089, 0x005040af, 0x00505455, 0x00505c03, 0x00505c08, 0x00505c17, 0x00505c25,
+  0x0050600f, 0x00506015, 0x00506021, 0x00506422, 0x00506804, 0x00506805, 0x00506806, 0x00506809,
+  0x0050680d, 0x0050682e, 0x00506c30, 0x00507092, 0x00508013, 0x00508001, 0x00508029, 0x0050840f,
+  0x00508401, 0x0050840c, 0x00508450, 0x00508c05, 0x00508c02, 0x00508c03, 0x00508c4e, 0x00509492,
+  0x0050a414, 0x0050a416, 0x0050a445, 0x0050ac29, 0x0050b02c, 0x0050b401, 0x0050b449, 0x0050bc2c,
+  0x0050c012, 0x0050c015, 0x0050c019, 0x0050c004, 0x0050c065, 0x0050cc89, 0x0050dc2f, 0x0050e033,
+  0x0050e415, 0x0050e46e, 0x0050f032, 0x0050f401, 0x0050f40c, 0x0050f428, 0x0050f829, 0x0050fc2c,
+  0x0051002e, 0x00510432, 0x00510834, 0x00510c36, 0x00511041, 0x00511823, 0x00511c24, 0x00512025,
+  0x00512427, 0x00512869, 0x0051344c, 0x00513c0d, 0x00513c0f, 0x00513c33, 0x00514074, 0x00514c35,
+  0x00515016, 0x00515021, 0x00515442, 0x00515c29, 0x0051602f, 0x00516410, 0x00516421, 0x00516825,
+  0x00516c89, 0x00517c33, 0x00518054, 0x00518815, 0x00518819, 0x0051881a, 0x00518832, 0x00518c13,
+  0x00518c15, 0x00518c25, 0x00519049, 0x0051980c, 0x00519830, 0x00519c54, 0x0051a461, 0x0051b022,
+  0x0051b403, 0x0051b404, 0x0051b425, 0x0051b846, 0x0051c0a9, 0x0051d42c, 0x0051d82e, 0x0051dc2f,
+  0x0051e050, 0x0051e833, 0x0051ec74, 0x0051f815, 0x0051f861, 0x00520423, 0x00520825, 0x00520c49,
+  0x0052142c, 0x00521810, 0x00521833, 0x00521c54, 0x00522435, 0x00522841, 0x00523065, 0x00523ca9,
+  0x0052500c, 0x005250af, 0x00526413, 0x0052640d, 0x00526415, 0x00526405, 0x00526402, 0x00526443,
+  0x00526c27, 0x0052706c, 0x00527c2d, 0x0052802e, 0x00528430, 0x00528832, 0x00528c14, 0x00528c1b,
+  0x00528c04, 0x00528c07, 0x00528c8c, 0x00529c4e, 0x0052a4d2, 0x0052bc53, 0x0052c454, 0x0052cc1b,
+  0x0052cc41, 0x0052d444, 0x0052dc06, 0x0052dc27, 0x0052e00b, 0x0052e02c, 0x0052e48e, 0x0052f46f,
+  0x00530010, 0x00530032, 0x00530473, 0x00531074, 0x00531c16, 0x00531c09, 0x00531c0b, 0x00531c8c,
+  0x00532c2d, 0x00533072, 0x00533c54, 0x0053441b, 0x00534422, 0x00534803, 0x00534847, 0x00535029,
+  0x0053542c, 0x0053580d, 0x00535832, 0x00535c33, 0x00536034, 0x00536436, 0x00536841, 0x00537024,
+  0x00537445, 0x00537c2c, 0x00538012, 0x00538033, 0x00538416, 0x00538409, 0x0053842c, 0x0053884e,
+  0x00539012, 0x00539033, 0x00539434, 0x0053981a, 0x00539825, 0x00539c29, 0x0053a00f, 0x0053a00d,
+  0x0053a036, 0x0053a401, 0x0053a429, 0x0053a808, 0x0053a80c, 0x0053a830, 0x0053ac14, 0x0053ac23,
+  0x0053b027, 0x0053b40d, 0x0053b410, 0x0053b413, 0x0053b423, 0x0053b804, 0x0053b852, 0x0053c029,
+  0x0053c415, 0x0053c401, 0x0053c403, 0x0053c424, 0x0053c84d, 0x0053d002, 0x0053d021, 0x0053d445,
+  0x0053dc09, 0x0053dc01, 0x0053dc03, 0x0053dc12, 0x0053dc14, 0x0053dc25, 0x0053e028, 0x0053e44f,
+  0x0053ec05, 0x0053ec32, 0x0053f013, 0x0053f014, 0x0053f009, 0x0053f001, 0x0053f02c, 0x0053f40f,
+  0x0053f415, 0x0053f422, 0x0053f805, 0x0053f830, 0x0053fc23, 0x00540004, 0x00540007, 0x00540029,
+  0x00540418, 0x00540404, 0x00540407, 0x0054040d, 0x0054044e, 0x00540c13, 0x00540c45, 0x00541409,
+  0x0054142f, 0x00541834, 0x00541c15, 0x00541c21, 0x00542029, 0x0054240f, 0x00542412, 0x00542403,
+  0x00542405, 0x00542469, 0x0054300f, 0x00543013, 0x00543034, 0x00543435, 0x00543828, 0x00543c29,
+  0x00544002, 0x00544012, 0x0054400e, 0x00544010, 0x00544032, 0x00544414, 0x0054440c, 0x00544413,
+  0x0054440d, 0x0054442f, 0x00544805, 0x00544819, 0x005448a3, 0x00545c44, 0x00546425, 0x00546826,
+  0x00546c27, 0x0054708c, 0x0054804d, 0x0054890e, 0x0054a870, 0x0054b492, 0x0054c4b3, 0x0054d8b4,
+  0x0054ec95, 0x0054fc56, 0x00550437, 0x005508c1, 0x00552105, 0x005540c9, 0x0055588c, 0x005568af,
+  0x00557c72, 0x005588f5, 0x0055a501, 0x0055c425, 0x0055c8a8, 0x0055dc69, 0x0055ea0f, 0x00562872,
+  0x00563475, 0x00564059, 0x0056483a, 0x00564c61, 0x00565905, 0x005678c9, 0x0056908f, 0x0056a072,
+  0x0056ac95, 0x0056bc59, 0x0056c441, 0x0056cc02, 0x0056cc23, 0x0056d025, 0x0056d407, 0x0056d449,
+  0x0056dc6c, 0x0056e8ae, 0x0056fc50, 0x00570431, 0x00570852, 0x00571033, 0x00571434, 0x00571855,
+  0x00572056, 0x00572878, 0x00573439, 0x00573841, 0x00574065, 0x00574c49, 0x0057548c, 0x0057642f,
+  0x00576872, 0x00577435, 0x00577881, 0x00578865, 0x00579428, 0x00579869, 0x0057a42e, 0x0057a84f,
+  0x0057b0b2, 0x0057c4e1, 0x0057e105, 0x00580069, 0x00580d2f, 0x00583035, 0x00583459, 0x00583c23,
+  0x00584084, 0x00585027, 0x0058542c, 0x0058586d, 0x0058652e, 0x00588832, 0x00588c53, 0x00589434,
+  0x00589881, 0x0058a825, 0x0058ac29, 0x0058b055, 0x0058b861, 0x0058c425, 0x0058c829, 0x0058cc2f,
+  0x0058d052, 0x0058d8a1, 0x0058ed05, 0x00590d09, 0x00592d0f, 0x00594c35, 0x00595121, 0x00597485,
+  0x005984c9, 0x00599c2e, 0x0059a0af, 0x0059b475, 0x0059c061, 0x0059cc85, 0x0059dca9, 0x0059f0ef,
+  0x005a0c55, 0x005a1442, 0x005a1c24, 0x005a2025, 0x005a2446, 0x005a2c2c, 0x005a302d, 0x005a342e,
+  0x005a3830, 0x005a3cb2, 0x005a5033, 0x005a5434, 0x005a5835, 0x005a5c36, 0x005a6038, 0x005a64c1,
+  0x005a7c85, 0x005a8c26, 0x005a9088, 0x005aa0c9, 0x005ab86c, 0x005ac4cf, 0x005adc72, 0x005ae853,
+  0x005af055, 0x005af859, 0x005b0055, 0x005b0901, 0x005b29a5, 0x005b5c28, 0x005b6089, 0x005b70cf,
+  0x005b8835, 0x005b8c39, 0x005b9081, 0x005ba0c3, 0x005bb925, 0x005bdc68, 0x005be869, 0x005bf44b,
+  0x005bfc2c, 0x005c002d, 0x005c042e, 0x005c084f, 0x005c10d0, 0x005c2831, 0x005c2cb4, 0x005c40b5,
+  0x005c5437, 0x005c5859, 0x005c60e1, 0x005c7d05, 0x005c9c68, 0x005ca869, 0x005cb50f, 0x005cd492,
+  0x005ce435, 0x005ce839, 0x005cec2b, 0x005cf12e, 0x005d1410, 0x005d1432, 0x005d1833, 0x005d1c41,
+  0x005d2445, 0x005d2ce9, 0x005d482f, 0x005d4c33, 0x005d50c1, 0x005d68a5, 0x005d7c48, 0x005d84c9,
+  0x005d9c4f, 0x005da452, 0x005dac36, 0x005db038, 0x005db425, 0x005db829, 0x005dbc45, 0x005dc40c,
+  0x005dc40e, 0x005dc432, 0x005dc801, 0x005dc834, 0x005dcc21, 0x005dd02c, 0x005dd42f, 0x005dd80c,
+  0x005dd852, 0x005de02f, 0x005de412, 0x005de425, 0x005de805, 0x005de80e, 0x005de80f, 0x005de82f,
+  0x005dec29, 0x005df00c, 0x005df00d, 0x005df029, 0x005df432, 0x005df801, 0x005df823, 0x005dfc25,
+  0x005e000f, 0x005e0014, 0x005e0015, 0x005e0005, 0x005e0017, 0x005e0021, 0x005e0415, 0x005e0403,
+  0x005e040d, 0x005e0429, 0x005e0802, 0x005e080e, 0x005e082c, 0x005e0c0f, 0x005e0c15, 0x005e0c07,
+  0x005e0c2e, 0x005e1025, 0x005e140c, 0x005e141b, 0x005e1419, 0x005e1429, 0x005e180f, 0x005e1825,
+  0x005e1c0e, 0x005e1c02, 0x005e1c04, 0x005e1c12, 0x005e1c09, 0x005e1c4e, 0x005e240f, 0x005e2421,
+  0x005e2805, 0x005e2825, 0x005e2c29, 0x005e3027, 0x005e3433, 0x005e3814, 0x005e381a, 0x005e381b,
+  0x005e3802, 0x005e3807, 0x005e3832, 0x005e3c33, 0x005e4054, 0x005e4832, 0x005e4c03, 0x005e4c06,
+  0x005e4c2c, 0x005e502e, 0x005e540e, 0x005e5432, 0x005e5825, 0x005e5c27, 0x005e602c, 0x005e6452,
+  0x005e6c34, 0x005e7025, 0x005e7429, 0x005e780c, 0x005e782f, 0x005e7c05, 0x005e7c0e, 0x005e7c33,
+  0x005e8015, 0x005e8029, 0x005e840c, 0x005e8403, 0x005e8425, 0x005e8806, 0x005e884d, 0x005e902e,
+  0x005e940f, 0x005e9410, 0x005e9433, 0x005e9814, 0x005e9815, 0x005e982c, 0x005e9c29, 0x005ea034,
+  0x005ea401, 0x005ea423, 0x005ea80e, 0x005ea830, 0x005eac14, 0x005eac35, 0x005eb021, 0x005eb429,
+  0x005eb80f, 0x005eb812, 0x005eb817, 0x005eb801, 0x005eb80c, 0x005eb812, 0x005eb812, 0x005eb814,
+  0x005eb832, 0x005ebc25, 0x005ec009, 0x005ec02c, 0x005ec40e, 0x005ec454, 0x005ecc03, 0x005ecc2c,
+  0x005ed032, 0x005ed433, 0x005ed825, 0x005edc05, 0x005edc23, 0x005ee044, 0x005ee80c, 0x005ee82d,
+  0x005eec2e, 0x005ef010, 0x005ef034, 0x005ef415, 0x005ef416, 0x005ef417, 0x005ef421, 0x005ef828,
+  0x005efc29, 0x005f0012, 0x005f0021, 0x005f0405, 0x005f042e, 0x005f0833, 0x005f0c09, 0x005f0c0c,
+  0x005f0c41, 0x005f1425, 0x005f180d, 0x005f182e, 0x005f1c0f, 0x005f1c1a, 0x005f1c09, 0x005f1c04,
+  0x005f1c2e, 0x005f200f, 0x005f2005, 0x005f2001, 0x005f2008, 0x005f2002, 0x005f202e, 0x005f2409,
+  0x005f2421, 0x005f2802, 0x005f2803, 0x005f2814, 0x005f2809, 0x005f2803, 0x005f2808, 0x005f2808,
+  0x005f2825, 0x005f2c12, 0x005f2c32, 0x005f3022, 0x005f3403, 0x005f342c, 0x005f3810, 0x005f3823,
+  0x005f3c27, 0x005f402e, 0x005f4452, 0x005f4c33, 0x005f5016, 0x005f5045, 0x005f582f, 0x005f5c01,
+  0x005f5c02, 0x005f5c03, 0x005f5c06, 0x005f5c2f, 0x005f6034, 0x005f641b, 0x005f6407, 0x005f642d,
+  0x005f6810, 0x005f6813, 0x005f682f, 0x005f6c0b, 0x005f6c21, 0x005f7005, 0x005f7008, 0x005f7001,
+  0x005f7005, 0x005f700c, 0x005f7032, 0x005f7408, 0x005f7415, 0x005f7404, 0x005f7429, 0x005f7825,
+  0x005f7c08, 0x005f7c07, 0x005f7c0e, 0x005f7c2e, 0x005f8072, 0x005f8c25, 0x005f9007, 0x005f9003,
+  0x005f9012, 0x005f9019, 0x005f9019, 0x005f9003, 0x005f9004, 0x005f900c, 0x005f9025, 0x005f9409,
+  0x005f9427, 0x005f9805, 0x005f9801, 0x005f9824, 0x005f9c05, 0x005f9c09, 0x005f9c22, 0x005fa029,
+  0x005fa433, 0x005fa812, 0x005fa82e, 0x005fac0b, 0x005fac14, 0x005fac01, 0x005fac05, 0x005fac09,
+  0x005fac09, 0x005fac15, 0x005fac09, 0x005fac0f, 0x005fac29, 0x005fb015, 0x005fb010, 0x005fb034,
+  0x005fb429, 0x005fb812, 0x005fb817, 0x005fb80f, 0x005fb80e, 0x005fb812, 0x005fb829, 0x005fbc21,
+  0x005fc004, 0x005fc025, 0x005fc427, 0x005fc815, 0x005fc829, 0x005fcc12, 0x005fcc35, 0x005fd01a,
+  0x005fd034, 0x005fd40e, 0x005fd433, 0x005fd81b, 0x005fd813, 0x005fd82e, 0x005fdc07, 0x005fdc09,
+  0x005fdc29, 0x005fe022, 0x005fe421, 0x005fe801, 0x005fe804, 0x005fe805, 0x005fe809, 0x005fe81b,
+  0x005fe801, 0x005fe808, 0x005fe80f, 0x005fe82e, 0x005fec14, 0x005fec34, 0x005ff012, 0x005ff026,
+  0x005ff401, 0x005ff409, 0x005ff409, 0x005ff434, 0x005ff805, 0x005ff829, 0x005ffc33, 0x00600014,
+  0x00600001, 0x00600029, 0x0060040f, 0x00600429, 0x0060080c, 0x00600808, 0x00600825, 0x00600c21,
+  0x0060104c, 0x0060180f, 0x00601804, 0x00601805, 0x00601869, 0x00602434, 0x00602819, 0x00602825,
+  0x00602c2f, 0x00603054, 0x00603819, 0x00603808, 0x00603829, 0x00603c21, 0x00604001, 0x00604001,
+  0x0060402d, 0x0060440e, 0x00604435, 0x00604825, 0x00604c1b, 0x00604c0c, 0x00604c1b, 0x00604c03,
+  0x00604c05, 0x00604c09, 0x00604c14, 0x00604c21, 0x00605001, 0x00605033, 0x00605414, 0x00605401,
+  0x00605402, 0x0060542e, 0x00605821, 0x00605c04, 0x00605c2c, 0x0060602d, 0x0060642e, 0x00606852,
+  0x0060704e, 0x0060780f, 0x00607814, 0x0060781a, 0x00607809, 0x00607802, 0x00607812, 0x00607812,
+  0x00607829, 0x00607c01, 0x00607c09, 0x00607c21, 0x00608025, 0x00608427, 0x0060880f, 0x0060880e,
+  0x00608805, 0x00608808, 0x00608829, 0x00608c54, 0x00609429, 0x00609852, 0x0060a00d, 0x0060a003,
+  0x0060a00d, 0x0060a007, 0x0060a012, 0x0060a02e, 0x0060a409, 0x0060a42f, 0x0060a825, 0x0060ac01,
+  0x0060ac05, 0x0060ac07, 0x0060ac14, 0x0060ac01, 0x0060ac29, 0x0060b00c, 0x0060b002, 0x0060b02f,
+  0x0060b405, 0x0060b405, 0x0060b401, 0x0060b405, 0x0060b409, 0x0060b433, 0x0060b854, 0x0060c021,
+  0x0060c404, 0x0060c434, 0x0060c816, 0x0060c806, 0x0060c80e, 0x0060c813, 0x0060c834, 0x0060cc50,
+  0x0060d433, 0x0060d804, 0x0060d802, 0x0060d84e, 0x0060e012, 0x0060e023, 0x0060e42d, 0x0060e812,
+  0x0060e834, 0x0060ec09, 0x0060ec54, 0x0060f401, 0x0060f405, 0x0060f409, 0x0060f409, 0x0060f419,
+  0x0060f421, 0x0060f829, 0x0060fc33, 0x00610049, 0x00610812, 0x00610808, 0x00610807, 0x00610804,
+  0x0061080b, 0x00610819, 0x00610829, 0x00610c0f, 0x00610c05, 0x00610c06, 0x00610c29, 0x0061102f,
+  0x00611421, 0x00611829, 0x00611c2f, 0x0061201b, 0x00612006, 0x00612049, 0x0061280f, 0x00612849,
+  0x0061304f, 0x0061381b, 0x00613821, 0x00613c0f, 0x00613c34, 0x00614015, 0x00614001, 0x00614009,
+  0x00614015, 0x00614008, 0x0061400d, 0x0061402e, 0x00614413, 0x00614403, 0x0061440f, 0x00614454,
+  0x00614c15, 0x00614c1b, 0x00614c0f, 0x00614c29, 0x00615014, 0x00615002, 0x00615021, 0x00615405,
+  0x00615414, 0x0061540e, 0x00615405, 0x00615421, 0x00615801, 0x00615825, 0x00615c29, 0x00616007,
+  0x0061600c, 0x00616005, 0x00616034, 0x00616409, 0x00616414, 0x00616409, 0x00616404, 0x00616453,
+  0x00616c1b, 0x00616c05, 0x00616c01, 0x00616c09, 0x00616c2f, 0x00617029, 0x00617421, 0x00617809,
+  0x00617804, 0x00617810, 0x00617814, 0x00617827, 0x00617c09, 0x00617c21, 0x0061800e, 0x00618002,
+  0x0061800c, 0x00618010, 0x00618017, 0x00618030, 0x00618401, 0x00618425, 0x00618854, 0x0061900c,
+  0x00619005, 0x00619022, 0x00619405, 0x00619405, 0x00619410, 0x00619414, 0x00619429, 0x00619825,
+  0x00619c25, 0x0061a02f, 0x0061a425, 0x0061a804, 0x0061a801, 0x0061a803, 0x0061a825, 0x0061ac49,
+  0x0061b40b, 0x0061b434, 0x0061b810, 0x0061b813, 0x0061b814, 0x0061b825, 0x0061bc28, 0x0061c029,
+  0x0061c415, 0x0061c425, 0x0061c809, 0x0061c80f, 0x0061c84c, 0x0061d00e, 0x0061d014, 0x0061d004,
+  0x0061d02e, 0x0061d401, 0x0061d433, 0x0061d802, 0x0061d846, 0x0061e00d, 0x0061e034, 0x0061e421,
+  0x0061e835, 0x0061ec0c, 0x0061ec4d, 0x0061f42e, 0x0061f852, 0x00620025, 0x00620421, 0x00620805,
+  0x0062082c, 0x00620c12, 0x00620c13, 0x00620c01, 0x00620c02, 0x00620c23, 0x0062100d, 0x00621014,
+  0x0062101a, 0x0062100c, 0x0062100e, 0x00621009, 0x0062102c, 0x00621409, 0x00621409, 0x00621419,
+  0x00621401, 0x00621414, 0x00621419, 0x00621432, 0x00621823, 0x00621c0c, 0x00621c4e, 0x00622414,
+  0x00622432, 0x00622833, 0x00622c0c, 0x00622c12, 0x00622c02, 0x00622c03, 0x00622c2e, 0x00623014,
+  0x00623013, 0x0062301b, 0x0062300c, 0x00623012, 0x00623012, 0x0062300c, 0x00623002, 0x00623006,
+  0x00623007, 0x00623033, 0x00623404, 0x00623405, 0x00623408, 0x00623419, 0x00623424, 0x0062380e,
+  0x00623801, 0x00623803, 0x0062382e, 0x00623c34, 0x00624017, 0x00624038, 0x0062441b, 0x00624401,
+  0x00624422, 0x00624803, 0x00624804, 0x00624827, 0x00624c0e, 0x00624c12, 0x00624c13, 0x00624c22,
+  0x00625043, 0x00625825, 0x00625c27, 0x0062600d, 0x0062602e, 0x0062640f, 0x00626433, 0x00626816,
+  0x00626821, 0x00626c0f, 0x00626c03, 0x00626c07, 0x00626c30, 0x00627008, 0x00627001, 0x00627004,
+  0x00627007, 0x00627003, 0x00627007, 0x0062702e, 0x0062740c, 0x00627414, 0x00627423, 0x00627805,
+  0x00627827, 0x00627c4e, 0x00628453, 0x00628c1a, 0x00628c29, 0x00629007, 0x0062902e, 0x00629409,
+  0x0062942c, 0x0062980e, 0x0062982d, 0x00629c2e, 0x0062a028, 0x0062a429, 0x0062a801, 0x0062a805,
+  0x0062a80d, 0x0062a832, 0x0062ac53, 0x0062b434, 0x0062b817, 0x0062b823, 0x0062bc05, 0x0062bc0c,
+  0x0062bc0f, 0x0062bc33, 0x0062c014, 0x0062c015, 0x0062c01a, 0x0062c007, 0x0062c013, 0x0062c016,
+  0x0062c017, 0x0062c021, 0x0062c428, 0x0062c801, 0x0062c806, 0x0062c81b, 0x0062c821, 0x0062cc05,
+  0x0062cc2f, 0x0062d00f, 0x0062d014, 0x0062d009, 0x0062d02e, 0x0062d40c, 0x0062d42e, 0x0062d834,
+  0x0062dc05, 0x0062dc09, 0x0062dc65, 0x0062e82f, 0x0062ec08, 0x0062ec29, 0x0062f034, 0x0062f449,
+  0x0062fc02, 0x0062fc2e, 0x00630012, 0x00630034, 0x0063040c, 0x00630428, 0x00630821, 0x00630c23,
+  0x00631029, 0x0063142c, 0x0063182d, 0x00631c8e, 0x00632c11, 0x00632c53, 0x00633414, 0x0063341b,
+  0x00633401, 0x00633423, 0x00633845, 0x0063402e, 0x0063440f, 0x00634414, 0x00634415, 0x00634436,
+  0x00634869, 0x0063540f, 0x00635402, 0x00635403, 0x00635412, 0x00635415, 0x00635425, 0x00635825,
+  0x00635c0c, 0x00635c17, 0x00635c14, 0x00635c21, 0x00636027, 0x00636421, 0x00636812, 0x00636815,
+  0x00636823, 0x00636c2e, 0x00637052, 0x00637801, 0x00637825, 0x00637c03, 0x00637c24, 0x00638027,
+  0x0063840d, 0x0063840e, 0x00638433, 0x00638815, 0x00638829, 0x00638c09, 0x00638c2c, 0x0063902e,
+  0x00639425, 0x00639829, 0x00639c32, 0x0063a029, 0x0063a421, 0x0063a849, 0x0063b02f, 0x0063b452,
+  0x0063bc32, 0x0063c002, 0x0063c02e, 0x0063c40f, 0x0063c42f, 0x0063c803, 0x0063c824, 0x0063cc2e,
+  0x0063d012, 0x0063d034, 0x0063d42e, 0x0063d801, 0x0063d805, 0x0063d849, 0x0063e04f, 0x0063e801,
+  0x0063e80d, 0x0063e80f, 0x0063e805, 0x0063e829, 0x0063ec12, 0x0063ec10, 0x0063ec33, 0x0063f001,
+  0x0063f04c, 0x0063f84e, 0x00640032, 0x00640404, 0x0064040c, 0x0064040e, 0x00640416, 0x00640403,
+  0x00640407, 0x00640405, 0x0064040c, 0x0064042e, 0x00640814, 0x0064081b, 0x0064080c, 0x00640812,
+  0x00640805, 0x0064080e, 0x0064082c, 0x00640c01, 0x00640c29, 0x00641034, 0x00641401, 0x00641428,
+  0x0064180f, 0x0064182c, 0x00641c13, 0x00641c34, 0x00642001, 0x00642014, 0x00642009, 0x0064200f,
+  0x00642024, 0x00642412, 0x00642413, 0x00642405, 0x0064242e, 0x00642813, 0x00642819, 0x00642861,
+  0x00643445, 0x00643c49, 0x00644413, 0x00644415, 0x0064441b, 0x00644425, 0x00644828, 0x00644c09,
+  0x00644c2c, 0x00645019, 0x00645001, 0x00645004, 0x00645005, 0x00645007, 0x0064500e, 0x00645034,
+  0x00645433, 0x0064580e, 0x00645832, 0x00645c24, 0x00646014, 0x00646041, 0x00646825, 0x00646c09,
+  0x00646c34, 0x00647014, 0x00647001, 0x00647033, 0x0064740c, 0x0064740c, 0x0064740c, 0x00647429,
+  0x00647805, 0x00647809, 0x00647809, 0x00647813, 0x00647801, 0x00647809, 0x0064780f, 0x0064781b,
+  0x00647825, 0x00647c0f, 0x00647c49, 0x0064840f, 0x0064840e, 0x00648413, 0x00648408, 0x00648429,
+  0x0064881a, 0x00648869, 0x00649419, 0x00649421, 0x00649829, 0x00649c0f, 0x00649c19, 0x00649c0d,
+  0x00649c19, 0x00649c09, 0x00649c08, 0x00649c0f, 0x00649c19, 0x00649c12, 0x00649c15, 0x00649c0e,
+  0x00649c35, 0x0064a00f, 0x0064a012, 0x0064a029, 0x0064a40f, 0x0064a40e, 0x0064a433, 0x0064a825,
+  0x0064ac27, 0x0064b013, 0x0064b01b, 0x0064b00c, 0x0064b00c, 0x0064b024, 0x0064b413, 0x0064b402,
+  0x0064b407, 0x0064b412, 0x0064b41b, 0x0064b434, 0x0064b80e, 0x0064b80f, 0x0064b80e, 0x0064b813,
+  0x0064b801, 0x0064b824, 0x0064bc09, 0x0064bc29, 0x0064c02f, 0x0064c41b, 0x0064c424, 0x0064c809,
+  0x0064c80e, 0x0064c830, 0x0064cc19, 0x0064cc0e, 0x0064cc33, 0x0064d014, 0x0064d006, 0x0064d005,
+  0x0064d032, 0x0064d414, 0x0064d401, 0x0064d40c, 0x0064d408, 0x0064d40d, 0x0064d414, 0x0064d415,
+  0x0064d421, 0x0064d843, 0x0064e024, 0x0064e447, 0x0064ec29, 0x0064f00b, 0x0064f034, 0x0064f40c,
+  0x0064f414, 0x0064f441, 0x0064fc24, 0x0065002c, 0x00650430, 0x00650834, 0x00650c13, 0x00650c0e,
+  0x00650c01, 0x00650c04, 0x00650c12, 0x00650c41, 0x0065140f, 0x00651409, 0x0065144c, 0x00651c0f,
+  0x00651c10, 0x00651c21, 0x00652012, 0x00652021, 0x00652422, 0x00652825, 0x00652c0e, 0x00652c2f,
+  0x00653019, 0x00653010, 0x00653025, 0x0065340e, 0x0065340f, 0x00653408, 0x00653425, 0x00653801,
+  0x0065382e, 0x00653c0c, 0x00653c0f, 0x00653c10, 0x00653c12, 0x00653c25, 0x00654013, 0x00654028,
+  0x0065440e, 0x00654432, 0x00654814, 0x00654829, 0x00654c13, 0x00654c05, 0x00654c21, 0x00655005,
+  0x00655001, 0x00655005, 0x00655001, 0x00655019, 0x00655004, 0x0065500e, 0x00655021, 0x00655429,
+  0x00655834, 0x00655c15, 0x00655c25, 0x00656010, 0x00656033, 0x00656425, 0x00656805, 0x0065682e,
+  0x00656c30, 0x00657012, 0x0065700e, 0x00657013, 0x00657029, 0x0065742b, 0x00657814, 0x00657814,
+  0x00657832, 0x00657c05, 0x00657c08, 0x00657c25, 0x00658003, 0x00658009, 0x00658014, 0x00658005,
+  0x00658013, 0x00658029, 0x00658432, 0x00658815, 0x00658852, 0x00659001, 0x0065900e, 0x00659054,
+  0x00659809, 0x00659809, 0x0065980e, 0x0065980d, 0x00659810, 0x00659852, 0x0065a013, 0x0065a019,
+  0x0065a015, 0x0065a00f, 0x0065a004, 0x0065a02e, 0x0065a430, 0x0065a819, 0x0065a803, 0x0065a801,
+  0x0065a819, 0x0065a805, 0x0065a835, 0x0065ac2c, 0x0065b00d, 0x0065b00f, 0x0065b012, 0x0065b009,
+  0x0065b02e, 0x0065b421, 0x0065b813, 0x0065b841, 0x0065c005, 0x0065c02f, 0x0065c414, 0x0065c415,
+  0x0065c405, 0x0065c40d, 0x0065c417, 0x0065c40f, 0x0065c405, 0x0065c401, 0x0065c404, 0x0065c401,
+  0x0065c405, 0x0065c40e, 0x0065c434, 0x0065c81b, 0x0065c803, 0x0065c814, 0x0065c832, 0x0065cc25,
+  0x0065d012, 0x0065d023, 0x0065d405, 0x0065d402, 0x0065d432, 0x0065d834, 0x0065dc02, 0x0065dc0c,
+  0x0065dc0e, 0x0065dc14, 0x0065dc12, 0x0065dc14, 0x0065dc05, 0x0065dc09, 0x0065dc12, 0x0065dc02,
+  0x0065dc24, 0x0065e00d, 0x0065e032, 0x0065e407, 0x0065e412, 0x0065e416, 0x0065e401, 0x0065e402,
+  0x0065e40f, 0x0065e433, 0x0065e814, 0x0065e81a, 0x0065e821, 0x0065ec11, 0x0065ec19, 0x0065ec12,
+  0x0065ec27, 0x0065f032, 0x0065f42e, 0x0065f814, 0x0065f824, 0x0065fc2c, 0x0066002e, 0x00660414,
+  0x00660409, 0x0066040e, 0x0066042c, 0x00660815, 0x00660816, 0x00660845, 0x0066102c, 0x00661405,
+  0x00661432, 0x00661833, 0x00661c01, 0x00661c25, 0x00662009, 0x0066202c, 0x0066240f, 0x00662415,
+  0x00662401, 0x0066240f, 0x00662413, 0x00662474, 0x0066301b, 0x00663003, 0x00663013, 0x00663014,
+  0x00663005, 0x00663035, 0x00663408, 0x0066341b, 0x00663413, 0x00663405, 0x00663412, 0x00663421,
+  0x00663825, 0x00663c09, 0x00663c08, 0x00663c09, 0x00663c08, 0x00663c09, 0x00663c0f, 0x00663c12,
+  0x00663c32, 0x00664003, 0x00664005, 0x0066400c, 0x00664001, 0x00664025, 0x00664449, 0x00664c02,
+  0x00664c03, 0x00664c05, 0x00664c24, 0x00665006, 0x0066500c, 0x00665013, 0x00665009, 0x00665024,
+  0x00665413, 0x00665434, 0x0066581a, 0x00665829, 0x00665c07, 0x00665c2e, 0x0066600c, 0x00666007,
+  0x00666012, 0x00666013, 0x00666008, 0x00666012, 0x00666021, 0x0066644f, 0x00666c02, 0x00666c04,
+  0x00666c13, 0x00666c34, 0x00667021, 0x00667413, 0x0066742d, 0x00667809, 0x00667819, 0x00667821,
+  0x00667c45, 0x00668421, 0x00668805, 0x00668809, 0x0066882c, 0x00668c32, 0x00669013, 0x00669022,
+  0x00669407, 0x0066940d, 0x0066940e, 0x00669414, 0x0066941b, 0x00669452, 0x00669c13, 0x00669c01,
+  0x00669c43, 0x0066a407, 0x0066a42c, 0x0066a80d, 0x0066a80f, 0x0066a833, 0x0066ac0d, 0x0066ac0e,
+  0x0066ac21, 0x0066b019, 0x0066b021, 0x0066b404, 0x0066b40c, 0x0066b41b, 0x0066b42c, 0x0066b82e,
+  0x0066bc52, 0x0066c42c, 0x0066c80f, 0x0066c814, 0x0066c852, 0x0066d014, 0x0066d012, 0x0066d02e,
+  0x0066d411, 0x0066d413, 0x0066d454, 0x0066dc07, 0x0066dc13, 0x0066dc09, 0x0066dc04, 0x0066dc34,
+  0x0066e019, 0x0066e00c, 0x0066e00f, 0x0066e024, 0x0066e425, 0x0066e807, 0x0066e81b, 0x0066e808,
+  0x0066e819, 0x0066e813, 0x0066e808, 0x0066e80e, 0x0066e829, 0x0066ec0f, 0x0066ec09, 0x0066ec05,
+  0x0066ec19, 0x0066ec0e, 0x0066ec0f, 0x0066ec24, 0x0066f025, 0x0066f434, 0x0066f807, 0x0066f809,
+  0x0066f805, 0x0066f821, 0x0066fc25, 0x00670029, 0x00670401, 0x0067040e, 0x00670452, 0x00670c13,
+  0x00670c09, 0x00670c09, 0x00670c14, 0x00670c07, 0x00670c1b, 0x00670c21, 0x00671003, 0x00671025,
+  0x00671414, 0x0067141b, 0x00671408, 0x00671412, 0x00671421, 0x00671805, 0x00671807, 0x00671809,
+  0x0067180f, 0x00671823, 0x00671c11, 0x00671c33, 0x00672001, 0x00672025, 0x00672405, 0x00672412,
+  0x00672413, 0x00672407, 0x0067240d, 0x00672432, 0x00672813, 0x00672834, 0x00672c09, 0x00672c29,
+  0x0067302f, 0x00673413, 0x00673434, 0x00673815, 0x00673819, 0x00673801, 0x00673825, 0x00673c09,
+  0x00673c25, 0x00674006, 0x0067400c, 0x00674021, 0x00674408, 0x00674432, 0x00674822, 0x00674c09,
+  0x00674c0f, 0x00674c10, 0x00674c01, 0x00674c25, 0x00675009, 0x0067502b, 0x00675407, 0x00675410,
+  0x00675429, 0x0067581b, 0x00675825, 0x00675c0c, 0x00675c14, 0x00675c17, 0x00675c01, 0x00675c03,
+  0x00675c07, 0x00675c0c, 0x00675c0e, 0x00675c14, 0x00675c2e, 0x00676031, 0x00676435, 0x00676817,
+  0x00676814, 0x0067682e, 0x00676c04, 0x00676c0e, 0x00676c21, 0x00677009, 0x00677029, 0x0067740f,
+  0x00677415, 0x00677425, 0x00677807, 0x00677829, 0x00677c04, 0x00677c25, 0x00678009, 0x0067800d,
+  0x00678021, 0x00678429, 0x0067882f, 0x00678c25, 0x0067902f, 0x00679414, 0x0067941b, 0x00679401,
+  0x0067942e, 0x00679814, 0x00679802, 0x00679801, 0x00679809, 0x0067982e, 0x00679c14, 0x00679c05,
+  0x00679c07, 0x00679c2e, 0x0067a00e, 0x0067a032, 0x0067a409, 0x0067a425, 0x0067a813, 0x0067a832,
+  0x0067ac12, 0x0067ac08, 0x0067ac09, 0x0067ac0e, 0x0067ac04, 0x0067ac01, 0x0067ac09, 0x0067ac4e,
+  0x0067b412, 0x0067b413, 0x0067b434, 0x0067b80e, 0x0067b814, 0x0067b805, 0x0067b80f, 0x0067b805,
+  0x0067b801, 0x0067b828, 0x0067bc0c, 0x0067bc29, 0x0067c00e, 0x0067c004, 0x0067c004, 0x0067c049,
+  0x0067c82c, 0x0067cc34, 0x0067d069, 0x0067dc49, 0x0067e42c, 0x0067e816, 0x0067e823, 0x0067ec05,
+  0x0067ec14, 0x0067ec05, 0x0067ec08, 0x0067ec49, 0x0067f414, 0x0067f40c, 0x0067f42e, 0x0067f816,
+  0x0067f849, 0x00680019, 0x0068001b, 0x0068002f, 0x00680414, 0x0068040f, 0x00680421, 0x00680824,
+  0x00680c05, 0x00680c09, 0x00680c33, 0x00681034, 0x0068140e, 0x00681433, 0x00681834, 0x00681c21,
+  0x00682005, 0x00682028, 0x00682452, 0x00682c01, 0x00682c07, 0x00682c49, 0x0068340c, 0x00683401,
+  0x00683404, 0x00683425, 0x00683827, 0x00683c14, 0x00683c15, 0x00683c14, 0x00683c25, 0x0068400c,
+  0x00684054, 0x00684808, 0x00684832, 0x00684c0e, 0x00684c32, 0x0068500f, 0x00685033, 0x00685425,
+  0x00685805, 0x00685825, 0x00685c27, 0x00686069, 0x00686c2f, 0x00687039, 0x00687421, 0x00687825,
+  0x00687c10, 0x00687c08, 0x00687c06, 0x00687c13, 0x00687c52, 0x00688414, 0x00688421, 0x00688801,
+  0x00688825, 0x00688c0e, 0x00688c12, 0x00688c13, 0x00688c32, 0x00689033, 0x00689435, 0x00689816,
+  0x00689812, 0x00689821, 0x00689c34, 0x0068a015, 0x0068a001, 0x0068a014, 0x0068a01b, 0x0068a025,
+  0x0068a429, 0x0068a814, 0x0068a829, 0x0068ac23, 0x0068b029, 0x0068b40b, 0x0068b403, 0x0068b405,
+  0x0068b409, 0x0068b40c, 0x0068b40d, 0x0068b403, 0x0068b434, 0x0068b821, 0x0068bc2f, 0x0068c033,
+  0x0068c414, 0x0068c405, 0x0068c412, 0x0068c433, 0x0068c801, 0x0068c825, 0x0068cc49, 0x0068d40e,
+  0x0068d414, 0x0068d435, 0x0068d809, 0x0068d80e, 0x0068d833, 0x0068dc02, 0x0068dc06, 0x0068dc14,
+  0x0068dc1a, 0x0068dc03, 0x0068dc12, 0x0068dc05, 0x0068dc12, 0x0068dc15, 0x0068dc0b, 0x0068dc21,
+  0x0068e005, 0x0068e001, 0x0068e029, 0x0068e409, 0x0068e40f, 0x0068e405, 0x0068e40f, 0x0068e441,
+  0x0068ec05, 0x0068ec09, 0x0068ec12, 0x0068ec10, 0x0068ec14, 0x0068ec17, 0x0068ec1b, 0x0068ec29,
+  0x0068f005, 0x0068f002, 0x0068f00c, 0x0068f02e, 0x0068f452, 0x0068fc01, 0x0068fc02, 0x0068fc0e,
+  0x0068fc14, 0x0068fc01, 0x0068fc16, 0x0068fc08, 0x0068fc0d, 0x0068fc02, 0x0068fc0e, 0x0068fc10,
+  0x0068fc01, 0x0068fc0c, 0x0068fc09, 0x0068fc12, 0x0068fc29, 0x00690012, 0x00690029, 0x00690425,
+  0x00690807, 0x00690834, 0x00690c1b, 0x00690c08, 0x00690c29, 0x0069102f, 0x00691412, 0x00691432,
+  0x00691814, 0x0069180e, 0x00691814, 0x00691821, 0x00691c16, 0x00691c2c, 0x0069200c, 0x00692005,
+  0x00692033, 0x00692409, 0x0069242f, 0x00692849, 0x0069300f, 0x00693019, 0x00693021, 0x00693429,
+  0x0069382f, 0x00693c41, 0x00694403, 0x00694405, 0x00694414, 0x00694401, 0x0069440e, 0x00694425,
+  0x0069480c, 0x00694825, 0x00694c02, 0x00694c34, 0x00695013, 0x00695004, 0x00695007, 0x00695003,
+  0x00695005, 0x00695009, 0x00695021, 0x00695402, 0x00695432, 0x00695802, 0x00695825, 0x00695c06,
+  0x00695c4e, 0x00696410, 0x0069642f, 0x0069682d, 0x00696c0e, 0x00696c26, 0x0069700e, 0x00697014,
+  0x00697005, 0x00697009, 0x00697012, 0x00697025, 0x00697404, 0x00697405, 0x00697434, 0x00697809,
+  0x00697802, 0x00697812, 0x0069780c, 0x0069782e, 0x00697c0c, 0x00697c25, 0x00698006, 0x0069800c,
+  0x00698021, 0x00698404, 0x00698441, 0x00698c05, 0x00698c29, 0x0069902f, 0x0069942c, 0x00699832,
+  0x00699c25, 0x0069a003, 0x0069a00f, 0x0069a012, 0x0069a023, 0x0069a407, 0x0069a401, 0x0069a454,
+  0x0069ac12, 0x0069ac54, 0x0069b42e, 0x0069b80f, 0x0069b812, 0x0069b805, 0x0069b813, 0x0069b814,
+  0x0069b819, 0x0069b829, 0x0069bc0f, 0x0069bc09, 0x0069bc0e, 0x0069bc02, 0x0069bc25, 0x0069c025,
+  0x0069c406, 0x0069c425, 0x0069c807, 0x0069c834, 0x0069cc0d, 0x0069cc2f, 0x0069d034, 0x0069d425,
+  0x0069d80e, 0x0069d805, 0x0069d80e, 0x0069d833, 0x0069dc05, 0x0069dc12, 0x0069dc33, 0x0069e014,
+  0x0069e009, 0x0069e001, 0x0069e023, 0x0069e424, 0x0069e806, 0x0069e80c, 0x0069e82e, 0x0069ec0f,
+  0x0069ec53, 0x0069f454, 0x0069fc16, 0x0069fc29, 0x006a0027, 0x006a0412, 0x006a040c, 0x006a0402,
+  0x006a042d, 0x006a080e, 0x006a0813, 0x006a0808, 0x006a080c, 0x006a0834, 0x006a0c05, 0x006a0c0c,
+  0x006a0c2e, 0x006a1032, 0x006a1434, 0x006a1801, 0x006a1843, 0x006a2004, 0x006a202e, 0x006a2425,
+  0x006a2827, 0x006a2c0e, 0x006a2c09, 0x006a2c32, 0x006a3003, 0x006a300e, 0x006a3029, 0x006a340f,
+  0x006a340e, 0x006a3433, 0x006a3815, 0x006a3803, 0x006a380f, 0x006a3813, 0x006a3815, 0x006a3825,
+  0x006a3c24, 0x006a402d, 0x006a4430, 0x006a4815, 0x006a4825, 0x006a4c29, 0x006a500d, 0x006a5001,
+  0x006a5005, 0x006a5009, 0x006a5009, 0x006a5004, 0x006a5014, 0x006a5004, 0x006a5032, 0x006a5421,
+  0x006a5825, 0x006a5c2e, 0x006a6014, 0x006a600e, 0x006a6033, 0x006a6407, 0x006a642c, 0x006a682e,
+  0x006a6c1b, 0x006a6c21, 0x006a7009, 0x006a7053, 0x006a7817, 0x006a7815, 0x006a7801, 0x006a7823,
+  0x006a7c0c, 0x006a7c0e, 0x006a7c0f, 0x006a7c34, 0x006a8015, 0x006a8009, 0x006a8005, 0x006a8006,
+  0x006a8035, 0x006a8405, 0x006a8408, 0x006a8425, 0x006a8814, 0x006a8848, 0x006a9019, 0x006a900d,
+  0x006a900c, 0x006a9005, 0x006a902f, 0x006a9412, 0x006a9405, 0x006a9474, 0x006aa015, 0x006aa001,
+  0x006aa00f, 0x006aa021, 0x006aa449, 0x006aac0e, 0x006aac2c, 0x006ab052, 0x006ab813, 0x006ab825,
+  0x006abc09, 0x006abc63, 0x006ac806, 0x006ac813, 0x006ac813, 0x006ac80c, 0x006ac828, 0x006acc14,
+  0x006acc23, 0x006ad004, 0x006ad00e, 0x006ad072, 0x006adc13, 0x006adc34, 0x006ae00c, 0x006ae025,
+  0x006ae40c, 0x006ae433, 0x006ae809, 0x006ae801, 0x006ae805, 0x006ae814, 0x006ae841, 0x006af00e,
+  0x006af001, 0x006af025, 0x006af434, 0x006af819, 0x006af815, 0x006af841, 0x006b0024, 0x006b0425,
+  0x006b0829, 0x006b0c25, 0x006b1048, 0x006b1832, 0x006b1c32, 0x006b2005, 0x006b2049, 0x006b2804,
+  0x006b2801, 0x006b2829, 0x006b2c21, 0x006b3003, 0x006b3034, 0x006b340e, 0x006b3461, 0x006b4029,
+  0x006b444d, 0x006b4c0e, 0x006b4c0f, 0x006b4c34, 0x006b5015, 0x006b5016, 0x006b5025, 0x006b5429,
+  0x006b5832, 0x006b5c2e, 0x006b6012, 0x006b6033, 0x006b6403, 0x006b6405, 0x006b642e, 0x006b6833,
+  0x006b6c1a, 0x006b6c02, 0x006b6c4e, 0x006b7412, 0x006b740e, 0x006b7429, 0x006b7819, 0x006b7801,
+  0x006b7805, 0x006b7809, 0x006b7803, 0x006b780e, 0x006b7832, 0x006b7c0f, 0x006b7c04, 0x006b7c0f,
+  0x006b7c1b, 0x006b7c0e, 0x006b7c28, 0x006b8015, 0x006b800e, 0x006b8033, 0x006b8401, 0x006b8425,
+  0x006b8807, 0x006b880e, 0x006b8809, 0x006b882d, 0x006b8c1b, 0x006b8c0d, 0x006b8c14, 0x006b8c2e,
+  0x006b9039, 0x006b9409, 0x006b9419, 0x006b9413, 0x006b9401, 0x006b940e, 0x006b9432, 0x006b9804,
+  0x006b980c, 0x006b980e, 0x006b9812, 0x006b9814, 0x006b9833, 0x006b9c39, 0x006ba043, 0x006ba825,
+  0x006bac26, 0x006bb02c, 0x006bb412, 0x006bb453, 0x006bbc34, 0x006bc016, 0x006bc005, 0x006bc02e,
+  0x006bc433, 0x006bc823, 0x006bcc26, 0x006bd00c, 0x006bd033, 0x006bd414, 0x006bd402, 0x006bd402,
+  0x006bd40d, 0x006bd412, 0x006bd403, 0x006bd412, 0x006bd425, 0x006bd812, 0x006bd854, 0x006be016,
+  0x006be012, 0x006be014, 0x006be01b, 0x006be009, 0x006be028, 0x006be40c, 0x006be426, 0x006be814,
+  0x006be80f, 0x006be825, 0x006bec09, 0x006bec25, 0x006bf027, 0x006bf409, 0x006bf40f, 0x006bf425,
+  0x006bf828, 0x006bfc03, 0x006bfc25, 0x006c0029, 0x006c0429, 0x006c0814, 0x006c0821, 0x006c0c25,
+  0x006c1029, 0x006c1402, 0x006c1407, 0x006c1406, 0x006c144e, 0x006c1c0e, 0x006c1c01, 0x006c1c25,
+  0x006c2002, 0x006c2014, 0x006c200d, 0x006c200c, 0x006c2001, 0x006c2025, 0x006c242e, 0x006c280c,
+  0x006c280e, 0x006c2832, 0x006c2c16, 0x006c2c17, 0x006c2c32, 0x006c304f, 0x006c3832, 0x006c3c05,
+  0x006c3c49, 0x006c4421, 0x006c4825, 0x006c4c09, 0x006c4c19, 0x006c4c29, 0x006c5014, 0x006c5009,
+  0x006c5015, 0x006c5054, 0x006c5829, 0x006c5c2f, 0x006c6015, 0x006c6009, 0x006c600f, 0x006c6015,
+  0x006c6030, 0x006c6433, 0x006c6854, 0x006c701b, 0x006c7025, 0x006c7429, 0x006c7832, 0x006c7c34,
+  0x006c8021, 0x006c8445, 0x006c8c29, 0x006c902f, 0x006c9408, 0x006c9412, 0x006c9414, 0x006c9403,
+  0x006c942e, 0x006c9813, 0x006c9814, 0x006c980e, 0x006c980c, 0x006c9802, 0x006c9807, 0x006c9801,
+  0x006c9821, 0x006c9c05, 0x006c9c49, 0x006ca40f, 0x006ca425, 0x006ca84e, 0x006cb012, 0x006cb014,
+  0x006cb021, 0x006cb409, 0x006cb429, 0x006cb821, 0x006cbc09, 0x006cbc0f, 0x006cbc30, 0x006cc021,
+  0x006cc404, 0x006cc405, 0x006cc407, 0x006cc428, 0x006cc82c, 0x006ccc03, 0x006ccc08, 0x006ccc10,
+  0x006ccc1b, 0x006ccc21, 0x006cd045, 0x006cd829, 0x006cdc35, 0x006ce045, 0x006ce809, 0x006ce814,
+  0x006ce805, 0x006ce829, 0x006cec04, 0x006cec07, 0x006cec33, 0x006cf003, 0x006cf00e, 0x006cf032,
+  0x006cf42e, 0x006cf80f, 0x006cf814, 0x006cf812, 0x006cf80c, 0x006cf812, 0x006cf814, 0x006cf819,
+  0x006cf803, 0x006cf813, 0x006cf814, 0x006cf816, 0x006cf815, 0x006cf80c, 0x006cf812, 0x006cf805,
+  0x006cf829, 0x006cfc25, 0x006d0025, 0x006d0425, 0x006d0809, 0x006d0810, 0x006d0821, 0x006d0c05,
+  0x006d0c29, 0x006d1034, 0x006d140d, 0x006d1414, 0x006d1425, 0x006d1829, 0x006d1c09, 0x006d1c0f,
+  0x006d1c30, 0x006d2013, 0x006d2028, 0x006d2419, 0x006d2401, 0x006d2425, 0x006d2801, 0x006d282e,
+  0x006d2c32, 0x006d3014, 0x006d302e, 0x006d3403, 0x006d3406, 0x006d340f, 0x006d3433, 0x006d380f,
+  0x006d3816, 0x006d380e, 0x006d3813, 0x006d3813, 0x006d3834, 0x006d3c23, 0x006d4032, 0x006d4413,
+  0x006d4416, 0x006d4401, 0x006d4402, 0x006d440e, 0x006d4423, 0x006d4807, 0x006d4802, 0x006d482e,
+  0x006d4c0f, 0x006d4c02, 0x006d4c04, 0x006d4c25, 0x006d5007, 0x006d506c, 0x006d5c33, 0x006d6016,
+  0x006d6009, 0x006d602f, 0x006d6408, 0x006d640c, 0x006d640e, 0x006d640c, 0x006d640e, 0x006d6430,
+  0x006d680b, 0x006d6834, 0x006d6c03, 0x006d6c29, 0x006d702c, 0x006d740e, 0x006d7432, 0x006d7833,
+  0x006d7c19, 0x006d7c03, 0x006d7c16, 0x006d7c27, 0x006d800b, 0x006d8032, 0x006d8414, 0x006d8421,
+  0x006d880d, 0x006d880f, 0x006d8814, 0x006d8803, 0x006d8824, 0x006d8c01, 0x006d8c29, 0x006d9015,
+  0x006d902f, 0x006d942e, 0x006d9810, 0x006d9816, 0x006d9804, 0x006d9809, 0x006d9813, 0x006d980f,
+  0x006d9805, 0x006d982e, 0x006d9c05, 0x006d9c09, 0x006d9c06, 0x006d9c30, 0x006da035, 0x006da413,
+  0x006da417, 0x006da40f, 0x006da414, 0x006da405, 0x006da40c, 0x006da412, 0x006da405, 0x006da406,
+  0x006da416, 0x006da405, 0x006da42f, 0x006da821, 0x006dac03, 0x006dac04, 0x006dac25, 0x006db007,
+  0x006db029, 0x006db454, 0x006dbc01, 0x006dbc0c, 0x006dbc0f, 0x006dbc36, 0x006dc01b, 0x006dc008,
+  0x006dc014, 0x006dc00d, 0x006dc025, 0x006dc409, 0x006dc412, 0x006dc416, 0x006dc40e, 0x006dc40f,
+  0x006dc410, 0x006dc416, 0x006dc42c, 0x006dc80e, 0x006dc832, 0x006dcc03, 0x006dcc45, 0x006dd429,
+  0x006dd82e, 0x006ddc05, 0x006ddc19, 0x006ddc01, 0x006ddc25, 0x006de007, 0x006de02e, 0x006de401,
+  0x006de429, 0x006de814, 0x006de84e, 0x006df014, 0x006df034, 0x006df42c, 0x006df80e, 0x006df80c,
+  0x006df80e, 0x006df834, 0x006dfc2c, 0x006e0005, 0x006e0014, 0x006e0021, 0x006e0404, 0x006e0429,
+  0x006e0816, 0x006e0801, 0x006e0807, 0x006e081b, 0x006e0848, 0x006e1003, 0x006e1004, 0x006e1009,
+  0x006e1009, 0x006e100e, 0x006e102e, 0x006e140f, 0x006e1412, 0x006e1425, 0x006e180f, 0x006e180c,
+  0x006e182e, 0x006e1c0f, 0x006e1c19, 0x006e1c0e, 0x006e1c12, 0x006e1c14, 0x006e1c21, 0x006e2013,
+  0x006e200c, 0x006e202e, 0x006e2433, 0x006e2814, 0x006e2825, 0x006e2c2c, 0x006e3009, 0x006e3025,
+  0x006e3432, 0x006e3807, 0x006e380c, 0x006e382d, 0x006e3c2e, 0x006e4010, 0x006e4034, 0x006e4404,
+  0x006e4452, 0x006e4c37, 0x006e5005, 0x006e5001, 0x006e5023, 0x006e5405, 0x006e5406, 0x006e542e,
+  0x006e5812, 0x006e581b, 0x006e5805, 0x006e5823, 0x006e5c2d, 0x006e602e, 0x006e6410, 0x006e6432,
+  0x006e6861, 0x006e7429, 0x006e7819, 0x006e780c, 0x006e7813, 0x006e7814, 0x006e7809, 0x006e780f,
+  0x006e7829, 0x006e7c2c, 0x006e802f, 0x006e8409, 0x006e840f, 0x006e842c, 0x006e8801, 0x006e8825,
+  0x006e8c09, 0x006e8c0b, 0x006e8c2c, 0x006e902f, 0x006e940f, 0x006e9424, 0x006e9834, 0x006e9c25,
+  0x006ea00c, 0x006ea001, 0x006ea003, 0x006ea005, 0x006ea029, 0x006ea405, 0x006ea419, 0x006ea429,
+  0x006ea835, 0x006eac0e, 0x006eac29, 0x006eb025, 0x006eb424, 0x006eb814, 0x006eb805, 0x006eb814,
+  0x006eb809, 0x006eb825, 0x006ebc09, 0x006ebc09, 0x006ebc13, 0x006ebc1b, 0x006ebc21, 0x006ec021,
+  0x006ec403, 0x006ec404, 0x006ec425, 0x006ec834, 0x006ecc05, 0x006ecc03, 0x006ecc04, 0x006ecc69,
+  0x006ed82e, 0x006edc16, 0x006edc33, 0x006ee01b, 0x006ee028, 0x006ee40e, 0x006ee441, 0x006eec29,
+  0x006ef014, 0x006ef043, 0x006ef80c, 0x006ef82e, 0x006efc44, 0x006f040f, 0x006f0432, 0x006f0802,
+  0x006f0834, 0x006f0c0b, 0x006f0c0f, 0x006f0c15, 0x006f0c09, 0x006f0c0e, 0x006f0c19, 0x006f0c15,
+  0x006f0c2c, 0x006f1010, 0x006f1035, 0x006f1401, 0x006f1425, 0x006f1809, 0x006f1803, 0x006f182e,
+  0x006f1c01, 0x006f1c05, 0x006f1c0d, 0x006f1c0f, 0x006f1c10, 0x006f1c34, 0x006f200c, 0x006f2001,
+  0x006f2001, 0x006f2025, 0x006f240e, 0x006f2404, 0x006f2433, 0x006f2834, 0x006f2c1b, 0x006f2c32,
+  0x006f300f, 0x006f3012, 0x006f3003, 0x006f3001, 0x006f3002, 0x006f3019, 0x006f3041, 0x006f380f,
+  0x006f3819, 0x006f3801, 0x006f3849, 0x006f4012, 0x006f4014, 0x006f4021, 0x006f4402, 0x006f4463,
+  0x006f5013, 0x006f5036, 0x006f5406, 0x006f542d, 0x006f5801, 0x006f5863, 0x006f640d, 0x006f6416,
+  0x006f642d, 0x006f684e, 0x006f7030, 0x006f7433, 0x006f7816, 0x006f7809, 0x006f7813, 0x006f7813,
+  0x006f7812, 0x006f7809, 0x006f7829, 0x006f7c1b, 0x006f7c05, 0x006f7c29, 0x006f800f, 0x006f8019,
+  0x006f8013, 0x006f8005, 0x006f8008, 0x006f8001, 0x006f8009, 0x006f8021, 0x006f8404, 0x006f8409,
+  0x006f8414, 0x006f840c, 0x006f8432, 0x006f882e, 0x006f8c25, 0x006f9002, 0x006f9014, 0x006f9005,
+  0x006f9012, 0x006f9033, 0x006f9416, 0x006f9403, 0x006f9445, 0x006f9c13, 0x006f9c14, 0x006f9c0e,
+  0x006f9c09, 0x006f9c05, 0x006f9c13, 0x006f9c34, 0x006fa029, 0x006fa425, 0x006fa80e, 0x006fa829,
+  0x006fac07, 0x006fac0d, 0x006fac01, 0x006fac25, 0x006fb002, 0x006fb034, 0x006fb428, 0x006fb825,
+  0x006fbc0e, 0x006fbc09, 0x006fbc01, 0x006fbc2e, 0x006fc033, 0x006fc421, 0x006fc849, 0x006fd025,
+  0x006fd409, 0x006fd432, 0x006fd815, 0x006fd80c, 0x006fd802, 0x006fd809, 0x006fd82c, 0x006fdc2e,
+  0x006fe032, 0x006fe414, 0x006fe412, 0x006fe40d, 0x006fe40e, 0x006fe433, 0x006fe816, 0x006fe817,
+  0x006fe821, 0x006fec45, 0x006ff413, 0x006ff432, 0x006ff801, 0x006ff82e, 0x006ffc2f, 0x00700029,
+  0x00700415, 0x00700407, 0x00700413, 0x0070041b, 0x00700405, 0x00700421, 0x00700825, 0x00700c12,
+  0x00700c26, 0x0070100e, 0x0070100f, 0x00701014, 0x0070101a, 0x00701029, 0x0070140f, 0x00701413,
+  0x00701405, 0x00701409, 0x00701425, 0x00701825, 0x00701c28, 0x00702029, 0x00702404, 0x0070240e,
+  0x00702410, 0x00702409, 0x00702401, 0x00702401, 0x00702403, 0x00702429, 0x0070280c, 0x00702825,
+  0x00702c12, 0x00702c12, 0x00702c02, 0x00702c14, 0x00702c0c, 0x00702c2e, 0x0070301b, 0x0070302c,
+  0x0070344e, 0x00703c2f, 0x00704013, 0x0070401a, 0x00704006, 0x00704007, 0x0070402d, 0x0070440e,
+  0x00704415, 0x00704429, 0x00704815, 0x00704805, 0x00704829, 0x00704c0f, 0x00704c15, 0x00704c0f,
+  0x00704c29, 0x00705009, 0x00705029, 0x0070542c, 0x0070580f, 0x00705819, 0x0070581b, 0x0070582f,
+  0x00705c35, 0x00706004, 0x00706085, 0x00707029, 0x0070742d, 0x00707833, 0x00707c34, 0x00708034,
+  0x0070841b, 0x00708425, 0x00708819, 0x0070882c, 0x00708c0e, 0x00708c85, 0x00709c09, 0x00709c0e,
+  0x00709c49, 0x0070a401, 0x0070a403, 0x0070a404, 0x0070a407, 0x0070a40c, 0x0070a412, 0x0070a415,
+  0x0070a40f, 0x0070a429, 0x0070a80f, 0x0070a815, 0x0070a809, 0x0070a812, 0x0070a819, 0x0070a801,
+  0x0070a805, 0x0070a814, 0x0070a816, 0x0070a809, 0x0070a821, 0x0070ac09, 0x0070ac19, 0x0070ac01,
+  0x0070ac25, 0x0070b00c, 0x0070b025, 0x0070b40f, 0x0070b414, 0x0070b41b, 0x0070b414, 0x0070b414,
+  0x0070b405, 0x0070b425, 0x0070b832, 0x0070bc34, 0x0070c00e, 0x0070c014, 0x0070c016, 0x0070c00c,
+  0x0070c014, 0x0070c02c, 0x0070c424, 0x0070c807, 0x0070c805, 0x0070c808, 0x0070c813, 0x0070c80e,
+  0x0070c825, 0x0070cc34, 0x0070d005, 0x0070d005, 0x0070d00f, 0x0070d035, 0x0070d409, 0x0070d40f,
+  0x0070d40c, 0x0070d409, 0x0070d405, 0x0070d429, 0x0070d82e, 0x0070dc23, 0x0070e004, 0x0070e012,
+  0x0070e005, 0x0070e00d, 0x0070e014, 0x0070e006, 0x0070e021, 0x0070e42f, 0x0070e801, 0x0070e828,
+  0x0070ec03, 0x0070ec25, 0x0070f013, 0x0070f004, 0x0070f012, 0x0070f003, 0x0070f001, 0x0070f00d,
+  0x0070f001, 0x0070f023, 0x0070f40f, 0x0070f413, 0x0070f401, 0x0070f412, 0x0070f429, 0x0070f803,
+  0x0070f80f, 0x0070f80c, 0x0070f821, 0x0070fc23, 0x00710008, 0x00710052, 0x00710835, 0x00710c64,
+  0x00711832, 0x00711c32, 0x00712034, 0x00712432, 0x00712825, 0x00712c47, 0x0071342c, 0x00713814,
+  0x00713821, 0x00713c30, 0x00714041, 0x00714803, 0x00714825, 0x00714c07, 0x00714c49, 0x0071542e,
+  0x0071582f, 0x00715c54, 0x00716425, 0x0071684f, 0x00717030, 0x00717443, 0x00717c2b, 0x00718013,
+  0x00718054, 0x00718803, 0x00718830, 0x00718c53, 0x00719454, 0x00719c59, 0x0071a428, 0x0071a82d,
+  0x0071ac2f, 0x0071b030, 0x0071b434, 0x0071b804, 0x0071b826, 0x0071bc33, 0x0071c034, 0x0071c409,
+  0x0071c42f, 0x0071c80e, 0x0071c823, 0x0071cc07, 0x0071cc6e, 0x0071d832, 0x0071dc33, 0x0071e034,
+  0x0071e421, 0x0071e822, 0x0071ec64, 0x0071f828, 0x0071fc2d, 0x00720032, 0x00720453, 0x00720c36,
+  0x00721042, 0x00721824, 0x00721c47, 0x0072242c, 0x0072286f, 0x00723434, 0x00723821, 0x00723c29,
+  0x0072402f, 0x00724435, 0x0072482c, 0x00724c4f, 0x00725432, 0x00725833, 0x00725c34, 0x00726009,
+  0x0072602f, 0x00726455, 0x00726c24, 0x00727026, 0x0072742e, 0x00727832, 0x00727c53, 0x00728434,
+  0x0072883a, 0x00728c43, 0x0072942c, 0x0072984d, 0x0072a02e, 0x0072a430, 0x0072a892, 0x0072b854,
+  0x0072c035, 0x0072c42c, 0x0072c861, 0x0072d445, 0x0072dc69, 0x0072e82c, 0x0072ec2f, 0x0072f027,
+  0x0072f42e, 0x0072f834, 0x0072fc21, 0x00730023, 0x00730424, 0x00730805, 0x00730827, 0x00730c28,
+  0x0073102b, 0x0073144c, 0x00731c2d, 0x0073208e, 0x00733030, 0x00733452, 0x00733c33, 0x00734034,
+  0x00734435, 0x00734837, 0x00734c21, 0x0073504f, 0x00735839, 0x00735c26, 0x0073602e, 0x00736433,
+  0x00736822, 0x00736c34, 0x00737025, 0x00737443, 0x00737c2d, 0x00738054, 0x00738821, 0x00738c23,
+  0x00739026, 0x0073944c, 0x00739c4d, 0x0073a40f, 0x0073a452, 0x0073ac33, 0x0073b021, 0x0073b443,
+  0x0073bc26, 0x0073c02a, 0x0073c432, 0x0073c853, 0x0073d02c, 0x0073d452, 0x0073dc14, 0x0073dc35,
+  0x0073e025, 0x0073e449, 0x0073ec4f, 0x0073f421, 0x0073f803, 0x0073f82d, 0x0073fc2f, 0x0074002e,
+  0x00740453, 0x00740c32, 0x00741053, 0x0074184f, 0x00742012, 0x00742027, 0x0074242a, 0x00742804,
+  0x00742845, 0x00743029, 0x00743421, 0x00743824, 0x00743c47, 0x00744413, 0x00744434, 0x00744829,
+  0x00744c33, 0x00745035, 0x00745427, 0x00745832, 0x00745c33, 0x00746048, 0x0074682c, 0x00746c33,
+  0x00747021, 0x00747425, 0x00747830, 0x00747c31, 0x00748034, 0x00748405, 0x00748423, 0x0074882c,
+  0x00748c22, 0x00749032, 0x00749433, 0x00749827, 0x00749c2e, 0x0074a041, 0x0074a825, 0x0074ac4f,
+  0x0074b435, 0x0074b872, 0x0074c425, 0x0074c849, 0x0074d02f, 0x0074d42e, 0x0074d82c, 0x0074dc33,
+  0x0074e035, 0x0074e43a, 0x0074e82e, 0x0074ecaf, 0x00750033, 0x0075042f, 0x00750801, 0x00750802,
+  0x00750827, 0x00750c2f, 0x00751012, 0x00751034, 0x00751441, 0x00751c25, 0x00752029, 0x0075244f,
+  0x00752c35, 0x00753024, 0x00753449, 0x00753c2c, 0x0075402d, 0x0075444e, 0x00754c52, 0x00755434,
+  0x00755829, 0x00755c4c, 0x0075644d, 0x00756c30, 0x00757052, 0x00757813, 0x00757814, 0x00757838,
+  0x00757c22, 0x00758025, 0x00758430, 0x00758845, 0x0075902b, 0x0075942c, 0x0075984d, 0x0075a04e,
+  0x0075a832, 0x0075ac34, 0x0075b035, 0x0075b416, 0x0075b422, 0x0075b824, 0x0075bc70, 0x0075c82f,
+  0x0075cc45, 0x0075d429, 0x0075d80c, 0x0075d82f, 0x0075dc4e, 0x0075e42c, 0x0075e821, 0x0075ec2d,
+  0x0075f050, 0x0075f823, 0x0075fc24, 0x00760005, 0x00760046, 0x0076080b, 0x00760830, 0x00760c33,
+  0x00761034, 0x00761435, 0x00761852, 0x00762009, 0x0076204f, 0x00762829, 0x00762c23, 0x0076302e,
+  0x00763430, 0x00763836, 0x00763c32, 0x00764033, 0x0076442e, 0x00764812, 0x00764824, 0x00764c2e,
+  0x00765032, 0x00765459, 0x00765c4c, 0x00766432, 0x00766829, 0x00766c2f, 0x00767043, 0x0076782d,
+  0x00767c4e, 0x00768432, 0x00768854, 0x00769021, 0x00769427, 0x00769829, 0x00769c0e, 0x00769c10,
+  0x00769c34, 0x0076a035, 0x0076a416, 0x0076a446, 0x0076ac47, 0x0076b42d, 0x0076b82e, 0x0076bc2f,
+  0x0076c030, 0x0076c431, 0x0076c834, 0x0076cc22, 0x0076d027, 0x0076d42a, 0x0076d82e, 0x0076dc2f,
+  0x0076e031, 0x0076e435, 0x0076e836, 0x0076ec23, 0x0076f063, 0x0076fc47, 0x0077042b, 0x0077084c,
+  0x0077108e, 0x00772072, 0x00772c33, 0x00773054, 0x00773838, 0x00773c24, 0x00774027, 0x00774432,
+  0x00774894, 0x00775823, 0x00775c24, 0x0077602c, 0x0077644d, 0x00776cae, 0x00778093, 0x00779025,
+  0x00779424, 0x0077982c, 0x00779c8e, 0x0077ac32, 0x0077b053, 0x0077b824, 0x0077bc2c, 0x0077c034,
+  0x0077c423, 0x0077c82d, 0x0077cc33, 0x0077d04f, 0x0077d830, 0x0077dc54, 0x0077e457, 0x0077ec03,
+  0x0077ec25, 0x0077f02a, 0x0077f42c, 0x0077f834, 0x0077fc24, 0x00780025, 0x007804ee, 0x0078202f,
+  0x00782432, 0x00782854, 0x00783036, 0x00783423, 0x00783834, 0x00783c2c, 0x00784033, 0x00784404,
+  0x00784432, 0x00784826, 0x00784c34, 0x00785029, 0x0078542e, 0x0078582f, 0x00785c45, 0x00786441,
+  0x00786c03, 0x00786c04, 0x00786c25, 0x00787034, 0x00787434, 0x00787808, 0x00787814, 0x00787825,
+  0x00787c29, 0x00788024, 0x00788427, 0x00788829, 0x00788c4c, 0x00789432, 0x00789834, 0x00789c24,
+  0x0078a025, 0x0078a44e, 0x0078ac74, 0x0078b821, 0x0078bc25, 0x0078c029, 0x0078c46f, 0x0078d034,
+  0x0078d423, 0x0078d805, 0x0078d82f, 0x0078dc30, 0x0078e032, 0x0078e414, 0x0078e461, 0x0078f025,
+  0x0078f435, 0x0078f829, 0x0078fc4c, 0x0079042d, 0x00790852, 0x00791033, 0x00791454, 0x00791d25,
+  0x00794029, 0x0079456f, 0x00797025, 0x00797439, 0x00797822, 0x00797c32, 0x0079802f, 0x00798434,
+  0x00798861, 0x00799429, 0x00799822, 0x00799c03, 0x00799c44, 0x0079a426, 0x0079a82d, 0x0079ac2e,
+  0x0079b054, 0x0079b856, 0x0079c041, 0x0079c863, 0x0079d444, 0x0079dc45, 0x0079e446, 0x0079ec49,
+  0x0079f42d, 0x0079f82e, 0x0079fc70, 0x007a0833, 0x007a0c34, 0x007a1035, 0x007a1457, 0x007a1c29,
+  0x007a2025, 0x007a2427, 0x007a282e, 0x007a2c34, 0x007a3022, 0x007a342f, 0x007a3811, 0x007a3833,
+  0x007a3c35, 0x007a4037, 0x007a4404, 0x007a4424, 0x007a488c, 0x007a5832, 0x007a5c34, 0x007a6035,
+  0x007a6421, 0x007a6825, 0x007a6cc8, 0x007a8429, 0x007a8832, 0x007a8c39, 0x007a9023, 0x007a944c,
+  0x007a9c6d, 0x007aa80e, 0x007aa830, 0x007aac92, 0x007abc33, 0x007ac034, 0x007ac436, 0x007ac821,
+  0x007acc8f, 0x007adc35, 0x007ae024, 0x007ae427, 0x007ae82e, 0x007aec2f, 0x007af039, 0x007af42e,
+  0x007af82f, 0x007afc2f, 0x007b004c, 0x007b0836, 0x007b0c21, 0x007b1065, 0x007b1c48, 0x007b2449,
+  0x007b2c4f, 0x007b3432, 0x007b3835, 0x007b3c81, 0x007b4c65, 0x007b584f, 0x007b6092, 0x007b7055,
+  0x007b78a2, 0x007b8c2d, 0x007b9050, 0x007b9852, 0x007ba033, 0x007ba429, 0x007ba82d, 0x007bac2e,
+  0x007bb022, 0x007bb426, 0x007bb82b, 0x007bbc2c, 0x007bc030, 0x007bc432, 0x007bc835, 0x007bcc23,
+  0x007bd04c, 0x007bd82d, 0x007bdc6e, 0x007be832, 0x007bec33, 0x007bf034, 0x007bf438, 0x007bf821,
+  0x007bfc25, 0x007c0029, 0x007c040c, 0x007c044d, 0x007c0c4e, 0x007c142c, 0x007c182d, 0x007c1c2e,
+  0x007c202f, 0x007c2450, 0x007c2c31, 0x007c3035, 0x007c3439, 0x007c3861, 0x007c4425, 0x007c4869,
+  0x007c542f, 0x007c5852, 0x007c6050, 0x007c6832, 0x007c6c21, 0x007c7023, 0x007c7424, 0x007c7825,
+  0x007c7c26, 0x007c8029, 0x007c840b, 0x007c840f, 0x007c8415, 0x007c8405, 0x007c8401, 0x007c8427,
+  0x007c8835, 0x007c8c2e, 0x007c9072, 0x007c9c23, 0x007ca024, 0x007ca425, 0x007ca849, 0x007cb02c,
+  0x007cb433, 0x007cb836, 0x007cbc29, 0x007cc030, 0x007cc424, 0x007cc828, 0x007ccc2c, 0x007cd032,
+  0x007cd433, 0x007cd836, 0x007cdc21, 0x007ce022, 0x007ce425, 0x007ce849, 0x007cf072, 0x007cfc25,
+  0x007d0049, 0x007d0824, 0x007d0c4c, 0x007d144e, 0x007d1c32, 0x007d2033, 0x007d2434, 0x007d282c,
+  0x007d2c52, 0x007d3421, 0x007d3825, 0x007d3c29, 0x007d4029, 0x007d4433, 0x007d482e, 0x007d4c21,
+  0x007d5029, 0x007d5404, 0x007d5421, 0x007d5814, 0x007d5829, 0x007d5c07, 0x007d5c04, 0x007d5c0f,
+  0x007d5c15, 0x007d5c14, 0x007d5c02, 0x007d5c06, 0x007d5c0e, 0x007d5c1b, 0x007d5c01, 0x007d5c12,
+  0x007d5c0e, 0x007d5c05, 0x007d5c0c, 0x007d5c09, 0x007d5c12, 0x007d5c0e, 0x007d5c0e, 0x007d5c04,
+  0x007d5c34, 0x007d601b, 0x007d6016, 0x007d6003, 0x007d601b, 0x007d6014, 0x007d6001, 0x007d6003,
+  0x007d6029, 0x007d640f, 0x007d6401, 0x007d6419, 0x007d640f, 0x007d6409, 0x007d640e, 0x007d6405,
+  0x007d6419, 0x007d6403, 0x007d6409, 0x007d6409, 0x007d6413, 0x007d6413, 0x007d6417, 0x007d6434,
+  0x007d6805, 0x007d6813, 0x007d6805, 0x007d6809, 0x007d6805, 0x007d6808, 0x007d6809, 0x007d681a,
+  0x007d6808, 0x007d680f, 0x007d680f, 0x007d6812, 0x007d680c, 0x007d6805, 0x007d680f, 0x007d6812,
+  0x007d682c, 0x007d6c01, 0x007d6c15, 0x007d6c01, 0x007d6c09, 0x007d6c14, 0x007d6c13, 0x007d6c14,
+  0x007d6c05, 0x007d6c29, 0x007d7025, 0x007d7407, 0x007d7449, 0x007d7c0c, 0x007d7c21, 0x007d802e,
+  0x007d8413, 0x007d8414, 0x007d8413, 0x007d840c, 0x007d840e, 0x007d8414, 0x007d8421, 0x007d8809,
+  0x007d8814, 0x007d881b, 0x007d880e, 0x007d8801, 0x007d880c, 0x007d880f, 0x007d8808, 0x007d880f,
+  0x007d881b, 0x007d8801, 0x007d882e, 0x007d8c14, 0x007d8c0d, 0x007d8c0e, 0x007d8c0d, 0x007d8c2e,
+  0x007d9015, 0x007d9029, 0x007d9410, 0x007d9407, 0x007d9401, 0x007d9402, 0x007d940e, 0x007d940f,
+  0x007d9401, 0x007d940e, 0x007d9419, 0x007d9412, 0x007d9412, 0x007d9425, 0x007d9821, 0x007d9c09,
+  0x007d9c01, 0x007d9c09, 0x007d9c01, 0x007d9c07, 0x007d9c12, 0x007d9c1a, 0x007d9c1a, 0x007d9c12,
+  0x007d9c14, 0x007d9c12, 0x007d9c0f, 0x007d9c01, 0x007d9c08, 0x007d9c10, 0x007d9c14, 0x007d9c03,
+  0x007d9c09, 0x007d9c14, 0x007d9c04, 0x007d9c08, 0x007d9c25, 0x007da009, 0x007da005, 0x007da005,
+  0x007da00f, 0x007da00e, 0x007da00e, 0x007da014, 0x007da001, 0x007da029, 0x007da403, 0x007da413,
+  0x007da41a, 0x007da419, 0x007da412, 0x007da40d, 0x007da425, 0x007da829, 0x007dac16, 0x007dac0c,
+  0x007dac30, 0x007db014, 0x007db00e, 0x007db00d, 0x007db029, 0x007db449, 0x007dbc10, 0x007dbc0f,
+  0x007dbc09, 0x007dbc05, 0x007dbc13, 0x007dbc1b, 0x007dbc45, 0x007dc409, 0x007dc423, 0x007dc814,
+  0x007dc80d, 0x007dc81b, 0x007dc803, 0x007dc801, 0x007dc809, 0x007dc81a, 0x007dc821, 0x007dcc05,
+  0x007dcc03, 0x007dcc12, 0x007dcc12, 0x007dcc03, 0x007dcc0e, 0x007dcc14, 0x007dcc29, 0x007dd01b,
+  0x007dd014, 0x007dd001, 0x007dd009, 0x007dd00c, 0x007dd00f, 0x007dd005, 0x007dd007, 0x007dd014,
+  0x007dd015, 0x007dd009, 0x007dd019, 0x007dd029, 0x007dd415, 0x007dd402, 0x007dd401, 0x007dd409,
+  0x007dd405, 0x007dd416, 0x007dd416, 0x007dd414, 0x007dd40e, 0x007dd40e, 0x007dd40c, 0x007dd40d,
+  0x007dd405, 0x007dd411, 0x007dd423, 0x007dd80c, 0x007dd82e, 0x007ddc12, 0x007ddc12, 0x007ddc29,
+  0x007de029, 0x007de409, 0x007de412, 0x007de40c, 0x007de40d, 0x007de434, 0x007de81b, 0x007de81a,
+  0x007de809, 0x007de813, 0x007de81b, 0x007de812, 0x007de81a, 0x007de814, 0x007de82f, 0x007dec12,
+  0x007dec2c, 0x007df012, 0x007df013, 0x007df01b, 0x007df005, 0x007df005, 0x007df012, 0x007df012,
+  0x007df015, 0x007df012, 0x007df013, 0x007df003, 0x007df00c, 0x007df005, 0x007df00e, 0x007df009,
+  0x007df006, 0x007df00e, 0x007df013, 0x007df01b, 0x007df003, 0x007df033, 0x007df449, 0x007dfc19,
+  0x007dfc05, 0x007dfc0d, 0x007dfc13, 0x007dfc0d, 0x007dfc30, 0x007e0003, 0x007e0001, 0x007e000f,
+  0x007e000d, 0x007e000e, 0x007e0001, 0x007e0001, 0x007e000f, 0x007e0005, 0x007e0009, 0x007e0005,
+  0x007e0029, 0x007e0425, 0x007e0825, 0x007e0c07, 0x007e0c14, 0x007e0c09, 0x007e0c04, 0x007e0c29,
+  0x007e1001, 0x007e1032, 0x007e1401, 0x007e1405, 0x007e1401, 0x007e141b, 0x007e1412, 0x007e1429,
+  0x007e1807, 0x007e1808, 0x007e1802, 0x007e181b, 0x007e1801, 0x007e1801, 0x007e1832, 0x007e1c05,
+  0x007e1c09, 0x007e1c08, 0x007e1c13, 0x007e1c1a, 0x007e1c29, 0x007e2001, 0x007e200f, 0x007e2014,
+  0x007e2025, 0x007e2403, 0x007e240f, 0x007e2409, 0x007e2414, 0x007e2412, 0x007e2413, 0x007e2408,
+  0x007e2427, 0x007e2825, 0x007e2c12, 0x007e2c0c, 0x007e2c03, 0x007e2c14, 0x007e2c29, 0x007e3023,
+  0x007e3404, 0x007e3408, 0x007e3402, 0x007e3402, 0x007e3401, 0x007e340c, 0x007e3413, 0x007e3404,
+  0x007e3429, 0x007e3805, 0x007e380c, 0x007e380f, 0x007e380e, 0x007e381b, 0x007e380f, 0x007e3801,
+  0x007e3823, 0x007e3c05, 0x007e3c14, 0x007e3c13, 0x007e3c14, 0x007e3c0b, 0x007e3c0e, 0x007e3c12,
+  0x007e3c05, 0x007e3c01, 0x007e3c13, 0x007e3c14, 0x007e3c1a, 0x007e3c14, 0x007e3c12, 0x007e3c15,
+  0x007e3c45, 0x007e440e, 0x007e4412, 0x007e4403, 0x007e4454, 0x007e4c36, 0x007e500e, 0x007e5025,
+  0x007e542e, 0x007e5834, 0x007e5c0e, 0x007e5c15, 0x007e5c01, 0x007e5c12, 0x007e5c32, 0x007e6005,
+  0x007e6002, 0x007e600e, 0x007e6007, 0x007e600d, 0x007e600e, 0x007e600f, 0x007e6035, 0x007e6412,
+  0x007e6404, 0x007e6404, 0x007e6405, 0x007e640f, 0x007e6449, 0x007e6c01, 0x007e6c03, 0x007e6c06,
+  0x007e6c07, 0x007e6c13, 0x007e6c0c, 0x007e6c14, 0x007e6c0c, 0x007e6c0f, 0x007e6c07, 0x007e6c09,
+  0x007e6c02, 0x007e6c07, 0x007e6c05, 0x007e6c13, 0x007e6c08, 0x007e6c05, 0x007e6c14, 0x007e6c08,
+  0x007e6c05, 0x007e6c1b, 0x007e6c0c, 0x007e6c0e, 0x007e6c34, 0x007e700e, 0x007e7012, 0x007e7001,
+  0x007e7005, 0x007e700c, 0x007e7014, 0x007e7029, 0x007e7409, 0x007e7413, 0x007e7405, 0x007e7405,
+  0x007e7414, 0x007e7419, 0x007e7414, 0x007e7401, 0x007e7403, 0x007e740e, 0x007e7414, 0x007e7413,
+  0x007e743a, 0x007e7816, 0x007e780e, 0x007e7813, 0x007e781a, 0x007e7814, 0x007e781a, 0x007e7814,
+  0x007e7801, 0x007e781b, 0x007e780e, 0x007e7805, 0x007e7809, 0x007e7814, 0x007e780f, 0x007e781a,
+  0x007e7815, 0x007e7801, 0x007e7888, 0x007e8833, 0x007e8c04, 0x007e8c0d, 0x007e8c09, 0x007e8c19,
+  0x007e8c1b, 0x007e8c25, 0x007e900f, 0x007e901a, 0x007e9005, 0x007e900e, 0x007e9013, 0x007e9005,
+  0x007e9005, 0x007e9025, 0x007e9425, 0x007e980e, 0x007e9814, 0x007e9829, 0x007e9c19, 0x007e9c14,
+  0x007e9c10, 0x007e9c01, 0x007e9c01, 0x007e9c15, 0x007e9c04, 0x007e9c12, 0x007e9c05, 0x007e9c0c,
+  0x007e9c25, 0x007ea009, 0x007ea01a, 0x007ea012, 0x007ea014, 0x007ea013, 0x007ea005, 0x007ea00e,
+  0x007ea005, 0x007ea00c, 0x007ea029, 0x007ea40f, 0x007ea40e, 0x007ea405, 0x007ea414, 0x007ea434,
+  0x007ea816, 0x007ea829, 0x007eac01, 0x007eac14, 0x007eac05, 0x007eac1b, 0x007eac01, 0x007eac1b,
+  0x007eac01, 0x007eac01, 0x007eac01, 0x007eac01, 0x007eac03, 0x007eac0c, 0x007eac0e, 0x007eac12,
+  0x007eac15, 0x007eac09, 0x007eac0f, 0x007eac0e, 0x007eac1b, 0x007eac01, 0x007eac09, 0x007eac05,
+  0x007eac01, 0x007eac14, 0x007eac02, 0x007eac05, 0x007eac19, 0x007eac34, 0x007eb001, 0x007eb005,
+  0x007eb009, 0x007eb001, 0x007eb00c, 0x007eb012, 0x007eb029, 0x007eb421, 0x007eb813, 0x007eb80e,
+  0x007eb829, 0x007ebc25, 0x007ec029, 0x007ec419, 0x007ec432, 0x007ec814, 0x007ec832, 0x007ecc21,
+  0x007ed006, 0x007ed004, 0x007ed014, 0x007ed005, 0x007ed005, 0x007ed015, 0x007ed00e, 0x007ed01b,
+  0x007ed00e, 0x007ed00e, 0x007ed010, 0x007ed029, 0x007ed40e, 0x007ed425, 0x007ed80c, 0x007ed80e,
+  0x007ed813, 0x007ed81b, 0x007ed819, 0x007ed821, 0x007edc09, 0x007edc01, 0x007edc09, 0x007edc01,
+  0x007edc0b, 0x007edc0c, 0x007edc0d, 0x007edc0d, 0x007edc14, 0x007edc0c, 0x007edc1b, 0x007edc33,
+  0x007ee01b, 0x007ee01b, 0x007ee005, 0x007ee00f, 0x007ee014, 0x007ee029, 0x007ee419, 0x007ee41b,
+  0x007ee405, 0x007ee433, 0x007ee803, 0x007ee80c, 0x007ee814, 0x007ee805, 0x007ee80e, 0x007ee82c,
+  0x007eec16, 0x007eec05, 0x007eec09, 0x007eec34, 0x007ef01b, 0x007ef002, 0x007ef00f, 0x007ef01b,
+  0x007ef072, 0x007efc29, 0x007f000f, 0x007f000f, 0x007f0012, 0x007f001b, 0x007f0012, 0x007f0012,
+  0x007f0034, 0x007f0401, 0x007f040c, 0x007f0401, 0x007f0425, 0x007f0843, 0x007f1012, 0x007f1001,
+  0x007f1035, 0x007f1414, 0x007f1407, 0x007f140c, 0x007f1403, 0x007f1412, 0x007f141a, 0x007f141b,
+  0x007f1434, 0x007f1805, 0x007f1815, 0x007f1814, 0x007f1830, 0x007f1c04, 0x007f1c07, 0x007f1c05,
+  0x007f1c01, 0x007f1c33, 0x007f2001, 0x007f2029, 0x007f241b, 0x007f2405, 0x007f2429, 0x007f280e,
+  0x007f2807, 0x007f280e, 0x007f2809, 0x007f2819, 0x007f2801, 0x007f2813, 0x007f281a, 0x007f282e,
+  0x007f2c1a, 0x007f2c19, 0x007f2c05, 0x007f2c13, 0x007f2c3a, 0x007f3007, 0x007f3001, 0x007f3005,
+  0x007f300e, 0x007f3003, 0x007f3005, 0x007f3015, 0x007f3005, 0x007f3001, 0x007f3009, 0x007f300c,
+  0x007f3009, 0x007f3049, 0x007f3819, 0x007f3801, 0x007f3805, 0x007f3805, 0x007f384c, 0x007f4032,
+  0x007f4409, 0x007f4432, 0x007f4819, 0x007f4821, 0x007f4c05, 0x007f4c33, 0x007f5014, 0x007f5005,
+  0x007f5001, 0x007f5053, 0x007f581a, 0x007f580c, 0x007f581b, 0x007f581b, 0x007f5819, 0x007f5821,
+  0x007f5c09, 0x007f5c13, 0x007f5c13, 0x007f5c09, 0x007f5c29, 0x007f6013, 0x007f6012, 0x007f6009,
+  0x007f6032, 0x007f6401, 0x007f6414, 0x007f6409, 0x007f6414, 0x007f6409, 0x007f640c, 0x007f642d,
+  0x007f6805, 0x007f681b, 0x007f680f, 0x007f680c, 0x007f6813, 0x007f6832, 0x007f6c34, 0x007f7034,
+  0x007f741a, 0x007f7402, 0x007f7412, 0x007f7403, 0x007f7405, 0x007f7405, 0x007f7409, 0x007f7423,
+  0x007f781a, 0x007f781b, 0x007f7801, 0x007f780f, 0x007f7812, 0x007f780f, 0x007f780c, 0x007f7805,
+  0x007f7809, 0x007f7827, 0x007f7c03, 0x007f7c1a, 0x007f7c07, 0x007f7c1a, 0x007f7c2c, 0x007f8002,
+  0x007f8032, 0x007f840c, 0x007f8403, 0x007f8409, 0x007f8422, 0x007f8813, 0x007f8812, 0x007f8805,
+  0x007f8807, 0x007f882c, 0x007f8c05, 0x007f8c05, 0x007f8c13, 0x007f8c05, 0x007f8c07, 0x007f8c14,
+  0x007f8c0d, 0x007f8c03, 0x007f8c34, 0x007f9014, 0x007f9032, 0x007f9401, 0x007f9405, 0x007f9404,
+  0x007f9454, 0x007f9c05, 0x007f9c14, 0x007f9c29, 0x007fa00f, 0x007fa005, 0x007fa01a, 0x007fa013,
+  0x007fa012, 0x007fa014, 0x007fa025, 0x007fa40e, 0x007fa425, 0x007fa812, 0x007fa813, 0x007fa803,
+  0x007fa805, 0x007fa81b, 0x007fa807, 0x007fa808, 0x007fa81b, 0x007fa805, 0x007fa829, 0x007fac05,
+  0x007fac29, 0x007fb005, 0x007fb029, 0x007fb401, 0x007fb433, 0x007fb832, 0x007fbc01, 0x007fbc1b,
+  0x007fbc09, 0x007fbc2e, 0x007fc005, 0x007fc00f, 0x007fc00c, 0x007fc014, 0x007fc019, 0x007fc009,
+  0x007fc019, 0x007fc029, 0x007fc40e, 0x007fc406, 0x007fc421, 0x007fc80e, 0x007fc812, 0x007fc807,
+  0x007fc809, 0x007fc829, 0x007fcc27, 0x007fd00c, 0x007fd008, 0x007fd034, 0x007fd401, 0x007fd419,
+  0x007fd407, 0x007fd40e, 0x007fd409, 0x007fd419, 0x007fd430, 0x007fd829, 0x007fdc0f, 0x007fdc19,
+  0x007fdc34, 0x007fe00c, 0x007fe014, 0x007fe025, 0x007fe413, 0x007fe41b, 0x007fe433, 0x007fe801,
+  0x007fe805, 0x007fe81b, 0x007fe809, 0x007fe825, 0x007fec2e, 0x007ff013, 0x007ff014, 0x007ff009,
+  0x007ff012, 0x007ff014, 0x007ff00e, 0x007ff014, 0x007ff00c, 0x007ff019, 0x007ff022, 0x007ff427,
+  0x007ff809, 0x007ff80c, 0x007ff813, 0x007ff812, 0x007ff829, 0x007ffc19, 0x007ffc29, 0x0080000c,
+  0x00800001, 0x00800003, 0x00800005, 0x0080000e, 0x00800008, 0x00800022, 0x00800407, 0x0080041b,
+  0x00800433, 0x00800821, 0x00800c05, 0x00800c09, 0x00800c0e, 0x00800c1a, 0x00800c09, 0x00800c0f,
+  0x00800c1b, 0x00800c07, 0x00800c34, 0x00801005, 0x00801009, 0x00801005, 0x00801021, 0x00801401,
+  0x00801414, 0x00801412, 0x00801402, 0x00801414, 0x00801414, 0x00801401, 0x00801429, 0x00801805,
+  0x00801809, 0x0080180f, 0x0080180d, 0x00801821, 0x00801c01, 0x00801c05, 0x00801c13, 0x00801c25,
+  0x00802014, 0x0080200f, 0x00802001, 0x00802029, 0x00802405, 0x00802412, 0x00802425, 0x00802829,
+  0x00802c05, 0x00802c09, 0x00802c14, 0x00802c0f, 0x00802c05, 0x00802c12, 0x00802c19, 0x00802c06,
+  0x00802c0c, 0x00802c2f, 0x00803009, 0x0080300c, 0x00803005, 0x00803005, 0x00803027, 0x00803412,
+  0x00803412, 0x00803407, 0x00803412, 0x00803421, 0x0080382c, 0x00803c2d, 0x00804005, 0x00804013,
+  0x00804014, 0x00804003, 0x00804032, 0x00804413, 0x00804401, 0x00804405, 0x0080440e, 0x00804433,
+  0x00804809, 0x00804829, 0x00804c21, 0x00805012, 0x00805012, 0x0080501a, 0x00805009, 0x00805009,
+  0x0080500c, 0x0080500c, 0x00805072, 0x00805c0c, 0x00805c2c, 0x00806007, 0x00806013, 0x00806004,
+  0x00806005, 0x00806012, 0x00806003, 0x00806014, 0x0080600e, 0x0080601a, 0x0080600e, 0x00806005,
+  0x0080601b, 0x00806005, 0x00806029, 0x00806402, 0x00806424, 0x00806852, 0x00807003, 0x00807012,
+  0x0080700c, 0x00807014, 0x0080700e, 0x00807008, 0x00807013, 0x00807027, 0x0080740c, 0x00807412,
+  0x0080741b, 0x00807434, 0x0080780c, 0x00807813, 0x00807801, 0x0080780c, 0x00807803, 0x00807825,
+  0x00807c05, 0x00807c0c, 0x00807c14, 0x00807c1b, 0x00807c07, 0x00807c14, 0x00807c09, 0x00807c12,
+  0x00807c1b, 0x00807c08, 0x00807c04, 0x00807c12, 0x00807c09, 0x00807c0c, 0x00807c19, 0x00807c14,
+  0x00807c30, 0x0080800c, 0x00808019, 0x0080800e, 0x00808009, 0x0080801b, 0x00808014, 0x00808005,
+  0x00808009, 0x00808012, 0x00808005, 0x0080800f, 0x00808012, 0x00808014, 0x00808004, 0x00808019,
+  0x00808032, 0x0080840c, 0x00808414, 0x00808404, 0x0080840e, 0x00808404, 0x0080840c, 0x0080840f,
+  0x0080840e, 0x00808404, 0x00808414, 0x00808413, 0x0080841b, 0x0080841a, 0x00808401, 0x0080841b,
+  0x00808401, 0x0080840f, 0x00808405, 0x00808407, 0x00808408, 0x0080840c, 0x00808408, 0x00808404,
+  0x00808402, 0x00808403, 0x00808449, 0x00808c19, 0x00808c04, 0x00808c12, 0x00808c07, 0x00808c2c,
+  0x00809007, 0x0080901b, 0x00809012, 0x00809019, 0x0080902e, 0x00809401, 0x00809409, 0x00809404,
+  0x0080941b, 0x0080942e, 0x0080980f, 0x00809801, 0x0080980b, 0x00809807, 0x0080980b, 0x00809801,
+  0x00809805, 0x00809805, 0x00809804, 0x00809834, 0x00809c19, 0x00809c04, 0x00809c0e, 0x00809c25,
+  0x0080a02c, 0x0080a40f, 0x0080a40e, 0x0080a429, 0x0080a807, 0x0080a805, 0x0080a801, 0x0080a812,
+  0x0080a81a, 0x0080a803, 0x0080a812, 0x0080a813, 0x0080a814, 0x0080a809, 0x0080a812, 0x0080a814,
+  0x0080a80e, 0x0080a813, 0x0080a821, 0x0080ac25, 0x0080b013, 0x0080b03a, 0x0080b429, 0x0080b81b,
+  0x0080b805, 0x0080b813, 0x0080b814, 0x0080b813, 0x0080b801, 0x0080b81b, 0x0080b80b, 0x0080b805,
+  0x0080b829, 0x0080bc49, 0x0080c40f, 0x0080c429, 0x0080c80c, 0x0080c81b, 0x0080c825, 0x0080cc29,
+  0x0080d00e, 0x0080d01b, 0x0080d01b, 0x0080d021, 0x0080d42c, 0x0080d814, 0x0080d805, 0x0080d81a,
+  0x0080d812, 0x0080d808, 0x0080d829, 0x0080dc34, 0x0080e045, 0x0080e809, 0x0080e825, 0x0080ec29,
+  0x0080f013, 0x0080f009, 0x0080f009, 0x0080f019, 0x0080f028, 0x0080f410, 0x0080f413, 0x0080f413,
+  0x0080f42e, 0x0080f80f, 0x0080f807, 0x0080f81b, 0x0080f814, 0x0080f804, 0x0080f813, 0x0080f805,
+  0x0080f80c, 0x0080f80e, 0x0080f81a, 0x0080f832, 0x0080fc09, 0x0080fc05, 0x0080fc12, 0x0080fc07,
+  0x0080fc08, 0x0080fc12, 0x0080fc02, 0x0080fc13, 0x0080fc13, 0x0080fc01, 0x0080fc19, 0x0080fc07,
+  0x0080fc0f, 0x0080fc08, 0x0080fc02, 0x0080fc32, 0x00810013, 0x00810013, 0x00810007, 0x00810032,
+  0x00810402, 0x00810414, 0x00810412, 0x00810429, 0x0081082e, 0x00810c12, 0x00810c13, 0x00810c05,
+  0x00810c05, 0x00810c0e, 0x00810c32, 0x00811009, 0x00811029, 0x00811405, 0x00811407, 0x0081142e,
+  0x00811821, 0x00811c0c, 0x00811c05, 0x00811c1a, 0x00811c25, 0x00812009, 0x0081200d, 0x00812005,
+  0x0081200c, 0x0081202e, 0x00812413, 0x0081241b, 0x00812405, 0x00812429, 0x00812805, 0x00812808,
+  0x00812805, 0x00812812, 0x00812809, 0x00812804, 0x0081280e, 0x00812813, 0x0081281b, 0x00812814,
+  0x0081281a, 0x00812814, 0x00812802, 0x00812805, 0x00812812, 0x00812812, 0x00812829, 0x00812c08,
+  0x00812c29, 0x00813005, 0x0081300e, 0x00813001, 0x00813034, 0x0081341a, 0x00813404, 0x00813434,
+  0x00813822, 0x00813c0c, 0x00813c12, 0x00813c14, 0x00813c01, 0x00813c0e, 0x00813c24, 0x00814035,
+  0x0081442f, 0x00814839, 0x00814c30, 0x00815021, 0x00815425, 0x00815829, 0x00815c25, 0x0081602f,
+  0x00816425, 0x0081682f, 0x00816c38, 0x00817025, 0x0081742f, 0x00817825, 0x00817c14, 0x00817c28,
+  0x00818023, 0x0081842c, 0x00818835, 0x00818c0d, 0x00818c33, 0x00819029, 0x0081942d, 0x00819805,
+  0x008198a9, 0x0081ac32, 0x0081b02c, 0x0081b434, 0x0081b825, 0x0081bc48, 0x0081c434, 0x0081c821,
+  0x0081cc29, 0x0081d019, 0x0081d028, 0x0081d449, 0x0081dc2f, 0x0081e025, 0x0081e432, 0x0081e82d,
+  0x0081ec2e, 0x0081f025, 0x0081f42f, 0x0081f80d, 0x0081f821, 0x0081fc32, 0x0082002c, 0x00820434,
+  0x0082086f, 0x00821429, 0x0082182b, 0x00821c01, 0x00821c24, 0x0082202b, 0x0082242f, 0x00822825,
+  0x00822c28, 0x0082302e, 0x00823423, 0x00823829, 0x00823c72, 0x00824837, 0x00824c21, 0x00825022,
+  0x00825401, 0x0082540d, 0x00825434, 0x00825829, 0x00825c2c, 0x00826035, 0x00826429, 0x00826827,
+  0x00826c33, 0x0082702c, 0x0082744d, 0x00827c32, 0x00828037, 0x0082842d, 0x0082882e, 0x00828c2e,
+  0x0082902e, 0x00829425, 0x0082982f, 0x00829c2b, 0x0082a02c, 0x0082a42e, 0x0082a834, 0x0082ac35,
+  0x0082b037, 0x0082b42e, 0x0082b833, 0x0082bc21, 0x0082c026, 0x0082c427, 0x0082c823, 0x0082cc29,
+  0x0082d033, 0x0082d454, 0x0082dc3a, 0x0082e028, 0x0082e42f, 0x0082e82c, 0x0082ec25, 0x0082f030,
+  0x0082f403, 0x0082f421, 0x0082f821, 0x0082fc29, 0x0083002f, 0x00830434, 0x00830841, 0x00831025,
+  0x0083142c, 0x00831801, 0x0083182e, 0x00831c30, 0x00832052, 0x0083282d, 0x00832c33, 0x00833021,
+  0x00833423, 0x0083382c, 0x00833c2f, 0x0083402c, 0x00834421, 0x00834831, 0x00834c12, 0x00834c33,
+  0x00835028, 0x00835425, 0x0083582e, 0x00835c25, 0x00836025, 0x0083642c, 0x00836835, 0x00836cb0,
+  0x00838026, 0x00838447, 0x00838c33, 0x00839034, 0x00839439, 0x00839865, 0x0083a42e, 0x0083a845,
+  0x0083b021, 0x0083b432, 0x0083b82f, 0x0083bc2e, 0x0083c023, 0x0083c433, 0x0083c830, 0x0083cc26,
+  0x0083d025, 0x0083d434, 0x0083d825, 0x0083dc2f, 0x0083e023, 0x0083e428, 0x0083e834, 0x0083ec33,
+  0x0083f041, 0x0083f825, 0x0083fc2c, 0x0084004c, 0x00840829, 0x00840c21, 0x00841025, 0x00841429,
+  0x0084186f, 0x00842401, 0x00842429, 0x00842803, 0x0084282c, 0x00842c28, 0x00843034, 0x00843426,
+  0x0084382b, 0x00843c45, 0x00844430, 0x00844834, 0x00844c2c, 0x00845023, 0x00845426, 0x00845822,
+  0x00845c23, 0x00846026, 0x00846436, 0x0084682d, 0x00846c30, 0x0084702e, 0x00847402, 0x00847430,
+  0x00847821, 0x00847c2c, 0x00848034, 0x00848434, 0x00848809, 0x00848834, 0x00848c2e, 0x00849033,
+  0x00849425, 0x0084982b, 0x00849c23, 0x0084a00d, 0x0084a034, 0x0084a40d, 0x0084a42f, 0x0084a825,
+  0x0084ac4c, 0x0084b432, 0x0084b82e, 0x0084bc34, 0x0084c049, 0x0084c82f, 0x0084cc09, 0x0084cc25,
+  0x0084d021, 0x0084d459, 0x0084dc25, 0x0084e034, 0x0084e42e, 0x0084e852, 0x0084f02c, 0x0084f435,
+  0x0084f832, 0x0084fc25, 0x0085002c, 0x00850432, 0x0085082d, 0x00850c34, 0x00851035, 0x00851429,
+  0x00851827, 0x00851c2d, 0x00852024, 0x00852432, 0x00852837, 0x00852c2f, 0x0085304d, 0x00853853,
+  0x00854034, 0x00854445, 0x00854c25, 0x00855036, 0x0085542e, 0x0085582b, 0x00855c41, 0x0085642f,
+  0x00856833, 0x00856c25, 0x00857014, 0x00857024, 0x00857407, 0x0085742d, 0x00857833, 0x00857c54,
+  0x00858425, 0x00858833, 0x00858c21, 0x0085902d, 0x00859454, 0x00859c2e, 0x0085a033, 0x0085a429,
+  0x0085a825, 0x0085ac34, 0x0085b035, 0x0085b42e, 0x0085b821, 0x0085bc26, 0x0085c032, 0x0085c486,
+  0x0085d429, 0x0085d824, 0x0085dc0b, 0x0085dc22, 0x0085e02c, 0x0085e423, 0x0085e82e, 0x0085ec29,
+  0x0085f033, 0x0085f429, 0x0085f86f, 0x00860421, 0x0086084d, 0x0086104f, 0x00861821, 0x00861c22,
+  0x00862012, 0x00862030, 0x00862426, 0x0086282b, 0x00862c2b, 0x0086304f, 0x00863825, 0x00863c2f,
+  0x00864025, 0x0086440f, 0x00864433, 0x00864822, 0x00864c2e, 0x00865025, 0x00865432, 0x00865825,
+  0x00865c28, 0x0086604f, 0x0086682e, 0x00866c21, 0x0086702f, 0x0086742f, 0x0086780c, 0x00867829,
+  0x00867c2f, 0x00868029, 0x00868427, 0x00868835, 0x00868c25, 0x00869029, 0x00869409, 0x00869435,
+  0x00869829, 0x00869c32, 0x0086a035, 0x0086a434, 0x0086a845, 0x0086b034, 0x0086b421, 0x0086b845,
+  0x0086c027, 0x0086c454, 0x0086cc2e, 0x0086d02b, 0x0086d435, 0x0086d821, 0x0086dc21, 0x0086e025,
+  0x0086e435, 0x0086e827, 0x0086ec2f, 0x0086f033, 0x0086f42c, 0x0086f84e, 0x00870033, 0x0087042e,
+  0x0087082f, 0x00870c34, 0x00871033, 0x0087142e, 0x00871829, 0x00871c19, 0x00871c25, 0x00872023,
+  0x00872424, 0x00872823, 0x00872c25, 0x00873008, 0x00873046, 0x00873825, 0x00873c23, 0x00874034,
+  0x0087442b, 0x00874825, 0x00874c34, 0x00875001, 0x00875028, 0x0087542f, 0x00875845, 0x0087602e,
+  0x00876433, 0x00876835, 0x00876c28, 0x0087702f, 0x00877425, 0x00877822, 0x00877c27, 0x0087802b,
+  0x00878435, 0x00878829, 0x00878c25, 0x00879021, 0x00879422, 0x0087982f, 0x00879c32, 0x0087a001,
+  0x0087a025, 0x0087a425, 0x0087a841, 0x0087b00f, 0x0087b001, 0x0087b023, 0x0087b433, 0x0087b835,
+  0x0087bc27, 0x0087c04b, 0x0087c834, 0x0087cc33, 0x0087d028, 0x0087d434, 0x0087d837, 0x0087dc49,
+  0x0087e461, 0x0087f003, 0x0087f0c1, 0x00880845, 0x00881068, 0x00881c32, 0x00882032, 0x00882421,
+  0x0088284c, 0x00883025, 0x00883429, 0x00883825, 0x00883c29, 0x0088402b, 0x0088442e, 0x00884835,
+  0x00884c23, 0x00885025, 0x0088542f, 0x00885834, 0x00885c2d, 0x00886025, 0x00886425, 0x00886821,
+  0x00886c25, 0x008870cf, 0x00888834, 0x00888c2f, 0x00889023, 0x00889431, 0x00889832, 0x00889c34,
+  0x0088a021, 0x0088a428, 0x0088a825, 0x0088ac28, 0x0088b026, 0x0088b42e, 0x0088b848, 0x0088c022,
+  0x0088c433, 0x0088c825, 0x0088cc33, 0x0088d034, 0x0088d42d, 0x0088d830, 0x0088dc32, 0x0088e025,
+  0x0088e434, 0x0088e841, 0x0088f085, 0x00890029, 0x00890430, 0x00890833, 0x00890c35, 0x0089103a,
+  0x00891432, 0x00891825, 0x00891c2f, 0x00892037, 0x00892425, 0x0089282c, 0x00892c23, 0x00893029,
+  0x00893434, 0x00893833, 0x00893c4c, 0x00894405, 0x00894427, 0x00894829, 0x00894c2d, 0x0089504e,
+  0x00895832, 0x00895c2e, 0x00896034, 0x0089642f, 0x00896828, 0x00896c0c, 0x00896c32, 0x00897024,
+  0x00897424, 0x00897825, 0x00897c2e, 0x00898021, 0x00898445, 0x00898ce1, 0x0089a828, 0x0089ac21,
+  0x0089b036, 0x0089b421, 0x0089b834, 0x0089bc05, 0x0089bc29, 0x0089c032, 0x0089c426, 0x0089c84e,
+  0x0089d04c, 0x0089d82e, 0x0089dc33, 0x0089e034, 0x0089e448, 0x0089ec21, 0x0089f00e, 0x0089f025,
+  0x0089f421, 0x0089f823, 0x0089fc2e, 0x008a0034, 0x008a0421, 0x008a0827, 0x008a0c2e, 0x008a1034,
+  0x008a14d9, 0x008a2c25, 0x008a304f, 0x008a3834, 0x008a3c94, 0x008a4c25, 0x008a502f, 0x008a5421,
+  0x008a5824, 0x008a5c26, 0x008a602c, 0x008a640d, 0x008a6450, 0x008a6c73, 0x008a7834, 0x008a7c37,
+  0x008a8025, 0x008a8443, 0x008a8c47, 0x008a9428, 0x008a982a, 0x008a9c2b, 0x008aa02d, 0x008aa430,
+  0x008aa853, 0x008ab054, 0x008ab836, 0x008abc37, 0x008ac035, 0x008ac423, 0x008ac825, 0x008acc27,
+  0x008ad02e, 0x008ad428, 0x008ad844, 0x008ae029, 0x008ae433, 0x008ae82e, 0x008aec22, 0x008af028,
+  0x008af429, 0x008af826, 0x008afc33, 0x008b0014, 0x008b0028, 0x008b0429, 0x008b0825, 0x008b0c29,
+  0x008b102c, 0x008b1432, 0x008b1829, 0x008b1c2f, 0x008b2034, 0x008b2429, 0x008b2835, 0x008b2c23,
+  0x008b3024, 0x008b342f, 0x008b3835, 0x008b3c23, 0x008b402d, 0x008b4429, 0x008b4821, 0x008b4c28,
+  0x008b502f, 0x008b5432, 0x008b5854, 0x008b6052, 0x008b6853, 0x008b7029, 0x008b7452, 0x008b7c2e,
+  0x008b802d, 0x008b8428, 0x008b8827, 0x008b8c15, 0x008b8c2f, 0x008b9026, 0x008b9414, 0x008b942e,
+  0x008b9804, 0x008b9822, 0x008b9c25, 0x008ba029, 0x008ba42d, 0x008ba834, 0x008bac33, 0x008bb025,
+  0x008bb425, 0x008bb834, 0x008bbc2e, 0x008bc025, 0x008bc449, 0x008bcc2e, 0x008bd04f, 0x008bd832,
+  0x008bdc57, 0x008be405, 0x008be435, 0x008be834, 0x008bec32, 0x008bf006, 0x008bf02c, 0x008bf421,
+  0x008bf825, 0x008bfca9, 0x008c1034, 0x008c1427, 0x008c1829, 0x008c1c2f, 0x008c2036, 0x008c2431,
+  0x008c2835, 0x008c2c25, 0x008c3050, 0x008c3825, 0x008c3c30, 0x008c4032, 0x008c4437, 0x008c4838,
+  0x008c4c25, 0x008c502e, 0x008c5427, 0x008c5835, 0x008c5c33, 0x008c6035, 0x008c642b, 0x008c6832,
+  0x008c6c25, 0x008c7035, 0x008c7425, 0x008c7823, 0x008c7c23, 0x008c804c, 0x008c882e, 0x008c8c25,
+  0x008c9029, 0x008c9423, 0x008c982e, 0x008c9c2b, 0x008ca032, 0x008ca429, 0x008ca825, 0x008cac22,
+  0x008cb02e, 0x008cb432, 0x008cb834, 0x008cbc21, 0x008cc025, 0x008cc432, 0x008cc823, 0x008ccc2b,
+  0x008cd061, 0x008cdc25, 0x008ce029, 0x008ce42f, 0x008ce830, 0x008cec34, 0x008cf024, 0x008cf425,
+  0x008cf82e, 0x008cfc33, 0x008d0034, 0x008d042d, 0x008d0825, 0x008d0c32, 0x008d1027, 0x008d1436,
+  0x008d1831, 0x008d1c2d, 0x008d2030, 0x008d2423, 0x008d282c, 0x008d2c26, 0x008d3025, 0x008d342b,
+  0x008d3825, 0x008d3c30, 0x008d4022, 0x008d4428, 0x008d4865, 0x008d542c, 0x008d5830, 0x008d5c21,
+  0x008d602e, 0x008d6435, 0x008d6821, 0x008d6c34, 0x008d7032, 0x008d7474, 0x008d802c, 0x008d8432,
+  0x008d8832, 0x008d8c25, 0x008d900f, 0x008d9007, 0x008d900b, 0x008d9023, 0x008d9421, 0x008d9801,
+  0x008d982c, 0x008d9c09, 0x008d9c4f, 0x008da435, 0x008da813, 0x008da82f, 0x008dac29, 0x008db02e,
+  0x008db436, 0x008db821, 0x008dbc42, 0x008dc425, 0x008dc830, 0x008dcc35, 0x008dd02b, 0x008dd42e,
+  0x008dd821, 0x008ddc2f, 0x008de021, 0x008de434, 0x008de805, 0x008de825, 0x008dec32, 0x008df032,
+  0x008df42e, 0x008df835, 0x008dfc24, 0x008e0024, 0x008e0421, 0x008e0825, 0x008e0c34, 0x008e1021,
+  0x008e1429, 0x008e1834, 0x008e1c29, 0x008e2034, 0x008e242c, 0x008e2835, 0x008e2c29, 0x008e3023,
+  0x008e3421, 0x008e3824, 0x008e3c32, 0x008e402c, 0x008e442d, 0x008e4834, 0x008e4c45, 0x008e5430,
+  0x008e584c, 0x008e602b, 0x008e6427, 0x008e682e, 0x008e6c2b, 0x008e702e, 0x008e7434, 0x008e7825,
+  0x008e7c23, 0x008e8034, 0x008e8425, 0x008e8809, 0x008e882c, 0x008e8c23, 0x008e9027, 0x008e9434,
+  0x008e9833, 0x008e9c23, 0x008ea026, 0x008ea424, 0x008ea84b, 0x008eb030, 0x008eb434, 0x008eb849,
+  0x008ec049, 0x008ec834, 0x008ecc27, 0x008ed02c, 0x008ed434, 0x008ed802, 0x008ed81a, 0x008ed809,
+  0x008ed813, 0x008ed81b, 0x008ed821, 0x008edc13, 0x008edc34, 0x008ee00f, 0x008ee016, 0x008ee00e,
+  0x008ee005, 0x008ee014, 0x008ee001, 0x008ee021, 0x008ee41a, 0x008ee412, 0x008ee407, 0x008ee412,
+  0x008ee40e, 0x008ee412, 0x008ee407, 0x008ee401, 0x008ee402, 0x008ee403, 0x008ee413, 0x008ee433,
+  0x008ee81b, 0x008ee81b, 0x008ee834, 0x008eec03, 0x008eec13, 0x008eec1b, 0x008eec13, 0x008eec06,
+  0x008eec1a, 0x008eec0f, 0x008eec0e, 0x008eec09, 0x008eec01, 0x008eec23, 0x008ef005, 0x008ef005,
+  0x008ef034, 0x008ef413, 0x008ef41b, 0x008ef416, 0x008ef401, 0x008ef402, 0x008ef401, 0x008ef40f,
+  0x008ef412, 0x008ef405, 0x008ef413, 0x008ef434, 0x008ef801, 0x008ef81b, 0x008ef805, 0x008ef813,
+  0x008ef81b, 0x008ef813, 0x008ef81b, 0x008ef801, 0x008ef80e, 0x008ef801, 0x008ef805, 0x008ef801,
+  0x008ef803, 0x008ef80f, 0x008ef816, 0x008ef805, 0x008ef80e, 0x008ef801, 0x008ef825, 0x008efc29,
+  0x008f0019, 0x008f001b, 0x008f001b, 0x008f0012, 0x008f000e, 0x008f0012, 0x008f0013, 0x008f0012,
+  0x008f001a, 0x008f0005, 0x008f0003, 0x008f0021, 0x008f042e, 0x008f0812, 0x008f082e, 0x008f0c1b,
+  0x008f0c0f, 0x008f0c01, 0x008f0c19, 0x008f0c13, 0x008f0c16, 0x008f0c12, 0x008f0c0c, 0x008f0c1b,
+  0x008f0c05, 0x008f0c13, 0x008f0c09, 0x008f0c29, 0x008f1001, 0x008f1013, 0x008f101b, 0x008f101a,
+  0x008f1005, 0x008f1012, 0x008f1001, 0x008f1013, 0x008f1009, 0x008f100f, 0x008f1048, 0x008f181b,
+  0x008f1801, 0x008f182e, 0x008f1c25, 0x008f2001, 0x008f2003, 0x008f2005, 0x008f2009, 0x008f2019,
+  0x008f201b, 0x008f2019, 0x008f2034, 0x008f2414, 0x008f240d, 0x008f2414, 0x008f2402, 0x008f2434,
+  0x008f281b, 0x008f2829, 0x008f2c01, 0x008f2c1b, 0x008f2c29, 0x008f3021, 0x008f3429, 0x008f3809,
+  0x008f3819, 0x008f380c, 0x008f382c, 0x008f3c29, 0x008f4001, 0x008f4013, 0x008f401b, 0x008f4016,
+  0x008f4012, 0x008f400e, 0x008f400f, 0x008f401a, 0x008f401a, 0x008f4005, 0x008f4019, 0x008f4004,
+  0x008f4032, 0x008f4407, 0x008f441a, 0x008f4405, 0x008f441b, 0x008f4409, 0x008f4416, 0x008f4409,
+  0x008f4407, 0x008f4409, 0x008f4412, 0x008f4405, 0x008f440c, 0x008f4405, 0x008f4403, 0x008f4403,
+  0x008f440c, 0x008f4414, 0x008f440c, 0x008f4409, 0x008f4410, 0x008f4434, 0x008f4803, 0x008f480e,
+  0x008f4814, 0x008f4804, 0x008f480e, 0x008f480e, 0x008f481b, 0x008f4814, 0x008f480c, 0x008f4830,
+  0x008f4c1b, 0x008f4c09, 0x008f4c02, 0x008f4c0c, 0x008f4c13, 0x008f4c14, 0x008f4c1b, 0x008f4c15,
+  0x008f4c03, 0x008f4c1b, 0x008f4c13, 0x008f4c1b, 0x008f4c1b, 0x008f4c05, 0x008f4c12, 0x008f4c08,
+  0x008f4c01, 0x008f4c03, 0x008f4c1a, 0x008f4c0c, 0x008f4c04, 0x008f4c09, 0x008f4c15, 0x008f4c13,
+  0x008f4c29, 0x008f5013, 0x008f5007, 0x008f5013, 0x008f5001, 0x008f5014, 0x008f5003, 0x008f5014,
+  0x008f501a, 0x008f500e, 0x008f5005, 0x008f5023, 0x008f5414, 0x008f5409, 0x008f5414, 0x008f5405,
+  0x008f540e, 0x008f5413, 0x008f5413, 0x008f5401, 0x008f5405, 0x008f5414, 0x008f541b, 0x008f541b,
+  0x008f5414, 0x008f5403, 0x008f5427, 0x008f5805, 0x008f581a, 0x008f5801, 0x008f5834, 0x008f5c04,
+  0x008f5c03, 0x008f5c0e, 0x008f5c05, 0x008f5c0e, 0x008f5c0f, 0x008f5c0f, 0x008f5c0c, 0x008f5c25,
+  0x008f6033, 0x008f642e, 0x008f682c, 0x008f6c35, 0x008f7022, 0x008f7412, 0x008f7422, 0x008f782e,
+  0x008f7c33, 0x008f8032, 0x008f842e, 0x008f8821, 0x008f8c22, 0x008f902e, 0x008f9427, 0x008f9825,
+  0x008f9c28, 0x008fa039, 0x008fa432, 0x008fa82f, 0x008fac36, 0x008fb021, 0x008fb424, 0x008fb828,
+  0x008fbc4e, 0x008fc432, 0x008fc813, 0x008fc829, 0x008fcc2c, 0x008fd028, 0x008fd42e, 0x008fd825,
+  0x008fdc69, 0x008fe821, 0x008fec2e, 0x008ff005, 0x008ff025, 0x008ff427, 0x008ff833, 0x008ffc23,
+  0x00900012, 0x0090004f, 0x00900830, 0x00900c23, 0x00901032, 0x00901433, 0x00901833, 0x00901c29,
+  0x00902021, 0x00902432, 0x0090282d, 0x00902c4e, 0x00903452, 0x00903c32, 0x00904033, 0x0090442c,
+  0x00904832, 0x00904c2e, 0x0090502c, 0x00905459, 0x00905c29, 0x00906028, 0x00906425, 0x00906821,
+  0x00906c29, 0x0090702f, 0x00907421, 0x00907836, 0x00907c2f, 0x0090800f, 0x00908025, 0x00908429,
+  0x0090882e, 0x00908c26, 0x00909025, 0x00909428, 0x00909821, 0x00909c21, 0x0090a025, 0x0090a428,
+  0x0090a825, 0x0090ac21, 0x0090b024, 0x0090b424, 0x0090b824, 0x0090bc30, 0x0090c02d, 0x0090c433,
+  0x0090c825, 0x0090cc2f, 0x0090d02f, 0x0090d42c, 0x0090d82e, 0x0090dc33, 0x0090e031, 0x0090e430,
+  0x0090e825, 0x0090ec25, 0x0090f02b, 0x0090f445, 0x0090fc29, 0x00910025, 0x00910409, 0x00910437,
+  0x00910825, 0x00910c30, 0x00911025, 0x00911432, 0x00911805, 0x00911802, 0x00911834, 0x00911c22,
+  0x0091200c, 0x00912037, 0x00912432, 0x00912833, 0x00912c2e, 0x00913029, 0x00913423, 0x00913821,
+  0x00913c4c, 0x00914434, 0x0091484f, 0x00915034, 0x0091542e, 0x00915828, 0x00915c2c, 0x00916032,
+  0x00916425, 0x00916832, 0x00916c35, 0x00917033, 0x0091742c, 0x00917833, 0x00917c21, 0x0091802e,
+  0x00918432, 0x00918829, 0x00918c4d, 0x00919421, 0x00919825, 0x00919c2f, 0x0091a034, 0x0091a435,
+  0x0091a82f, 0x0091ac25, 0x0091b032, 0x0091b434, 0x0091b832, 0x0091bc32, 0x0091c04c, 0x0091c82f,
+  0x0091cc33, 0x0091d025, 0x0091d423, 0x0091d82d, 0x0091dc2e, 0x0091e033, 0x0091e432, 0x0091e84b,
+  0x0091f02f, 0x0091f453, 0x0091fc34, 0x0092002c, 0x00920429, 0x0092082f, 0x00920c52, 0x0092142b,
+  0x00921828, 0x00921c33, 0x00922039, 0x00922425, 0x00922822, 0x00922c30, 0x00923033, 0x0092342c,
+  0x00923821, 0x00923c29, 0x0092402e, 0x00924437, 0x00924823, 0x00924c33, 0x00925023, 0x00925409,
+  0x00925433, 0x00925836, 0x00925c25, 0x0092602c, 0x00926429, 0x00926832, 0x00926c33, 0x0092702e,
+  0x00927432, 0x00927821, 0x00927c52, 0x00928429, 0x00928828, 0x00928c2c, 0x0092902c, 0x00929428,
+  0x00929834, 0x00929c25, 0x0092a025, 0x0092a42c, 0x0092a825, 0x0092ac2f, 0x0092b02d, 0x0092b445,
+  0x0092bc2f, 0x0092c008, 0x0092c025, 0x0092c42f, 0x0092c839, 0x0092cc4e, 0x0092d428, 0x0092d834,
+  0x0092dc29, 0x0092e033, 0x0092e42c, 0x0092e825, 0x0092ec29, 0x0092f025, 0x0092f425, 0x0092f82f,
+  0x0092fc14, 0x0092fc36, 0x0093002e, 0x0093042e, 0x0093082e, 0x00930c4c, 0x0093142e, 0x00931832,
+  0x00931c21, 0x00932033, 0x00932433, 0x00932894, 0x00933821, 0x00933c29, 0x00934021, 0x0093442c,
+  0x00934829, 0x00934c35, 0x00935029, 0x00935433, 0x00935832, 0x00935c34, 0x00936025, 0x0093642d,
+  0x00936827, 0x00936c29, 0x00937023, 0x00937432, 0x00937825, 0x00937c29, 0x00938023, 0x00938439,
+  0x00938828, 0x00938c22, 0x0093902c, 0x0093942e, 0x0093982f, 0x00939c34, 0x0093a034, 0x0093a423,
+  0x0093a858, 0x0093b02d, 0x0093b433, 0x0093b834, 0x0093bc45, 0x0093c425, 0x0093c834, 0x0093cc28,
+  0x0093d032, 0x0093d42c, 0x0093d854, 0x0093e02e, 0x0093e42f, 0x0093e826, 0x0093ec2c, 0x0093f044,
+  0x0093f833, 0x0093fc26, 0x00940056, 0x00940828, 0x00940c30, 0x00941024, 0x0094142d, 0x00941821,
+  0x00941c33, 0x0094202c, 0x00942433, 0x00942834, 0x00942c37, 0x0094302c, 0x00943409, 0x00943429,
+  0x00943825, 0x00943c28, 0x0094402f, 0x0094444f, 0x00944c29, 0x00945024, 0x00945427, 0x00945830,
+  0x00945c32, 0x00946034, 0x00946421, 0x00946829, 0x00946c25, 0x00947009, 0x00947024, 0x00947433,
+  0x0094782f, 0x00947c2c, 0x00948037, 0x00948421, 0x00948824, 0x00948c2e, 0x0094904f, 0x00949834,
+  0x00949c19, 0x00949c25, 0x0094a025, 0x0094a424, 0x0094a832, 0x0094ac2f, 0x0094b032, 0x0094b425,
+  0x0094b825, 0x0094bc34, 0x0094c02f, 0x0094c42c, 0x0094c827, 0x0094cc33, 0x0094d054, 0x0094d832,
+  0x0094dc31, 0x0094e025, 0x0094e44e, 0x0094ec24, 0x0094f00e, 0x0094f022, 0x0094f42e, 0x0094f821,
+  0x0094fc34, 0x00950021, 0x00950427, 0x00950872, 0x00951429, 0x00951834, 0x00951c24, 0x00952036,
+  0x00952425, 0x00952828, 0x00952c32, 0x00953025, 0x0095342f, 0x00953821, 0x00953c2e, 0x00954033,
+  0x0095442d, 0x00954821, 0x00954c29, 0x0095502d, 0x00955421, 0x00955833, 0x00955c25, 0x0095602f,
+  0x00956434, 0x00956829, 0x00956c2e, 0x00957025, 0x00957428, 0x00957825, 0x00957c25, 0x0095802e,
+  0x00958421, 0x00958833, 0x00958c25, 0x00959012, 0x00959028, 0x0095942c, 0x0095982e, 0x00959c25,
+  0x0095a025, 0x0095a44f, 0x0095ac53, 0x0095b42f, 0x0095b834, 0x0095bc35, 0x0095c022, 0x0095c433,
+  0x0095c825, 0x0095cc23, 0x0095d029, 0x0095d42f, 0x0095d834, 0x0095dc33, 0x0095e021, 0x0095e425,
+  0x0095e821, 0x0095ec21, 0x0095f033, 0x0095f433, 0x0095f833, 0x0095fc25, 0x00960033, 0x0096042f,
+  0x0096082c, 0x00960c29, 0x00961030, 0x00961439, 0x00961828, 0x00961c2c, 0x00962033, 0x00962429,
+  0x0096282f, 0x00962c34, 0x00963009, 0x00963021, 0x00963425, 0x00963825, 0x00963c25, 0x00964023,
+  0x0096442f, 0x00964826, 0x00964c2c, 0x0096502e, 0x00965422, 0x00965826, 0x00965c2c, 0x00966030,
+  0x00966433, 0x00966834, 0x00966c2d, 0x00967012, 0x00967041, 0x0096782f, 0x00967c39, 0x0096802f,
+  0x0096848f, 0x00969426, 0x00969821, 0x00969c29, 0x0096a02f, 0x0096a423, 0x0096a833, 0x0096ac53,
+  0x0096b42f, 0x0096b845, 0x0096c034, 0x0096c428, 0x0096c832, 0x0096cc27, 0x0096d009, 0x0096d02f,
+  0x0096d42c, 0x0096d823, 0x0096dc32, 0x0096e039, 0x0096e423, 0x0096e825, 0x0096ec29, 0x0096f050,
+  0x0096f853, 0x00970034, 0x00970432, 0x0097082e, 0x00970c2f, 0x00971035, 0x0097142f, 0x00971869,
+  0x00972402, 0x00972432, 0x00972833, 0x00972c36, 0x00973029, 0x00973421, 0x00973825, 0x00973c32,
+  0x00974033, 0x00974423, 0x00974833, 0x00974c2c, 0x0097503a, 0x00975425, 0x0097582f, 0x00975c2f,
+  0x0097602c, 0x00976428, 0x0097682d, 0x00976c32, 0x0097702d, 0x00977431, 0x00977834, 0x00977c35,
+  0x00978033, 0x00978433, 0x0097882d, 0x00978c2e, 0x00979025, 0x00979424, 0x00979830, 0x00979c37,
+  0x0097a029, 0x0097a42d, 0x0097a825, 0x0097ac32, 0x0097b027, 0x0097b426, 0x0097b834, 0x0097bc29,
+  0x0097c02f, 0x0097c42f, 0x0097c830, 0x0097cc21, 0x0097d022, 0x0097d42f, 0x0097d821, 0x0097dc27,
+  0x0097e00f, 0x0097e030, 0x0097e46f, 0x0097f036, 0x0097f429, 0x0097f829, 0x0097fc32, 0x0098002c,
+  0x00980434, 0x00980832, 0x00980c34, 0x00981022, 0x00981423, 0x00981824, 0x00981c26, 0x00982027,
+  0x0098244c, 0x00982c8d, 0x00983c2f, 0x0098400c, 0x00984029, 0x0098442c, 0x00984821, 0x00984c14,
+  0x00984c4f, 0x00985426, 0x0098584f, 0x00986039, 0x00986461, 0x0098702f, 0x00987425, 0x00987830,
+  0x00987c4f, 0x00988421, 0x00988829, 0x00988c24, 0x0098902c, 0x0098942e, 0x00989821, 0x00989c34,
+  0x0098a025, 0x0098a433, 0x0098a829, 0x0098ac23, 0x0098b025, 0x0098b421, 0x0098b824, 0x0098bc45,
+  0x0098c467, 0x0098d070, 0x0098dc33, 0x0098e027, 0x0098e425, 0x0098e835, 0x0098ec21, 0x0098f021,
+  0x0098f428, 0x0098f833, 0x0098fc35, 0x0099002e, 0x0099042d, 0x0099082d, 0x00990c29, 0x00991025,
+  0x0099142f, 0x00991821, 0x00991c52, 0x00992422, 0x00992825, 0x00992c30, 0x00993034, 0x00993432,
+  0x00993833, 0x00993c45, 0x00994435, 0x00994825, 0x00994c32, 0x00995029, 0x00995425, 0x00995821,
+  0x00995c49, 0x00996425, 0x00996823, 0x00996c54, 0x00997425, 0x0099784f, 0x00998049, 0x00998825,
+  0x00998c24, 0x00999048, 0x00999833, 0x00999c25, 0x0099a027, 0x0099a421, 0x0099a824, 0x0099ac72,
+  0x0099b82e, 0x0099bca9, 0x0099d034, 0x0099d429, 0x0099d821, 0x0099dc2f, 0x0099e029, 0x0099e428,
+  0x0099e833, 0x0099ec2f, 0x0099f02e, 0x0099f42b, 0x0099f82c, 0x0099fc32, 0x009a0030, 0x009a0427,
+  0x009a0821, 0x009a0c32, 0x009a1023, 0x009a1428, 0x009a1835, 0x009a1c32, 0x009a2027, 0x009a2428,
+  0x009a2830, 0x009a2c14, 0x009a2c29, 0x009a3032, 0x009a3433, 0x009a3829, 0x009a3c21, 0x009a402f,
+  0x009a4429, 0x009a482f, 0x009a4c21, 0x009a5025, 0x009a5432, 0x009a5821, 0x009a5c29, 0x009a602f,
+  0x009a6421, 0x009a6834, 0x009a6c2c, 0x009a7074, 0x009a7c34, 0x009a8024, 0x009a8425, 0x009a8853,
+  0x009a9025, 0x009a942f, 0x009a9821, 0x009a9c21, 0x009aa02c, 0x009aa432, 0x009aa82f, 0x009aac25,
+  0x009ab024, 0x009ab42d, 0x009ab83a, 0x009abc21, 0x009ac02f, 0x009ac434, 0x009ac82f, 0x009acc41,
+  0x009ad445, 0x009adc34, 0x009ae028, 0x009ae425, 0x009ae825, 0x009aec30, 0x009af033, 0x009af444,
+  0x009afc28, 0x009b0032, 0x009b0453, 0x009b0c34, 0x009b1025, 0x009b1425, 0x009b1805, 0x009b1825,
+  0x009b1c2f, 0x009b2035, 0x009b2450, 0x009b2c32, 0x009b3021, 0x009b3425, 0x009b3833, 0x009b3c2c,
+  0x009b4025, 0x009b4428, 0x009b4835, 0x009b4c53, 0x009b5421, 0x009b582c, 0x009b5c30, 0x009b6023,
+  0x009b642e, 0x009b6825, 0x009b6c2b, 0x009b702e, 0x009b7434, 0x009b7832, 0x009b7c25, 0x009b8029,
+  0x009b844c, 0x009b8c35, 0x009b9024, 0x009b9432, 0x009b982e, 0x009b9c29, 0x009ba02f, 0x009ba425,
+  0x009ba854, 0x009bb027, 0x009bb421, 0x009bb80c, 0x009bb824, 0x009bbc34, 0x009bc029, 0x009bc42c,
+  0x009bc830, 0x009bcc25, 0x009bd028, 0x009bd425, 0x009bd82e, 0x009bdc30, 0x009be034, 0x009be434,
+  0x009be830, 0x009bec2e, 0x009bf029, 0x009bf434, 0x009bf829, 0x009bfc38, 0x009c002f, 0x009c0423,
+  0x009c0821, 0x009c0c21, 0x009c1052, 0x009c1825, 0x009c1c45, 0x009c2425, 0x009c2835, 0x009c2c2d,
+  0x009c3034, 0x009c3428, 0x009c3825, 0x009c3c32, 0x009c402f, 0x009c4421, 0x009c4833, 0x009c4c21,
+  0x009c5025, 0x009c542e, 0x009c5827, 0x009c5c2b, 0x009c6032, 0x009c6425, 0x009c682f, 0x009c6c0e,
+  0x009c6c25, 0x009c7032, 0x009c742e, 0x009c7822, 0x009c7c21, 0x009c8028, 0x009c842c, 0x009c8837,
+  0x009c8c21, 0x009c902d, 0x009c9435, 0x009c9833, 0x009c9c28, 0x009ca033, 0x009ca42b, 0x009ca827,
+  0x009cac29, 0x009cb025, 0x009cb434, 0x009cb834, 0x009cbc93, 0x009ccc25, 0x009cd023, 0x009cd425,
+  0x009cd835, 0x009cdc34, 0x009ce02c, 0x009ce422, 0x009ce825, 0x009cec21, 0x009cf02c, 0x009cf427,
+  0x009cf829, 0x009cfc34, 0x009d0012, 0x009d0032, 0x009d0429, 0x009d0833, 0x009d0c25, 0x009d1025,
+  0x009d1405, 0x009d142c, 0x009d1829, 0x009d1c25, 0x009d2032, 0x009d2421, 0x009d2828, 0x009d2c34,
+  0x009d3028, 0x009d3421, 0x009d3821, 0x009d3c30, 0x009d4025, 0x009d4423, 0x009d4829, 0x009d4c33,
+  0x009d5026, 0x009d5445, 0x009d5c25, 0x009d6027, 0x009d642c, 0x009d682f, 0x009d6c29, 0x009d702f,
+  0x009d742e, 0x009d7828, 0x009d7c33, 0x009d803a, 0x009d8425, 0x009d8828, 0x009d8c2c, 0x009d9028,
+  0x009d9425, 0x009d9833, 0x009d9c29, 0x009da028, 0x009da433, 0x009da833, 0x009dac25, 0x009db028,
+  0x009db426, 0x009db833, 0x009dbc21, 0x009dc028, 0x009dc421, 0x009dc823, 0x009dcc29, 0x009dd034,
+  0x009dd429, 0x009dd82e, 0x009ddc25, 0x009de039, 0x009de421, 0x009de833, 0x009dec12, 0x009dec05,
+  0x009dec12, 0x009dec13, 0x009dec29, 0x009df021, 0x009df405, 0x009df429, 0x009df812, 0x009df803,
+  0x009df812, 0x009df807, 0x009df807, 0x009df803, 0x009df829, 0x009dfc19, 0x009dfc05, 0x009dfc1b,
+  0x009dfc29, 0x009e0005, 0x009e001a, 0x009e0016, 0x009e0014, 0x009e0013, 0x009e0009, 0x009e001a,
+  0x009e0001, 0x009e0005, 0x009e0005, 0x009e001a, 0x009e0001, 0x009e001b, 0x009e0029, 0x009e044d,
+  0x009e0c21, 0x009e1039, 0x009e1441, 0x009e1c2e, 0x009e202c, 0x009e242c, 0x009e2821, 0x009e2c30,
+  0x009e3034, 0x009e342f, 0x009e382e, 0x009e3c32, 0x009e4031, 0x009e4428, 0x009e4834, 0x009e4c32,
+  0x009e5053, 0x009e5839, 0x009e5c34, 0x009e6025, 0x009e644c, 0x009e6c25, 0x009e702f, 0x009e742f,
+  0x009e7835, 0x009e7c25, 0x009e802f, 0x009e842f, 0x009e8825, 0x009e8c24, 0x009e9034, 0x009e942d,
+  0x009e9830, 0x009e9c56, 0x009ea42e, 0x009ea833, 0x009eac32, 0x009eb04e, 0x009eb834, 0x009ebc29,
+  0x009ec02c, 0x009ec42e, 0x009ec834, 0x009ecc28, 0x009ed02f, 0x009ed430, 0x009ed845, 0x009ee022,
+  0x009ee427, 0x009ee821, 0x009eec21, 0x009ef02f, 0x009ef435, 0x009ef825, 0x009efc2f, 0x009f0024,
+  0x009f0423, 0x009f0825, 0x009f0c35, 0x009f1029, 0x009f1429, 0x009f182d, 0x009f1c33, 0x009f2025,
+  0x009f2435, 0x009f282e, 0x009f2c27, 0x009f3024, 0x009f3423, 0x009f3832, 0x009f3c29, 0x009f401b,
+  0x009f4033, 0x009f442f, 0x009f4829, 0x009f4c26, 0x009f5033, 0x009f542f, 0x009f5822, 0x009f5c34,
+  0x009f6024, 0x009f6439, 0x009f6821, 0x009f6c50, 0x009f7445, 0x009f7c45, 0x009f8425, 0x009f8832,
+  0x009f8c25, 0x009f9025, 0x009f9421, 0x009f982c, 0x009f9c2e, 0x009fa029, 0x009fa429, 0x009fa837,
+  0x009fac35, 0x009fb025, 0x009fb452, 0x009fbc45, 0x009fc428, 0x009fc832, 0x009fcc33, 0x009fd02e,
+  0x009fd424, 0x009fd82f, 0x009fdc21, 0x009fe028, 0x009fe452, 0x009fec21, 0x009ff028, 0x009ff422,
+  0x009ff828, 0x009ffc32, 0x00a00034, 0x00a0042f, 0x00a00826, 0x00a00c25, 0x00a01032, 0x00a01425,
+  0x00a0182f, 0x00a01c32, 0x00a0202b, 0x00a02434, 0x00a02825, 0x00a02c27, 0x00a03025, 0x00a03409,
+  0x00a0342f, 0x00a03833, 0x00a03c25, 0x00a04025, 0x00a0442f, 0x00a04825, 0x00a04c29, 0x00a05043,
+  0x00a0581b, 0x00a0582e, 0x00a05c2e, 0x00a06022, 0x00a0642e, 0x00a06832, 0x00a06c2e, 0x00a0702e,
+  0x00a07432, 0x00a07834, 0x00a07c32, 0x00a08032, 0x00a08425, 0x00a08832, 0x00a08c29, 0x00a09029,
+  0x00a09421, 0x00a09829, 0x00a09c30, 0x00a0a030, 0x00a0a412, 0x00a0a421, 0x00a0a829, 0x00a0ac27,
+  0x00a0b025, 0x00a0b42b, 0x00a0b823, 0x00a0bc33, 0x00a0c024, 0x00a0c428, 0x00a0c82f, 0x00a0cc2f,
+  0x00a0d029, 0x00a0d426, 0x00a0d82d, 0x00a0dc36, 0x00a0e037, 0x00a0e429, 0x00a0e82f, 0x00a0ec28,
+  0x00a0f02c, 0x00a0f42c, 0x00a0f821, 0x00a0fc21, 0x00a10034, 0x00a1042f, 0x00a10832, 0x00a10c2e,
+  0x00a11029, 0x00a11421, 0x00a11834, 0x00a11c25, 0x00a12032, 0x00a1241b, 0x00a12421, 0x00a12823,
+  0x00a12c2f, 0x00a1300f, 0x00a13021, 0x00a13434, 0x00a13825, 0x00a13c1b, 0x00a13c32, 0x00a14021,
+  0x00a14429, 0x00a14833, 0x00a14c25, 0x00a15025, 0x00a15445, 0x00a15c33, 0x00a16021, 0x00a16432,
+  0x00a16824, 0x00a16c25, 0x00a1701b, 0x00a1704c, 0x00a17829, 0x00a17c23, 0x00a18038, 0x00a18430,
+  0x00a1882e, 0x00a18c2d, 0x00a19033, 0x00a19423, 0x00a19836, 0x00a19c2f, 0x00a1a032, 0x00a1a433,
+  0x00a1a823, 0x00a1ac1b, 0x00a1ac1b, 0x00a1ac33, 0x00a1b030, 0x00a1b430, 0x00a1b830, 0x00a1bc21,
+  0x00a1c02f, 0x00a1c423, 0x00a1c825, 0x00a1cc41, 0x00a1d425, 0x00a1d839, 0x00a1dc29, 0x00a1e023,
+  0x00a1e434, 0x00a1e829, 0x00a1ec25, 0x00a1f029, 0x00a1f433, 0x00a1f81b, 0x00a1f82e, 0x00a1fc33,
+  0x00a2002f, 0x00a20429, 0x00a2082e, 0x00a20c21, 0x00a2102f, 0x00a21423, 0x00a21829, 0x00a21c25,
+  0x00a2202c, 0x00a22421, 0x00a2282c, 0x00a22c44, 0x00a23428, 0x00a2384f, 0x00a24012, 0x00a24024,
+  0x00a24428, 0x00a24834, 0x00a24c32, 0x00a25033, 0x00a2542f, 0x00a25824, 0x00a25c4c, 0x00a26425,
+  0x00a26833, 0x00a26c34, 0x00a27029, 0x00a27439, 0x00a27825, 0x00a27c29, 0x00a28034, 0x00a28433,
+  0x00a28834, 0x00a28c54, 0x00a29432, 0x00a29825, 0x00a29c2f, 0x00a2a02c, 0x00a2a433, 0x00a2a836,
+  0x00a2ac2f, 0x00a2b04e, 0x00a2b832, 0x00a2bc29, 0x00a2c029, 0x00a2c435, 0x00a2c82d, 0x00a2cc33,
+  0x00a2d021, 0x00a2d42f, 0x00a2d825, 0x00a2dc2c, 0x00a2e02c, 0x00a2e421, 0x00a2e81b, 0x00a2e834,
+  0x00a2ec49, 0x00a2f430, 0x00a2f82f, 0x00a2fc21, 0x00a30034, 0x00a3042e, 0x00a30831, 0x00a30c25,
+  0x00a31035, 0x00a31430, 0x00a31834, 0x00a31c2e, 0x00a32025, 0x00a3242c, 0x00a32828, 0x00a32c28,
+  0x00a33029, 0x00a33430, 0x00a33834, 0x00a33c33, 0x00a34025, 0x00a3441b, 0x00a34430, 0x00a34825,
+  0x00a34c21, 0x00a35029, 0x00a35425, 0x00a3582f, 0x00a35c2d, 0x00a36033, 0x00a36428, 0x00a36832,
+  0x00a36c44, 0x00a37433, 0x00a3781b, 0x00a37834, 0x00a37c25, 0x00a3802e, 0x00a3842c, 0x00a38828,
+  0x00a38c27, 0x00a39033, 0x00a39432, 0x00a39839, 0x00a39c25, 0x00a3a02f, 0x00a3a425, 0x00a3a835,
+  0x00a3ac2d, 0x00a3b029, 0x00a3b42f, 0x00a3b821, 0x00a3bc29, 0x00a3c029, 0x00a3c433, 0x00a3c825,
+  0x00a3cc2c, 0x00a3d032, 0x00a3d424, 0x00a3d827, 0x00a3dc36, 0x00a3e04c, 0x00a3e829, 0x00a3ec35,
+  0x00a3f02f, 0x00a3f42f, 0x00a3f825, 0x00a3fc2f, 0x00a40032, 0x00a40437, 0x00a40832, 0x00a40c25,
+  0x00a41023, 0x00a41429, 0x00a4182e, 0x00a41c21, 0x00a42034, 0x00a42433, 0x00a42832, 0x00a42c33,
+  0x00a43034, 0x00a43432, 0x00a4382e, 0x00a43c2f, 0x00a44037, 0x00a4442e, 0x00a44823, 0x00a44c33,
+  0x00a45034, 0x00a45433, 0x00a45823, 0x00a45c6e, 0x00a4682f, 0x00a46c25, 0x00a47024, 0x00a47433,
+  0x00a47832, 0x00a47c23, 0x00a48034, 0x00a48430, 0x00a48834, 0x00a48c26, 0x00a49037, 0x00a49433,
+  0x00a49821, 0x00a49c30, 0x00a4a033, 0x00a4a428, 0x00a4a824, 0x00a4ac27, 0x00a4b02f, 0x00a4b41b,
+  0x00a4b42e, 0x00a4b833, 0x00a4bc28, 0x00a4c023, 0x00a4c429, 0x00a4c834, 0x00a4cc1b, 0x00a4cc34,
+  0x00a4d01b, 0x00a4d025, 0x00a4d42c, 0x00a4d82e, 0x00a4dc32, 0x00a4e021, 0x00a4e425, 0x00a4e821,
+  0x00a4ec23, 0x00a4f02e, 0x00a4f436, 0x00a4f82f, 0x00a4fc23, 0x00a5002d, 0x00a50433, 0x00a5082c,
+  0x00a50c21, 0x00a51023, 0x00a51421, 0x00a51829, 0x00a51c2f, 0x00a5202f, 0x00a5242f, 0x00a52821,
+  0x00a52c28, 0x00a53034, 0x00a53421, 0x00a53830, 0x00a53c2d, 0x00a5402e, 0x00a54444, 0x00a54c4c,
+  0x00a55430, 0x00a55845, 0x00a56026, 0x00a5642f, 0x00a56853, 0x00a57034, 0x00a57427, 0x00a5782c,
+  0x00a57c27, 0x00a58032, 0x00a58437, 0x00a58839, 0x00a58c1b, 0x00a58c37, 0x00a59021, 0x00a59433,
+  0x00a59845, 0x00a5a029, 0x00a5a433, 0x00a5a821, 0x00a5ac2e, 0x00a5b02c, 0x00a5b435, 0x00a5b823,
+  0x00a5bc2c, 0x00a5c028, 0x00a5c42e, 0x00a5c824, 0x00a5cc28, 0x00a5d02f, 0x00a5d450, 0x00a5dc34,
+  0x00a5e02f, 0x00a5e425, 0x00a5e829, 0x00a5ec37, 0x00a5f029, 0x00a5f42f, 0x00a5f826, 0x00a5fc30,
+  0x00a60035, 0x00a60429, 0x00a60830, 0x00a60c29, 0x00a61025, 0x00a6143a, 0x00a61837, 0x00a61c29,
+  0x00a62024, 0x00a62421, 0x00a62834, 0x00a62c25, 0x00a63033, 0x00a63427, 0x00a63834, 0x00a63c2d,
+  0x00a64029, 0x00a64425, 0x00a64825, 0x00a64c29, 0x00a65025, 0x00a65435, 0x00a65828, 0x00a65c23,
+  0x00a6602f, 0x00a66425, 0x00a6682f, 0x00a66c29, 0x00a67032, 0x00a67437, 0x00a67829, 0x00a67c29,
+  0x00a68034, 0x00a68422, 0x00a6882f, 0x00a68c21, 0x00a69021, 0x00a69425, 0x00a69825, 0x00a69c2e,
+  0x00a6a021, 0x00a6a430, 0x00a6a832, 0x00a6ac34, 0x00a6b033, 0x00a6b426, 0x00a6b82e, 0x00a6bc35,
+  0x00a6c02f, 0x00a6c424, 0x00a6c82b, 0x00a6cc2e, 0x00a6d029, 0x00a6d423, 0x00a6d82e, 0x00a6dc21,
+  0x00a6e025, 0x00a6e429, 0x00a6e82d, 0x00a6ec34, 0x00a6f02f, 0x00a6f428, 0x00a6f849, 0x00a7002c,
+  0x00a70432, 0x00a70825, 0x00a70c2c, 0x00a71021, 0x00a71445, 0x00a71c29, 0x00a7202f, 0x00a72427,
+  0x00a72833, 0x00a72c54, 0x00a73427, 0x00a7382c, 0x00a73c36, 0x00a74029, 0x00a7442c, 0x00a7482d,
+  0x00a74c2c, 0x00a75024, 0x00a7542e, 0x00a75834, 0x00a75c33, 0x00a7604d, 0x00a76828, 0x00a76c27,
+  0x00a7702f, 0x00a7742c, 0x00a77833, 0x00a77c2f, 0x00a78029, 0x00a78428, 0x00a78822, 0x00a78c28,
+  0x00a79021, 0x00a79421, 0x00a7984e, 0x00a7a021, 0x00a7a432, 0x00a7a82e, 0x00a7ac21, 0x00a7b02e,
+  0x00a7b434, 0x00a7b821, 0x00a7bc2f, 0x00a7c039, 0x00a7c428, 0x00a7c833, 0x00a7cc1b, 0x00a7cc34,
+  0x00a7d032, 0x00a7d42c, 0x00a7d833, 0x00a7dc22, 0x00a7e02d, 0x00a7e435, 0x00a7e823, 0x00a7ec32,
+  0x00a7f034, 0x00a7f421, 0x00a7f822, 0x00a7fc23, 0x00a80032, 0x00a80421, 0x00a80832, 0x00a80c29,
+  0x00a8102f, 0x00a81439, 0x00a8182e, 0x00a81c2c, 0x00a82039, 0x00a82421, 0x00a82834, 0x00a82c24,
+  0x00a83033, 0x00a83432, 0x00a8384e, 0x00a84021, 0x00a84422, 0x00a84823, 0x00a84c32, 0x00a8502e,
+  0x00a85473, 0x00a8602c, 0x00a86429, 0x00a86821, 0x00a86c39, 0x00a87033, 0x00a8742c, 0x00a87834,
+  0x00a87c2e, 0x00a88032, 0x00a88433, 0x00a888af, 0x00a89c25, 0x00a8a033, 0x00a8a423, 0x00a8a833,
+  0x00a8ac39, 0x00a8b027, 0x00a8b429, 0x00a8b821, 0x00a8bc49, 0x00a8c435, 0x00a8c834, 0x00a8cc25,
+  0x00a8d028, 0x00a8d452, 0x00a8dc53, 0x00a8e454, 0x00a8ec25, 0x00a8f034, 0x00a8f42b, 0x00a8f827,
+  0x00a8fc33, 0x00a90021, 0x00a9042b, 0x00a9082e, 0x00a90c2f, 0x00a91035, 0x00a9142f, 0x00a91821,
+  0x00a91c32, 0x00a9202e, 0x00a9242e, 0x00a92825, 0x00a92c29, 0x00a9302f, 0x00a93423, 0x00a9382d,
+  0x00a93c25, 0x00a9402c, 0x00a9442c, 0x00a94833, 0x00a94c21, 0x00a95029, 0x00a9542e, 0x00a95814,
+  0x00a95832, 0x00a95c22, 0x00a96026, 0x00a96422, 0x00a9681b, 0x00a96825, 0x00a96c50, 0x00a97434,
+  0x00a97823, 0x00a97c2e, 0x00a98025, 0x00a98425, 0x00a98829, 0x00a98c33, 0x00a9901b, 0x00a9902f,
+  0x00a99434, 0x00a99832, 0x00a99c23, 0x00a9a037, 0x00a9a42e, 0x00a9a82e, 0x00a9ac34, 0x00a9b030,
+  0x00a9b42c, 0x00a9b82b, 0x00a9bc2c, 0x00a9c033, 0x00a9c435, 0x00a9c82d, 0x00a9cc2f, 0x00a9d035,
+  0x00a9d44c, 0x00a9dc34, 0x00a9e024, 0x00a9e422, 0x00a9e832, 0x00a9ec29, 0x00a9f032, 0x00a9f429,
+  0x00a9f829, 0x00a9fc34, 0x00aa0052, 0x00aa0828, 0x00aa0c34, 0x00aa1025, 0x00aa1429, 0x00aa182f,
+  0x00aa1c29, 0x00aa2029, 0x00aa242b, 0x00aa2829, 0x00aa2c2d, 0x00aa3021, 0x00aa3430, 0x00aa382d,
+  0x00aa3c29, 0x00aa4033, 0x00aa441b, 0x00aa4425, 0x00aa4822, 0x00aa4c21, 0x00aa5034, 0x00aa5429,
+  0x00aa5824, 0x00aa5c39, 0x00aa6025, 0x00aa6434, 0x00aa6837, 0x00aa6c27, 0x00aa7025, 0x00aa741b,
+  0x00aa7432, 0x00aa7829, 0x00aa7c33, 0x00aa8025, 0x00aa842f, 0x00aa8845, 0x00aa9025, 0x00aa9433,
+  0x00aa982f, 0x00aa9c25, 0x00aaa029, 0x00aaa42e, 0x00aaa834, 0x00aaac2f, 0x00aab027, 0x00aab42c,
+  0x00aab852, 0x00aac073, 0x00aacc29, 0x00aad053, 0x00aad828, 0x00aadc2d, 0x00aae021, 0x00aae42c,
+  0x00aae833, 0x00aaec34, 0x00aaf02c, 0x00aaf42f, 0x00aaf821, 0x00aafc33, 0x00ab0027, 0x00ab0428,
+  0x00ab0821, 0x00ab0c23, 0x00ab1034, 0x00ab1447, 0x00ab1c24, 0x00ab2027, 0x00ab2426, 0x00ab2830,
+  0x00ab2c24, 0x00ab3032, 0x00ab3422, 0x00ab3822, 0x00ab3c24, 0x00ab4025, 0x00ab442d, 0x00ab4852,
+  0x00ab5033, 0x00ab5429, 0x00ab5825, 0x00ab5c29, 0x00ab602f, 0x00ab6432, 0x00ab681b, 0x00ab6821,
+  0x00ab6c36, 0x00ab7034, 0x00ab7434, 0x00ab7835, 0x00ab7c32, 0x00ab8029, 0x00ab8432, 0x00ab8829,
+  0x00ab8c2f, 0x00ab9052, 0x00ab9832, 0x00ab9c33, 0x00aba025, 0x00aba42f, 0x00aba825, 0x00abac22,
+  0x00abb025, 0x00abb425, 0x00abb829, 0x00abbc2d, 0x00abc02f, 0x00abc436, 0x00abc834, 0x00abcc25,
+  0x00abd03a, 0x00abd429, 0x00abd832, 0x00abdc33, 0x00abe033, 0x00abe421, 0x00abe82f, 0x00abec23,
+  0x00abf027, 0x00abf430, 0x00abf836, 0x00abfc32, 0x00ac0028, 0x00ac0433, 0x00ac0814, 0x00ac0828,
+  0x00ac0c45, 0x00ac1421, 0x00ac1859, 0x00ac2032, 0x00ac241b, 0x00ac2432, 0x00ac282e, 0x00ac2c21,
+  0x00ac3029, 0x00ac3425, 0x00ac3834, 0x00ac3c32, 0x00ac4036, 0x00ac442c, 0x00ac482e, 0x00ac4c29,
+  0x00ac5033, 0x00ac5433, 0x00ac581b, 0x00ac5828, 0x00ac5c1b, 0x00ac5c29, 0x00ac604c, 0x00ac6821,
+  0x00ac6c30, 0x00ac7025, 0x00ac742e, 0x00ac7823, 0x00ac7c2c, 0x00ac8032, 0x00ac8433, 0x00ac8837,
+  0x00ac8c35, 0x00ac9025, 0x00ac944e, 0x00ac9c2b, 0x00aca047, 0x00aca829, 0x00acac34, 0x00acb034,
+  0x00acb425, 0x00acb832, 0x00acbc25, 0x00acc023, 0x00acc425, 0x00acc853, 0x00acd030, 0x00acd421,
+  0x00acd825, 0x00acdc50, 0x00ace423, 0x00ace82e, 0x00acec23, 0x00acf029, 0x00acf430, 0x00acf832,
+  0x00acfc2f, 0x00ad0032, 0x00ad0428, 0x00ad0834, 0x00ad0c28, 0x00ad1032, 0x00ad1424, 0x00ad1832,
+  0x00ad1c2f, 0x00ad202e, 0x00ad2423, 0x00ad280f, 0x00ad2814, 0x00ad280f, 0x00ad281a, 0x00ad281a,
+  0x00ad2803, 0x00ad2829, 0x00ad2c39, 0x00ad3034, 0x00ad344d, 0x00ad3c2c, 0x00ad402d, 0x00ad4423,
+  0x00ad4825, 0x00ad4c25, 0x00ad502c, 0x00ad5421, 0x00ad5828, 0x00ad5c2d, 0x00ad6044, 0x00ad6821,
+  0x00ad6c35, 0x00ad7025, 0x00ad7421, 0x00ad782f, 0x00ad7c65, 0x00ad8829, 0x00ad8c33, 0x00ad9032,
+  0x00ad9432, 0x00ad9829, 0x00ad9c39, 0x00ada032, 0x00ada42c, 0x00ada84d, 0x00adb023, 0x00adb436,
+  0x00adb824, 0x00adbc24, 0x00adc02f, 0x00adc449, 0x00adcc39, 0x00add025, 0x00add425, 0x00add845,
+  0x00ade049, 0x00ade827, 0x00adec21, 0x00adf029, 0x00adf421, 0x00adf82f, 0x00adfc21, 0x00ae0021,
+  0x00ae042f, 0x00ae082f, 0x00ae0c4f, 0x00ae1432, 0x00ae1833, 0x00ae1c28, 0x00ae2033, 0x00ae241b,
+  0x00ae2435, 0x00ae2825, 0x00ae2c2c, 0x00ae3074, 0x00ae3c2d, 0x00ae402d, 0x00ae4427, 0x00ae4835,
+  0x00ae4c35, 0x00ae5032, 0x00ae5421, 0x00ae5830, 0x00ae5c25, 0x00ae602e, 0x00ae6425, 0x00ae6823,
+  0x00ae6c33, 0x00ae702b, 0x00ae7435, 0x00ae7827, 0x00ae7c24, 0x00ae802b, 0x00ae8446, 0x00ae8c2f,
+  0x00ae901b, 0x00ae9027, 0x00ae9434, 0x00ae9825, 0x00ae9c34, 0x00aea054, 0x00aea82c, 0x00aeac28,
+  0x00aeb029, 0x00aeb434, 0x00aeb830, 0x00aebc33, 0x00aec01b, 0x00aec032, 0x00aec433, 0x00aec832,
+  0x00aecc33, 0x00aed033, 0x00aed429, 0x00aed834, 0x00aedc2c, 0x00aee04e, 0x00aee82f, 0x00aeec1b,
+  0x00aeec33, 0x00aef021, 0x00aef429, 0x00aef825, 0x00aefc33, 0x00af0033, 0x00af041b, 0x00af0433,
+  0x00af081b, 0x00af0821, 0x00af0c1b, 0x00af0c34, 0x00af1027, 0x00af141b, 0x00af1432, 0x00af1842,
+  0x00af202f, 0x00af2433, 0x00af281b, 0x00af282d, 0x00af2c25, 0x00af3025, 0x00af3425, 0x00af3848,
+  0x00af4032, 0x00af4429, 0x00af482c, 0x00af4c32, 0x00af5032, 0x00af5433, 0x00af5834, 0x00af5c25,
+  0x00af6029, 0x00af6428, 0x00af6832, 0x00af6c1b, 0x00af6c33, 0x00af702d, 0x00af7434, 0x00af7834,
+  0x00af7c26, 0x00af8023, 0x00af8441, 0x00af8c27, 0x00af9033, 0x00af941b, 0x00af9425, 0x00af9825,
+  0x00af9c29, 0x00afa033, 0x00afa421, 0x00afa824, 0x00afac25, 0x00afb02f, 0x00afb421, 0x00afb84d,
+  0x00afc029, 0x00afc433, 0x00afc835, 0x00afcc22, 0x00afd027, 0x00afd434, 0x00afd827, 0x00afdc33,
+  0x00afe02f, 0x00afe42e, 0x00afe833, 0x00afec25, 0x00aff033, 0x00aff425, 0x00aff821, 0x00affc28,
+  0x00b00029, 0x00b00421, 0x00b00836, 0x00b00c27, 0x00b0102e, 0x00b0142f, 0x00b01829, 0x00b01c29,
+  0x00b02025, 0x00b0242e, 0x00b02833, 0x00b02c35, 0x00b0302f, 0x00b03426, 0x00b03833, 0x00b03c34,
+  0x00b04021, 0x00b04423, 0x00b04821, 0x00b04c21, 0x00b05034, 0x00b05432, 0x00b05821, 0x00b05c2d,
+  0x00b06021, 0x00b06434, 0x00b06834, 0x00b06c32, 0x00b07023, 0x00b07432, 0x00b07833, 0x00b07c21,
+  0x00b08035, 0x00b08422, 0x00b08828, 0x00b08c33, 0x00b09029, 0x00b09433, 0x00b09834, 0x00b09c2c,
+  0x00b0a027, 0x00b0a433, 0x00b0a821, 0x00b0ac54, 0x00b0b449, 0x00b0bc39, 0x00b0c033, 0x00b0c434,
+  0x00b0c829, 0x00b0cc29, 0x00b0d024, 0x00b0d469, 0x00b0e034, 0x00b0e42c, 0x00b0e821, 0x00b0ec35,
+  0x00b0f04f, 0x00b0f854, 0x00b1002f, 0x00b10428, 0x00b10832, 0x00b10c28, 0x00b11024, 0x00b11432,
+  0x00b1182d, 0x00b11c45, 0x00b1241b, 0x00b1242d, 0x00b12834, 0x00b12c2e, 0x00b1304c, 0x00b13821,
+  0x00b13c28, 0x00b1402f, 0x00b14422, 0x00b14824, 0x00b14c2e, 0x00b1501b, 0x00b15021, 0x00b15429,
+  0x00b15832, 0x00b15c26, 0x00b16027, 0x00b16432, 0x00b1682e, 0x00b16c28, 0x00b1702e, 0x00b1742c,
+  0x00b1784c, 0x00b18022, 0x00b18429, 0x00b18821, 0x00b18c29, 0x00b19021, 0x00b19423, 0x00b19833,
+  0x00b19c21, 0x00b1a035, 0x00b1a428, 0x00b1a829, 0x00b1ac24, 0x00b1b021, 0x00b1b42c, 0x00b1b829,
+  0x00b1bc2f, 0x00b1c02e, 0x00b1c429, 0x00b1c829, 0x00b1cc25, 0x00b1d01b, 0x00b1d034, 0x00b1d421,
+  0x00b1d825, 0x00b1dc29, 0x00b1e029, 0x00b1e425, 0x00b1e832, 0x00b1ec2f, 0x00b1f032, 0x00b1f430,
+  0x00b1f833, 0x00b1fc23, 0x00b20029, 0x00b20424, 0x00b20833, 0x00b20c1b, 0x00b20c29, 0x00b21025,
+  0x00b2142f, 0x00b2182e, 0x00b21c21, 0x00b22037, 0x00b2242e, 0x00b22835, 0x00b22c2e, 0x00b23029,
+  0x00b23425, 0x00b23832, 0x00b23c39, 0x00b24026, 0x00b24436, 0x00b24821, 0x00b24c2e, 0x00b25039,
+  0x00b2542f, 0x00b25827, 0x00b25c35, 0x00b26032, 0x00b26433, 0x00b26821, 0x00b26c32, 0x00b2702b,
+  0x00b2742d, 0x00b2782f, 0x00b27c29, 0x00b28025, 0x00b28443, 0x00b28c28, 0x00b29029, 0x00b2941b,
+  0x00b29423, 0x00b2982f, 0x00b29c32, 0x00b2a034, 0x00b2a424, 0x00b2a823, 0x00b2ac2d, 0x00b2b02f,
+  0x00b2b434, 0x00b2b825, 0x00b2bc21, 0x00b2c033, 0x00b2c41b, 0x00b2c454, 0x00b2cc28, 0x00b2d02c,
+  0x00b2d421, 0x00b2d821, 0x00b2dc21, 0x00b2e032, 0x00b2e41b, 0x00b2e421, 0x00b2e82e, 0x00b2ec52,
+  0x00b2f432, 0x00b2f833, 0x00b2fc29, 0x00b30021, 0x00b3043a, 0x00b3082d, 0x00b30c2e, 0x00b31034,
+  0x00b31434, 0x00b31834, 0x00b31c2e, 0x00b3202c, 0x00b32429, 0x00b32829, 0x00b32c21, 0x00b33029,
+  0x00b33425, 0x00b33829, 0x00b33c2f, 0x00b34023, 0x00b34423, 0x00b3482d, 0x00b34c32, 0x00b35050,
+  0x00b35821, 0x00b35c33, 0x00b36039, 0x00b36433, 0x00b36832, 0x00b36c21, 0x00b3701b, 0x00b3702e,
+  0x00b37433, 0x00b3781b, 0x00b37835, 0x00b37c29, 0x00b38045, 0x00b3882f, 0x00b38c27, 0x00b39024,
+  0x00b39425, 0x00b39861, 0x00b3a42b, 0x00b3a834, 0x00b3ac21, 0x00b3b034, 0x00b3b421, 0x00b3b849,
+  0x00b3c039, 0x00b3c41b, 0x00b3c430, 0x00b3c854, 0x00b3d032, 0x00b3d434, 0x00b3d833, 0x00b3dc39,
+  0x00b3e032, 0x00b3e421, 0x00b3e839, 0x00b3ec26, 0x00b3f025, 0x00b3f429, 0x00b3f823, 0x00b3fc21,
+  0x00b40033, 0x00b40429, 0x00b40829, 0x00b40c32, 0x00b4104d, 0x00b4181b, 0x00b41834, 0x00b41c25,
+  0x00b42029, 0x00b42421, 0x00b42832, 0x00b42c28, 0x00b43023, 0x00b43421, 0x00b43824, 0x00b43c2f,
+  0x00b4402c, 0x00b44433, 0x00b44835, 0x00b44c32, 0x00b45021, 0x00b45429, 0x00b45822, 0x00b45c28,
+  0x00b46021, 0x00b4641b, 0x00b4642c, 0x00b46829, 0x00b46c52, 0x00b47435, 0x00b47834, 0x00b47c24,
+  0x00b4802c, 0x00b48432, 0x00b4882e, 0x00b48c2f, 0x00b49021, 0x00b49422, 0x00b49833, 0x00b49c30,
+  0x00b4a025, 0x00b4a429, 0x00b4a81b, 0x00b4a841, 0x00b4b025, 0x00b4b42f, 0x00b4b823, 0x00b4bc2e,
+  0x00b4c029, 0x00b4c432, 0x00b4c82f, 0x00b4cc34, 0x00b4d025, 0x00b4d425, 0x00b4d829, 0x00b4dc32,
+  0x00b4e029, 0x00b4e425, 0x00b4e82d, 0x00b4ec33, 0x00b4f030, 0x00b4f42f, 0x00b4f832, 0x00b4fc33,
+  0x00b50025, 0x00b5041b, 0x00b5042d, 0x00b50829, 0x00b50c29, 0x00b5104c, 0x00b51828, 0x00b51c25,
+  0x00b52032, 0x00b52425, 0x00b5281b, 0x00b52834, 0x00b52c4c, 0x00b53421, 0x00b5382c, 0x00b53c32,
+  0x00b5404e, 0x00b54821, 0x00b54c33, 0x00b5501b, 0x00b55034, 0x00b5544d, 0x00b55c21, 0x00b5602c,
+  0x00b56433, 0x00b56823, 0x00b56c21, 0x00b5702c, 0x00b5742c, 0x00b57849, 0x00b58033, 0x00b58454,
+  0x00b58c1b, 0x00b58c30, 0x00b5901b, 0x00b59034, 0x00b59423, 0x00b59825, 0x00b59c25, 0x00b5a025,
+  0x00b5a433, 0x00b5a832, 0x00b5ac1b, 0x00b5ac34, 0x00b5b032, 0x00b5b429, 0x00b5b825, 0x00b5bc2c,
+  0x00b5c02d, 0x00b5c435, 0x00b5c82f, 0x00b5cc26, 0x00b5d02f, 0x00b5d429, 0x00b5d82e, 0x00b5dc24,
+  0x00b5e028, 0x00b5e425, 0x00b5e834, 0x00b5ec23, 0x00b5f034, 0x00b5f42c, 0x00b5f824, 0x00b5fc25,
+  0x00b60064, 0x00b60c2f, 0x00b61025, 0x00b6142f, 0x00b61824, 0x00b61c26, 0x00b62044, 0x00b62834,
+  0x00b62c35, 0x00b6302f, 0x00b63425, 0x00b63829, 0x00b63c25, 0x00b6401b, 0x00b64027, 0x00b6442e,
+  0x00b64833, 0x00b64c2e, 0x00b6502f, 0x00b65445, 0x00b65c6c, 0x00b66835, 0x00b66c27, 0x00b6702d,
+  0x00b67435, 0x00b67821, 0x00b67c27, 0x00b68025, 0x00b68427, 0x00b68824, 0x00b68c54, 0x00b6942c,
+  0x00b69835, 0x00b69c25, 0x00b6a048, 0x00b6a829, 0x00b6ac39, 0x00b6b02f, 0x00b6b425, 0x00b6b833,
+  0x00b6bc21, 0x00b6c030, 0x00b6c425, 0x00b6c821, 0x00b6cc25, 0x00b6d034, 0x00b6d425, 0x00b6d82f,
+  0x00b6dc45, 0x00b6e429, 0x00b6e82f, 0x00b6ec32, 0x00b6f026, 0x00b6f441, 0x00b6fc29, 0x00b70052,
+  0x00b7084e, 0x00b71021, 0x00b7142c, 0x00b7182f, 0x00b71c55, 0x00b7242e, 0x00b72833, 0x00b72c1b,
+  0x00b72c32, 0x00b73027, 0x00b73424, 0x00b73823, 0x00b73c25, 0x00b74028, 0x00b7442d, 0x00b7482e,
+  0x00b74c6e, 0x00b7582f, 0x00b75c1b, 0x00b75c39, 0x00b76021, 0x00b76421, 0x00b7681b, 0x00b7682c,
+  0x00b76c22, 0x00b7702d, 0x00b77432, 0x00b77821, 0x00b77c29, 0x00b78023, 0x00b7842c, 0x00b78834,
+  0x00b78c33, 0x00b79024, 0x00b79429, 0x00b7982e, 0x00b79c23, 0x00b7a034, 0x00b7a474, 0x00b7b029,
+  0x00b7b430, 0x00b7b850, 0x00b7c025, 0x00b7c435, 0x00b7c833, 0x00b7cc21, 0x00b7d029, 0x00b7d439,
+  0x00b7d82d, 0x00b7dc29, 0x00b7e054, 0x00b7e839, 0x00b7ec25, 0x00b7f023, 0x00b7f445, 0x00b7fc33,
+  0x00b8004c, 0x00b80835, 0x00b80c27, 0x00b8102c, 0x00b81454, 0x00b81c21, 0x00b82039, 0x00b82443,
+  0x00b82c35, 0x00b83033, 0x00b83424, 0x00b83846, 0x00b84027, 0x00b8442e, 0x00b84837, 0x00b84c24,
+  0x00b8501b, 0x00b85025, 0x00b8541b, 0x00b85421, 0x00b8582f, 0x00b85c2e, 0x00b86054, 0x00b8682c,
+  0x00b86c30, 0x00b87050, 0x00b87845, 0x00b88031, 0x00b88439, 0x00b88821, 0x00b88c25, 0x00b8902d,
+  0x00b89434, 0x00b8982f, 0x00b89c32, 0x00b8a033, 0x00b8a432, 0x00b8a832, 0x00b8ac32, 0x00b8b048,
+  0x00b8b823, 0x00b8bc25, 0x00b8c001, 0x00b8c035, 0x00b8c42d, 0x00b8c823, 0x00b8cc2e, 0x00b8d02f,
+  0x00b8d429, 0x00b8d847, 0x00b8e023, 0x00b8e422, 0x00b8e81b, 0x00b8e821, 0x00b8ec21, 0x00b8f045,
+  0x00b8f829, 0x00b8fc25, 0x00b90033, 0x00b90433, 0x00b90834, 0x00b90c74, 0x00b91821, 0x00b91c35,
+  0x00b92029, 0x00b9242c, 0x00b9281b, 0x00b92830, 0x00b92c1b, 0x00b92c25, 0x00b93025, 0x00b9342e,
+  0x00b9382f, 0x00b93c21, 0x00b94043, 0x00b9481b, 0x00b94850, 0x00b95021, 0x00b95427, 0x00b9582c,
+  0x00b95c2f, 0x00b96034, 0x00b96425, 0x00b96829, 0x00b96c21, 0x00b97029, 0x00b97432, 0x00b9782f,
+  0x00b97c28, 0x00b9802c, 0x00b98425, 0x00b98830, 0x00b98c3a, 0x00b99023, 0x00b99434, 0x00b99829,
+  0x00b99c29, 0x00b9a021, 0x00b9a43a, 0x00b9a824, 0x00b9ac34, 0x00b9b02e, 0x00b9b42e, 0x00b9b821,
+  0x00b9bc33, 0x00b9c01b, 0x00b9c02f, 0x00b9c425, 0x00b9c826, 0x00b9cc32, 0x00b9d02d, 0x00b9d42e,
+  0x00b9d82d, 0x00b9dc29, 0x00b9e023, 0x00b9e422, 0x00b9e82e, 0x00b9ec29, 0x00b9f025, 0x00b9f430,
+  0x00b9f81b, 0x00b9f82c, 0x00b9fc2c, 0x00ba0022, 0x00ba0432, 0x00ba0826, 0x00ba0c29, 0x00ba1030,
+  0x00ba141b, 0x00ba1425, 0x00ba1829, 0x00ba1c25, 0x00ba2033, 0x00ba2421, 0x00ba2823, 0x00ba2c34,
+  0x00ba302c, 0x00ba3429, 0x00ba3833, 0x00ba3c1b, 0x00ba3c29, 0x00ba401b, 0x00ba4035, 0x00ba4452,
+  0x00ba4c2e, 0x00ba502b, 0x00ba5428, 0x00ba5829, 0x00ba5c25, 0x00ba6039, 0x00ba6433, 0x00ba681b,
+  0x00ba682d, 0x00ba6c30, 0x00ba7037, 0x00ba7436, 0x00ba7823, 0x00ba7c57, 0x00ba8434, 0x00ba8829,
+  0x00ba8c2c, 0x00ba9029, 0x00ba9434, 0x00ba9828, 0x00ba9c25, 0x00baa027, 0x00baa433, 0x00baa833,
+  0x00baac25, 0x00bab021, 0x00bab427, 0x00bab828, 0x00babc25, 0x00bac025, 0x00bac428, 0x00bac845,
+  0x00bad021, 0x00bad426, 0x00bad832, 0x00badc45, 0x00bae429, 0x00bae82c, 0x00baec2c, 0x00baf025,
+  0x00baf427, 0x00baf821, 0x00bafc29, 0x00bb0039, 0x00bb041b, 0x00bb042c, 0x00bb0828, 0x00bb0c2e,
+  0x00bb102d, 0x00bb146f, 0x00bb2029, 0x00bb2425, 0x00bb2829, 0x00bb2c52, 0x00bb342c, 0x00bb3829,
+  0x00bb3c33, 0x00bb4021, 0x00bb442e, 0x00bb4822, 0x00bb4c33, 0x00bb501b, 0x00bb5021, 0x00bb5433,
+  0x00bb581b, 0x00bb5824, 0x00bb5c24, 0x00bb6035, 0x00bb6429, 0x00bb682e, 0x00bb6c24, 0x00bb7035,
+  0x00bb7425, 0x00bb7821, 0x00bb7c21, 0x00bb8033, 0x00bb8425, 0x00bb8854, 0x00bb9021, 0x00bb942f,
+  0x00bb981b, 0x00bb981b, 0x00bb9832, 0x00bb9c25, 0x00bba032, 0x00bba421, 0x00bba845, 0x00bbb033,
+  0x00bbb425, 0x00bbb82d, 0x00bbbc39, 0x00bbc054, 0x00bbc858, 0x00bbd024, 0x00bbd433, 0x00bbd81b,
+  0x00bbd82f, 0x00bbdc21, 0x00bbe029, 0x00bbe423, 0x00bbe82e, 0x00bbec2e, 0x00bbf021, 0x00bbf41b,
+  0x00bbf429, 0x00bbf827, 0x00bbfc29, 0x00bc002c, 0x00bc041b, 0x00bc0433, 0x00bc081b, 0x00bc082e,
+  0x00bc0c2c, 0x00bc101b, 0x00bc1032, 0x00bc1432, 0x00bc181b, 0x00bc1827, 0x00bc1c28, 0x00bc202f,
+  0x00bc241b, 0x00bc2434, 0x00bc2821, 0x00bc2c29, 0x00bc3054, 0x00bc3832, 0x00bc3c33, 0x00bc4025,
+  0x00bc4433, 0x00bc481b, 0x00bc4827, 0x00bc4c2c, 0x00bc5025, 0x00bc5435, 0x00bc581b, 0x00bc5832,
+  0x00bc5c28, 0x00bc6036, 0x00bc6429, 0x00bc6830, 0x00bc6c32, 0x00bc704d, 0x00bc7833, 0x00bc7c21,
+  0x00bc8032, 0x00bc8428, 0x00bc8833, 0x00bc8c32, 0x00bc9021, 0x00bc9421, 0x00bc982f, 0x00bc9c32,
+  0x00bca02f, 0x00bca425, 0x00bca828, 0x00bcac1b, 0x00bcac24, 0x00bcb01b, 0x00bcb039, 0x00bcb42e,
+  0x00bcb824, 0x00bcbc28, 0x00bcc025, 0x00bcc41b, 0x00bcc429, 0x00bcc833, 0x00bccc1b, 0x00bccc24,
+  0x00bcd029, 0x00bcd434, 0x00bcd81b, 0x00bcd81b, 0x00bcd829, 0x00bcdc23, 0x00bce02f, 0x00bce429,
+  0x00bce825, 0x00bcec32, 0x00bcf049, 0x00bcf849, 0x00bd002e, 0x00bd042d, 0x00bd082e, 0x00bd0c24,
+  0x00bd1033, 0x00bd141b, 0x00bd1433, 0x00bd186d, 0x00bd242f, 0x00bd2833, 0x00bd2c25, 0x00bd301b,
+  0x00bd3029, 0x00bd342f, 0x00bd3829, 0x00bd3c39, 0x00bd402c, 0x00bd442f, 0x00bd4829, 0x00bd4c2f,
+  0x00bd5053, 0x00bd5823, 0x00bd5c58, 0x00bd6470, 0x00bd7024, 0x00bd742c, 0x00bd7833, 0x00bd7c1b,
+  0x00bd7c2e, 0x00bd8033, 0x00bd8425, 0x00bd8833, 0x00bd8c43, 0x00bd9422, 0x00bd9852, 0x00bda04e,
+  0x00bda834, 0x00bdac27, 0x00bdb02d, 0x00bdb42d, 0x00bdb834, 0x00bdbc2f, 0x00bdc023, 0x00bdc425,
+  0x00bdc81b, 0x00bdc854, 0x00bdd01b, 0x00bdd021, 0x00bdd421, 0x00bdd849, 0x00bde02f, 0x00bde42f,
+  0x00bde822, 0x00bdec32, 0x00bdf02e, 0x00bdf430, 0x00bdf821, 0x00bdfc24, 0x00be0074, 0x00be0c33,
+  0x00be1025, 0x00be1434, 0x00be1821, 0x00be1c1b, 0x00be1c1b, 0x00be1c2e, 0x00be202c, 0x00be2425,
+  0x00be281b, 0x00be2833, 0x00be2c1b, 0x00be2c35, 0x00be3032, 0x00be3433, 0x00be3832, 0x00be3c1b,
+  0x00be3c33, 0x00be401b, 0x00be4025, 0x00be4425, 0x00be4843, 0x00be5028, 0x00be542f, 0x00be581b,
+  0x00be581b, 0x00be5834, 0x00be5c1b, 0x00be5c34, 0x00be601b, 0x00be602e, 0x00be6425, 0x00be682c,
+  0x00be6c33, 0x00be701b, 0x00be7027, 0x00be742d, 0x00be782e, 0x00be7c23, 0x00be8032, 0x00be8434,
+  0x00be881b, 0x00be881b, 0x00be8832, 0x00be8c1b, 0x00be8c1b, 0x00be8c44, 0x00be9429, 0x00be982c,
+  0x00be9c4e, 0x00bea41b, 0x00bea425, 0x00bea82f, 0x00beac21, 0x00beb025, 0x00beb433, 0x00beb81b,
+  0x00beb82f, 0x00bebc44, 0x00bec42f, 0x00bec839, 0x00becc21, 0x00bed034, 0x00bed434, 0x00bed835,
+  0x00bedc2e, 0x00bee025, 0x00bee41b, 0x00bee434, 0x00bee825, 0x00beec25, 0x00bef034, 0x00bef42f,
+  0x00bef829, 0x00befc32, 0x00bf0033, 0x00bf042e, 0x00bf081b, 0x00bf084c, 0x00bf1021, 0x00bf1421,
+  0x00bf181b, 0x00bf182e, 0x00bf1c29, 0x00bf202e, 0x00bf242c, 0x00bf2842, 0x00bf3021, 0x00bf3449,
+  0x00bf3c25, 0x00bf4053, 0x00bf4823, 0x00bf4c35, 0x00bf5028, 0x00bf5429, 0x00bf5829, 0x00bf5c29,
+  0x00bf602e, 0x00bf6434, 0x00bf6829, 0x00bf6c2e, 0x00bf701b, 0x00bf7052, 0x00bf7833, 0x00bf7c21,
+  0x00bf802c, 0x00bf8434, 0x00bf8825, 0x00bf8c32, 0x00bf904b, 0x00bf9832, 0x00bf9c5a, 0x00bfa432,
+  0x00bfa821, 0x00bfac45, 0x00bfb42c, 0x00bfb82e, 0x00bfbc27, 0x00bfc04c, 0x00bfc845, 0x00bfd048,
+  0x00bfd82d, 0x00bfdc21, 0x00bfe022, 0x00bfe434, 0x00bfe829, 0x00bfec25, 0x00bff022, 0x00bff429,
+  0x00bff834, 0x00bffc49, 0x00c00429, 0x00c0082f, 0x00c00c74, 0x00c01821, 0x00c01c33, 0x00c0202e,
+  0x00c02427, 0x00c02835, 0x00c02c1b, 0x00c02c34, 0x00c03034, 0x00c03430, 0x00c03821, 0x00c03c25,
+  0x00c04025, 0x00c0441b, 0x00c04452, 0x00c04c33, 0x00c0501b, 0x00c05025, 0x00c05433, 0x00c0581b,
+  0x00c05823, 0x00c05c29, 0x00c06021, 0x00c06421, 0x00c06825, 0x00c06c23, 0x00c07025, 0x00c07433,
+  0x00c07825, 0x00c07c21, 0x00c0802c, 0x00c08434, 0x00c0882d, 0x00c08c30, 0x00c09033, 0x00c0941b,
+  0x00c09450, 0x00c09c1b, 0x00c09c25, 0x00c0a032, 0x00c0a426, 0x00c0a829, 0x00c0ac29, 0x00c0b033,
+  0x00c0b41b, 0x00c0b429, 0x00c0b845, 0x00c0c025, 0x00c0c421, 0x00c0c81b, 0x00c0c82e, 0x00c0cc29,
+  0x00c0d02e, 0x00c0d42c, 0x00c0d81b, 0x00c0d827, 0x00c0dc34, 0x00c0e034, 0x00c0e424, 0x00c0e854,
+  0x00c0f01b, 0x00c0f039, 0x00c0f433, 0x00c0f832, 0x00c0fc45, 0x00c10439, 0x00c10821, 0x00c10c35,
+  0x00c1102c, 0x00c1142e, 0x00c1181b, 0x00c11821, 0x00c11c32, 0x00c12021, 0x00c12423, 0x00c12822,
+  0x00c12c2e, 0x00c13029, 0x00c13427, 0x00c1381b, 0x00c13824, 0x00c13c29, 0x00c14054, 0x00c14835,
+  0x00c14c44, 0x00c1542f, 0x00c15823, 0x00c15c33, 0x00c16025, 0x00c1642e, 0x00c16825, 0x00c16c23,
+  0x00c17023, 0x00c17452, 0x00c17c29, 0x00c18030, 0x00c1842d, 0x00c18829, 0x00c18c23, 0x00c19032,
+  0x00c19425, 0x00c19825, 0x00c19c1b, 0x00c19c25, 0x00c1a022, 0x00c1a433, 0x00c1a823, 0x00c1ac2e,
+  0x00c1b021, 0x00c1b423, 0x00c1b853, 0x00c1c024, 0x00c1c42b, 0x00c1c828, 0x00c1cc24, 0x00c1d04c,
+  0x00c1d825, 0x00c1dc25, 0x00c1e023, 0x00c1e445, 0x00c1ec1b, 0x00c1ec2e, 0x00c1f025, 0x00c1f429,
+  0x00c1f829, 0x00c1fc1b, 0x00c1fc35, 0x00c2002f, 0x00c20429, 0x00c20829, 0x00c20c22, 0x00c2102c,
+  0x00c2142f, 0x00c21821, 0x00c21c1b, 0x00c21c32, 0x00c22021, 0x00c22429, 0x00c22834, 0x00c22c1b,
+  0x00c22c25, 0x00c2302f, 0x00c2344b, 0x00c23c39, 0x00c24032, 0x00c24441, 0x00c24c34, 0x00c25024,
+  0x00c2541b, 0x00c25425, 0x00c2582f, 0x00c25c25, 0x00c26021, 0x00c26434, 0x00c26833, 0x00c26c2c,
+  0x00c27021, 0x00c27430, 0x00c27823, 0x00c27c33, 0x00c2801b, 0x00c2801b, 0x00c28030, 0x00c28444,
+  0x00c28c27, 0x00c29021, 0x00c2942f, 0x00c29823, 0x00c29c21, 0x00c2a045, 0x00c2a832, 0x00c2ac23,
+  0x00c2b025, 0x00c2b434, 0x00c2b833, 0x00c2bc2c, 0x00c2c025, 0x00c2c41b, 0x00c2c434, 0x00c2c82e,
+  0x00c2cc29, 0x00c2d021, 0x00c2d425, 0x00c2d82d, 0x00c2dc29, 0x00c2e039, 0x00c2e452, 0x00c2ec2b,
+  0x00c2f01b, 0x00c2f025, 0x00c2f429, 0x00c2f824, 0x00c2fc1b, 0x00c2fc25, 0x00c30028, 0x00c30421,
+  0x00c30833, 0x00c30c1b, 0x00c30c2b, 0x00c3101b, 0x00c31025, 0x00c31427, 0x00c31829, 0x00c31c2e,
+  0x00c3201b, 0x00c32025, 0x00c3241b, 0x00c32422, 0x00c32825, 0x00c32c30, 0x00c33025, 0x00c33433,
+  0x00c3381b, 0x00c33830, 0x00c33c33, 0x00c3401b, 0x00c34025, 0x00c34425, 0x00c34830, 0x00c34c34,
+  0x00c35029, 0x00c3544e, 0x00c35c2c, 0x00c3601b, 0x00c36029, 0x00c3642e, 0x00c3682b, 0x00c36c23,
+  0x00c3701b, 0x00c37034, 0x00c37434, 0x00c37821, 0x00c37c29, 0x00c38039, 0x00c3841b, 0x00c38421,
+  0x00c38834, 0x00c38c2e, 0x00c39035, 0x00c3941b, 0x00c3942f, 0x00c3982e, 0x00c39c25, 0x00c3a030,
+  0x00c3a421, 0x00c3a834, 0x00c3ac27, 0x00c3b029, 0x00c3b42c, 0x00c3b821, 0x00c3bc25, 0x00c3c035,
+  0x00c3c434, 0x00c3c81b, 0x00c3c824, 0x00c3cc25, 0x00c3d029, 0x00c3d42e, 0x00c3d848, 0x00c3e025,
+  0x00c3e469, 0x00c3f04d, 0x00c3f827, 0x00c3fc72, 0x00c40842, 0x00c4102c, 0x00c41439, 0x00c41828,
+  0x00c41c1b, 0x00c41c53, 0x00c4242d, 0x00c42854, 0x00c4302e, 0x00c4342c, 0x00c4382f, 0x00c43c34,
+  0x00c44023, 0x00c44427, 0x00c44826, 0x00c44c32, 0x00c45032, 0x00c4541b, 0x00c45434, 0x00c45821,
+  0x00c45c25, 0x00c46025, 0x00c46430, 0x00c4682b, 0x00c46c2f, 0x00c47034, 0x00c4741b, 0x00c47434,
+  0x00c47836, 0x00c47c39, 0x00c48043, 0x00c4882e, 0x00c48c21, 0x00c49045, 0x00c49833, 0x00c49c2e,
+  0x00c4a02f, 0x00c4a432, 0x00c4a828, 0x00c4ac45, 0x00c4b439, 0x00c4b843, 0x00c4c029, 0x00c4c42f,
+  0x00c4c829, 0x00c4cc2f, 0x00c4d02c, 0x00c4d42d, 0x00c4d86f, 0x00c4e433, 0x00c4e81b, 0x00c4e823,
+  0x00c4ec29, 0x00c4f025, 0x00c4f428, 0x00c4f823, 0x00c4fc2c, 0x00c50024, 0x00c50433, 0x00c5081b,
+  0x00c5081b, 0x00c50825, 0x00c50c29, 0x00c51025, 0x00c51434, 0x00c51828, 0x00c51c2e, 0x00c5202e,
+  0x00c52434, 0x00c52854, 0x00c53029, 0x00c53428, 0x00c53827, 0x00c53c36, 0x00c5402c, 0x00c54429,
+  0x00c5482f, 0x00c54c24, 0x00c55034, 0x00c5542f, 0x00c5581b, 0x00c5582a, 0x00c55c25, 0x00c56029,
+  0x00c56433, 0x00c56832, 0x00c56c29, 0x00c5702b, 0x00c5742f, 0x00c57824, 0x00c57c33, 0x00c5801b,
+  0x00c58025, 0x00c58433, 0x00c5881b, 0x00c5884c, 0x00c59033, 0x00c59430, 0x00c5981b, 0x00c59829,
+  0x00c59c33, 0x00c5a01b, 0x00c5a021, 0x00c5a42c, 0x00c5a82e, 0x00c5ac32, 0x00c5b034, 0x00c5b457,
+  0x00c5bc1b, 0x00c5bc2b, 0x00c5c033, 0x00c5c42f, 0x00c5c81b, 0x00c5c833, 0x00c5cc1b, 0x00c5cc21,
+  0x00c5d029, 0x00c5d42f, 0x00c5d834, 0x00c5dc4d, 0x00c5e425, 0x00c5e82f, 0x00c5ec30, 0x00c5f021,
+  0x00c5f42c, 0x00c5f82e, 0x00c5fc29, 0x00c60028, 0x00c60432, 0x00c60829, 0x00c60c2e, 0x00c6102e,
+  0x00c6142e, 0x00c6181b, 0x00c61825, 0x00c61c1b, 0x00c61c4e, 0x00c62435, 0x00c6282b, 0x00c62c2e,
+  0x00c63028, 0x00c6342e, 0x00c6382c, 0x00c63c2c, 0x00c64028, 0x00c6442c, 0x00c64830, 0x00c64c33,
+  0x00c6501b, 0x00c65023, 0x00c65432, 0x00c65821, 0x00c65c26, 0x00c6602d, 0x00c66434, 0x00c66833,
+  0x00c66c33, 0x00c6701b, 0x00c67045, 0x00c67829, 0x00c67c33, 0x00c68025, 0x00c68430, 0x00c68833,
+  0x00c68c1b, 0x00c68c23, 0x00c6901b, 0x00c69025, 0x00c69425, 0x00c69872, 0x00c6a434, 0x00c6a81b,
+  0x00c6a839, 0x00c6ac29, 0x00c6b029, 0x00c6b42f, 0x00c6b839, 0x00c6bc1b, 0x00c6bc8e, 0x00c6cc32,
+  0x00c6d02e, 0x00c6d433, 0x00c6d825, 0x00c6dc2c, 0x00c6e02f, 0x00c6e429, 0x00c6e82c, 0x00c6ec21,
+  0x00c6f01b, 0x00c6f045, 0x00c6f821, 0x00c6fc1b, 0x00c6fc25, 0x00c7002e, 0x00c70454, 0x00c70c25,
+  0x00c71025, 0x00c7142c, 0x00c71833, 0x00c71c1b, 0x00c71c34, 0x00c72032, 0x00c72430, 0x00c7281b,
+  0x00c72833, 0x00c72c32, 0x00c7301b, 0x00c7302e, 0x00c73425, 0x00c7381b, 0x00c7382d, 0x00c73c34,
+  0x00c74033, 0x00c7441b, 0x00c7442f, 0x00c7482e, 0x00c74c35, 0x00c75033, 0x00c7541b, 0x00c7542f,
+  0x00c75825, 0x00c75c29, 0x00c76034, 0x00c7642c, 0x00c76845, 0x00c77025, 0x00c7742f, 0x00c7782e,
+  0x00c77c30, 0x00c78045, 0x00c78829, 0x00c78c53, 0x00c7941b, 0x00c79429, 0x00c79829, 0x00c79c2f,
+  0x00c7a052, 0x00c7a839, 0x00c7ac2f, 0x00c7b025, 0x00c7b42e, 0x00c7b82e, 0x00c7bc52, 0x00c7c427,
+  0x00c7c829, 0x00c7cc35, 0x00c7d021, 0x00c7d42c, 0x00c7d825, 0x00c7dc2f, 0x00c7e032, 0x00c7e433,
+  0x00c7e835, 0x00c7ec30, 0x00c7f024, 0x00c7f433, 0x00c7f82f, 0x00c7fc21, 0x00c80030, 0x00c80449,
+  0x00c80c33, 0x00c81039, 0x00c81429, 0x00c81821, 0x00c81c2c, 0x00c8201b, 0x00c8202b, 0x00c8242c,
+  0x00c82833, 0x00c82c21, 0x00c83021, 0x00c83427, 0x00c83823, 0x00c83c3a, 0x00c8402c, 0x00c84435,
+  0x00c84854, 0x00c8502c, 0x00c85434, 0x00c85834, 0x00c85c33, 0x00c8601b, 0x00c8602e, 0x00c8642d,
+  0x00c86821, 0x00c86c65, 0x00c87829, 0x00c87c25, 0x00c88033, 0x00c8841b, 0x00c88422, 0x00c88834,
+  0x00c88c54, 0x00c89425, 0x00c89825, 0x00c89c1b, 0x00c89c32, 0x00c8a029, 0x00c8a435, 0x00c8a824,
+  0x00c8ac33, 0x00c8b01b, 0x00c8b033, 0x00c8b41b, 0x00c8b422, 0x00c8b81b, 0x00c8b825, 0x00c8bc4d,
+  0x00c8c41b, 0x00c8c42c, 0x00c8c82f, 0x00c8cc32, 0x00c8d034, 0x00c8d421, 0x00c8d827, 0x00c8dc29,
+  0x00c8e029, 0x00c8e42c, 0x00c8e828, 0x00c8ec25, 0x00c8f028, 0x00c8f425, 0x00c8f833, 0x00c8fc2e,
+  0x00c90023, 0x00c90433, 0x00c9082e, 0x00c90c1b, 0x00c90c39, 0x00c91027, 0x00c91432, 0x00c9181b,
+  0x00c91832, 0x00c91c32, 0x00c92029, 0x00c92425, 0x00c9282f, 0x00c92c47, 0x00c93430, 0x00c9382c,
+  0x00c93c1b, 0x00c93c25, 0x00c94054, 0x00c94824, 0x00c94c23, 0x00c95025, 0x00c95439, 0x00c95825,
+  0x00c95c2c, 0x00c96029, 0x00c96454, 0x00c96c34, 0x00c97028, 0x00c97450, 0x00c97c30, 0x00c9801b,
+  0x00c98030, 0x00c98430, 0x00c9882f, 0x00c98c21, 0x00c99029, 0x00c99444, 0x00c99c1b, 0x00c99c27,
+  0x00c9a033, 0x00c9a433, 0x00c9a81b, 0x00c9a827, 0x00c9ac25, 0x00c9b032, 0x00c9b464, 0x00c9c033,
+  0x00c9c41b, 0x00c9c41b, 0x00c9c421, 0x00c9c825, 0x00c9cc2f, 0x00c9d025, 0x00c9d421, 0x00c9d825,
+  0x00c9dc32, 0x00c9e02c, 0x00c9e433, 0x00c9e82f, 0x00c9ec2e, 0x00c9f029, 0x00c9f429, 0x00c9f823,
+  0x00c9fc32, 0x00ca0034, 0x00ca0423, 0x00ca082e, 0x00ca0c2e, 0x00ca1025, 0x00ca1429, 0x00ca1821,
+  0x00ca1c33, 0x00ca202f, 0x00ca2432, 0x00ca2833, 0x00ca2c32, 0x00ca3025, 0x00ca3425, 0x00ca3833,
+  0x00ca3c1b, 0x00ca3c22, 0x00ca4025, 0x00ca4425, 0x00ca4832, 0x00ca4c4f, 0x00ca5423, 0x00ca5825,
+  0x00ca5c1b, 0x00ca5c2c, 0x00ca6021, 0x00ca6427, 0x00ca6821, 0x00ca6c2d, 0x00ca702e, 0x00ca7434,
+  0x00ca782c, 0x00ca7c52, 0x00ca8436, 0x00ca8829, 0x00ca8c39, 0x00ca9029, 0x00ca9421, 0x00ca9823,
+  0x00ca9c30, 0x00caa025, 0x00caa42f, 0x00caa81b, 0x00caa832, 0x00caac25, 0x00cab025, 0x00cab41b,
+  0x00cab434, 0x00cab827, 0x00cabc27, 0x00cac034, 0x00cac433, 0x00cac82c, 0x00cacc2e, 0x00cad02d,
+  0x00cad434, 0x00cad837, 0x00cadc33, 0x00cae01b, 0x00cae030, 0x00cae42d, 0x00cae82f, 0x00caec29,
+  0x00caf025, 0x00caf432, 0x00caf832, 0x00cafc33, 0x00cb0041, 0x00cb0832, 0x00cb0c21, 0x00cb102c,
+  0x00cb1433, 0x00cb181b, 0x00cb1825, 0x00cb1c1b, 0x00cb1c2f, 0x00cb201b, 0x00cb2035, 0x00cb2430,
+  0x00cb2821, 0x00cb2c28, 0x00cb3027, 0x00cb3424, 0x00cb382e, 0x00cb3c2c, 0x00cb4025, 0x00cb4427,
+  0x00cb4835, 0x00cb4c2f, 0x00cb5025, 0x00cb5439, 0x00cb582f, 0x00cb5c29, 0x00cb601b, 0x00cb6025,
+  0x00cb6437, 0x00cb681b, 0x00cb6834, 0x00cb6c24, 0x00cb7033, 0x00cb741b, 0x00cb7439, 0x00cb781b,
+  0x00cb781b, 0x00cb781b, 0x00cb7828, 0x00cb7c29, 0x00cb8029, 0x00cb8427, 0x00cb8829, 0x00cb8c21,
+  0x00cb9025, 0x00cb9424, 0x00cb9821, 0x00cb9c25, 0x00cba033, 0x00cba41b, 0x00cba434, 0x00cba84e,
+  0x00cbb025, 0x00cbb421, 0x00cbb823, 0x00cbbc21, 0x00cbc02e, 0x00cbc423, 0x00cbc835, 0x00cbcc33,
+  0x00cbd035, 0x00cbd444, 0x00cbdc1b, 0x00cbdc1b, 0x00cbdc25, 0x00cbe027, 0x00cbe41b, 0x00cbe432,
+  0x00cbe833, 0x00cbec36, 0x00cbf01b, 0x00cbf025, 0x00cbf424, 0x00cbf835, 0x00cbfc2e, 0x00cc0025,
+  0x00cc0435, 0x00cc0833, 0x00cc0c32, 0x00cc1029, 0x00cc1423, 0x00cc1833, 0x00cc1c21, 0x00cc202e,
+  0x00cc2439, 0x00cc2829, 0x00cc2c29, 0x00cc301b, 0x00cc301b, 0x00cc301b, 0x00cc3021, 0x00cc3433,
+  0x00cc381b, 0x00cc3850, 0x00cc4021, 0x00cc4433, 0x00cc4836, 0x00cc4c2d, 0x00cc5025, 0x00cc541b,
+  0x00cc5445, 0x00cc5c2c, 0x00cc6023, 0x00cc6432, 0x00cc6825, 0x00cc6c29, 0x00cc7025, 0x00cc7425,
+  0x00cc781b, 0x00cc7821, 0x00cc7c45, 0x00cc8429, 0x00cc8825, 0x00cc8c21, 0x00cc901b, 0x00cc9027,
+  0x00cc9454, 0x00cc9c2e, 0x00cca01b, 0x00cca021, 0x00cca41b, 0x00cca42c, 0x00cca833, 0x00ccac1b,
+  0x00ccac23, 0x00ccb054, 0x00ccb845, 0x00ccc025, 0x00ccc425, 0x00ccc821, 0x00cccc29, 0x00ccd02e,
+  0x00ccd42c, 0x00ccd832, 0x00ccdc21, 0x00cce045, 0x00cce833, 0x00ccec1b, 0x00ccec2f, 0x00ccf033,
+  0x00ccf42e, 0x00ccf835, 0x00ccfc25, 0x00cd0025, 0x00cd0424, 0x00cd082f, 0x00cd0c34, 0x00cd1025,
+  0x00cd1443, 0x00cd1c33, 0x00cd201b, 0x00cd201b, 0x00cd2033, 0x00cd2432, 0x00cd2830, 0x00cd2c27,
+  0x00cd3045, 0x00cd382e, 0x00cd3c1b, 0x00cd3c52, 0x00cd4421, 0x00cd481b, 0x00cd4825, 0x00cd4c1b,
+  0x00cd4c1b, 0x00cd4c2d, 0x00cd5021, 0x00cd5429, 0x00cd582d, 0x00cd5c4e, 0x00cd641b, 0x00cd641b,
+  0x00cd6454, 0x00cd6c52, 0x00cd7425, 0x00cd781b, 0x00cd7829, 0x00cd7c1b, 0x00cd7c1b, 0x00cd7c2b,
+  0x00cd801b, 0x00cd801b, 0x00cd8024, 0x00cd8433, 0x00cd881b, 0x00cd882c, 0x00cd8c25, 0x00cd9029,
+  0x00cd9439, 0x00cd982e, 0x00cd9c24, 0x00cda02e, 0x00cda44c, 0x00cdac1b, 0x00cdac30, 0x00cdb033,
+  0x00cdb41b, 0x00cdb437, 0x00cdb81b, 0x00cdb82c, 0x00cdbc2f, 0x00cdc025, 0x00cdc433, 0x00cdc845,
+  0x00cdd032, 0x00cdd425, 0x00cdd834, 0x00cddc32, 0x00cde045, 0x00cde829, 0x00cdec21, 0x00cdf01b,
+  0x00cdf01b, 0x00cdf025, 0x00cdf433, 0x00cdf81b, 0x00cdf834, 0x00cdfc1b, 0x00cdfc44, 0x00ce0435,
+  0x00ce0834, 0x00ce0c2c, 0x00ce1029, 0x00ce142c, 0x00ce1822, 0x00ce1c33, 0x00ce2034, 0x00ce2433,
+  0x00ce2825, 0x00ce2c1b, 0x00ce2c54, 0x00ce3434, 0x00ce3834, 0x00ce3c2f, 0x00ce402f, 0x00ce4433,
+  0x00ce4824, 0x00ce4c1b, 0x00ce4c2d, 0x00ce5034, 0x00ce5433, 0x00ce581b, 0x00ce5825, 0x00ce5c26,
+  0x00ce6045, 0x00ce6823, 0x00ce6c32, 0x00ce7021, 0x00ce7433, 0x00ce781b, 0x00ce782d, 0x00ce7c21,
+  0x00ce8065, 0x00ce8c35, 0x00ce9030, 0x00ce9433, 0x00ce981b, 0x00ce982f, 0x00ce9c24, 0x00cea032,
+  0x00cea429, 0x00cea839, 0x00ceac33, 0x00ceb01b, 0x00ceb033, 0x00ceb41b, 0x00ceb450, 0x00cebc54,
+  0x00cec42c, 0x00cec829, 0x00cecc36, 0x00ced01b, 0x00ced02c, 0x00ced431, 0x00ced829, 0x00cedc2f,
+  0x00cee036, 0x00cee463, 0x00cef02d, 0x00cef429, 0x00cef833, 0x00cefc1b, 0x00cefc1b, 0x00cefc1b,
+  0x00cefc44, 0x00cf0428, 0x00cf0874, 0x00cf1425, 0x00cf182e, 0x00cf1c21, 0x00cf202c, 0x00cf2432,
+  0x00cf281b, 0x00cf2829, 0x00cf2c39, 0x00cf301b, 0x00cf3033, 0x00cf3454, 0x00cf3c28, 0x00cf4023,
+  0x00cf441b, 0x00cf441b, 0x00cf4432, 0x00cf4833, 0x00cf4c33, 0x00cf5054, 0x00cf584d, 0x00cf6033,
+  0x00cf6435, 0x00cf681b, 0x00cf6825, 0x00cf6c28, 0x00cf701b, 0x00cf7029, 0x00cf7439, 0x00cf782e,
+  0x00cf7c29, 0x00cf801b, 0x00cf8021, 0x00cf8463, 0x00cf901b, 0x00cf902e, 0x00cf9424, 0x00cf981b,
+  0x00cf981b, 0x00cf9834, 0x00cf9c1b, 0x00cf9c21, 0x00cfa01b, 0x00cfa025, 0x00cfa41b, 0x00cfa42f,
+  0x00cfa825, 0x00cfac29, 0x00cfb029, 0x00cfb433, 0x00cfb81b, 0x00cfb81b, 0x00cfb829, 0x00cfbc33,
+  0x00cfc01b, 0x00cfc01b, 0x00cfc01b, 0x00cfc02d, 0x00cfc425, 0x00cfc827, 0x00cfcc2e, 0x00cfd054,
+  0x00cfd832, 0x00cfdc2f, 0x00cfe04c, 0x00cfe827, 0x00cfec21, 0x00cff028, 0x00cff425, 0x00cff845,
+  0x00d00029, 0x00d00439, 0x00d00833, 0x00d00c33, 0x00d0101b, 0x00d0102e, 0x00d0141b, 0x00d0141b,
+  0x00d01432, 0x00d0181b, 0x00d01852, 0x00d0201b, 0x00d0201b, 0x00d02033, 0x00d0241b, 0x00d02443,
+  0x00d02c28, 0x00d03021, 0x00d03433, 0x00d03828, 0x00d03c29, 0x00d04037, 0x00d04433, 0x00d04824,
+  0x00d04c1b, 0x00d04c25, 0x00d0502c, 0x00d0542e, 0x00d0582c, 0x00d05c45, 0x00d0642c, 0x00d0681b,
+  0x00d06829, 0x00d06c25, 0x00d07032, 0x00d0741b, 0x00d07445, 0x00d07c29, 0x00d0801b, 0x00d08033,
+  0x00d08445, 0x00d08c33, 0x00d0901b, 0x00d09029, 0x00d09452, 0x00d09c4e, 0x00d0a425, 0x00d0a833,
+  0x00d0ac30, 0x00d0b01b, 0x00d0b033, 0x00d0b429, 0x00d0b829, 0x00d0bc2c, 0x00d0c01b, 0x00d0c02f,
+  0x00d0c42e, 0x00d0c82d, 0x00d0cc21, 0x00d0d032, 0x00d0d41b, 0x00d0d433, 0x00d0d81b, 0x00d0d81b,
+  0x00d0d830, 0x00d0dc33, 0x00d0e034, 0x00d0e429, 0x00d0e829, 0x00d0ec25, 0x00d0f02f, 0x00d0f432,
+  0x00d0f833, 0x00d0fc29, 0x00d10034, 0x00d10421, 0x00d10830, 0x00d10c28, 0x00d11032, 0x00d1141b,
+  0x00d11421, 0x00d11829, 0x00d11c1b, 0x00d11c29, 0x00d12034, 0x00d12424, 0x00d12845, 0x00d13022,
+  0x00d1342c, 0x00d13833, 0x00d13c35, 0x00d1401b, 0x00d14052, 0x00d14839, 0x00d14c23, 0x00d15021,
+  0x00d15437, 0x00d15839, 0x00d15c21, 0x00d16022, 0x00d16422, 0x00d16834, 0x00d16c21, 0x00d17023,
+  0x00d1741b, 0x00d17429, 0x00d17839, 0x00d17c29, 0x00d1801b, 0x00d18030, 0x00d18433, 0x00d18836,
+  0x00d18c25, 0x00d1902e, 0x00d1941b, 0x00d19445, 0x00d19c33, 0x00d1a01b, 0x00d1a033, 0x00d1a41b,
+  0x00d1a432, 0x00d1a82c, 0x00d1ac32, 0x00d1b025, 0x00d1b433, 0x00d1b834, 0x00d1bc25, 0x00d1c01b,
+  0x00d1c01b, 0x00d1c032, 0x00d1c421, 0x00d1c845, 0x00d1d025, 0x00d1d433, 0x00d1d81b, 0x00d1d845,
+  0x00d1e027, 0x00d1e425, 0x00d1e825, 0x00d1ec29, 0x00d1f05a, 0x00d1f839, 0x00d1fc30, 0x00d2003a,
+  0x00d2041b, 0x00d20424, 0x00d20839, 0x00d20c21, 0x00d21023, 0x00d2142e, 0x00d2181b, 0x00d21838,
+  0x00d21c29, 0x00d2202d, 0x00d22425, 0x00d22828, 0x00d22c30, 0x00d2301b, 0x00d2302e, 0x00d23432,
+  0x00d23833, 0x00d23c29, 0x00d2401b, 0x00d2401b, 0x00d24034, 0x00d24441, 0x00d24c33, 0x00d2501b,
+  0x00d25033, 0x00d25423, 0x00d25833, 0x00d25c34, 0x00d26033, 0x00d2641b, 0x00d26435, 0x00d26829,
+  0x00d26c33, 0x00d2701b, 0x00d27029, 0x00d2742c, 0x00d27845, 0x00d28023, 0x00d28425, 0x00d2882d,
+  0x00d28c34, 0x00d2902d, 0x00d29445, 0x00d29c29, 0x00d2a025, 0x00d2a449, 0x00d2ac2e, 0x00d2b025,
+  0x00d2b428, 0x00d2b821, 0x00d2bc34, 0x00d2c035, 0x00d2c42e, 0x00d2c825, 0x00d2cc30, 0x00d2d033,
+  0x00d2d430, 0x00d2d82f, 0x00d2dc29, 0x00d2e02c, 0x00d2e421, 0x00d2e81b, 0x00d2e82f, 0x00d2ec1b,
+  0x00d2ec33, 0x00d2f01b, 0x00d2f027, 0x00d2f432, 0x00d2f833, 0x00d2fc1b, 0x00d2fc1b, 0x00d2fc24,
+  0x00d3002d, 0x00d30427, 0x00d3082f, 0x00d30c33, 0x00d3101b, 0x00d3101b, 0x00d31045, 0x00d31829,
+  0x00d31c2e, 0x00d32026, 0x00d32425, 0x00d32835, 0x00d32c1b, 0x00d32c1b, 0x00d32c25, 0x00d33033,
+  0x00d3341b, 0x00d3341b, 0x00d33425, 0x00d33823, 0x00d33c32, 0x00d34034, 0x00d34445, 0x00d34c25,
+  0x00d35033, 0x00d3541b, 0x00d3541b, 0x00d35423, 0x00d3581b, 0x00d35825, 0x00d35c25, 0x00d3601b,
+  0x00d36034, 0x00d36428, 0x00d36833, 0x00d36c1b, 0x00d36c21, 0x00d3702d, 0x00d37425, 0x00d37821,
+  0x00d37c25, 0x00d38024, 0x00d38432, 0x00d3882f, 0x00d38c28, 0x00d39032, 0x00d3942b, 0x00d39830,
+  0x00d39c27, 0x00d3a034, 0x00d3a41b, 0x00d3a424, 0x00d3a825, 0x00d3ac32, 0x00d3b01b, 0x00d3b01b,
+  0x00d3b024, 0x00d3b41b, 0x00d3b449, 0x00d3bc39, 0x00d3c025, 0x00d3c42f, 0x00d3c823, 0x00d3cc1b,
+  0x00d3cc4e, 0x00d3d42f, 0x00d3d834, 0x00d3dc21, 0x00d3e032, 0x00d3e433, 0x00d3e81b, 0x00d3e81b,
+  0x00d3e82c, 0x00d3ec1b, 0x00d3ec1b, 0x00d3ec1b, 0x00d3ec23, 0x00d3f029, 0x00d3f445, 0x00d3fc33,
+  0x00d4001b, 0x00d40034, 0x00d40432, 0x00d40828, 0x00d40c2c, 0x00d41029, 0x00d41425, 0x00d41823,
+  0x00d41c39, 0x00d42029, 0x00d42434, 0x00d42834, 0x00d42c29, 0x00d43025, 0x00d43433, 0x00d43833,
+  0x00d43c1b, 0x00d43c2d, 0x00d44029, 0x00d4441b, 0x00d44434, 0x00d4482f, 0x00d44c21, 0x00d45030,
+  0x00d45432, 0x00d45829, 0x00d45c28, 0x00d4601b, 0x00d4601b, 0x00d46029, 0x00d46430, 0x00d46833,
+  0x00d46c29, 0x00d47025, 0x00d4741b, 0x00d4741b, 0x00d47433, 0x00d4781b, 0x00d4782e, 0x00d47c1b,
+  0x00d47c1b, 0x00d47c30, 0x00d4801b, 0x00d48025, 0x00d4841b, 0x00d48429, 0x00d4882f, 0x00d48c39,
+  0x00d4901b, 0x00d49039, 0x00d4942c, 0x00d49833, 0x00d49c3a, 0x00d4a035, 0x00d4a41b, 0x00d4a429,
+  0x00d4a82f, 0x00d4ac39, 0x00d4b01b, 0x00d4b025, 0x00d4b421, 0x00d4b834, 0x00d4bc1b, 0x00d4bc45,
+  0x00d4c435, 0x00d4c830, 0x00d4cc1b, 0x00d4cc2c, 0x00d4d033, 0x00d4d41b, 0x00d4d422, 0x00d4d824,
+  0x00d4dc27, 0x00d4e033, 0x00d4e41b, 0x00d4e433, 0x00d4e832, 0x00d4ec39, 0x00d4f01b, 0x00d4f034,
+  0x00d4f429, 0x00d4f825, 0x00d4fc33, 0x00d50021, 0x00d50423, 0x00d50833, 0x00d50c21, 0x00d51029,
+  0x00d5141b, 0x00d51454, 0x00d51c34, 0x00d5202f, 0x00d5241b, 0x00d52432, 0x00d52852, 0x00d5302e,
+  0x00d53434, 0x00d53821, 0x00d53c33, 0x00d5401b, 0x00d54052, 0x00d54852, 0x00d55027, 0x00d55421,
+  0x00d55833, 0x00d55c1b, 0x00d55c21, 0x00d56025, 0x00d5641b, 0x00d56426, 0x00d5682e, 0x00d56c32,
+  0x00d57021, 0x00d5742f, 0x00d5784d, 0x00d58032, 0x00d5842c, 0x00d58823, 0x00d58c27, 0x00d59021,
+  0x00d59425, 0x00d5981b, 0x00d59843, 0x00d5a032, 0x00d5a434, 0x00d5a825, 0x00d5ac44, 0x00d5b42c,
+  0x00d5b81b, 0x00d5b834, 0x00d5bc29, 0x00d5c02f, 0x00d5c429, 0x00d5c829, 0x00d5cc2f, 0x00d5d034,
+  0x00d5d42f, 0x00d5d821, 0x00d5dc36, 0x00d5e025, 0x00d5e41b, 0x00d5e433, 0x00d5e830, 0x00d5ec39,
+  0x00d5f02c, 0x00d5f42c, 0x00d5f81b, 0x00d5f832, 0x00d5fc34, 0x00d60085, 0x00d61029, 0x00d61421,
+  0x00d61845, 0x00d6202c, 0x00d62429, 0x00d6281b, 0x00d62825, 0x00d62c25, 0x00d63029, 0x00d6341b,
+  0x00d6341b, 0x00d63425, 0x00d6382e, 0x00d63c24, 0x00d64033, 0x00d6441b, 0x00d6442f, 0x00d64824,
+  0x00d64c1b, 0x00d64c2c, 0x00d65029, 0x00d65434, 0x00d6581b, 0x00d6581b, 0x00d65824, 0x00d65c2f,
+  0x00d66021, 0x00d66453, 0x00d66c25, 0x00d6701b, 0x00d6701b, 0x00d6702c, 0x00d67432, 0x00d67821,
+  0x00d67c25, 0x00d6802c, 0x00d6842e, 0x00d68829, 0x00d68c45, 0x00d69435, 0x00d69829, 0x00d69c26,
+  0x00d6a02e, 0x00d6a430, 0x00d6a832, 0x00d6ac32, 0x00d6b029, 0x00d6b421, 0x00d6b823, 0x00d6bc27,
+  0x00d6c028, 0x00d6c423, 0x00d6c829, 0x00d6cc1b, 0x00d6cc1b, 0x00d6cc29, 0x00d6d045, 0x00d6d81b,
+  0x00d6d82e, 0x00d6dc23, 0x00d6e034, 0x00d6e433, 0x00d6e81b, 0x00d6e82c, 0x00d6ec2c, 0x00d6f032,
+  0x00d6f433, 0x00d6f81b, 0x00d6f825, 0x00d6fc28, 0x00d70024, 0x00d7041b, 0x00d7041b, 0x00d70425,
+  0x00d7082e, 0x00d70c25, 0x00d71029, 0x00d71423, 0x00d71825, 0x00d71c33, 0x00d7201b, 0x00d72025,
+  0x00d72421, 0x00d72825, 0x00d72c24, 0x00d73023, 0x00d7342e, 0x00d73833, 0x00d73c1b, 0x00d73c4e,
+  0x00d7441b, 0x00d7441b, 0x00d7441b, 0x00d74432, 0x00d74829, 0x00d74c21, 0x00d75033, 0x00d7541b,
+  0x00d7541b, 0x00d7542e, 0x00d75832, 0x00d75c4d, 0x00d7642c, 0x00d76833, 0x00d76c21, 0x00d77029,
+  0x00d77429, 0x00d77828, 0x00d77c2e, 0x00d78047, 0x00d78823, 0x00d78c2c, 0x00d79028, 0x00d79421,
+  0x00d79829, 0x00d79c28, 0x00d7a025, 0x00d7a427, 0x00d7a84d, 0x00d7b025, 0x00d7b433, 0x00d7b834,
+  0x00d7bc2c, 0x00d7c01b, 0x00d7c034, 0x00d7c434, 0x00d7c832, 0x00d7cc33, 0x00d7d01b, 0x00d7d025,
+  0x00d7d433, 0x00d7d81b, 0x00d7d829, 0x00d7dc33, 0x00d7e01b, 0x00d7e029, 0x00d7e433, 0x00d7e821,
+  0x00d7ec2e, 0x00d7f02c, 0x00d7f434, 0x00d7f825, 0x00d7fc2f, 0x00d80032, 0x00d8041b, 0x00d80433,
+  0x00d8081b, 0x00d80825, 0x00d80c25, 0x00d8101b, 0x00d8104e, 0x00d8182e, 0x00d81c28, 0x00d82028,
+  0x00d82434, 0x00d82834, 0x00d82c29, 0x00d83025, 0x00d83433, 0x00d83839, 0x00d83c28, 0x00d84034,
+  0x00d84428, 0x00d8481b, 0x00d84821, 0x00d84c21, 0x00d85050, 0x00d85825, 0x00d85c33, 0x00d8601b,
+  0x00d86028, 0x00d86425, 0x00d86835, 0x00d86c36, 0x00d87033, 0x00d87425, 0x00d87833, 0x00d87c34,
+  0x00d88022, 0x00d8844c, 0x00d88c29, 0x00d8902e, 0x00d89421, 0x00d8981b, 0x00d89833, 0x00d89c35,
+  0x00d8a02e, 0x00d8a428, 0x00d8a82e, 0x00d8ac25, 0x00d8b02c, 0x00d8b44c, 0x00d8bc34, 0x00d8c02c,
+  0x00d8c42d, 0x00d8c835, 0x00d8cc2e, 0x00d8d036, 0x00d8d433, 0x00d8d81b, 0x00d8d835, 0x00d8dc2e,
+  0x00d8e029, 0x00d8e425, 0x00d8e825, 0x00d8ec45, 0x00d8f41b, 0x00d8f41b, 0x00d8f454, 0x00d8fc26,
+  0x00d9002e, 0x00d90425, 0x00d90821, 0x00d90c29, 0x00d91032, 0x00d91425, 0x00d91823, 0x00d91c21,
+  0x00d9201b, 0x00d92025, 0x00d92433, 0x00d9281b, 0x00d92821, 0x00d92c26, 0x00d93028, 0x00d93426,
+  0x00d9381b, 0x00d93829, 0x00d93c2e, 0x00d94045, 0x00d9482e, 0x00d94c2c, 0x00d9501b, 0x00d95021,
+  0x00d9541b, 0x00d95429, 0x00d9581b, 0x00d95825, 0x00d95c28, 0x00d96045, 0x00d96852, 0x00d97025,
+  0x00d9741b, 0x00d97427, 0x00d97854, 0x00d9801b, 0x00d9802e, 0x00d98421, 0x00d98823, 0x00d98c2e,
+  0x00d9901b, 0x00d9901b, 0x00d9902e, 0x00d99453, 0x00d99c2c, 0x00d9a01b, 0x00d9a049, 0x00d9a839,
+  0x00d9ac52, 0x00d9b41b, 0x00d9b421, 0x00d9b82f, 0x00d9bc33, 0x00d9c021, 0x00d9c42f, 0x00d9c835,
+  0x00d9cc1b, 0x00d9cc35, 0x00d9d033, 0x00d9d433, 0x00d9d833, 0x00d9dc33, 0x00d9e02c, 0x00d9e433,
+  0x00d9e81b, 0x00d9e823, 0x00d9ec21, 0x00d9f027, 0x00d9f41b, 0x00d9f433, 0x00d9f81b, 0x00d9f854,
+  0x00da002c, 0x00da0425, 0x00da081b, 0x00da0825, 0x00da0c33, 0x00da101b, 0x00da1033, 0x00da141b,
+  0x00da1452, 0x00da1c52, 0x00da2434, 0x00da2823, 0x00da2c2f, 0x00da3025, 0x00da3445, 0x00da3c22,
+  0x00da4024, 0x00da441b, 0x00da4429, 0x00da482e, 0x00da4c29, 0x00da501b, 0x00da5033, 0x00da5432,
+  0x00da5833, 0x00da5c29, 0x00da6029, 0x00da6423, 0x00da6852, 0x00da7029, 0x00da7439, 0x00da781b,
+  0x00da782b, 0x00da7c39, 0x00da8028, 0x00da841b, 0x00da8424, 0x00da881b, 0x00da881b, 0x00da8833,
+  0x00da8c1b, 0x00da8c30, 0x00da902e, 0x00da9421, 0x00da982c, 0x00da9c2e, 0x00daa033, 0x00daa432,
+  0x00daa833, 0x00daac33, 0x00dab01b, 0x00dab033, 0x00dab41b, 0x00dab452, 0x00dabc23, 0x00dac01b,
+  0x00dac034, 0x00dac41b, 0x00dac429, 0x00dac81b, 0x00dac825, 0x00dacc1b, 0x00dacc1b, 0x00dacc2f,
+  0x00dad01b, 0x00dad033, 0x00dad41b, 0x00dad448, 0x00dadc1b, 0x00dadc25, 0x00dae01b, 0x00dae02e,
+  0x00dae433, 0x00dae825, 0x00daec33, 0x00daf01b, 0x00daf021, 0x00daf432, 0x00daf828, 0x00dafc29,
+  0x00db0033, 0x00db041b, 0x00db042c, 0x00db0834, 0x00db0c52, 0x00db141b, 0x00db1429, 0x00db1833,
+  0x00db1c1b, 0x00db1c2d, 0x00db2037, 0x00db2425, 0x00db282c, 0x00db2c25, 0x00db302c, 0x00db3454,
+  0x00db3c39, 0x00db401b, 0x00db4033, 0x00db4425, 0x00db4829, 0x00db4c65, 0x00db5821, 0x00db5c4e,
+  0x00db642e, 0x00db681b, 0x00db6825, 0x00db6c30, 0x00db701b, 0x00db701b, 0x00db701b, 0x00db7034,
+  0x00db7433, 0x00db781b, 0x00db7868, 0x00db841b, 0x00db844d, 0x00db8c1b, 0x00db8c1b, 0x00db8c22,
+  0x00db9024, 0x00db9433, 0x00db981b, 0x00db9853, 0x00dba02f, 0x00dba41b, 0x00dba436, 0x00dba81b,
+  0x00dba841, 0x00dbb025, 0x00dbb41b, 0x00dbb41b, 0x00dbb41b, 0x00dbb433, 0x00dbb81b, 0x00dbb865,
+  0x00dbc429, 0x00dbc825, 0x00dbcc2f, 0x00dbd025, 0x00dbd425, 0x00dbd835, 0x00dbdc33, 0x00dbe06e,
+  0x00dbec45, 0x00dbf429, 0x00dbf833, 0x00dbfc1b, 0x00dbfc25, 0x00dc002f, 0x00dc041b, 0x00dc0433,
+  0x00dc081b, 0x00dc0834, 0x00dc0c21, 0x00dc1065, 0x00dc1c29, 0x00dc2032, 0x00dc2425, 0x00dc2843,
+  0x00dc302b, 0x00dc341b, 0x00dc3425, 0x00dc381b, 0x00dc381b, 0x00dc3833, 0x00dc3c1b, 0x00dc3c25,
+  0x00dc401b, 0x00dc4033, 0x00dc441b, 0x00dc441b, 0x00dc4433, 0x00dc481b, 0x00dc4833, 0x00dc4c1b,
+  0x00dc4c53, 0x00dc5445, 0x00dc5c23, 0x00dc602f, 0x00dc6425, 0x00dc681b, 0x00dc6825, 0x00dc6c2e,
+  0x00dc704e, 0x00dc7821, 0x00dc7c33, 0x00dc801b, 0x00dc8025, 0x00dc841b, 0x00dc8429, 0x00dc882e,
+  0x00dc8c1b, 0x00dc8c32, 0x00dc901b, 0x00dc902e, 0x00dc942e, 0x00dc981b, 0x00dc9826, 0x00dc9c1b,
+  0x00dc9c1b, 0x00dc9c33, 0x00dca01b, 0x00dca01b, 0x00dca033, 0x00dca41b, 0x00dca422, 0x00dca850,
+  0x00dcb025, 0x00dcb439, 0x00dcb833, 0x00dcbc1b, 0x00dcbc34, 0x00dcc052, 0x00dcc832, 0x00dccc33,
+  0x00dcd025, 0x00dcd41b, 0x00dcd41b, 0x00dcd41b, 0x00dcd421, 0x00dcd81b, 0x00dcd833, 0x00dcdc1b,
+  0x00dcdc1b, 0x00dcdc33, 0x00dce01b, 0x00dce029, 0x00dce42c, 0x00dce82d, 0x00dcec21, 0x00dcf030,
+  0x00dcf41b, 0x00dcf41b, 0x00dcf41b, 0x00dcf41b, 0x00dcf445, 0x00dcfc29, 0x00dd0024, 0x00dd0433,
+  0x00dd081b, 0x00dd0839, 0x00dd0c25, 0x00dd101b, 0x00dd1025, 0x00dd1433, 0x00dd181b, 0x00dd1833,
+  0x00dd1c1b, 0x00dd1c33, 0x00dd201b, 0x00dd201b, 0x00dd2021, 0x00dd2433, 0x00dd281b, 0x00dd2833,
+  0x00dd2c1b, 0x00dd2c33, 0x00dd3025, 0x00dd3425, 0x00dd3825, 0x00dd3c2e, 0x00dd4041, 0x00dd482f,
+  0x00dd4c24, 0x00dd501b, 0x00dd5021, 0x00dd542d, 0x00dd581b, 0x00dd581b, 0x00dd5828, 0x00dd5c29,
+  0x00dd6029, 0x00dd6423, 0x00dd6833, 0x00dd6c34, 0x00dd7034, 0x00dd742d, 0x00dd7834, 0x00dd7c2f,
+  0x00dd8029, 0x00dd842d, 0x00dd8868, 0x00dd9433, 0x00dd9841, 0x00dda023, 0x00dda434, 0x00dda823,
+  0x00ddac29, 0x00ddb035, 0x00ddb433, 0x00ddb81b, 0x00ddb82c, 0x00ddbc39, 0x00ddc029, 0x00ddc423,
+  0x00ddc833, 0x00ddcc1b, 0x00ddcc1b, 0x00ddcc29, 0x00ddd023, 0x00ddd425, 0x00ddd81b, 0x00ddd82c,
+  0x00dddc4c, 0x00dde42c, 0x00dde832, 0x00ddec2c, 0x00ddf01b, 0x00ddf025, 0x00ddf41b, 0x00ddf41b,
+  0x00ddf434, 0x00ddf81b, 0x00ddf81b, 0x00ddf81b, 0x00ddf81b, 0x00ddf833, 0x00ddfc1b, 0x00ddfc1b,
+  0x00ddfc2d, 0x00de001b, 0x00de0025, 0x00de041b, 0x00de0452, 0x00de0c1b, 0x00de0c1b, 0x00de0c52,
+  0x00de141b, 0x00de1443, 0x00de1c33, 0x00de201b, 0x00de202e, 0x00de241b, 0x00de2433, 0x00de281b,
+  0x00de2828, 0x00de2c33, 0x00de3032, 0x00de342e, 0x00de3829, 0x00de3c1b, 0x00de3c1b, 0x00de3c48,
+  0x00de4425, 0x00de481b, 0x00de481b, 0x00de481b, 0x00de482b, 0x00de4c2f, 0x00de501b, 0x00de5033,
+  0x00de541b, 0x00de5432, 0x00de5834, 0x00de5c54, 0x00de641b, 0x00de6424, 0x00de6825, 0x00de6c23,
+  0x00de7029, 0x00de742c, 0x00de781b, 0x00de781b, 0x00de781b, 0x00de781b, 0x00de784d, 0x00de8045,
+  0x00de881b, 0x00de8821, 0x00de8c23, 0x00de901b, 0x00de902c, 0x00de9425, 0x00de9833, 0x00de9c1b,
+  0x00de9c28, 0x00dea034, 0x00dea41b, 0x00dea41b, 0x00dea42f, 0x00dea824, 0x00deac1b, 0x00deac2f,
+  0x00deb01b, 0x00deb053, 0x00deb834, 0x00debc2f, 0x00dec032, 0x00dec445, 0x00decc2e, 0x00ded01b,
+  0x00ded023, 0x00ded42f, 0x00ded832, 0x00dedc48, 0x00dee41b, 0x00dee425, 0x00dee833, 0x00deec1b,
+  0x00deec29, 0x00def01b, 0x00def035, 0x00def41b, 0x00def41b, 0x00def41b, 0x00def41b, 0x00def425,
+  0x00def825, 0x00defc25, 0x00df002e, 0x00df041b, 0x00df0424, 0x00df081b, 0x00df082e, 0x00df0c45,
+  0x00df1429, 0x00df1833, 0x00df1c33, 0x00df2033, 0x00df241b, 0x00df2434, 0x00df2821, 0x00df2c1b,
+  0x00df2c25, 0x00df3033, 0x00df341b, 0x00df341b, 0x00df341b, 0x00df341b, 0x00df3452, 0x00df3c1b,
+  0x00df3c1b, 0x00df3c21, 0x00df401b, 0x00df402e, 0x00df4425, 0x00df482e, 0x00df4c32, 0x00df5033,
+  0x00df5425, 0x00df5830, 0x00df5c23, 0x00df601b, 0x00df604d, 0x00df6825, 0x00df6c28, 0x00df7024,
+  0x00df7421, 0x00df7845, 0x00df8052, 0x00df8839, 0x00df8c1b, 0x00df8c25, 0x00df9033, 0x00df941b,
+  0x00df944e, 0x00df9c45, 0x00dfa425, 0x00dfa833, 0x00dfac1b, 0x00dfac33, 0x00dfb029, 0x00dfb434,
+  0x00dfb82f, 0x00dfbc1b, 0x00dfbc39, 0x00dfc01b, 0x00dfc024, 0x00dfc433, 0x00dfc81b, 0x00dfc81b,
+  0x00dfc828, 0x00dfcc2f, 0x00dfd025, 0x00dfd41b, 0x00dfd433, 0x00dfd834, 0x00dfdc1b, 0x00dfdc2c,
+  0x00dfe05a, 0x00dfe821, 0x00dfec1b, 0x00dfec23, 0x00dff033, 0x00dff41b, 0x00dff41b, 0x00dff41b,
+  0x00dff41b, 0x00dff428, 0x00dff82e, 0x00dffc2e, 0x00e00028, 0x00e0042f, 0x00e00833, 0x00e00c29,
+  0x00e01023, 0x00e01428, 0x00e01825, 0x00e01c23, 0x00e0201b, 0x00e0201b, 0x00e02027, 0x00e02425,
+  0x00e0281b, 0x00e02833, 0x00e02c35, 0x00e0301b, 0x00e0304c, 0x00e03825, 0x00e03c54, 0x00e04421,
+  0x00e04833, 0x00e04c23, 0x00e05035, 0x00e0541b, 0x00e0542e, 0x00e05834, 0x00e05c29, 0x00e06033,
+  0x00e0641b, 0x00e06433, 0x00e06854, 0x00e07027, 0x00e0741b, 0x00e0742c, 0x00e0781b, 0x00e0781b,
+  0x00e0781b, 0x00e07833, 0x00e07c29, 0x00e0801b, 0x00e08029, 0x00e0842e, 0x00e08824, 0x00e08c25,
+  0x00e0902c, 0x00e09425, 0x00e0981b, 0x00e09822, 0x00e09c36, 0x00e0a045, 0x00e0a829, 0x00e0ac1b,
+  0x00e0ac35, 0x00e0b039, 0x00e0b433, 0x00e0b81b, 0x00e0b827, 0x00e0bc2f, 0x00e0c02e, 0x00e0c41b,
+  0x00e0c433, 0x00e0c81b, 0x00e0c833, 0x00e0cc1b, 0x00e0cc35, 0x00e0d02c, 0x00e0d41b, 0x00e0d42c,
+  0x00e0d833, 0x00e0dc26, 0x00e0e029, 0x00e0e423, 0x00e0e830, 0x00e0ec35, 0x00e0f033, 0x00e0f41b,
+  0x00e0f444, 0x00e0fc29, 0x00e10025, 0x00e1041b, 0x00e10433, 0x00e10821, 0x00e10c33, 0x00e1101b,
+  0x00e11025, 0x00e11425, 0x00e11827, 0x00e11c33, 0x00e1201b, 0x00e12045, 0x00e1281b, 0x00e12836,
+  0x00e12c2e, 0x00e13023, 0x00e13424, 0x00e13834, 0x00e13c29, 0x00e14033, 0x00e1442e, 0x00e14829,
+  0x00e14c4e, 0x00e15428, 0x00e15828, 0x00e15c1b, 0x00e15c25, 0x00e16025, 0x00e1641b, 0x00e16465,
+  0x00e17024, 0x00e1742d, 0x00e17833, 0x00e17c1b, 0x00e17c54, 0x00e1842e, 0x00e18833, 0x00e18c1b,
+  0x00e18c21, 0x00e1902f, 0x00e1941b, 0x00e1941b, 0x00e1942f, 0x00e1982e, 0x00e19c23, 0x00e1a01b,
+  0x00e1a01b, 0x00e1a04e, 0x00e1a81b, 0x00e1a825, 0x00e1ac2f, 0x00e1b025, 0x00e1b41b, 0x00e1b433,
+  0x00e1b82e, 0x00e1bc2e, 0x00e1c01b, 0x00e1c052, 0x00e1c845, 0x00e1d04b, 0x00e1d82e, 0x00e1dc2e,
+  0x00e1e021, 0x00e1e41b, 0x00e1e42c, 0x00e1e833, 0x00e1ec1b, 0x00e1ec34, 0x00e1f023, 0x00e1f454,
+  0x00e1fc27, 0x00e20026, 0x00e20425, 0x00e2081b, 0x00e2082c, 0x00e20c23, 0x00e21028, 0x00e21425,
+  0x00e21825, 0x00e21c28, 0x00e22034, 0x00e22421, 0x00e22833, 0x00e22c1b, 0x00e22c29, 0x00e23034,
+  0x00e23428, 0x00e2381b, 0x00e23825, 0x00e23c25, 0x00e2401b, 0x00e2401b, 0x00e2402d, 0x00e24421,
+  0x00e24821, 0x00e24c1b, 0x00e24c47, 0x00e25432, 0x00e2582e, 0x00e25c28, 0x00e2602e, 0x00e2641b,
+  0x00e2641b, 0x00e26443, 0x00e26c52, 0x00e27425, 0x00e2784b, 0x00e28027, 0x00e2841b, 0x00e28433,
+  0x00e2881b, 0x00e2881b, 0x00e28826, 0x00e28c2c, 0x00e2901b, 0x00e2901b, 0x00e29033, 0x00e29421,
+  0x00e29825, 0x00e29c39, 0x00e2a054, 0x00e2a832, 0x00e2ac34, 0x00e2b025, 0x00e2b41b, 0x00e2b425,
+  0x00e2b82c, 0x00e2bc1b, 0x00e2bc33, 0x00e2c039, 0x00e2c421, 0x00e2c830, 0x00e2cc23, 0x00e2d025,
+  0x00e2d433, 0x00e2d825, 0x00e2dc33, 0x00e2e01b, 0x00e2e032, 0x00e2e425, 0x00e2e81b, 0x00e2e824,
+  0x00e2ec1b, 0x00e2ec1b, 0x00e2ec25, 0x00e2f033, 0x00e2f452, 0x00e2fc1b, 0x00e2fc36, 0x00e3001b,
+  0x00e30033, 0x00e3041b, 0x00e3042e, 0x00e3082e, 0x00e30c39, 0x00e31029, 0x00e31433, 0x00e31835,
+  0x00e31c2f, 0x00e3201b, 0x00e3201b, 0x00e32033, 0x00e32433, 0x00e3281b, 0x00e3281b, 0x00e32825,
+  0x00e32c25, 0x00e33029, 0x00e33429, 0x00e3382c, 0x00e33c1b, 0x00e33c1b, 0x00e33c2c, 0x00e34034,
+  0x00e34428, 0x00e3481b, 0x00e34833, 0x00e34c2e, 0x00e35033, 0x00e3541b, 0x00e35432, 0x00e3582b,
+  0x00e35c29, 0x00e36032, 0x00e36433, 0x00e36825, 0x00e36c33, 0x00e3702e, 0x00e37421, 0x00e37829,
+  0x00e37c2c, 0x00e38033, 0x00e3841b, 0x00e38425, 0x00e3881b, 0x00e3882d, 0x00e38c1b, 0x00e38c32,
+  0x00e39044, 0x00e39829, 0x00e39c1b, 0x00e39c24, 0x00e3a039, 0x00e3a429, 0x00e3a839, 0x00e3ac29,
+  0x00e3b025, 0x00e3b425, 0x00e3b82e, 0x00e3bc27, 0x00e3c01b, 0x00e3c033, 0x00e3c433, 0x00e3c834,
+  0x00e3cc2e, 0x00e3d052, 0x00e3d832, 0x00e3dc33, 0x00e3e01b, 0x00e3e033, 0x00e3e41b, 0x00e3e454,
+  0x00e3ec1b, 0x00e3ec1b, 0x00e3ec2e, 0x00e3f052, 0x00e3f81b, 0x00e3f824, 0x00e3fc45, 0x00e40424,
+  0x00e40832, 0x00e40c1b, 0x00e40c24, 0x00e41034, 0x00e41421, 0x00e41834, 0x00e41c2e, 0x00e42044,
+  0x00e42833, 0x00e42c1b, 0x00e42c44, 0x00e43439, 0x00e43832, 0x00e43c26, 0x00e4401b, 0x00e44039,
+  0x00e44433, 0x00e4481b, 0x00e44825, 0x00e44c29, 0x00e4501b, 0x00e45028, 0x00e45433, 0x00e4581b,
+  0x00e45825, 0x00e45c2c, 0x00e46028, 0x00e4641b, 0x00e46445, 0x00e46c2d, 0x00e47034, 0x00e4741b,
+  0x00e47443, 0x00e47c33, 0x00e4801b, 0x00e48029, 0x00e48439, 0x00e48834, 0x00e48c32, 0x00e4901b,
+  0x00e49032, 0x00e4942e, 0x00e49834, 0x00e49c33, 0x00e4a01b, 0x00e4a01b, 0x00e4a01b, 0x00e4a01b,
+  0x00e4a01b, 0x00e4a01b, 0x00e4a021, 0x00e4a42e, 0x00e4a84f, 0x00e4b01b, 0x00e4b033, 0x00e4b41b,
+  0x00e4b41b, 0x00e4b41b, 0x00e4b41b, 0x00e4b428, 0x00e4b81b, 0x00e4b833, 0x00e4bc1b, 0x00e4bc33,
+  0x00e4c01b, 0x00e4c029, 0x00e4c41b, 0x00e4c435, 0x00e4c832, 0x00e4cc33, 0x00e4d01b, 0x00e4d02c,
+  0x00e4d41b, 0x00e4d421, 0x00e4d81b, 0x00e4d825, 0x00e4dc1b, 0x00e4dc29, 0x00e4e033, 0x00e4e42e,
+  0x00e4e833, 0x00e4ec48, 0x00e4f433, 0x00e4f81b, 0x00e4f825, 0x00e4fc1b, 0x00e4fc29, 0x00e5001b,
+  0x00e50025, 0x00e5041b, 0x00e5041b, 0x00e50448, 0x00e50c34, 0x00e51034, 0x00e5141b, 0x00e51425,
+  0x00e5181b, 0x00e51839, 0x00e51c1b, 0x00e51c1b, 0x00e51c1b, 0x00e51c33, 0x00e5201b, 0x00e52021,
+  0x00e5241b, 0x00e52434, 0x00e52833, 0x00e52c32, 0x00e5301b, 0x00e53045, 0x00e53849, 0x00e54032,
+  0x00e5441b, 0x00e54436, 0x00e5481b, 0x00e5481b, 0x00e54850, 0x00e5501b, 0x00e55021, 0x00e55423,
+  0x00e5581b, 0x00e5581b, 0x00e55829, 0x00e55c33, 0x00e5601b, 0x00e5602f, 0x00e5641b, 0x00e5641b,
+  0x00e56429, 0x00e56852, 0x00e57029, 0x00e5741b, 0x00e57425, 0x00e57833, 0x00e57c1b, 0x00e57c1b,
+  0x00e57c1b, 0x00e57c24, 0x00e58042, 0x00e58824, 0x00e58c33, 0x00e5901b, 0x00e59022, 0x00e59433,
+  0x00e5981b, 0x00e59829, 0x00e59c2e, 0x00e5a02c, 0x00e5a41b, 0x00e5a41b, 0x00e5a425, 0x00e5a829,
+  0x00e5ac1b, 0x00e5ac33, 0x00e5b01b, 0x00e5b02c, 0x00e5b41b, 0x00e5b41b, 0x00e5b425, 0x00e5b81b,
+  0x00e5b84e, 0x00e5c021, 0x00e5c42d, 0x00e5c830, 0x00e5cc33, 0x00e5d01b, 0x00e5d024, 0x00e5d433,
+  0x00e5d81b, 0x00e5d82f, 0x00e5dc1b, 0x00e5dc2e, 0x00e5e01b, 0x00e5e01b, 0x00e5e021, 0x00e5e42d,
+  0x00e5e821, 0x00e5ec33, 0x00e5f01b, 0x00e5f033, 0x00e5f41b, 0x00e5f421, 0x00e5f81b, 0x00e5f834,
+  0x00e5fc4e, 0x00e6041b, 0x00e6042c, 0x00e60822, 0x00e60c24, 0x00e61033, 0x00e6141b, 0x00e61436,
+  0x00e6181b, 0x00e61832, 0x00e61c45, 0x00e62429, 0x00e6281b, 0x00e62833, 0x00e62c1b, 0x00e62c1b,
+  0x00e62c1b, 0x00e62c1b, 0x00e62c1b, 0x00e62c25, 0x00e6301b, 0x00e63033, 0x00e6341b, 0x00e63428,
+  0x00e63832, 0x00e63c33, 0x00e64035, 0x00e64425, 0x00e64823, 0x00e64c34, 0x00e6502c, 0x00e6541b,
+  0x00e6541b, 0x00e6542f, 0x00e6581b, 0x00e65839, 0x00e65c21, 0x00e66027, 0x00e66434, 0x00e6681b,
+  0x00e6681b, 0x00e6682f, 0x00e66c29, 0x00e67039, 0x00e6741b, 0x00e6741b, 0x00e67429, 0x00e6781b,
+  0x00e67833, 0x00e67c1b, 0x00e67c1b, 0x00e67c34, 0x00e68033, 0x00e6842c, 0x00e6881b, 0x00e6881b,
+  0x00e68823, 0x00e68c1b, 0x00e68c1b, 0x00e68c26, 0x00e69034, 0x00e69433, 0x00e6981b, 0x00e69821,
+  0x00e69c1b, 0x00e69c1b, 0x00e69c1b, 0x00e69c23, 0x00e6a02e, 0x00e6a41b, 0x00e6a454, 0x00e6ac1b,
+  0x00e6ac2e, 0x00e6b01b, 0x00e6b01b, 0x00e6b01b, 0x00e6b01b, 0x00e6b01b, 0x00e6b02d, 0x00e6b41b,
+  0x00e6b443, 0x00e6bc1b, 0x00e6bc27, 0x00e6c029, 0x00e6c42c, 0x00e6c835, 0x00e6cc49, 0x00e6d433,
+  0x00e6d843, 0x00e6e01b, 0x00e6e028, 0x00e6e428, 0x00e6e828, 0x00e6ec21, 0x00e6f029, 0x00e6f44e,
+  0x00e6fc23, 0x00e70035, 0x00e70425, 0x00e70829, 0x00e70c39, 0x00e7101b, 0x00e71053, 0x00e71834,
+  0x00e71c25, 0x00e72039, 0x00e7242b, 0x00e7282f, 0x00e72c2c, 0x00e7301b, 0x00e73025, 0x00e7341b,
+  0x00e7342d, 0x00e73834, 0x00e73c1b, 0x00e73c30, 0x00e74034, 0x00e74445, 0x00e74c1b, 0x00e74c25,
+  0x00e75039, 0x00e75425, 0x00e75829, 0x00e75c1b, 0x00e75c33, 0x00e7601b, 0x00e7601b, 0x00e7601b,
+  0x00e7601b, 0x00e76033, 0x00e7641b, 0x00e76433, 0x00e7681b, 0x00e76845, 0x00e77029, 0x00e7741b,
+  0x00e77445, 0x00e77c1b, 0x00e77c34, 0x00e7801b, 0x00e7801b, 0x00e78027, 0x00e78421, 0x00e78825,
+  0x00e78c33, 0x00e7901b, 0x00e7901b, 0x00e7904d, 0x00e7984d, 0x00e7a01b, 0x00e7a025, 0x00e7a433,
+  0x00e7a81b, 0x00e7a82f, 0x00e7ac34, 0x00e7b029, 0x00e7b425, 0x00e7b81b, 0x00e7b833, 0x00e7bc1b,
+  0x00e7bc33, 0x00e7c01b, 0x00e7c027, 0x00e7c421, 0x00e7c829, 0x00e7cc1b, 0x00e7cc1b, 0x00e7cc2f,
+  0x00e7d021, 0x00e7d42e, 0x00e7d81b, 0x00e7d82e, 0x00e7dc25, 0x00e7e01b, 0x00e7e021, 0x00e7e44d,
+  0x00e7ec30, 0x00e7f033, 0x00e7f41b, 0x00e7f429, 0x00e7f834, 0x00e7fc2f, 0x00e8001b, 0x00e80025,
+  0x00e80433, 0x00e80852, 0x00e81049, 0x00e81833, 0x00e81c33, 0x00e82052, 0x00e8281b, 0x00e82834,
+  0x00e82c47, 0x00e8341b, 0x00e83427, 0x00e83833, 0x00e83c1b, 0x00e83c23, 0x00e8401b, 0x00e8401b,
+  0x00e8401b, 0x00e84025, 0x00e84422, 0x00e8482e, 0x00e84c1b, 0x00e84c33, 0x00e8501b, 0x00e8502e,
+  0x00e8541b, 0x00e85434, 0x00e85823, 0x00e85c29, 0x00e86033, 0x00e86421, 0x00e86828, 0x00e86c2f,
+  0x00e8702c, 0x00e8741b, 0x00e87432, 0x00e87832, 0x00e87c2f, 0x00e8802e, 0x00e88433, 0x00e8881b,
+  0x00e88833, 0x00e88c1b, 0x00e88c1b, 0x00e88c33, 0x00e89054, 0x00e89823, 0x00e89c34, 0x00e8a029,
+  0x00e8a434, 0x00e8a81b, 0x00e8a81b, 0x00e8a81b, 0x00e8a833, 0x00e8ac2f, 0x00e8b034, 0x00e8b41b,
+  0x00e8b41b, 0x00e8b41b, 0x00e8b439, 0x00e8b834, 0x00e8bc32, 0x00e8c02d, 0x00e8c429, 0x00e8c821,
+  0x00e8cc21, 0x00e8d025, 0x00e8d432, 0x00e8d81b, 0x00e8d833, 0x00e8dc21, 0x00e8e01b, 0x00e8e029,
+  0x00e8e429, 0x00e8e830, 0x00e8ec54, 0x00e8f433, 0x00e8f81b, 0x00e8f833, 0x00e8fc34, 0x00e9001b,
+  0x00e9001b, 0x00e90052, 0x00e90834, 0x00e90c33, 0x00e9102c, 0x00e9141b, 0x00e9142e, 0x00e91833,
+  0x00e91c1b, 0x00e91c34, 0x00e9201b, 0x00e9201b, 0x00e92033, 0x00e92425, 0x00e92825, 0x00e92c23,
+  0x00e9301b, 0x00e9301b, 0x00e93033, 0x00e9341b, 0x00e9342c, 0x00e93825, 0x00e93c2f, 0x00e94021,
+  0x00e9442e, 0x00e94854, 0x00e9501b, 0x00e95033, 0x00e9541b, 0x00e9541b, 0x00e9542c, 0x00e95845,
+  0x00e96033, 0x00e9641b, 0x00e96423, 0x00e96833, 0x00e96c1b, 0x00e96c1b, 0x00e96c1b, 0x00e96c1b,
+  0x00e96c24, 0x00e9701b, 0x00e9701b, 0x00e97021, 0x00e9741b, 0x00e9741b, 0x00e9741b, 0x00e97425,
+  0x00e97834, 0x00e97c25, 0x00e98028, 0x00e98450, 0x00e98c1b, 0x00e98c33, 0x00e9901b, 0x00e99023,
+  0x00e9941b, 0x00e9941b, 0x00e9942e, 0x00e9981b, 0x00e9981b, 0x00e99832, 0x00e99c29, 0x00e9a01b,
+  0x00e9a033, 0x00e9a41b, 0x00e9a421, 0x00e9a82f, 0x00e9ac21, 0x00e9b035, 0x00e9b428, 0x00e9b82f,
+  0x00e9bc1b, 0x00e9bc27, 0x00e9c021, 0x00e9c423, 0x00e9c834, 0x00e9cc2e, 0x00e9d039, 0x00e9d41b,
+  0x00e9d432, 0x00e9d824, 0x00e9dc33, 0x00e9e01b, 0x00e9e01b, 0x00e9e025, 0x00e9e41b, 0x00e9e429,
+  0x00e9e839, 0x00e9ec23, 0x00e9f01b, 0x00e9f032, 0x00e9f42e, 0x00e9f82e, 0x00e9fc94, 0x00ea0c25,
+  0x00ea1033, 0x00ea141b, 0x00ea141b, 0x00ea142e, 0x00ea1824, 0x00ea1c1b, 0x00ea1c1b, 0x00ea1c25,
+  0x00ea2033, 0x00ea241b, 0x00ea2433, 0x00ea281b, 0x00ea2833, 0x00ea2c1b, 0x00ea2c1b, 0x00ea2c1b,
+  0x00ea2c1b, 0x00ea2c2c, 0x00ea301b, 0x00ea301b, 0x00ea3021, 0x00ea3425, 0x00ea3829, 0x00ea3c1b,
+  0x00ea3c25, 0x00ea402e, 0x00ea4444, 0x00ea4c28, 0x00ea5025, 0x00ea5432, 0x00ea5832, 0x00ea5c29,
+  0x00ea603a, 0x00ea6454, 0x00ea6c1b, 0x00ea6c34, 0x00ea701b, 0x00ea7025, 0x00ea741b, 0x00ea7424,
+  0x00ea7829, 0x00ea7c2e, 0x00ea802c, 0x00ea8433, 0x00ea881b, 0x00ea881b, 0x00ea8827, 0x00ea8c1b,
+  0x00ea8c33, 0x00ea9045, 0x00ea9829, 0x00ea9c33, 0x00eaa01b, 0x00eaa01b, 0x00eaa033, 0x00eaa41b,
+  0x00eaa41b, 0x00eaa41b, 0x00eaa434, 0x00eaa81b, 0x00eaa82f, 0x00eaac2e, 0x00eab02e, 0x00eab41b,
+  0x00eab425, 0x00eab81b, 0x00eab81b, 0x00eab825, 0x00eabc32, 0x00eac01b, 0x00eac039, 0x00eac41b,
+  0x00eac41b, 0x00eac433, 0x00eac828, 0x00eacc1b, 0x00eacc1b, 0x00eacc33, 0x00ead032, 0x00ead41b,
+  0x00ead41b, 0x00ead41b, 0x00ead41b, 0x00ead42e, 0x00ead829, 0x00eadc33, 0x00eae01b, 0x00eae021,
+  0x00eae454, 0x00eaec23, 0x00eaf021, 0x00eaf41b, 0x00eaf423, 0x00eaf828, 0x00eafc33, 0x00eb002e,
+  0x00eb041b, 0x00eb041b, 0x00eb041b, 0x00eb0452, 0x00eb0c43, 0x00eb1423, 0x00eb1839, 0x00eb1c21,
+  0x00eb201b, 0x00eb201b, 0x00eb2034, 0x00eb2424, 0x00eb281b, 0x00eb281b, 0x00eb2829, 0x00eb2c23,
+  0x00eb3021, 0x00eb341b, 0x00eb3452, 0x00eb3c1b, 0x00eb3c43, 0x00eb444c, 0x00eb4c34, 0x00eb5025,
+  0x00eb541b, 0x00eb5433, 0x00eb5829, 0x00eb5c1b, 0x00eb5c33, 0x00eb601b, 0x00eb6031, 0x00eb641b,
+  0x00eb641b, 0x00eb6425, 0x00eb681b, 0x00eb6821, 0x00eb6c1b, 0x00eb6c29, 0x00eb7027, 0x00eb7425,
+  0x00eb781b, 0x00eb781b, 0x00eb781b, 0x00eb782c, 0x00eb7c33, 0x00eb801b, 0x00eb801b, 0x00eb801b,
+  0x00eb801b, 0x00eb8025, 0x00eb8429, 0x00eb881b, 0x00eb8833, 0x00eb8c1b, 0x00eb8c1b, 0x00eb8c33,
+  0x00eb901b, 0x00eb901b, 0x00eb901b, 0x00eb901b, 0x00eb901b, 0x00eb9026, 0x00eb941b, 0x00eb9427,
+  0x00eb9833, 0x00eb9c1b, 0x00eb9c1b, 0x00eb9c33, 0x00eba01b, 0x00eba01b, 0x00eba01b, 0x00eba034,
+  0x00eba424, 0x00eba81b, 0x00eba81b, 0x00eba833, 0x00ebac54, 0x00ebb41b, 0x00ebb41b, 0x00ebb42c,
+  0x00ebb825, 0x00ebbc33, 0x00ebc01b, 0x00ebc01b, 0x00ebc029, 0x00ebc421, 0x00ebc81b, 0x00ebc82d,
+  0x00ebcc25, 0x00ebd01b, 0x00ebd029, 0x00ebd430, 0x00ebd81b, 0x00ebd81b, 0x00ebd829, 0x00ebdc1b,
+  0x00ebdc2c, 0x00ebe01b, 0x00ebe033, 0x00ebe41b, 0x00ebe41b, 0x00ebe429, 0x00ebe81b, 0x00ebe81b,
+  0x00ebe823, 0x00ebec33, 0x00ebf02f, 0x00ebf41b, 0x00ebf425, 0x00ebf82e, 0x00ebfc32, 0x00ec002e,
+  0x00ec0449, 0x00ec0c27, 0x00ec101b, 0x00ec1025, 0x00ec1429, 0x00ec181b, 0x00ec1833, 0x00ec1c30,
+  0x00ec201b, 0x00ec2049, 0x00ec2839, 0x00ec2c29, 0x00ec3029, 0x00ec341b, 0x00ec341b, 0x00ec341b,
+  0x00ec342c, 0x00ec3839, 0x00ec3c1b, 0x00ec3c39, 0x00ec4033, 0x00ec441b, 0x00ec4443, 0x00ec4c33,
+  0x00ec501b, 0x00ec5029, 0x00ec5429, 0x00ec5839, 0x00ec5c2e, 0x00ec601b, 0x00ec6036, 0x00ec641b,
+  0x00ec642e, 0x00ec6833, 0x00ec6c33, 0x00ec701b, 0x00ec7034, 0x00ec741b, 0x00ec741b, 0x00ec741b,
+  0x00ec7429, 0x00ec782c, 0x00ec7c1b, 0x00ec7c1b, 0x00ec7c2c, 0x00ec801b, 0x00ec8033, 0x00ec8454,
+  0x00ec8c25, 0x00ec9024, 0x00ec942e, 0x00ec981b, 0x00ec9825, 0x00ec9c33, 0x00eca033, 0x00eca41b,
+  0x00eca42b, 0x00eca81b, 0x00eca828, 0x00ecac1b, 0x00ecac1b, 0x00ecac1b, 0x00ecac4e, 0x00ecb41b,
+  0x00ecb436, 0x00ecb81b, 0x00ecb82c, 0x00ecbc1b, 0x00ecbc1b, 0x00ecbc4e, 0x00ecc428, 0x00ecc833,
+  0x00eccc1b, 0x00eccc39, 0x00ecd02c, 0x00ecd41b, 0x00ecd41b, 0x00ecd425, 0x00ecd81b, 0x00ecd824,
+  0x00ecdc1b, 0x00ecdc2e, 0x00ece01b, 0x00ece033, 0x00ece41b, 0x00ece421, 0x00ece845, 0x00ecf01b,
+  0x00ecf072, 0x00ecfc1b, 0x00ecfc25, 0x00ed001b, 0x00ed002c, 0x00ed042e, 0x00ed081b, 0x00ed0832,
+  0x00ed0c1b, 0x00ed0c1b, 0x00ed0c2e, 0x00ed1025, 0x00ed141b, 0x00ed142e, 0x00ed181b, 0x00ed181b,
+  0x00ed181b, 0x00ed181b, 0x00ed181b, 0x00ed1834, 0x00ed1c1b, 0x00ed1c1b, 0x00ed1c2e, 0x00ed202b,
+  0x00ed241b, 0x00ed2433, 0x00ed281b, 0x00ed281b, 0x00ed2829, 0x00ed2c33, 0x00ed301b, 0x00ed3039,
+  0x00ed3454, 0x00ed3c1b, 0x00ed3c33, 0x00ed4023, 0x00ed4433, 0x00ed481b, 0x00ed4833, 0x00ed4c1b,
+  0x00ed4c1b, 0x00ed4c1b, 0x00ed4c1b, 0x00ed4c2c, 0x00ed5023, 0x00ed5433, 0x00ed581b, 0x00ed5829,
+  0x00ed5c33, 0x00ed6052, 0x00ed6823, 0x00ed6c1b, 0x00ed6c29, 0x00ed7039, 0x00ed7429, 0x00ed7833,
+  0x00ed7c1b, 0x00ed7c1b, 0x00ed7c2e, 0x00ed8021, 0x00ed841b, 0x00ed8421, 0x00ed8835, 0x00ed8c2c,
+  0x00ed9029, 0x00ed9433, 0x00ed981b, 0x00ed981b, 0x00ed981b, 0x00ed981b, 0x00ed9843, 0x00eda01b,
+  0x00eda01b, 0x00eda01b, 0x00eda024, 0x00eda433, 0x00eda82e, 0x00edac33, 0x00edb01b, 0x00edb01b,
+  0x00edb01b, 0x00edb02e, 0x00edb424, 0x00edb81b, 0x00edb829, 0x00edbc39, 0x00edc033, 0x00edc41b,
+  0x00edc432, 0x00edc81b, 0x00edc832, 0x00edcc34, 0x00edd021, 0x00edd433, 0x00edd81b, 0x00edd81b,
+  0x00edd845, 0x00ede04c, 0x00ede834, 0x00edec33, 0x00edf02d, 0x00edf429, 0x00edf81b, 0x00edf833,
+  0x00edfc4e, 0x00ee0429, 0x00ee0839, 0x00ee0c32, 0x00ee101b, 0x00ee1033, 0x00ee1435, 0x00ee182e,
+  0x00ee1c24, 0x00ee201b, 0x00ee2033, 0x00ee241b, 0x00ee2421, 0x00ee2835, 0x00ee2c1b, 0x00ee2c2c,
+  0x00ee3033, 0x00ee341b, 0x00ee3429, 0x00ee3833, 0x00ee3c1b, 0x00ee3c1b, 0x00ee3c1b, 0x00ee3c1b,
+  0x00ee3c24, 0x00ee404c, 0x00ee481b, 0x00ee481b, 0x00ee4825, 0x00ee4c29, 0x00ee5039, 0x00ee5421,
+  0x00ee581b, 0x00ee582e, 0x00ee5c29, 0x00ee602d, 0x00ee6439, 0x00ee6828, 0x00ee6c29, 0x00ee701b,
+  0x00ee7024, 0x00ee741b, 0x00ee741b, 0x00ee741b, 0x00ee7433, 0x00ee781b, 0x00ee7825, 0x00ee7c1b,
+  0x00ee7c21, 0x00ee8029, 0x00ee8454, 0x00ee8c2c, 0x00ee902f, 0x00ee942c, 0x00ee982f, 0x00ee9c1b,
+  0x00ee9c1b, 0x00ee9c33, 0x00eea02e, 0x00eea434, 0x00eea81b, 0x00eea839, 0x00eeac1b, 0x00eeac2c,
+  0x00eeb02e, 0x00eeb421, 0x00eeb829, 0x00eebc33, 0x00eec01b, 0x00eec023, 0x00eec41b, 0x00eec41b,
+  0x00eec433, 0x00eec81b, 0x00eec81b, 0x00eec81b, 0x00eec829, 0x00eecc25, 0x00eed01b, 0x00eed029,
+  0x00eed41b, 0x00eed41b, 0x00eed41b, 0x00eed41b, 0x00eed41b, 0x00eed425, 0x00eed81b, 0x00eed852,
+  0x00eee04e, 0x00eee827, 0x00eeec25, 0x00eef029, 0x00eef41b, 0x00eef425, 0x00eef82c, 0x00eefc1b,
+  0x00eefc1b, 0x00eefc1b, 0x00eefc1b, 0x00eefc29, 0x00ef0027, 0x00ef0432, 0x00ef0845, 0x00ef1033,
+  0x00ef1425, 0x00ef1833, 0x00ef1c1b, 0x00ef1c1b, 0x00ef1c1b, 0x00ef1c1b, 0x00ef1c21, 0x00ef2023,
+  0x00ef241b, 0x00ef242c, 0x00ef2832, 0x00ef2c2c, 0x00ef3021, 0x00ef341b, 0x00ef342e, 0x00ef3835,
+  0x00ef3c2c, 0x00ef4045, 0x00ef4829, 0x00ef4c21, 0x00ef501b, 0x00ef501b, 0x00ef501b, 0x00ef501b,
+  0x00ef502e, 0x00ef5425, 0x00ef581b, 0x00ef5825, 0x00ef5c1b, 0x00ef5c1b, 0x00ef5c1b, 0x00ef5c21,
+  0x00ef6025, 0x00ef6433, 0x00ef681b, 0x00ef681b, 0x00ef681b, 0x00ef681b, 0x00ef681b, 0x00ef6833,
+  0x00ef6c1b, 0x00ef6c1b, 0x00ef6c1b, 0x00ef6c21, 0x00ef702c, 0x00ef7432, 0x00ef782e, 0x00ef7c2e,
+  0x00ef8029, 0x00ef8432, 0x00ef881b, 0x00ef8825, 0x00ef8c1b, 0x00ef8c1b, 0x00ef8c1b, 0x00ef8c2c,
+  0x00ef901b, 0x00ef9033, 0x00ef941b, 0x00ef9425, 0x00ef9834, 0x00ef9c1b, 0x00ef9c2f, 0x00efa049,
+  0x00efa829, 0x00efac1b, 0x00efac1b, 0x00efac1b, 0x00efac24, 0x00efb01b, 0x00efb02e, 0x00efb41b,
+  0x00efb41b, 0x00efb41b, 0x00efb44e, 0x00efbc1b, 0x00efbc1b, 0x00efbc32, 0x00efc052, 0x00efc81b,
+  0x00efc81b, 0x00efc825, 0x00efcc29, 0x00efd01b, 0x00efd01b, 0x00efd034, 0x00efd42f, 0x00efd81b,
+  0x00efd834, 0x00efdc33, 0x00efe01b, 0x00efe025, 0x00efe41b, 0x00efe41b, 0x00efe41b, 0x00efe41b,
+  0x00efe41b, 0x00efe433, 0x00efe81b, 0x00efe833, 0x00efec1b, 0x00efec33, 0x00eff01b, 0x00eff02d,
+  0x00eff429, 0x00eff821, 0x00effc1b, 0x00effc21, 0x00f00033, 0x00f00433, 0x00f0081b, 0x00f00829,
+  0x00f00c39, 0x00f01033, 0x00f0141b, 0x00f01445, 0x00f01c1b, 0x00f01c1b, 0x00f01c2e, 0x00f0201b,
+  0x00f02035, 0x00f02432, 0x00f02834, 0x00f02c2e, 0x00f0301b, 0x00f0302e, 0x00f03429, 0x00f0381b,
+  0x00f03832, 0x00f03c2e, 0x00f0401b, 0x00f0401b, 0x00f04034, 0x00f0441b, 0x00f0441b, 0x00f0441b,
+  0x00f0441b, 0x00f04425, 0x00f04834, 0x00f04c33, 0x00f0501b, 0x00f05039, 0x00f0541b, 0x00f0541b,
+  0x00f05423, 0x00f0582c, 0x00f05c1b, 0x00f05c33, 0x00f06036, 0x00f06428, 0x00f0682f, 0x00f06c1b,
+  0x00f06c1b, 0x00f06c50, 0x00f0741b, 0x00f0741b, 0x00f07433, 0x00f0781b, 0x00f0781b, 0x00f07834,
+  0x00f07c27, 0x00f0802f, 0x00f08436, 0x00f0881b, 0x00f08832, 0x00f08c2e, 0x00f0901b, 0x00f0901b,
+  0x00f09023, 0x00f09433, 0x00f09833, 0x00f09c21, 0x00f0a023, 0x00f0a41b, 0x00f0a41b, 0x00f0a41b,
+  0x00f0a41b, 0x00f0a421, 0x00f0a81b, 0x00f0a82d, 0x00f0ac2c, 0x00f0b025, 0x00f0b41b, 0x00f0b445,
+  0x00f0bc25, 0x00f0c01b, 0x00f0c025, 0x00f0c41b, 0x00f0c439, 0x00f0c82c, 0x00f0cc25, 0x00f0d025,
+  0x00f0d454, 0x00f0dc33, 0x00f0e01b, 0x00f0e01b, 0x00f0e01b, 0x00f0e027, 0x00f0e41b, 0x00f0e41b,
+  0x00f0e41b, 0x00f0e429, 0x00f0e81b, 0x00f0e833, 0x00f0ec1b, 0x00f0ec25, 0x00f0f01b, 0x00f0f033,
+  0x00f0f41b, 0x00f0f421, 0x00f0f81b, 0x00f0f81b, 0x00f0f825, 0x00f0fc1b, 0x00f0fc1b, 0x00f0fc27,
+  0x00f1001b, 0x00f1004e, 0x00f10833, 0x00f10c34, 0x00f11029, 0x00f11433, 0x00f1181b, 0x00f1181b,
+  0x00f11839, 0x00f11c1b, 0x00f11c39, 0x00f1201b, 0x00f12033, 0x00f12433, 0x00f1281b, 0x00f1281b,
+  0x00f1281b, 0x00f1281b, 0x00f12831, 0x00f12c1b, 0x00f12c1b, 0x00f12c25, 0x00f13029, 0x00f1341b,
+  0x00f1341b, 0x00f1342d, 0x00f1381b, 0x00f1381b, 0x00f13829, 0x00f13c1b, 0x00f13c34, 0x00f1401b,
+  0x00f14033, 0x00f1441b, 0x00f1441b, 0x00f14425, 0x00f1481b, 0x00f14843, 0x00f1501b, 0x00f1501b,
+  0x00f15034, 0x00f1542c, 0x00f15832, 0x00f15c29, 0x00f16023, 0x00f1641b, 0x00f16433, 0x00f1681b,
+  0x00f1681b, 0x00f1681b, 0x00f16827, 0x00f16c1b, 0x00f16c1b, 0x00f16c1b, 0x00f16c43, 0x00f1741b,
+  0x00f1741b, 0x00f1741b, 0x00f17426, 0x00f17833, 0x00f17c4e, 0x00f1841b, 0x00f18433, 0x00f1881b,
+  0x00f1882c, 0x00f18c1b, 0x00f18c39, 0x00f19029, 0x00f19429, 0x00f19835, 0x00f19c1b, 0x00f19c33,
+  0x00f1a01b, 0x00f1a043, 0x00f1a81b, 0x00f1a829, 0x00f1ac4d, 0x00f1b432, 0x00f1b81b, 0x00f1b81b,
+  0x00f1b81b, 0x00f1b81b, 0x00f1b82d, 0x00f1bc39, 0x00f1c01b, 0x00f1c023, 0x00f1c41b, 0x00f1c41b,
+  0x00f1c425, 0x00f1c839, 0x00f1cc1b, 0x00f1cc23, 0x00f1d01b, 0x00f1d02e, 0x00f1d41b, 0x00f1d423,
+  0x00f1d830, 0x00f1dc1b, 0x00f1dc2f, 0x00f1e02e, 0x00f1e429, 0x00f1e81b, 0x00f1e81b, 0x00f1e81b,
+  0x00f1e823, 0x00f1ec33, 0x00f1f01b, 0x00f1f02f, 0x00f1f42c, 0x00f1f822, 0x00f1fc2c, 0x00f2002d,
+  0x00f20429, 0x00f20829, 0x00f20c1b, 0x00f20c25, 0x00f21025, 0x00f2141b, 0x00f21423, 0x00f2181b,
+  0x00f21828, 0x00f21c1b, 0x00f21c23, 0x00f2201b, 0x00f2202f, 0x00f22429, 0x00f22833, 0x00f22c1b,
+  0x00f22c33, 0x00f2301b, 0x00f2301b, 0x00f23032, 0x00f2342e, 0x00f2381b, 0x00f23839, 0x00f23c4e,
+  0x00f24425, 0x00f24825, 0x00f24c2c, 0x00f2501b, 0x00f2501b, 0x00f25032, 0x00f2541b, 0x00f2544c,
+  0x00f25c1b, 0x00f25c25, 0x00f2602d, 0x00f2641b, 0x00f2642c, 0x00f26821, 0x00f26c2c, 0x00f2701b,
+  0x00f27033, 0x00f2741b, 0x00f27421, 0x00f2782e, 0x00f27c54, 0x00f28433, 0x00f2881b, 0x00f28834,
+  0x00f28c24, 0x00f2901b, 0x00f29033, 0x00f2941b, 0x00f2941b, 0x00f2941b, 0x00f29427, 0x00f2982e,
+  0x00f29c23, 0x00f2a025, 0x00f2a452, 0x00f2ac24, 0x00f2b01b, 0x00f2b01b, 0x00f2b029, 0x00f2b42c,
+  0x00f2b823, 0x00f2bc33, 0x00f2c021, 0x00f2c41b, 0x00f2c427, 0x00f2c833, 0x00f2cc1b, 0x00f2cc1b,
+  0x00f2cc33, 0x00f2d01b, 0x00f2d01b, 0x00f2d023, 0x00f2d429, 0x00f2d84e, 0x00f2e029, 0x00f2e41b,
+  0x00f2e41b, 0x00f2e41b, 0x00f2e41b, 0x00f2e41b, 0x00f2e42d, 0x00f2e823, 0x00f2ec30, 0x00f2f02c,
+  0x00f2f445, 0x00f2fc1b, 0x00f2fc25, 0x00f3001b, 0x00f3001b, 0x00f30033, 0x00f3041b, 0x00f30425,
+  0x00f30825, 0x00f30c1b, 0x00f30c25, 0x00f31025, 0x00f3141b, 0x00f31423, 0x00f3181b, 0x00f31827,
+  0x00f31c2c, 0x00f3201b, 0x00f3201b, 0x00f3201b, 0x00f3201b, 0x00f3201b, 0x00f3202c, 0x00f3241b,
+  0x00f32445, 0x00f32c29, 0x00f3302e, 0x00f33433, 0x00f3381b, 0x00f33829, 0x00f33c25, 0x00f3401b,
+  0x00f3402e, 0x00f34425, 0x00f3481b, 0x00f34827, 0x00f34c21, 0x00f35023, 0x00f35434, 0x00f3582c,
+  0x00f35c33, 0x00f3602c, 0x00f3641b, 0x00f3642c, 0x00f36833, 0x00f36c33, 0x00f3701b, 0x00f3701b,
+  0x00f3701b, 0x00f3701b, 0x00f37029, 0x00f3741b, 0x00f3741b, 0x00f37433, 0x00f3781b, 0x00f3781b,
+  0x00f3781b, 0x00f37821, 0x00f37c1b, 0x00f37c52, 0x00f3841b, 0x00f3842e, 0x00f3881b, 0x00f3881b,
+  0x00f38829, 0x00f38c2f, 0x00f39029, 0x00f39429, 0x00f39821, 0x00f39c1b, 0x00f39c1b, 0x00f39c1b,
+  0x00f39c1b, 0x00f39c34, 0x00f3a035, 0x00f3a41b, 0x00f3a423, 0x00f3a81b, 0x00f3a834, 0x00f3ac39,
+  0x00f3b01b, 0x00f3b033, 0x00f3b421, 0x00f3b81b, 0x00f3b82f, 0x00f3bc1b, 0x00f3bc45, 0x00f3c42e,
+  0x00f3c81b, 0x00f3c81b, 0x00f3c81b, 0x00f3c833, 0x00f3cc1b, 0x00f3cc1b, 0x00f3cc1b, 0x00f3cc33,
+  0x00f3d01b, 0x00f3d01b, 0x00f3d039, 0x00f3d41b, 0x00f3d433, 0x00f3d82e, 0x00f3dc2d, 0x00f3e01b,
+  0x00f3e033, 0x00f3e41b, 0x00f3e433, 0x00f3e833, 0x00f3ec1b, 0x00f3ec25, 0x00f3f01b, 0x00f3f01b,
+  0x00f3f01b, 0x00f3f01b, 0x00f3f01b, 0x00f3f01b, 0x00f3f023, 0x00f3f41b, 0x00f3f421, 0x00f3f835,
+  0x00f3fc25, 0x00f4002e, 0x00f4041b, 0x00f4041b, 0x00f40427, 0x00f40835, 0x00f40c25, 0x00f41035,
+  0x00f4141b, 0x00f41433, 0x00f4182f, 0x00f41c29, 0x00f4201b, 0x00f4201b, 0x00f42025, 0x00f4241b,
+  0x00f4242e, 0x00f42823, 0x00f42c1b, 0x00f42c1b, 0x00f42c1b, 0x00f42c27, 0x00f4301b, 0x00f43033,
+  0x00f4341b, 0x00f4341b, 0x00f4342e, 0x00f43839, 0x00f43c1b, 0x00f43c33, 0x00f4401b, 0x00f4404e,
+  0x00f44821, 0x00f44c1b, 0x00f44c32, 0x00f45021, 0x00f4541b, 0x00f4542c, 0x00f4581b, 0x00f45833,
+  0x00f45c1b, 0x00f45c1b, 0x00f45c29, 0x00f4601b, 0x00f4601b, 0x00f4601b, 0x00f46029, 0x00f4641b,
+  0x00f4642e, 0x00f46833, 0x00f46c1b, 0x00f46c1b, 0x00f46c23, 0x00f4702f, 0x00f47421, 0x00f4784d,
+  0x00f4802e, 0x00f4841b, 0x00f4841b, 0x00f4841b, 0x00f4841b, 0x00f48421, 0x00f48833, 0x00f48c1b,
+  0x00f48c2f, 0x00f4902f, 0x00f4941b, 0x00f49435, 0x00f4981b, 0x00f49833, 0x00f49c1b, 0x00f49c33,
+  0x00f4a01b, 0x00f4a01b, 0x00f4a01b, 0x00f4a024, 0x00f4a432, 0x00f4a828, 0x00f4ac1b, 0x00f4ac29,
+  0x00f4b039, 0x00f4b433, 0x00f4b81b, 0x00f4b823, 0x00f4bc21, 0x00f4c01b, 0x00f4c033, 0x00f4c432,
+  0x00f4c81b, 0x00f4c81b, 0x00f4c81b, 0x00f4c82c, 0x00f4cc28, 0x00f4d039, 0x00f4d41b, 0x00f4d41b,
+  0x00f4d42c, 0x00f4d825, 0x00f4dc1b, 0x00f4dc1b, 0x00f4dc34, 0x00f4e01b, 0x00f4e01b, 0x00f4e033,
+  0x00f4e41b, 0x00f4e425, 0x00f4e823, 0x00f4ec21, 0x00f4f033, 0x00f4f423, 0x00f4f82c, 0x00f4fc29,
+  0x00f50021, 0x00f5041b, 0x00f50439, 0x00f5081b, 0x00f5081b, 0x00f5082c, 0x00f50c32, 0x00f51033,
+  0x00f5141b, 0x00f51421, 0x00f5181b, 0x00f5181b, 0x00f5181b, 0x00f5181b, 0x00f51825, 0x00f51c1b,
+  0x00f51c1b, 0x00f51c45, 0x00f5241b, 0x00f5241b, 0x00f52425, 0x00f52823, 0x00f52c34, 0x00f5301b,
+  0x00f53027, 0x00f53439, 0x00f53825, 0x00f53c2e, 0x00f54025, 0x00f5442f, 0x00f5482e, 0x00f54c2e,
+  0x00f5501b, 0x00f5501b, 0x00f55028, 0x00f5541b, 0x00f5541b, 0x00f55434, 0x00f5581b, 0x00f5581b,
+  0x00f55823, 0x00f55c34, 0x00f5602c, 0x00f56439, 0x00f56832, 0x00f56c1b, 0x00f56c1b, 0x00f56c2f,
+  0x00f57027, 0x00f5741b, 0x00f5741b, 0x00f5741b, 0x00f57427, 0x00f5782c, 0x00f57c33, 0x00f5801b,
+  0x00f5801b, 0x00f5802c, 0x00f5841b, 0x00f5844e, 0x00f58c2e, 0x00f59032, 0x00f5941b, 0x00f5941b,
+  0x00f5941b, 0x00f59434, 0x00f5982b, 0x00f59c23, 0x00f5a01b, 0x00f5a01b, 0x00f5a01b, 0x00f5a032,
+  0x00f5a41b, 0x00f5a41b, 0x00f5a41b, 0x00f5a425, 0x00f5a82c, 0x00f5ac39, 0x00f5b01b, 0x00f5b039,
+  0x00f5b41b, 0x00f5b41b, 0x00f5b421, 0x00f5b823, 0x00f5bc1b, 0x00f5bc1b, 0x00f5bc1b, 0x00f5bc34,
+  0x00f5c036, 0x00f5c41b, 0x00f5c42c, 0x00f5c839, 0x00f5cc1b, 0x00f5cc32, 0x00f5d01b, 0x00f5d033,
+  0x00f5d41b, 0x00f5d41b, 0x00f5d434, 0x00f5d81b, 0x00f5d81b, 0x00f5d81b, 0x00f5d82e, 0x00f5dc3a,
+  0x00f5e02e, 0x00f5e42c, 0x00f5e81b, 0x00f5e81b, 0x00f5e835, 0x00f5ec29, 0x00f5f045, 0x00f5f81b,
+  0x00f5f81b, 0x00f5f81b, 0x00f5f81b, 0x00f5f82e, 0x00f5fc1b, 0x00f5fc29, 0x00f6001b, 0x00f6001b,
+  0x00f6001b, 0x00f60033, 0x00f6041b, 0x00f60429, 0x00f60821, 0x00f60c25, 0x00f61025, 0x00f61428,
+  0x00f61839, 0x00f61c1b, 0x00f61c25, 0x00f6201b, 0x00f6201b, 0x00f6202c, 0x00f6242f, 0x00f62835,
+  0x00f62c25, 0x00f63039, 0x00f6341b, 0x00f63439, 0x00f6381b, 0x00f6381b, 0x00f63825, 0x00f63c25,
+  0x00f64025, 0x00f64425, 0x00f6482e, 0x00f64c21, 0x00f65033, 0x00f6541b, 0x00f6541b, 0x00f65423,
+  0x00f6581b, 0x00f65835, 0x00f65c2d, 0x00f6601b, 0x00f66029, 0x00f6641b, 0x00f6641b, 0x00f6641b,
+  0x00f6641b, 0x00f66435, 0x00f66834, 0x00f66c52, 0x00f6741b, 0x00f6741b, 0x00f6741b, 0x00f6742e,
+  0x00f6781b, 0x00f6781b, 0x00f67827, 0x00f67c2c, 0x00f6801b, 0x00f68021, 0x00f6842d, 0x00f6881b,
+  0x00f68834, 0x00f68c33, 0x00f6901b, 0x00f69033, 0x00f6941b, 0x00f69425, 0x00f6981b, 0x00f6981b,
+  0x00f6982c, 0x00f69c1b, 0x00f69c33, 0x00f6a034, 0x00f6a41b, 0x00f6a41b, 0x00f6a41b, 0x00f6a434,
+  0x00f6a829, 0x00f6ac28, 0x00f6b023, 0x00f6b425, 0x00f6b81b, 0x00f6b82f, 0x00f6bc32, 0x00f6c029,
+  0x00f6c425, 0x00f6c81b
+};
+
+// where in hyphenValues the pattern ending at each node is, or 0
+extern const uint16_t hyphenPatterns[15794] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 7,
+  10, 0, 0, 0, 13, 16, 0, 0, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 23, 27, 0, 31, 34, 0,
+  38, 41, 44, 48, 52, 0, 56, 0, 59, 64, 0, 67,
+  70, 0, 74, 77, 0, 80, 83, 86, 89, 94, 97, 100,
+  0, 103, 108, 0, 112, 0, 115, 119, 122, 125, 0, 129,
+  0, 133, 0, 137, 140, 0, 144, 147, 152, 155, 158, 161,
+  0, 166, 169, 172, 175, 0, 178, 0, 0, 0, 182, 0,
+  185, 189, 192, 0, 0, 0, 0, 0, 0, 195, 0, 0,
+  0, 198, 0, 0, 0, 0, 201, 204, 208, 0, 211, 215,
+  218, 221, 225, 228, 231, 234, 0, 238, 242, 245, 248, 251,
+  254, 257, 0, 260, 0, 0, 265, 268, 0, 271, 274, 277,
+  280, 0, 0, 283, 286, 0, 289, 0, 292, 295, 0, 298,
+  301, 306, 310, 0, 314, 318, 323, 0, 0, 328, 0, 331,
+  0, 0, 335, 338, 0, 343, 346, 349, 354, 357, 0, 0,
+  0, 360, 363, 0, 366, 0, 0, 369, 372, 375, 0, 379,
+  0, 382, 385, 0, 0, 0, 388, 0, 391, 394, 397, 400,
+  403, 406, 0, 0, 0, 409, 414, 417, 0, 420, 424, 429,
+  0, 432, 435, 440, 0, 444, 0, 447, 450, 453, 0, 458,
+  461, 465, 470, 0, 0, 473, 477, 480, 483, 487, 0, 491,
+  495, 0, 498, 501, 505, 508, 512, 515, 519, 523, 528, 531,
+  534, 537, 540, 0, 0, 0, 545, 0, 548, 0, 553, 556,
+  561, 565, 568, 0, 573, 577, 580, 583, 588, 0, 591, 595,
+  0, 599, 602, 0, 0, 0, 0, 0, 0, 605, 609, 612,
+  615, 0, 0, 618, 621, 0, 624, 0, 0, 0, 627, 0,
+  0, 0, 630, 633, 637, 0, 640, 643, 0, 0, 646, 651,
+  656, 660, 0, 664, 668, 671, 676, 0, 680, 683, 0, 686,
+  689, 0, 0, 692, 695, 698, 0, 701, 0, 704, 707, 0,
+  0, 710, 713, 717, 0, 0, 0, 722, 0, 725, 728, 0,
+  732, 0, 736, 740, 744, 0, 747, 750, 754, 758, 762, 0,
+  0, 765, 768, 0, 771, 774, 777, 780, 783, 786, 790, 793,
+  0, 797, 801, 0, 0, 805, 808, 812, 817, 820, 0, 824,
+  829, 834, 837, 840, 843, 846, 0, 0, 0, 0, 0, 0,
+  0, 849, 854, 857, 0, 0, 0, 0, 0, 0, 860, 0,
+  863, 866, 0, 0, 870, 0, 0, 0, 873, 878, 0, 881,
+  0, 0, 884, 887, 0, 0, 890, 895, 0, 0, 898, 901,
+  904, 907, 911, 914, 917, 920, 923, 926, 930, 933, 0, 936,
+  939, 942, 0, 0, 945, 949, 0, 0, 0, 952, 0, 0,
+  0, 0, 956, 959, 962, 965, 968, 972, 975, 978, 0, 981,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 986, 0, 0, 0, 989, 0, 992, 0, 0,
+  0, 995, 0, 0, 0, 0, 0, 999, 0, 0, 0, 0,
+  1002, 1005, 1008, 0, 0, 1011, 1014, 1019, 1022, 0, 1025, 1028,
+  1031, 1034, 1037, 1040, 0, 0, 1043, 0, 0, 0, 0, 1047,
+  1050, 0, 1053, 0, 0, 1056, 0, 0, 1059, 0, 0, 1062,
+  0, 1065, 0, 0, 0, 1068, 0, 0, 0, 0, 0, 0,
+  0, 1071, 0, 0, 1074, 0, 0, 0, 0, 0, 0, 0,
+  1077, 0, 0, 1080, 1083, 0, 0, 0, 0, 0, 0, 1086,
+  0, 0, 0, 0, 0, 1089, 1092, 0, 1095, 0, 0, 1098,
+  0, 0, 1101, 1104, 1107, 0, 1110, 0, 1114, 0, 0, 1117,
+  0, 1120, 0, 0, 1123, 0, 1126, 0, 0, 1129, 1132, 0,
+  0, 0, 0, 0, 0, 0, 0, 1135, 1138, 1141, 1144, 0,
+  0, 1147, 0, 1152, 1155, 0, 1160, 1166, 1169, 0, 1172, 1175,
+  1178, 1181, 1184, 1188, 0, 0, 1191, 0, 0, 0, 1194, 0,
+  0, 1197, 1200, 0, 0, 0, 1203, 0, 1206, 0, 0, 0,
+  0, 0, 1212, 1215, 1218, 0, 0, 0, 0, 1221, 0, 0,
+  0, 1224, 1227, 0, 0, 0, 1230, 1236, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1240, 0, 1243, 1246, 0,
+  0, 1249, 1252, 1255, 0, 1258, 0, 1261, 0, 1267, 1270, 1273,
+  0, 0, 1276, 0, 1279, 1282, 0, 0, 0, 1285, 1289, 1292,
+  0, 0, 0, 1295, 0, 1298, 1301, 1304, 0, 0, 0, 0,
+  0, 0, 1307, 0, 0, 0, 0, 1310, 0, 0, 0, 1313,
+  0, 0, 1316, 1319, 1322, 1325, 0, 0, 1328, 0, 0, 1331,
+  1334, 1338, 1341, 0, 1346, 1349, 1352, 0, 0, 1356, 1359, 1365,
+  1368, 0, 0, 0, 1371, 0, 0, 0, 1375, 1378, 1381, 1384,
+  0, 1387, 1390, 1393, 1396, 1399, 1402, 0, 1405, 1408, 1411, 0,
+  1416, 0, 1419, 0, 0, 1422, 1425, 0, 1428, 1431, 0, 1434,
+  1439, 1442, 0, 1446, 1450, 1454, 0, 1457, 1460, 1464, 0, 0,
+  0, 0, 0, 1467, 1470, 0, 1473, 1476, 1479, 0, 1482, 0,
+  0, 0, 1485, 1488, 1491, 1494, 1497, 1500, 1504, 0, 1507, 0,
+  0, 1510, 1513, 1516, 0, 1519, 0, 1523, 0, 1526, 0, 0,
+  0, 0, 1529, 1532, 0, 0, 1535, 0, 0, 1538, 1541, 0,
+  0, 1544, 0, 1547, 1550, 1554, 0, 1559, 1562, 0, 0, 1565,
+  0, 1568, 0, 1571, 0, 1574, 1578, 0, 1582, 0, 1585, 0,
+  0, 0, 0, 0, 0, 1588, 0, 0, 1591, 0, 1594, 1597,
+  1600, 0, 0, 0, 0, 0, 0, 0, 1603, 0, 1606, 1609,
+  0, 0, 0, 0, 0, 0, 1612, 1615, 0, 0, 0, 0,
+  0, 1618, 0, 0, 0, 0, 0, 1621, 1624, 0, 0, 0,
+  0, 1627, 1632, 1635, 1638, 1643, 0, 1646, 1649, 1652, 0, 1655,
+  1658, 0, 0, 0, 1661, 0, 0, 0, 0, 0, 1664, 1667,
+  0, 0, 1670, 1673, 1676, 0, 1680, 1683, 0, 1686, 0, 1689,
+  1693, 1696, 1700, 1703, 0, 0, 0, 1706, 1709, 0, 0, 1712,
+  0, 0, 0, 0, 1715, 0, 0, 0, 0, 1718, 1721, 1724,
+  0, 1727, 0, 0, 0, 1730, 0, 1733, 1736, 0, 1739, 0,
+  1742, 1745, 0, 1748, 0, 0, 1751, 0, 0, 0, 1754, 0,
+  0, 0, 1757, 0, 1760, 0, 0, 0, 1763, 1766, 1769, 0,
+  0, 0, 1772, 1775, 0, 0, 0, 0, 1778, 0, 0, 0,
+  0, 1781, 1786, 1789, 1792, 0, 0, 1795, 0, 1798, 1801, 0,
+  1804, 0, 0, 0, 0, 0, 1807, 0, 1810, 0, 0, 0,
+  0, 1813, 1816, 0, 0, 1819, 1822, 0, 0, 0, 1825, 1828,
+  1831, 0, 1834, 0, 0, 0, 1837, 1842, 0, 1845, 0, 0,
+  1848, 1851, 0, 1854, 1857, 1860, 1863, 1866, 1869, 0, 1872, 1875,
+  1878, 0, 1881, 1884, 1887, 1890, 1893, 0, 1898, 1901, 0, 0,
+  1904, 1907, 0, 0, 0, 1910, 0, 0, 1913, 1916, 1919, 0,
+  1922, 1925, 1928, 1933, 0, 0, 0, 0, 0, 0, 1938, 0,
+  0, 0, 0, 0, 1941, 0, 0, 1944, 0, 0, 1947, 0,
+  1950, 0, 1953, 1956, 1959, 0, 0, 0, 1962, 0, 0, 0,
+  1967, 0, 0, 0, 1970, 0, 1973, 0, 0, 1976, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1979, 0, 0, 1982,
+  1985, 0, 0, 0, 1988, 0, 0, 1991, 1994, 1997, 2000, 0,
+  0, 0, 2003, 0, 2006, 2009, 2012, 0, 0, 0, 0, 2015,
+  2018, 0, 0, 2021, 0, 0, 0, 2025, 0, 2028, 0, 0,
+  2031, 2034, 0, 0, 0, 0, 0, 0, 2037, 0, 0, 0,
+  2040, 2043, 2046, 0, 0, 0, 2049, 2052, 2056, 0, 0, 2059,
+  0, 2062, 2065, 0, 2068, 0, 0, 0, 2071, 0, 0, 2074,
+  0, 0, 2077, 0, 0, 2080, 2083, 0, 2086, 2089, 2092, 2095,
+  2098, 2102, 0, 2105, 2108, 2111, 0, 2114, 2117, 0, 0, 0,
+  2120, 0, 0, 2123, 2126, 0, 2129, 0, 0, 0, 2132, 0,
+  0, 0, 2135, 0, 0, 0, 0, 2138, 2143, 2146, 0, 0,
+  2149, 0, 0, 2154, 2157, 2160, 0, 2165, 2168, 0, 2171, 2174,
+  2177, 0, 0, 2180, 0, 0, 0, 0, 0, 2183, 0, 2186,
+  0, 0, 2189, 0, 0, 2192, 2195, 0, 2198, 2201, 0, 2204,
+  2207, 2210, 2213, 2216, 0, 0, 2219, 2222, 0, 2225, 0, 2229,
+  0, 2232, 2235, 2238, 0, 2241, 0, 2244, 2248, 0, 2251, 0,
+  2254, 2257, 2260, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2263, 0, 2266, 2269, 2272, 2275, 2278, 2281, 0, 0, 0, 0,
+  0, 0, 0, 2284, 0, 2287, 2290, 2293, 0, 2296, 0, 0,
+  0, 0, 0, 0, 2299, 2302, 0, 0, 0, 2307, 0, 2311,
+  0, 2314, 2317, 0, 2320, 2323, 2326, 0, 0, 0, 0, 0,
+  2329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2332, 2335,
+  0, 0, 0, 2338, 2341, 2344, 2347, 0, 0, 2350, 0, 0,
+  2353, 2356, 2359, 0, 0, 0, 2362, 0, 0, 2365, 2368, 0,
+  2371, 0, 2374, 2377, 0, 0, 2380, 2386, 0, 0, 2389, 0,
+  0, 0, 2392, 0, 0, 0, 0, 0, 2395, 2398, 0, 2401,
+  2404, 0, 0, 2407, 0, 2410, 2413, 2416, 0, 2419, 0, 0,
+  0, 2422, 0, 2425, 2428, 0, 2431, 0, 2434, 0, 2437, 0,
+  0, 2441, 0, 0, 0, 2444, 2447, 0, 0, 2450, 0, 0,
+  0, 2453, 0, 0, 2456, 2459, 2462, 0, 2465, 2468, 2471, 2474,
+  2477, 0, 0, 2482, 0, 0, 2485, 0, 2488, 2491, 2494, 0,
+  0, 0, 0, 0, 0, 2497, 2500, 0, 2503, 0, 0, 0,
+  0, 2506, 2509, 2512, 0, 0, 0, 2515, 2518, 0, 2521, 2524,
+  2527, 0, 2530, 2533, 2536, 0, 0, 0, 0, 0, 0, 0,
+  2539, 2542, 2545, 2548, 2551, 0, 2555, 0, 0, 0, 2558, 2561,
+  2564, 2567, 0, 2570, 0, 0, 2573, 2576, 2579, 0, 0, 0,
+  2582, 2587, 2590, 0, 0, 0, 2593, 2596, 0, 0, 0, 2599,
+  0, 0, 2602, 0, 2605, 0, 2608, 2611, 0, 2614, 2617, 0,
+  0, 0, 0, 0, 2620, 0, 2623, 0, 2626, 2629, 0, 0,
+  0, 2632, 2635, 2640, 0, 2643, 2646, 2649, 2652, 0, 0, 0,
+  0, 0, 0, 2655, 2658, 0, 2661, 2664, 0, 0, 0, 0,
+  0, 0, 0, 0, 2667, 0, 2672, 0, 2675, 0, 2678, 2681,
+  0, 2684, 0, 2687, 0, 0, 0, 2690, 0, 0, 0, 0,
+  2693, 0, 0, 0, 0, 0, 0, 2696, 2699, 0, 0, 2702,
+  0, 0, 0, 2705, 0, 2708, 2711, 0, 0, 2714, 0, 0,
+  0, 0, 2717, 2720, 2723, 0, 0, 0, 0, 0, 2726, 0,
+  0, 0, 0, 2729, 0, 0, 0, 2732, 0, 2735, 0, 0,
+  2738, 2741, 2744, 2747, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2750, 0, 2753, 0, 2756, 2759, 0, 0, 0,
+  0, 2762, 0, 0, 0, 0, 0, 2765, 0, 2768, 0, 0,
+  0, 0, 0, 2771, 0, 2774, 2777, 0, 2780, 0, 2783, 2786,
+  0, 2789, 0, 0, 2792, 2795, 2798, 2803, 2806, 2810, 2813, 0,
+  0, 0, 0, 2816, 2819, 0, 0, 0, 2822, 0, 2825, 2828,
+  2831, 2834, 2837, 2840, 0, 2843, 0, 0, 0, 2846, 2849, 0,
+  0, 0, 0, 0, 2854, 0, 0, 2857, 0, 0, 0, 2862,
+  2865, 2869, 2872, 0, 0, 2875, 0, 0, 0, 0, 0, 2878,
+  2881, 0, 0, 2884, 2887, 0, 0, 2890, 2893, 2896, 2899, 0,
+  2902, 2905, 0, 2908, 2911, 0, 0, 2914, 0, 0, 2917, 0,
+  0, 0, 0, 0, 2920, 0, 0, 0, 0, 0, 2923, 2926,
+  2929, 0, 0, 0, 0, 2932, 0, 0, 0, 2935, 0, 0,
+  0, 0, 0, 2939, 0, 2942, 0, 0, 2947, 2950, 0, 2953,
+  2956, 2959, 0, 0, 2962, 0, 2965, 0, 2968, 2971, 2974, 0,
+  0, 0, 0, 0, 0, 0, 2977, 0, 2980, 2983, 0, 0,
+  0, 0, 2986, 0, 2989, 0, 2994, 0, 2997, 0, 0, 0,
+  3000, 3003, 0, 3006, 3009, 0, 3012, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3015, 0, 3018, 0, 3022, 0, 0, 0,
+  0, 3025, 3028, 3031, 3034, 3037, 0, 3040, 3043, 0, 0, 3046,
+  0, 0, 3049, 0, 0, 0, 0, 3052, 0, 0, 3055, 0,
+  3058, 3061, 0, 3064, 3067, 0, 3071, 0, 0, 3074, 0, 3077,
+  0, 3080, 0, 0, 3083, 0, 0, 0, 3086, 3089, 0, 3092,
+  3096, 3099, 0, 0, 0, 0, 0, 3102, 0, 3106, 0, 3109,
+  3112, 0, 0, 3115, 3118, 3121, 3124, 0, 0, 0, 0, 3127,
+  3131, 3134, 3137, 0, 3140, 3143, 3146, 3149, 0, 0, 3152, 0,
+  3155, 0, 0, 0, 0, 0, 0, 3158, 0, 3161, 0, 3164,
+  3167, 0, 0, 0, 0, 0, 0, 3170, 3173, 0, 3177, 3180,
+  3183, 0, 3186, 0, 3189, 0, 0, 0, 3192, 0, 0, 3195,
+  3198, 3203, 3206, 0, 3209, 3213, 0, 3217, 3220, 3223, 3226, 3229,
+  3232, 3235, 0, 0, 3238, 0, 0, 3241, 0, 3247, 0, 0,
+  0, 0, 0, 0, 0, 3250, 3253, 0, 3256, 3259, 0, 0,
+  3262, 3266, 3269, 0, 0, 0, 3272, 3275, 0, 0, 0, 3278,
+  3281, 3284, 3287, 0, 3290, 0, 3293, 0, 3296, 3299, 3302, 3305,
+  0, 0, 0, 3310, 3313, 0, 3316, 3319, 3323, 3326, 0, 0,
+  3329, 3332, 3335, 3338, 0, 3341, 3344, 3347, 0, 0, 3350, 0,
+  0, 0, 0, 0, 3353, 0, 0, 3356, 0, 0, 0, 0,
+  3359, 3362, 3365, 0, 3368, 3371, 3374, 0, 3377, 3380, 3383, 3389,
+  3394, 0, 0, 0, 3397, 3400, 0, 3404, 3407, 3410, 0, 3413,
+  3416, 3419, 0, 0, 3422, 3425, 3428, 3431, 0, 3435, 0, 0,
+  3438, 3441, 3444, 3447, 0, 0, 0, 0, 3450, 0, 0, 3453,
+  3456, 0, 0, 0, 3459, 0, 0, 3462, 3465, 0, 0, 3468,
+  0, 3471, 0, 3474, 3479, 3483, 0, 3486, 3489, 0, 0, 3492,
+  0, 3495, 0, 3498, 3501, 3504, 0, 3508, 3511, 3514, 0, 3517,
+  3520, 3523, 0, 3526, 3529, 0, 3532, 0, 3535, 3538, 0, 0,
+  0, 3541, 0, 0, 0, 0, 0, 3544, 0, 3547, 0, 0,
+  0, 3550, 0, 0, 3553, 0, 0, 3556, 3561, 0, 3565, 3568,
+  3571, 3574, 3577, 0, 3582, 0, 0, 0, 0, 0, 3585, 3588,
+  3591, 3594, 0, 0, 0, 3597, 0, 3601, 0, 0, 3604, 0,
+  3607, 3610, 3613, 0, 3616, 0, 0, 0, 3619, 3622, 3625, 0,
+  0, 0, 0, 3628, 0, 3631, 0, 0, 0, 3634, 0, 0,
+  0, 0, 0, 0, 0, 0, 3637, 0, 3640, 3643, 3646, 0,
+  3649, 0, 0, 3652, 0, 0, 3655, 3658, 0, 3661, 3664, 3667,
+  3670, 0, 3673, 0, 0, 3677, 3680, 3683, 0, 3686, 0, 3689,
+  3692, 3695, 3698, 0, 0, 3701, 0, 0, 3704, 3707, 3710, 3713,
+  3719, 3722, 3725, 0, 3728, 3731, 3734, 3737, 3740, 3743, 0, 3746,
+  3749, 0, 3752, 0, 0, 3755, 3758, 0, 3761, 3764, 3767, 3771,
+  0, 3774, 0, 3777, 3780, 0, 3783, 0, 0, 3786, 3789, 3792,
+  3795, 0, 3799, 3802, 3805, 0, 0, 0, 3808, 3812, 3815, 3818,
+  3821, 3824, 3827, 3830, 3833, 0, 3836, 3839, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 3842, 3845, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3848,
+  0, 0, 3851, 0, 0, 0, 0, 0, 0, 3854, 0, 3857,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3860, 3863,
+  0, 0, 0, 0, 0, 0, 3866, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3869, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3872, 0, 0, 0, 0, 3875,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3878, 0,
+  0, 0, 0, 0, 0, 0, 3881, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 3884, 3887, 0,
+  0, 0, 0, 0, 0, 0, 3890, 0, 0, 3893, 3896, 3899,
+  3902, 3905, 0, 0, 0, 0, 0, 0, 3908, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3911, 0, 0, 3914, 3917, 0, 3920, 0, 0, 0, 0, 3923,
+  3926, 0, 3929, 0, 3932, 3935, 3938, 0, 0, 3941, 3944, 0,
+  0, 3947, 0, 0, 3950, 3953, 3956, 3959, 3962, 0, 3965, 3968,
+  3971, 0, 3974, 3977, 0, 3980, 3983, 3986, 0, 0, 3989, 3992,
+  3995, 0, 3998, 0, 4001, 4004, 4007, 4010, 4013, 0, 4016, 0,
+  4021, 0, 0, 0, 4024, 4027, 4030, 4033, 4036, 4039, 0, 0,
+  0, 0, 4042, 4045, 0, 4048, 4051, 0, 0, 0, 0, 4054,
+  0, 0, 0, 4057, 0, 4060, 4063, 0, 4066, 0, 4069, 4072,
+  0, 4076, 0, 0, 4080, 4083, 0, 4086, 4089, 0, 0, 4092,
+  4095, 0, 4098, 4101, 4104, 0, 0, 0, 4107, 4110, 4113, 4116,
+  4119, 4122, 4125, 4128, 0, 0, 4131, 0, 4134, 0, 4137, 0,
+  0, 0, 0, 4140, 0, 0, 4143, 0, 0, 4146, 4149, 4152,
+  4155, 4160, 0, 0, 0, 4163, 0, 4166, 0, 0, 4169, 4172,
+  0, 0, 4175, 0, 4178, 4181, 4184, 4187, 0, 4191, 4194, 4197,
+  4200, 4203, 0, 4206, 0, 4209, 4212, 4215, 4221, 4224, 4227, 4230,
+  0, 4233, 0, 0, 4236, 0, 4239, 4242, 0, 0, 0, 0,
+  4245, 0, 4248, 4251, 4254, 4258, 4261, 0, 0, 4264, 4267, 4270,
+  4273, 4276, 0, 4279, 0, 4282, 4285, 4288, 4291, 4294, 0, 4297,
+  4300, 4303, 0, 0, 4306, 4309, 4312, 0, 0, 0, 4315, 4318,
+  4321, 4324, 4327, 4330, 4333, 4336, 0, 4339, 0, 4342, 4345, 0,
+  4348, 4351, 0, 0, 0, 4354, 0, 4357, 4360, 4363, 4366, 4369,
+  4372, 4375, 4378, 4381, 0, 4384, 4387, 0, 0, 4390, 4393, 4396,
+  4399, 4402, 0, 0, 4405, 0, 0, 4408, 0, 4411, 0, 4414,
+  0, 4417, 0, 4420, 4423, 0, 4426, 4429, 0, 0, 4432, 4435,
+  4439, 4442, 4445, 4448, 4451, 4454, 4457, 0, 4460, 0, 4463, 0,
+  4466, 4469, 4472, 0, 4475, 0, 0, 4478, 4481, 0, 4484, 0,
+  4487, 4490, 0, 0, 0, 4493, 4496, 4499, 0, 0, 4502, 0,
+  0, 0, 4505, 4508, 0, 0, 4511, 4514, 0, 4517, 0, 0,
+  4520, 4523, 4526, 4529, 4532, 4538, 4541, 0, 4544, 0, 4547, 4550,
+  4554, 0, 0, 4559, 0, 0, 0, 0, 4562, 4567, 4570, 4573,
+  4576, 4579, 4583, 4586, 0, 4589, 4592, 4595, 0, 4598, 4601, 4604,
+  4607, 4610, 0, 0, 0, 4613, 4616, 4619, 4622, 4625, 4628, 0,
+  4631, 4634, 0, 4637, 4640, 4643, 4646, 4649, 0, 4652, 4655, 0,
+  4658, 4661, 4664, 4667, 4670, 0, 0, 0, 4673, 0, 4676, 4679,
+  4682, 4685, 0, 0, 0, 4688, 4691, 0, 4694, 0, 0, 4697,
+  0, 4700, 0, 4703, 4706, 4709, 4712, 4715, 0, 0, 0, 0,
+  4718, 4721, 4724, 4727, 4730, 4733, 0, 4736, 4739, 4742, 0, 0,
+  0, 0, 0, 4745, 4748, 0, 4751, 0, 0, 4754, 0, 4757,
+  0, 4760, 4763, 4766, 4769, 4772, 4775, 0, 4778, 4781, 4784, 0,
+  4788, 4791, 4794, 0, 4797, 4802, 0, 4805, 4808, 4811, 4816, 0,
+  4819, 0, 4822, 4825, 4828, 4831, 0, 4834, 4837, 4842, 4845, 0,
+  4848, 4851, 4854, 4857, 0, 0, 0, 4860, 4863, 4866, 4869, 0,
+  4873, 0, 4876, 4879, 4882, 4885, 4888, 0, 4891, 0, 0, 4894,
+  4897, 0, 4900, 4903, 4906, 4909, 0, 4912, 0, 0, 0, 4915,
+  4918, 4921, 0, 0, 4924, 4927, 4930, 4933, 4936, 0, 0, 0,
+  4939, 0, 4943, 4946, 0, 4949, 4952, 4955, 0, 4958, 0, 4961,
+  0, 4964, 4967, 0, 0, 4970, 0, 0, 4973, 0, 0, 4976,
+  4979, 4982, 4986, 4989, 4992, 0, 4995, 4998, 5001, 5004, 5007, 5010,
+  5013, 5016, 5019, 5022, 5025, 5028, 5031, 0, 5034, 5037, 0, 5040,
+  0, 0, 5043, 5046, 5049, 5052, 0, 5055, 5061, 5064, 5067, 5070,
+  5073, 5076, 5079, 5082, 5085, 0, 5088, 5091, 5094, 5097, 5100, 5103,
+  5106, 5109, 0, 0, 5112, 0, 5115, 5118, 0, 5121, 5124, 0,
+  5127, 5130, 5134, 0, 0, 0, 0, 5137, 0, 5140, 5143, 5146,
+  5152, 5155, 5158, 5161, 0, 5164, 5167, 5170, 5173, 5176, 5179, 5182,
+  5185, 5188, 0, 5191, 0, 5194, 5199, 5202, 0, 5205, 0, 5208,
+  5211, 5214, 0, 0, 0, 0, 5217, 5220, 5223, 0, 0, 0,
+  5226, 0, 5229, 5232, 5235, 0, 5238, 5241, 5244, 5247, 5250, 5253,
+  5256, 0, 0, 5259, 5262, 5265, 0, 5268, 0, 5271, 5274, 5277,
+  0, 5280, 0, 0, 5283, 5286, 0, 5289, 5292, 0, 5295, 0,
+  5298, 0, 5301, 0, 5304, 5307, 0, 0, 0, 0, 0, 0,
+  5310, 0, 5313, 5316, 5319, 0, 0, 0, 5325, 5328, 5331, 5334,
+  0, 5337, 5340, 5343, 5346, 5349, 0, 0, 5352, 5355, 5358, 0,
+  0, 5361, 5364, 5367, 5370, 0, 0, 5373, 0, 5376, 5379, 0,
+  5382, 5386, 0, 5390, 0, 5393, 5396, 5399, 0, 0, 0, 0,
+  0, 0, 5402, 5407, 5410, 5413, 0, 5416, 0, 5419, 0, 5422,
+  5425, 0, 0, 5428, 5431, 0, 0, 5434, 5437, 5440, 5443, 0,
+  5446, 5449, 5453, 5456, 0, 0, 5459, 5462, 5465, 5468, 5471, 5474,
+  5477, 5480, 5483, 0, 5486, 5489, 5492, 5495, 5498, 5501, 0, 5504,
+  0, 0, 5509, 0, 5512, 0, 5515, 0, 5518, 5521, 5524, 5527,
+  5530, 5533, 5536, 5539, 0, 5542, 5546, 0, 0, 5549, 5552, 5555,
+  5558, 0, 0, 5562, 0, 5565, 5568, 5571, 5575, 5578, 5583, 0,
+  0, 5586, 0, 0, 5589, 0, 0, 5592, 0, 5595, 5598, 0,
+  5601, 5604, 5607, 0, 5610, 5613, 5616, 5619, 5622, 5625, 5628, 5631,
+  0, 5634, 0, 5637, 5640, 5644, 5647, 0, 5650, 0, 5653, 0,
+  0, 5656, 5659, 5662, 5665, 5668, 5671, 5674, 5677, 5680, 5683, 5686,
+  0, 5689, 5692, 0, 5695, 5698, 0, 0, 0, 5701, 5705, 5709,
+  5712, 0, 5715, 5718, 5721, 5724, 5727, 0, 5730, 5733, 5736, 5739,
+  5742, 0, 5747, 0, 0, 5750, 0, 5753, 5756, 0, 5759, 5762,
+  0, 5765, 5768, 5771, 0, 5774, 5780, 5783, 5788, 5791, 5794, 5797,
+  5800, 0, 0, 5803, 0, 5806, 0, 5809, 5812, 0, 5815, 0,
+  0, 0, 5818, 5821, 5824, 5827, 5830, 0, 5833, 5838, 0, 5842,
+  5845, 5848, 5851, 5854, 0, 0, 5857, 0, 5860, 5863, 0, 5867,
+  5870, 5873, 0, 5876, 0, 5879, 5882, 5885, 5888, 0, 5891, 0,
+  5894, 0, 5897, 0, 5900, 5903, 0, 5906, 5912, 5915, 5918, 5921,
+  5924, 5927, 0, 0, 0, 5930, 5933, 5936, 5939, 0, 5942, 0,
+  0, 5945, 5948, 5951, 0, 0, 5954, 5957, 0, 5961, 5964, 0,
+  5967, 5970, 5973, 5979, 5982, 0, 0, 5985, 0, 5988, 5991, 0,
+  5994, 5997, 6001, 6004, 6007, 6010, 6013, 6016, 6019, 6022, 6025, 0,
+  6028, 6031, 6034, 6038, 6041, 6044, 6047, 0, 6050, 6053, 6056, 6059,
+  0, 0, 6062, 0, 6065, 6068, 6071, 6074, 6077, 6080, 6083, 6086,
+  6089, 6092, 6097, 6100, 6104, 6107, 0, 6110, 6113, 6116, 0, 0,
+  6119, 0, 6122, 6125, 0, 0, 6128, 6131, 6134, 6137, 6140, 6143,
+  6146, 6149, 6152, 6155, 0, 6159, 0, 6163, 6166, 6169, 6172, 6175,
+  6178, 0, 6181, 6184, 0, 6187, 6190, 6193, 6196, 0, 0, 6199,
+  0, 0, 0, 6202, 6205, 6208, 0, 6211, 6215, 0, 0, 6218,
+  0, 0, 6221, 6224, 6227, 0, 6230, 6233, 6236, 6239, 6242, 0,
+  6245, 6248, 6253, 6256, 6259, 0, 6262, 6267, 6270, 6273, 6276, 0,
+  0, 6279, 6282, 6285, 6288, 6291, 6294, 6297, 0, 6300, 6303, 6308,
+  6311, 0, 0, 6314, 6317, 6320, 0, 6323, 6326, 6332, 6335, 0,
+  6338, 0, 6341, 0, 6346, 0, 6349, 6352, 6355, 6358, 6361, 6364,
+  0, 0, 6367, 6370, 6373, 0, 0, 6376, 0, 6379, 6382, 0,
+  0, 0, 6385, 6388, 0, 0, 6391, 0, 6394, 6397, 6403, 6406,
+  6409, 0, 6412, 6415, 6418, 6422, 0, 6425, 6428, 6431, 6434, 6439,
+  0, 6442, 0, 6445, 6448, 6451, 0, 0, 0, 0, 6454, 6457,
+  0, 6460, 6464, 0, 6467, 6470, 0, 6473, 6476, 6479, 6482, 0,
+  6487, 6490, 6493, 0, 0, 6496, 6499, 6502, 6505, 6508, 6511, 6514,
+  0, 6517, 6520, 6523, 6526, 6529, 6532, 6535, 0, 0, 6538, 6541,
+  6544, 0, 0, 0, 6547, 6551, 0, 6554, 6557, 6560, 6563, 6566,
+  6569, 0, 6572, 0, 6575, 6578, 6581, 6584, 0, 6587, 6590, 6593,
+  6597, 0, 6600, 6603, 6606, 0, 6609, 6612, 6615, 6618, 6621, 0,
+  6624, 0, 6627, 0, 0, 6630, 0, 6633, 6636, 6639, 0, 6642,
+  0, 6645, 6648, 0, 6651, 0, 0, 6654, 6657, 6660, 6665, 6668,
+  6672, 0, 6675, 6678, 0, 6681, 0, 6684, 6687, 6690, 6693, 6696,
+  6699, 6702, 6705, 6710, 6715, 0, 0, 6721, 6724, 0, 6727, 6730,
+  0, 6733, 0, 6736, 6739, 0, 6742, 6745, 6748, 0, 6751, 6754,
+  6757, 0, 0, 0, 0, 6760, 6763, 6766, 0, 6769, 6772, 6775,
+  6778, 0, 6781, 6784, 6787, 0, 6790, 0, 6793, 0, 6796, 0,
+  6799, 6802, 6805, 6808, 6811, 6814, 6817, 0, 6820, 6823, 0, 6826,
+  6829, 6835, 6838, 6841, 6844, 0, 6847, 0, 6850, 6853, 6856, 0,
+  0, 0, 0, 0, 0, 6859, 0, 6862, 6865, 6868, 6871, 0,
+  6874, 6878, 0, 6881, 0, 6884, 6888, 0, 6891, 6894, 6898, 0,
+  6901, 6904, 6907, 6910, 6913, 0, 0, 6916, 6919, 0, 6922, 6925,
+  6928, 0, 6931, 6934, 6937, 0, 0, 6940, 6943, 6946, 0, 6949,
+  0, 6952, 0, 6955, 6958, 6961, 6964, 0, 6967, 0, 0, 0,
+  0, 0, 0, 0, 6970, 6973, 6976, 6979, 0, 6982, 0, 6985,
+  0, 6988, 6992, 6995, 0, 0, 0, 6998, 7001, 0, 7004, 7007,
+  7010, 7013, 7016, 0, 7019, 7022, 0, 0, 0, 7025, 7028, 7031,
+  7034, 7037, 7040, 7043, 0, 0, 0, 0, 7046, 7049, 7052, 0,
+  7055, 0, 0, 7058, 7061, 0, 7064, 7067, 0, 7070, 7073, 7077,
+  7080, 7083, 7086, 7089, 7092, 7095, 7098, 0, 7101, 7104, 0, 7107,
+  7110, 7113, 7116, 0, 7119, 7122, 7127, 7130, 7133, 7136, 7139, 0,
+  7142, 7145, 7148, 0, 0, 7151, 7154, 7157, 7160, 7163, 7166, 7169,
+  7172, 7175, 7178, 7181, 7184, 7187, 7190, 7193, 7196, 7199, 0, 0,
+  7202, 0, 7205, 7208, 0, 0, 7211, 0, 7214, 7217, 7220, 0,
+  7223, 7226, 7229, 7232, 0, 7235, 0, 0, 7239, 7242, 0, 7245,
+  0, 0, 7248, 7251, 7254, 7257, 7260, 0, 7263, 0, 7266, 0,
+  7269, 7273, 7276, 7279, 7282, 7285, 0, 7288, 0, 7291, 0, 7294,
+  0, 7297, 0, 0, 7300, 0, 7303, 7306, 7311, 7314, 7317, 0,
+  7320, 7323, 0, 7326, 7329, 7333, 7336, 7339, 7342, 0, 7345, 7348,
+  0, 7351, 0, 7354, 0, 0, 0, 0, 0, 7357, 7360, 7363,
+  0, 7366, 7369, 0, 7372, 0, 0, 7377, 7380, 7383, 7386, 7390,
+  7393, 0, 7397, 7400, 7403, 7406, 0, 0, 7409, 0, 7412, 0,
+  7415, 0, 0, 0, 7418, 7421, 7424, 0, 7427, 7430, 0, 7433,
+  7436, 7439, 0, 0, 7442, 7447, 0, 7450, 0, 0, 7453, 0,
+  0, 7456, 7459, 7462, 0, 7465, 7468, 7471, 7474, 0, 7477, 7480,
+  0, 0, 7483, 7486, 0, 7489, 7492, 0, 0, 7495, 7498, 0,
+  7501, 7504, 0, 7507, 7510, 0, 7513, 7516, 7519, 7522, 7525, 0,
+  0, 0, 0, 7528, 0, 7531, 7535, 7538, 7541, 7544, 7547, 7550,
+  7553, 7556, 7559, 0, 0, 0, 7562, 7565, 0, 7568, 0, 0,
+  7572, 7575, 7578, 0, 7581, 7584, 7587, 0, 7591, 7594, 7597, 0,
+  7600, 7603, 7606, 7609, 0, 7612, 7615, 7618, 7621, 0, 7624, 7627,
+  7630, 7633, 0, 7636, 7639, 0, 7643, 7646, 7649, 7652, 0, 7655,
+  0, 0, 7658, 0, 7661, 0, 7665, 7668, 7671, 7674, 0, 7677,
+  0, 7680, 7683, 0, 7686, 0, 7689, 0, 7693, 0, 7696, 7699,
+  7702, 7705, 0, 7708, 7711, 0, 0, 7714, 7717, 0, 0, 7720,
+  7723, 7727, 0, 0, 0, 7730, 7733, 7736, 7739, 0, 0, 7742,
+  0, 7745, 0, 7748, 0, 7751, 7754, 0, 7757, 7760, 0, 0,
+  0, 0, 7763, 0, 7766, 7769, 0, 0, 7772, 7775, 0, 7778,
+  7781, 0, 7784, 7787, 7790, 7793, 7796, 7799, 0, 7802, 7805, 7808,
+  7811, 7814, 7817, 7820, 7823, 0, 7826, 0, 7829, 7832, 7835, 7838,
+  7841, 7844, 7847, 7852, 0, 7855, 7858, 7861, 7864, 7867, 0, 7870,
+  7873, 7876, 7879, 7882, 0, 0, 0, 0, 0, 0, 7885, 0,
+  0, 7888, 7891, 0, 7897, 0, 0, 7900, 0, 7903, 7906, 7909,
+  7913, 7916, 7919, 7922, 7925, 7928, 0, 7931, 7934, 7937, 7940, 7943,
+  0, 7946, 0, 7949, 7952, 0, 7955, 0, 0, 7958, 7961, 0,
+  0, 7964, 7967, 0, 0, 7970, 0, 0, 0, 7973, 7976, 7979,
+  7982, 7985, 7988, 0, 7991, 7996, 7999, 8002, 8005, 0, 8008, 8011,
+  8014, 0, 8017, 8020, 0, 0, 0, 8023, 0, 0, 8026, 8029,
+  8032, 0, 8035, 8038, 8041, 0, 0, 0, 8044, 8047, 8050, 8053,
+  0, 0, 8056, 8059, 0, 0, 0, 0, 0, 0, 0, 0,
+  8062, 8065, 8068, 8071, 8074, 8077, 8080, 8083, 8086, 8089, 8092, 8095,
+  0, 8098, 8101, 8104, 0, 0, 8107, 8110, 0, 8113, 0, 0,
+  8116, 8119, 0, 8122, 8125, 8128, 8131, 8134, 8137, 8140, 8143, 8146,
+  8149, 0, 0, 0, 8152, 0, 8155, 8158, 8161, 0, 8164, 8167,
+  8170, 8173, 8176, 0, 0, 8179, 8182, 8185, 8188, 8191, 8194, 8197,
+  8200, 8203, 8209, 8212, 8215, 8218, 8221, 8224, 0, 0, 0, 0,
+  8227, 8230, 0, 8233, 0, 0, 8236, 8239, 0, 0, 8242, 8245,
+  0, 8248, 0, 8251, 8254, 0, 8257, 0, 0, 8260, 0, 8263,
+  8266, 8269, 0, 8272, 8275, 8278, 8281, 8284, 0, 8287, 0, 8290,
+  8293, 8297, 8300, 8305, 0, 8308, 8311, 0, 8314, 8317, 8320, 0,
+  8323, 0, 0, 8326, 8329, 0, 8332, 8335, 8339, 8342, 8345, 0,
+  8348, 0, 8351, 0, 0, 8354, 0, 0, 8357, 8360, 8363, 0,
+  8366, 0, 8369, 0, 8372, 8375, 8378, 8381, 0, 8384, 0, 8387,
+  0, 0, 8390, 8393, 8396, 8399, 8402, 8405, 8408, 0, 8412, 8415,
+  8418, 0, 0, 8421, 8424, 8427, 8431, 8434, 8438, 8441, 8444, 8447,
+  8450, 8453, 0, 0, 8456, 8459, 0, 8462, 0, 0, 8465, 8469,
+  8472, 0, 8475, 8479, 8482, 8485, 0, 8490, 8493, 8496, 8499, 8502,
+  8505, 8508, 0, 8511, 8514, 8517, 0, 8520, 0, 8523, 8526, 8529,
+  0, 8532, 8535, 8538, 0, 8541, 0, 8544, 0, 0, 8547, 8550,
+  8553, 0, 0, 8556, 8559, 0, 8562, 0, 8566, 8569, 8572, 8575,
+  0, 8579, 8582, 8585, 8588, 8591, 0, 8594, 8598, 8601, 8604, 8607,
+  0, 8610, 8613, 8616, 8619, 8622, 0, 8625, 8628, 0, 0, 8631,
+  8634, 0, 8637, 0, 0, 8640, 8643, 0, 0, 8646, 0, 8651,
+  0, 8654, 8657, 8660, 8663, 8666, 8669, 0, 8672, 8675, 8678, 0,
+  0, 0, 8681, 0, 0, 0, 8684, 8687, 8690, 8693, 8696, 8699,
+  0, 0, 0, 8702, 8705, 0, 8708, 0, 8711, 8714, 0, 0,
+  8717, 0, 0, 0, 8720, 8723, 8726, 8729, 0, 8732, 8735, 0,
+  0, 8738, 0, 0, 0, 8741, 8744, 8747, 8750, 0, 8753, 8756,
+  8759, 8762, 8765, 0, 8770, 8773, 0, 8776, 8779, 8782, 8785, 8791,
+  0, 8794, 8797, 8800, 0, 8803, 8806, 0, 8809, 0, 8812, 0,
+  0, 8815, 0, 8818, 0, 8821, 8824, 8827, 8832, 8835, 8838, 8841,
+  0, 8844, 0, 8847, 0, 8850, 8853, 0, 8856, 8859, 8862, 8865,
+  8868, 0, 8871, 8874, 8877, 0, 8880, 8883, 0, 0, 8886, 0,
+  8889, 8892, 8895, 8898, 8901, 8904, 0, 8907, 8910, 8913, 0, 8916,
+  8919, 0, 8922, 0, 8925, 0, 8928, 8931, 8934, 0, 8937, 8940,
+  0, 0, 0, 0, 8943, 8946, 8949, 8952, 8955, 8958, 0, 8961,
+  8965, 8968, 8971, 8974, 8977, 8980, 8983, 8986, 8989, 0, 8992, 8995,
+  8998, 9001, 9004, 0, 0, 9007, 9010, 9013, 9016, 0, 9019, 9022,
+  0, 9025, 9028, 9031, 9034, 9037, 9040, 0, 0, 0, 9043, 0,
+  9046, 9049, 9052, 0, 9055, 0, 9058, 0, 9061, 9064, 9067, 0,
+  0, 0, 0, 0, 9070, 0, 9073, 9076, 9079, 9082, 0, 0,
+  0, 9085, 9088, 9091, 9094, 0, 9097, 9100, 0, 0, 9103, 0,
+  9106, 0, 0, 0, 9109, 9112, 9115, 9118, 9121, 0, 0, 9124,
+  9127, 9130, 9133, 9136, 9139, 0, 9142, 9145, 9148, 9151, 0, 0,
+  0, 9154, 9157, 9160, 9163, 9166, 9169, 9172, 9175, 0, 9178, 0,
+  9181, 9184, 9187, 9190, 9193, 9196, 9199, 0, 0, 0, 9202, 9205,
+  9209, 9212, 0, 9215, 9218, 0, 9221, 9224, 0, 9227, 9230, 9233,
+  0, 9236, 0, 0, 9239, 9242, 9245, 0, 0, 9248, 0, 0,
+  0, 0, 0, 0, 9251, 9254, 9257, 0, 9260, 0, 9263, 9266,
+  0, 9269, 9274, 9277, 9280, 9283, 9286, 9291, 9294, 0, 9297, 9300,
+  9303, 9306, 9309, 9312, 9315, 9318, 9321, 9324, 0, 9327, 9330, 9333,
+  0, 9336, 0, 9339, 9342, 9345, 9348, 9351, 9354, 0, 0, 0,
+  9357, 9360, 9363, 9366, 9369, 0, 0, 9372, 9375, 9378, 9381, 9384,
+  0, 0, 9387, 9390, 9393, 0, 9396, 9399, 9402, 9405, 9408, 0,
+  0, 0, 9411, 9414, 9417, 9420, 9423, 9426, 0, 0, 9429, 0,
+  9432, 0, 9435, 9438, 9441, 9444, 9447, 9450, 9453, 0, 9456, 9459,
+  9462, 9465, 0, 9468, 9471, 9474, 0, 0, 9477, 0, 0, 0,
+  0, 0, 9480, 0, 0, 0, 0, 9483, 0, 0, 0, 9486,
+  0, 9489, 0, 0, 0, 9492, 0, 0, 0, 0, 0, 9495,
+  0, 9498, 9501, 9504, 0, 0, 0, 0, 0, 0, 0, 9507,
+  0, 0, 0, 9510, 0, 9513, 0, 9516, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 9519, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9522,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 9525, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 9528, 0, 0, 0, 0, 0, 0,
+  0, 9531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9534,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9537, 0,
+  0, 0, 0, 0, 9540, 0, 0, 0, 0, 0, 0, 0,
+  9543, 0, 0, 9546, 0, 0, 0, 0, 9549, 9552, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 9555, 0, 0, 0, 0, 9558, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 9561, 9564, 0, 0, 9567, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 9570, 9573, 0, 9576, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 9579, 0, 0, 0, 0, 0, 0, 9582, 0,
+  0, 0, 0, 9585, 0, 0, 0, 9588, 0, 9591, 0, 9594,
+  0, 0, 9597, 9600, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 9603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9606,
+  0, 0, 0, 0, 0, 0, 9609, 9612, 0, 0, 9615, 0,
+  9618, 0, 9621, 9624, 0, 0, 9627, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9630, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 9633, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 9636, 0, 0, 0, 0,
+  0, 0, 0, 0, 9639, 9642, 0, 9645, 0, 9648, 9651, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 9654, 0, 0, 0, 9657, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 9660, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 9663, 0, 0, 0, 0, 0, 9666,
+  0, 0, 0, 0, 0, 9669, 0, 0, 0, 0, 9672, 0,
+  0, 0, 9675, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 9678, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 9681, 0, 0, 0, 0, 0, 0, 9684, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 9687, 0, 0, 9690,
+  0, 0, 9693, 9696, 9699, 9702, 9705, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 9708, 0, 9711, 0, 9714, 9717, 9720, 9723, 9726, 9729, 9732,
+  9735, 9738, 9741, 9744, 9747, 9750, 9753, 9756, 9759, 9762, 9765, 9768,
+  0, 9771, 9774, 9777, 9780, 9783, 9787, 9790, 0, 9793, 9797, 9800,
+  9803, 9806, 9809, 9812, 9815, 9818, 9821, 9824, 9827, 9830, 9833, 0,
+  9836, 9839, 9842, 9845, 9848, 9851, 9854, 9857, 9860, 9863, 9866, 9869,
+  9872, 9875, 9878, 9881, 0, 9884, 9887, 9890, 9893, 9896, 9899, 9902,
+  9905, 0, 0, 9908, 0, 9911, 0, 0, 9914, 9917, 9920, 9923,
+  9926, 9929, 0, 9932, 9935, 9938, 9941, 9944, 9947, 9950, 9953, 9956,
+  9959, 9962, 9965, 9968, 9971, 9974, 9977, 0, 9980, 0, 9983, 9986,
+  9989, 9992, 9995, 9998, 10001, 10004, 10007, 10010, 10013, 0, 0, 10016,
+  10019, 10022, 10025, 10028, 10031, 10034, 10037, 10040, 10044, 10047, 10050, 10055,
+  10061, 10064, 10067, 10070, 10073, 10076, 10079, 10082, 0, 10085, 10088, 10091,
+  10094, 10097, 10100, 10103, 10106, 0, 10109, 10112, 10115, 10118, 10121, 10124,
+  0, 0, 10127, 10130, 0, 10133, 10136, 10139, 10142, 0, 10145, 10148,
+  10151, 10154, 10157, 10160, 0, 10163, 0, 10166, 10169, 10172, 10175, 10178,
+  10181, 10184, 0, 10187, 10190, 10193, 10196, 10199, 10202, 10205, 0, 10208,
+  10211, 10214, 10218, 10221, 10224, 10227, 10230, 10233, 10236, 10239, 10242, 0,
+  10245, 10248, 10252, 10255, 10258, 10261, 10265, 10268, 10271, 10274, 10277, 10280,
+  10283, 10286, 10290, 10293, 0, 10296, 10299, 0, 0, 10302, 10305, 10308,
+  10311, 0, 10314, 10317, 10320, 10323, 10326, 10329, 10332, 10335, 0, 10338,
+  0, 10341, 10344, 10347, 10350, 10353, 10356, 10359, 10362, 10365, 10368, 10371,
+  10374, 10377, 10380, 10383, 10386, 10389, 10392, 10395, 10398, 0, 0, 10401,
+  10404, 10407, 10410, 10413, 0, 10416, 10419, 10422, 10425, 10428, 10431, 10434,
+  10437, 10440, 10444, 10447, 0, 0, 0, 10450, 10453, 10456, 10459, 0,
+  10462, 0, 10465, 10468, 10471, 10474, 10478, 0, 10481, 10485, 10488, 10491,
+  10494, 10497, 0, 10500, 10503, 10507, 10510, 10513, 0, 10516, 10519, 10522,
+  0, 10525, 10528, 10531, 10534, 10537, 10540, 10543, 0, 0, 10546, 10549,
+  10552, 10555, 0, 10558, 10561, 10564, 10567, 10570, 10575, 10578, 10581, 10587,
+  0, 10590, 10593, 10596, 10599, 10602, 10605, 10608, 0, 10611, 10614, 10617,
+  10620, 10623, 10626, 10629, 10632, 10635, 10638, 10641, 10644, 10647, 10650, 10653,
+  0, 10656, 10659, 10662, 0, 0, 10665, 0, 0, 0, 10668, 10671,
+  10674, 10677, 0, 10680, 10683, 10688, 10691, 10694, 10697, 10700, 0, 10703,
+  10706, 10709, 10712, 10715, 0, 10718, 10721, 10724, 10727, 10730, 10733, 10736,
+  10739, 10742, 10745, 10748, 10751, 10754, 10757, 10760, 10763, 10766, 10769, 10772,
+  10775, 10778, 10781, 10785, 0, 10788, 10791, 10794, 10797, 10800, 10803, 0,
+  10806, 10809, 10812, 10815, 10818, 10821, 10824, 10827, 10830, 10833, 10836, 10839,
+  10842, 10845, 10848, 10851, 10854, 10857, 10860, 10863, 10866, 10869, 10872, 10875,
+  10878, 10881, 10884, 10887, 10890, 10893, 0, 0, 10896, 10899, 10902, 10905,
+  10908, 0, 10911, 10914, 10918, 10921, 10924, 10927, 10930, 0, 0, 10933,
+  10936, 0, 10939, 10942, 10945, 10948, 10951, 10954, 10957, 10960, 10963, 10966,
+  0, 10969, 10972, 10975, 10978, 10981, 10984, 10987, 10990, 10993, 0, 10996,
+  10999, 11002, 11005, 0, 11008, 0, 11011, 11014, 11017, 11020, 11023, 11026,
+  11029, 11032, 11035, 11039, 11042, 11045, 11048, 11051, 11054, 11057, 11060, 11063,
+  11066, 11069, 11072, 11075, 11078, 11081, 11084, 11087, 11090, 0, 11093, 11096,
+  11099, 11102, 11105, 11108, 0, 0, 11111, 11114, 0, 0, 0, 11117,
+  0, 11120, 0, 0, 11123, 11126, 11129, 11134, 11137, 11140, 11143, 11146,
+  11149, 11152, 11155, 0, 11158, 0, 11161, 11164, 11167, 11170, 11173, 0,
+  11176, 11179, 11182, 11185, 11188, 11192, 11195, 11198, 11201, 11204, 11207, 0,
+  11210, 11214, 11217, 11220, 11224, 0, 11227, 11230, 11233, 0, 11236, 11239,
+  11242, 11245, 11248, 0, 11251, 11254, 11257, 11260, 11263, 11266, 11269, 11272,
+  0, 0, 11275, 11278, 11281, 11284, 11287, 11290, 0, 11293, 11296, 11299,
+  0, 0, 11302, 11305, 0, 11308, 11311, 11314, 11317, 11320, 11323, 11327,
+  0, 11330, 11333, 11336, 0, 11339, 11342, 11345, 11348, 0, 11351, 0,
+  11354, 11357, 0, 11360, 11363, 11366, 11369, 11372, 11375, 11378, 11381, 0,
+  11384, 11387, 11390, 11393, 0, 11396, 11400, 11403, 11406, 11409, 11412, 11415,
+  11418, 11421, 11424, 11427, 11430, 0, 11433, 11436, 11439, 11443, 11446, 0,
+  11449, 0, 11452, 0, 11455, 0, 11458, 11461, 11464, 0, 11467, 11470,
+  11473, 11476, 11479, 11482, 11485, 11488, 11491, 11494, 0, 11497, 11500, 11504,
+  0, 11507, 11510, 11513, 11516, 11519, 11522, 0, 11525, 11528, 11531, 11534,
+  11537, 0, 0, 11540, 11543, 11546, 11549, 11552, 11555, 11559, 11562, 0,
+  11565, 11568, 11571, 11574, 11577, 11580, 11583, 11586, 11589, 0, 11592, 11595,
+  11599, 11602, 0, 11605, 0, 11608, 11613, 11616, 0, 11619, 11622, 11625,
+  11628, 0, 11632, 11635, 11638, 11642, 11645, 11648, 11651, 11654, 0, 11657,
+  0, 11660, 11663, 11666, 0, 11669, 11672, 0, 11675, 11678, 11681, 11684,
+  11687, 11690, 0, 11693, 0, 11696, 11699, 11702, 11705, 11708, 11711, 11714,
+  11717, 11720, 0, 11723, 0, 11726, 0, 11729, 0, 0, 11732, 11735,
+  11738, 0, 11741, 11744, 11747, 11750, 11753, 11756, 11759, 11762, 11765, 11768,
+  11771, 11774, 11777, 11780, 11783, 0, 0, 11786, 11789, 0, 11792, 11795,
+  11798, 11801, 11804, 11807, 11810, 0, 11813, 11816, 0, 11819, 11822, 0,
+  11825, 11828, 0, 11831, 11834, 11837, 11840, 0, 0, 11843, 11846, 11849,
+  11852, 11855, 11858, 11861, 11864, 11867, 0, 0, 11870, 11873, 11876, 11879,
+  0, 11882, 0, 11885, 11888, 11891, 11894, 11897, 11900, 0, 11903, 11906,
+  0, 0, 11909, 11912, 11915, 11918, 11921, 11924, 11927, 11930, 0, 11933,
+  11936, 11939, 0, 11942, 11945, 11948, 11951, 11954, 11957, 11960, 0, 11963,
+  11966, 11969, 11972, 0, 11975, 11978, 11981, 0, 11984, 11988, 11991, 0,
+  11994, 11997, 0, 0, 12000, 12003, 12006, 12009, 12012, 12015, 12018, 12021,
+  12024, 0, 12027, 12030, 12033, 12036, 0, 12039, 12042, 12045, 12048, 0,
+  0, 0, 12051, 12054, 12057, 12060, 0, 12063, 12066, 12071, 12074, 0,
+  12077, 0, 0, 12080, 12083, 12086, 12091, 12094, 12097, 12100, 0, 12103,
+  0, 12106, 12109, 12112, 12115, 12118, 12121, 12124, 12127, 12130, 12133, 12136,
+  12139, 12142, 0, 12145, 0, 0, 12150, 12153, 12156, 12159, 12162, 12165,
+  12168, 12171, 12174, 12177, 12180, 0, 12183, 12186, 12190, 12193, 12196, 0,
+  12199, 12202, 12205, 12208, 12211, 12214, 12217, 12220, 12223, 12226, 12229, 12232,
+  12235, 12238, 12241, 12244, 0, 12247, 12250, 12253, 12256, 12259, 12262, 12265,
+  12268, 12271, 12274, 12277, 12282, 12285, 12289, 12296, 0, 12299, 12302, 12305,
+  12308, 12311, 12314, 12317, 12320, 12323, 12326, 12329, 12332, 12335, 12338, 12341,
+  12344, 12347, 12350, 12353, 12356, 12359, 12362, 12365, 12369, 12372, 0, 12375,
+  12378, 12381, 12384, 0, 12387, 12390, 12393, 12396, 0, 12399, 12402, 12405,
+  12408, 0, 12411, 12414, 12417, 12420, 12423, 12426, 12429, 12432, 12435, 0,
+  12438, 12441, 12444, 0, 0, 12447, 12450, 0, 12453, 12456, 12459, 12462,
+  12465, 12468, 12471, 12474, 12477, 12480, 12483, 12486, 12489, 12492, 0, 0,
+  12495, 0, 0, 12498, 12501, 12504, 12507, 12510, 12513, 12516, 12519, 12522,
+  0, 0, 12525, 0, 12528, 12531, 0, 0, 12534, 12537, 12540, 0,
+  0, 12543, 12546, 12549, 12552, 12555, 12558, 0, 0, 12561, 0, 0,
+  12564, 12567, 12570, 12573, 0, 12576, 12579, 12582, 0, 12585, 12588, 12592,
+  12595, 12598, 12601, 12604, 12607, 12610, 12613, 0, 12616, 12619, 12622, 12625,
+  12628, 12631, 12634, 12639, 12642, 12645, 12648, 12651, 12655, 12658, 12661, 0,
+  12664, 12667, 12670, 0, 12673, 12676, 12679, 0, 0, 12682, 12685, 12688,
+  12691, 12694, 0, 12697, 0, 12700, 12703, 0, 0, 12706, 12709, 12712,
+  0, 12715, 12718, 12721, 12724, 12727, 12730, 12733, 12736, 0, 12739, 12742,
+  12745, 12748, 12751, 12754, 12757, 12761, 12764, 12767, 12770, 12774, 12777, 12780,
+  12783, 12786, 0, 12789, 0, 12792, 12795, 12798, 0, 12801, 12804, 0,
+  0, 12807, 12810, 12813, 12816, 12819, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12822, 0,
+  0, 0, 0, 12825, 0, 0, 0, 12828, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 12831, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 12834, 0, 0, 0, 0, 0, 0, 0, 12837,
+  0, 0, 0, 12840, 0, 0, 0, 0, 0, 0, 0, 0,
+  12843, 12846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 12849, 0, 0, 0, 0, 0, 0, 0,
+  0, 12852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 12855, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 12858, 12861, 12864,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12867, 0, 0, 0, 0, 0,
+  12870, 0, 0, 0, 0, 0, 0, 12873, 0, 12876, 0, 0,
+  0, 0, 0, 0, 0, 0, 12879, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12882, 0, 12886, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12889, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 12892, 0, 0, 0,
+  0, 0, 0, 0, 0, 12895, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12898, 0, 0, 0, 0, 0,
+  0, 0, 12901, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 12904, 0, 0,
+  0, 0, 0, 12907, 0, 12910, 0, 0, 0, 0, 0, 12913,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 12916, 0, 0, 0, 12920,
+  12923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 12926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  12929, 0, 0, 12932, 0, 0, 0, 0, 12935, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 12938, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 12941, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 12944, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12947, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 12950, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12953,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 12956, 0, 0, 12959, 0,
+  12962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 12965, 0, 0, 0, 12968, 12971, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12974, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 12977, 12981, 12984, 0, 0, 12987,
+  0, 12990, 0, 0, 12993, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 12996, 0, 0, 0,
+  0, 0, 0, 0, 12999, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13002,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 13005, 13010, 13014, 13017, 13020, 13023, 13026,
+  0, 13029, 13032, 13035, 13038, 13041, 13044, 0, 13047, 13050, 13053, 13056,
+  13059, 13062, 13065, 13068, 13071, 13076, 13079, 0, 13083, 13086, 0, 13089,
+  13092, 13095, 13098, 13101, 13104, 13107, 13110, 13113, 13116, 0, 13119, 13122,
+  0, 13125, 13128, 13131, 13134, 13137, 13140, 13143, 13146, 13149, 13152, 0,
+  13155, 13158, 13161, 13164, 13167, 13170, 13173, 13176, 13179, 13182, 13185, 13188,
+  13191, 13194, 13197, 13200, 13203, 13206, 0, 0, 13209, 13212, 13215, 13218,
+  13221, 13224, 13227, 13230, 13233, 13236, 13239, 0, 0, 13242, 0, 13245,
+  13248, 13251, 13254, 13257, 13260, 13263, 13266, 13269, 13272, 13275, 13278, 0,
+  13281, 13284, 13287, 13290, 13293, 13296, 13299, 13302, 13306, 13309, 0, 13312,
+  13315, 0, 0, 13318, 13321, 13324, 13327, 13330, 13333, 13336, 0, 13339,
+  13342, 13345, 13348, 0, 13351, 0, 13354, 13357, 0, 0, 0, 13360,
+  13367, 13370, 0, 0, 13373, 13376, 13379, 13382, 13385, 13388, 13391, 13394,
+  13397, 13400, 13403, 13406, 0, 13409, 13412, 13415, 13418, 13421, 13424, 13427,
+  13430, 13433, 13436, 13439, 13442, 13445, 13448, 13451, 13454, 13457, 13460, 13463,
+  13466, 0, 13469, 13472, 13475, 13478, 13481, 13484, 13487, 13490, 13493, 0,
+  13496, 13499, 13502, 13505, 13508, 13511, 13514, 13519, 13522, 13525, 13528, 13531,
+  13534, 13537, 13540, 13543, 13546, 13549, 13552, 13555, 13558, 13561, 13564, 13567,
+  0, 13570, 13573, 13576, 13579, 13582, 13585, 13588, 13591, 13594, 13597, 0,
+  13600, 13603, 13606, 13609, 13612, 13615, 13620, 13623, 13626, 13629, 13632, 13635,
+  13638, 13641, 0, 13644, 13647, 13650, 0, 13653, 13656, 13659, 13662, 13665,
+  13668, 13671, 13674, 0, 0, 0, 0, 0, 0, 13677, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 13680, 0, 0, 0, 0, 0,
+  0, 0, 0, 13683, 0, 0, 0, 0, 13686, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13692, 0,
+  0, 0, 0, 0, 13695, 13698, 0, 0, 13701, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 13704, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 13707, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  13710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13715, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  13721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 13724, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13727,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13730, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 13733, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13736, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 13739, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 13742, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 13745, 0, 0, 0, 13748, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 13751, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13754, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 13757, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13760,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13763, 0,
+  0, 0, 0, 0, 13766, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13769, 13772,
+  13775, 13778, 0, 0, 13781, 0, 13785, 13788, 13791, 13794, 13797, 13800,
+  0, 13803, 13806, 13809, 0, 13812, 13815, 13818, 13821, 13824, 13827, 13830,
+  13833, 13836, 13839, 13842, 13845, 13848, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 13851, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 13857, 0, 0, 0, 0, 0, 0, 0, 0,
+  13860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 13866, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 13869, 0, 0, 0, 13875, 0, 0,
+  0, 13878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13884, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 13890, 13896, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13902, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 13908, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13911, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 13917, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13923, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 13929, 0, 0, 0, 0, 0, 0, 13935, 0,
+  13941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 13947, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13953, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 13959, 0, 0, 0, 0,
+  13962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13968, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 13974, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 13980, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13986, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 13992, 0, 0, 0, 0, 0,
+  13995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 14001, 0, 14007, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 14013, 14016, 14019, 14022, 14025, 14028, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 14031, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14038, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14045, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 14052, 0, 0, 0, 0, 0, 0, 14059, 0,
+  14066, 0, 14073, 0, 0, 14080, 0, 0, 0, 0, 14087, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 14094, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14108, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14115, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14122, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14129, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 14136, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14143, 0, 0, 0,
+  0, 0, 0, 0, 14150, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 14157, 0, 0, 14164, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14171, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14178, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14192, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14199, 0, 0, 0, 0, 0, 0,
+  0, 0, 14206, 0, 0, 0, 0, 0, 0, 0, 0, 14213,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14220, 0, 14227, 0, 0, 0, 0, 0, 0, 0, 14234, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14241, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14248,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14255, 0,
+  0, 0, 14262, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14269, 0, 14276, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14283, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14286, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14293, 0, 14300, 0, 0, 0,
+  0, 0, 0, 14307, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14314, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14321, 0, 0, 0, 0, 0, 0, 0, 14328, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 14335, 0, 14342, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 14349, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14356, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14363, 0, 0, 14370, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14377, 14384, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14391,
+  0, 0, 0, 0, 0, 0, 0, 14398, 0, 0, 0, 0,
+  14405, 0, 14412, 0, 0, 14419, 0, 0, 14426, 0, 0, 0,
+  14433, 0, 0, 0, 0, 0, 0, 0, 0, 14440, 0, 0,
+  0, 0, 14447, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14454,
+  0, 14461, 0, 0, 0, 0, 0, 14468, 0, 0, 14476, 0,
+  0, 0, 14484, 14492, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14500, 0, 0, 0, 0, 0, 14508,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 14516, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14524, 0, 14532, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 14540, 14548, 0, 0, 0, 14556, 0, 14564, 0,
+  0, 0, 0, 14572, 0, 14580, 0, 0, 0, 0, 0, 14588,
+  14596, 0, 14604, 0, 14612, 0, 0, 0, 0, 14620, 0, 0,
+  0, 0, 0, 0, 14628, 14636, 0, 14644, 14652, 0, 0, 0,
+  0, 14660, 0, 0, 0, 0, 0, 14668, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14676, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14684, 0, 0, 0, 14692, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14700, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14708, 0, 0, 0, 0, 0,
+  0, 14716, 0, 0, 14724, 0, 0, 14732, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14740,
+  0, 14748, 0, 0, 0, 0, 0, 0, 14756, 0, 0, 0,
+  0, 14764, 0, 0, 0, 0, 14772, 0, 0, 0, 0, 0,
+  14780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14788, 0,
+  0, 0, 0, 0, 0, 0, 0, 14796, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 14804, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14812, 0, 0, 0, 0, 14820, 0, 0, 0, 0, 0, 0,
+  0, 0, 14828, 0, 0, 0, 0, 14836, 0, 0, 0, 0,
+  0, 0, 0, 0, 14844, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14852, 14860, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 14868, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14876, 0, 0, 0,
+  14884, 0, 0, 0, 0, 14892, 0, 14900, 0, 0, 0, 0,
+  14908, 0, 14916, 0, 0, 0, 0, 0, 14924, 0, 0, 14932,
+  0, 0, 0, 0, 0, 0, 0, 14940, 0, 0, 0, 0,
+  14948, 0, 0, 0, 0, 0, 14956, 0, 0, 0, 0, 14964,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14980, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 14988, 0, 0, 0, 0, 0, 0,
+  0, 0, 14996, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15004, 0, 0, 0, 0, 0, 0, 0, 0, 15012,
+  15020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15028, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 15036, 0, 0, 15044, 0,
+  0, 0, 15052, 0, 0, 15060, 0, 0, 0, 0, 0, 0,
+  15068, 0, 0, 0, 15076, 0, 15084, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 15092, 0, 15100, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15108, 0, 0, 0, 0, 0, 0, 0,
+  0, 15116, 0, 0, 0, 0, 0, 0, 15124, 0, 15132, 0,
+  0, 0, 0, 15140, 0, 0, 0, 0, 0, 15148, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15156, 0, 0, 15164,
+  0, 0, 0, 0, 0, 0, 0, 15172, 0, 0, 0, 15180,
+  0, 0, 15188, 0, 0, 15196, 0, 0, 0, 15204, 0, 0,
+  0, 0, 15212, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15220, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 15228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 15236, 0, 0, 0, 0, 0, 0,
+  0, 15244, 0, 0, 0, 0, 0, 15252, 0, 0, 0, 0,
+  0, 15260, 0, 15268, 0, 15276, 0, 0, 15284, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 15292, 0, 0, 0, 15300, 0, 0, 0, 0,
+  0, 0, 0, 0, 15308, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 15316, 0, 0, 0, 0,
+  0, 0, 15324, 0, 0, 0, 15332, 0, 0, 0, 0, 0,
+  15340, 15348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15356, 0, 0, 0,
+  0, 0, 0, 0, 15364, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15372,
+  0, 0, 0, 15380, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 15388, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 15396, 0, 15404, 0, 15412, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15420, 0, 0, 15428, 0, 0, 0, 15436, 0, 15444,
+  15452, 15460, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 15468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15476, 15484, 0, 0, 15492, 0, 0, 0, 15500, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 15509, 15518, 15527, 0, 0, 15536, 0, 0, 0,
+  0, 0, 0, 15545, 0, 0, 0, 0, 0, 0, 0, 0,
+  15554, 0, 0, 0, 0, 0, 15563, 0, 0, 0, 15572, 0,
+  15581, 0, 0, 15590, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 15599, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15608, 15617, 0, 0, 0, 0,
+  0, 0, 15626, 0, 0, 15635, 0, 15644, 15653, 0, 0, 0,
+  0, 0, 15662, 15671, 0, 0, 0, 15680, 0, 15689, 15698, 0,
+  15707, 15716, 0, 0, 15725, 0, 0, 0, 0, 0, 0, 0,
+  0, 15734, 0, 0, 15743, 0, 15752, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 15761, 15770, 0, 0, 15779,
+  0, 15788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 15797, 0, 0, 0, 0, 0, 0, 0, 15806, 0, 0,
+  0, 15815, 0, 0, 0, 0, 0, 0, 0, 15824, 0, 0,
+  0, 0, 0, 0, 15833, 0, 0, 0, 0, 0, 0, 15842,
+  0, 15851, 0, 0, 0, 0, 0, 15860, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 15869, 15878, 15887, 0, 0, 0, 0,
+  0, 0, 0, 0, 15896, 0, 0, 15905, 0, 0, 0, 0,
+  15914, 15923, 0, 0, 0, 0, 0, 0, 0, 15932, 0, 0,
+  15941, 0, 0, 0, 0, 15950, 0, 0, 15959, 0, 0, 15968,
+  15977, 0, 15986, 0, 15995, 0, 16004, 0, 0, 0, 0, 0,
+  16013, 16022, 0, 0, 16031, 16040, 16049, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  16058, 0, 16067, 16076, 0, 16085, 0, 16094, 16103, 0, 16112, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16121, 0, 0, 0,
+  0, 0, 0, 16130, 0, 0, 0, 16139, 0, 0, 16148, 0,
+  0, 0, 16157, 0, 0, 0, 0, 0, 0, 16166, 0, 0,
+  0, 0, 16175, 0, 0, 0, 0, 0, 16184, 0, 16193, 16202,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 16211, 0, 0, 16220, 0, 0, 0, 0, 0,
+  0, 0, 0, 16229, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 16238, 0, 0, 0, 16247, 0, 0, 0,
+  0, 0, 16256, 0, 0, 16265, 0, 16274, 0, 0, 0, 0,
+  0, 0, 0, 16283, 16292, 0, 0, 0, 0, 0, 16301, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16310, 0, 0, 0,
+  0, 0, 16319, 0, 0, 0, 0, 0, 0, 16328, 0, 0,
+  0, 0, 16337, 16346, 0, 0, 0, 16355, 0, 0, 0, 0,
+  0, 16364, 0, 0, 0, 16373, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 16382, 0, 16391,
+  0, 16400, 0, 0, 0, 16409, 16418, 0, 0, 0, 0, 0,
+  16427, 16436, 0, 0, 0, 0, 0, 0, 16445, 16454, 0, 0,
+  16463, 16472, 0, 0, 0, 0, 0, 0, 0, 16481, 16490, 0,
+  16499, 0, 0, 16508, 0, 0, 0, 16517, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16526, 0,
+  0, 0, 16535, 16544, 0, 16553, 0, 0, 0, 0, 0, 16562,
+  0, 0, 0, 0, 0, 0, 16571, 16580, 0, 16589, 16598, 16607,
+  0, 0, 0, 0, 16616, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16625, 0, 0, 16634,
+  0, 0, 0, 0, 0, 0, 0, 16643, 16652, 0, 0, 0,
+  0, 0, 16661, 16670, 0, 16679, 0, 16688, 16697, 0, 16706, 0,
+  16715, 0, 0, 0, 16724, 0, 0, 0, 0, 0, 16733, 0,
+  0, 0, 16742, 0, 0, 0, 16751, 0, 0, 0, 16760, 0,
+  0, 16769, 0, 0, 0, 0, 16778, 0, 0, 0, 16787, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16796, 0, 0, 0,
+  16805, 0, 0, 0, 0, 0, 0, 16814, 0, 0, 0, 0,
+  0, 16823, 0, 0, 16832, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 16841, 0, 0, 0, 0, 0, 0,
+  16850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  16859, 0, 0, 0, 0, 0, 16868, 0, 0, 0, 0, 0,
+  0, 0, 0, 16877, 0, 0, 0, 16886, 16895, 0, 0, 0,
+  0, 16904, 0, 0, 16913, 0, 0, 0, 16922, 16931, 0, 0,
+  0, 0, 0, 16940, 16949, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 16958, 16967, 0, 0, 16976, 0, 0, 0, 0,
+  16985, 0, 0, 0, 0, 16994, 0, 0, 0, 17003, 17012, 0,
+  0, 0, 0, 0, 0, 0, 17021, 0, 0, 0, 0, 0,
+  0, 0, 17030, 0, 17039, 17048, 17057, 0, 0, 0, 0, 17066,
+  17075, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 17084, 0, 0, 0, 0, 17093, 0, 0, 17102, 0, 0,
+  17111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17120, 0,
+  17129, 0, 0, 17138, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 17147, 0, 0, 0, 0, 0, 17156,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 17165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 17174, 0, 0, 0, 0, 0, 0,
+  17183, 17192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  17201, 0, 0, 17210, 0, 0, 0, 0, 17219, 0, 0, 0,
+  0, 0, 17228, 0, 17237, 0, 17246, 0, 0, 0, 0, 0,
+  17256, 0, 0, 17266, 0, 0, 0, 0, 17276, 17286, 0, 0,
+  0, 17296, 0, 0, 0, 17306, 0, 0, 0, 0, 0, 0,
+  17316, 0, 0, 0, 0, 0, 0, 0, 17326, 0, 0, 0,
+  17336, 0, 17346, 0, 0, 0, 17356, 0, 0, 17366, 0, 17376,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 17386, 0, 0,
+  0, 17396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17406,
+  0, 0, 0, 17416, 0, 17426, 17436, 0, 17446, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 17456, 0, 17466, 0, 0, 17476,
+  0, 17486, 0, 17496, 0, 17506, 17516, 0, 17526, 0, 17536, 0,
+  17546, 0, 17556, 0, 0, 0, 0, 17566, 0, 0, 0, 0,
+  0, 17576, 0, 0, 0, 17586, 0, 0, 17596, 0, 0, 0,
+  0, 0, 0, 0, 0, 17606, 0, 0, 0, 0, 0, 0,
+  0, 17616, 0, 0, 17626, 17636, 17646, 0, 0, 17656, 0, 17666,
+  0, 17676, 17686, 0, 0, 0, 17696, 0, 0, 17706, 0, 17716,
+  0, 0, 17726, 17736, 17746, 0, 17756, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 17766, 0, 0, 17776, 0,
+  17786, 0, 0, 0, 0, 0, 0, 0, 0, 17796, 0, 17806,
+  17816, 0, 17826, 0, 17836, 0, 17846, 17856, 0, 17866, 0, 17876,
+  0, 0, 0, 0, 0, 17886, 0, 0, 0, 0, 0, 17896,
+  0, 17906, 0, 0, 17916, 0, 17926, 0, 0, 17936, 0, 17946,
+  17956, 0, 17966, 17976, 0, 17986, 0, 0, 0, 0, 0, 17996,
+  0, 0, 0, 0, 0, 18006, 18016, 18026, 0, 18036, 0, 18046,
+  18056, 0, 18066, 0, 0, 0, 0, 0, 18076, 18086, 18096, 18106,
+  0, 0, 0, 0, 18116, 0, 0, 18126, 0, 0, 18136, 0,
+  18146, 0, 18156, 18166, 0, 0, 18176, 0, 18186, 0, 0, 0,
+  0, 0, 0, 0, 0, 18196, 0, 0, 18206, 18216, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 18226, 0, 0, 0, 0,
+  0, 18236, 18246, 0, 0, 0, 18256, 0, 0, 0, 0, 0,
+  18266, 0, 18276, 18286, 0, 18296, 18306, 18316, 18326, 0, 18336, 18346,
+  0, 18356, 0, 18366, 0, 18376, 18386, 0, 18396, 0, 0, 18406,
+  0, 18416, 0, 18426, 0, 0, 0, 0, 0, 18436, 18446, 0,
+  0, 18456, 18466, 18476, 0, 0, 18486, 0, 18496, 0, 0, 0,
+  18506, 0, 0, 0, 0, 0, 18516, 18526, 18536, 18546, 0, 0,
+  18556, 0, 0, 18566, 0, 0, 0, 18576, 0, 0, 18586, 18596,
+  0, 0, 18606, 0, 18616, 0, 0, 0, 0, 0, 0, 18626,
+  0, 0, 0, 0, 18636, 0, 0, 18646, 0, 18656, 0, 18666,
+  18676, 18686, 18696, 0, 0, 0, 0, 18706, 0, 18716, 0, 0,
+  0, 0, 0, 0, 18726, 0, 0, 18736, 0, 0, 18746, 18756,
+  18766, 18776, 0, 18786, 18796, 0, 18806, 0, 0, 0, 0, 0,
+  0, 0, 0, 18816, 0, 0, 0, 0, 0, 0, 0, 0,
+  18826, 0, 0, 18836, 0, 0, 0, 0, 18846, 0, 0, 0,
+  0, 18856, 0, 18866, 0, 0, 18876, 18886, 0, 0, 0, 18896,
+  0, 0, 18906, 0, 0, 0, 18916, 0, 0, 18926, 18936, 18946,
+  18956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  18966, 18976, 0, 0, 18986, 0, 0, 18996, 0, 0, 0, 0,
+  0, 0, 0, 19006, 0, 0, 0, 0, 19016, 0, 0, 0,
+  19026, 0, 19036, 19046, 19056, 0, 0, 19066, 0, 0, 0, 0,
+  0, 0, 19076, 0, 0, 0, 0, 19086, 0, 0, 0, 19096,
+  0, 0, 0, 19106, 0, 19116, 0, 19126, 0, 0, 19136, 0,
+  0, 0, 0, 0, 0, 0, 0, 19146, 0, 0, 0, 19156,
+  0, 0, 0, 19166, 0, 0, 0, 0, 19176, 0, 19186, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19196,
+  0, 0, 19206, 0, 0, 0, 0, 19216, 0, 0, 0, 19226,
+  0, 0, 19236, 19246, 0, 0, 0, 19256, 19266, 0, 19276, 0,
+  0, 0, 19286, 0, 0, 0, 19296, 0, 0, 0, 0, 0,
+  0, 19306, 0, 0, 19316, 0, 0, 0, 0, 0, 0, 19326,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 19336, 0, 0,
+  0, 19346, 0, 0, 19356, 19366, 0, 0, 0, 19376, 0, 0,
+  0, 0, 0, 19386, 19396, 0, 0, 0, 0, 0, 19406, 0,
+  19416, 19426, 0, 0, 19436, 19446, 0, 0, 0, 0, 0, 0,
+  0, 0, 19456, 0, 0, 19466, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 19476, 0, 0, 19486, 0, 19496, 19506, 0, 0,
+  0, 19516, 0, 19526, 0, 19536, 0, 0, 0, 0, 0, 0,
+  0, 19546, 19556, 0, 0, 19566, 19576, 0, 0, 0, 0, 0,
+  19586, 19596, 0, 0, 0, 19606, 0, 0, 0, 19616, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19626, 0,
+  19636, 0, 19646, 0, 0, 0, 19656, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 19666, 0, 0, 0, 0, 0, 0, 0,
+  19676, 0, 19686, 0, 19696, 19706, 0, 0, 19716, 0, 0, 0,
+  0, 19726, 0, 0, 0, 0, 0, 0, 0, 19736, 0, 0,
+  0, 0, 19746, 0, 0, 19757, 0, 0, 19768, 0, 0, 19779,
+  0, 0, 0, 19790, 0, 0, 0, 19801, 0, 0, 19812, 0,
+  0, 0, 0, 19823, 0, 0, 0, 0, 19834, 19845, 19856, 19867,
+  19878, 19889, 0, 0, 0, 19900, 0, 19911, 19922, 19933, 19944, 0,
+  19955, 0, 19966, 0, 19977, 0, 19988, 0, 0, 0, 19999, 0,
+  20010, 0, 20021, 0, 20032, 0, 0, 0, 0, 0, 0, 20043,
+  0, 20054, 0, 20065, 0, 20076, 20087, 0, 0, 0, 20098, 0,
+  20109, 0, 20120, 20131, 20142, 0, 20153, 0, 20164, 0, 0, 0,
+  20175, 0, 0, 0, 20186, 0, 20197, 20208, 0, 20219, 0, 0,
+  20230, 20241, 0, 0, 20252, 0, 20263, 20274, 0, 0, 0, 20285,
+  0, 0, 20296, 20307, 20318, 0, 0, 0, 0, 20329, 0, 0,
+  20340, 0, 0, 0, 20351, 20362, 0, 0, 20373, 0, 20384, 0,
+  20395, 20406, 0, 20417, 0, 0, 0, 0, 0, 20428, 0, 0,
+  20439, 0, 20450, 0, 20461, 20472, 0, 0, 0, 0, 20483, 0,
+  20494, 0, 20505, 0, 0, 20516, 0, 0, 0, 0, 20527, 0,
+  20538, 0, 0, 0, 20549, 0, 20560, 20571, 20582, 20593, 20604, 0,
+  20615, 0, 20626, 0, 0, 0, 0, 0, 0, 0, 0, 20637,
+  20648, 0, 20659, 0, 0, 0, 0, 20670, 20681, 0, 0, 0,
+  20692, 20703, 0, 20714, 0, 20725, 20736, 0, 0, 0, 20747, 20758,
+  0, 20769, 20780, 0, 0, 0, 20791, 0, 20802, 20813, 20824, 0,
+  0, 20835, 0, 20846, 0, 20857, 20868, 20879, 20890, 20901, 0, 20912,
+  0, 20923, 0, 0, 0, 0, 0, 0, 0, 20934, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 20945, 0, 0,
+  0, 0, 0, 0, 0, 20956, 0, 20967, 0, 0, 20978, 0,
+  0, 0, 20989, 0, 0, 0, 0, 21000, 0, 21011, 21022, 21033,
+  21044, 0, 21055, 0, 21066, 0, 0, 21077, 0, 21088, 0, 21099,
+  21110, 0, 0, 0, 0, 21121, 21132, 0, 0, 21143, 0, 0,
+  21154, 0, 0, 0, 0, 21165, 0, 21176, 0, 21187, 0, 0,
+  0, 21198, 21209, 0, 0, 0, 21220, 0, 0, 21231, 0, 0,
+  0, 0, 21242, 0, 0, 0, 21253, 0, 0, 0, 0, 0,
+  0, 0, 21264, 0, 0, 21275, 0, 0, 21286, 0, 21297, 21308,
+  21319, 0, 0, 0, 21330, 0, 21341, 0, 21352, 0, 0, 0,
+  0, 0, 0, 0, 0, 21363, 0, 0, 0, 0, 0, 21374,
+  0, 21385, 21396, 0, 0, 0, 0, 0, 0, 21407, 21418, 21429,
+  0, 0, 0, 21440, 21451, 21462, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 21473, 0, 0, 21484, 0, 0, 0, 0, 0,
+  21495, 0, 0, 21506, 21517, 0, 0, 0, 0, 21528, 0, 0,
+  21539, 0, 21550, 21561, 0, 0, 0, 0, 21572, 21583, 0, 21594,
+  0, 0, 0, 0, 0, 0, 21605, 0, 21616, 21627, 0, 0,
+  0, 21638, 0, 0, 21649, 21660, 21671, 21682, 0, 21693, 21704, 0,
+  21715, 21726, 21737, 0, 0, 0, 0, 0, 21748, 0, 21759, 0,
+  21770, 21781, 0, 21792, 21803, 0, 0, 21814, 0, 21825, 0, 0,
+  0, 0, 0, 0, 21836, 0, 0, 0, 0, 0, 0, 21847,
+  0, 0, 0, 21858, 21869, 0, 21880, 0, 0, 0, 21891, 0,
+  0, 0, 0, 0, 0, 21902, 21913, 0, 0, 21924, 21935, 0,
+  0, 21946, 0, 21957, 0, 21968, 21979, 21990, 22001, 0, 22012, 22023,
+  0, 0, 0, 22034, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 22045, 0, 22056, 0, 22067, 0, 0, 0, 0, 0,
+  22078, 22089, 0, 22100, 0, 0, 0, 0, 22111, 22122, 0, 22133,
+  22144, 22155, 0, 22166, 0, 0, 0, 22177, 0, 22188, 22199, 0,
+  0, 22210, 0, 22221, 22232, 0, 0, 22243, 22254, 0, 0, 22265,
+  22276, 22287, 22298, 0, 0, 0, 22309, 0, 0, 0, 0, 22320,
+  0, 0, 0, 0, 22331, 22342, 22353, 0, 0, 0, 0, 0,
+  22364, 22375, 0, 0, 22386, 22397, 0, 0, 0, 22408, 0, 22419,
+  0, 0, 0, 0, 22430, 0, 0, 22441, 0, 22452, 0, 22463,
+  22474, 0, 22485, 0, 22496, 0, 0, 0, 22507, 22518, 22529, 0,
+  0, 22540, 22551, 22562, 22573, 0, 0, 22584, 0, 22595, 22606, 0,
+  22617, 22628, 22639, 22650, 22661, 0, 22672, 0, 0, 22683, 22694, 0,
+  22705, 22716, 22727, 0, 0, 22738, 22750, 0, 0, 22762, 22774, 0,
+  0, 0, 22786, 22798, 0, 0, 22810, 0, 0, 22822, 0, 0,
+  22834, 22846, 0, 22858, 0, 22870, 0, 22882, 22894, 0, 22906, 22918,
+  0, 0, 0, 22930, 0, 0, 0, 0, 0, 0, 22942, 0,
+  0, 22954, 0, 0, 22966, 0, 0, 0, 0, 22978, 22990, 23002,
+  0, 0, 23014, 0, 0, 23026, 0, 0, 23038, 0, 0, 0,
+  0, 23050, 0, 23062, 0, 0, 0, 23074, 0, 23086, 23098, 23110,
+  0, 0, 23122, 23134, 0, 23146, 0, 0, 0, 0, 0, 23158,
+  0, 0, 0, 23170, 0, 23182, 0, 23194, 23206, 23218, 0, 23230,
+  0, 23242, 0, 23254, 23266, 0, 0, 0, 23278, 0, 0, 23290,
+  23302, 0, 23314, 0, 23326, 0, 23338, 0, 23350, 0, 0, 23362,
+  0, 23374, 0, 23386, 0, 0, 23398, 0, 23410, 23422, 0, 0,
+  23434, 0, 23446, 23458, 23470, 23482, 23494, 0, 23506, 23518, 0, 0,
+  23530, 0, 23542, 23554, 0, 0, 23566, 0, 0, 23578, 0, 0,
+  0, 23590, 0, 23602, 23614, 23626, 23638, 0, 0, 0, 23650, 0,
+  0, 0, 0, 23662, 0, 0, 0, 0, 23674, 23686, 0, 0,
+  23698, 0, 0, 0, 0, 0, 23710, 23722, 23734, 23746, 0, 23758,
+  23770, 23782, 0, 0, 0, 0, 23794, 23806, 23818, 0, 0, 23830,
+  0, 0, 0, 23842, 0, 23854, 0, 0, 0, 0, 23866, 23878,
+  0, 0, 0, 0, 0, 0, 23890, 0, 0, 0, 0, 0,
+  23902, 0, 0, 0, 0, 23914, 0, 23926, 0, 0, 23938, 0,
+  0, 23950, 0, 0, 23962, 23974, 23986, 23998, 0, 0, 24010, 24022,
+  0, 0, 0, 0, 24034, 0, 0, 0, 0, 0, 0, 24046,
+  0, 24058, 24070, 24082, 0, 24094, 0, 24106, 0, 0, 0, 0,
+  0, 0, 0, 24118, 24130, 0, 0, 0, 24142, 0, 24154, 0,
+  0, 0, 0, 0, 24166, 0, 24178, 24190, 0, 24202, 24214, 24226,
+  0, 0, 24238, 0, 24250, 24262, 24274, 24286, 24298, 0, 24310, 0,
+  0, 0, 0, 0, 24322, 0, 0, 24334, 24346, 24358, 24370, 0,
+  0, 0, 0, 0, 0, 0, 24382, 24394, 24406, 24418, 0, 0,
+  24430, 0, 0, 0, 0, 24442, 0, 0, 0, 0, 0, 0,
+  24454, 24466, 24478, 24490, 0, 0, 24502, 0, 24514, 24526, 24538, 0,
+  0, 0, 24550, 24562, 24574, 24586, 24598, 0, 24610, 24622, 24634, 0,
+  0, 0, 0, 0, 0, 0, 24646, 0, 24658, 24670, 24682, 0,
+  24694, 0, 24706, 0, 0, 24718, 0, 0, 0, 24730, 24742, 24754,
+  0, 24766, 0, 24778, 24790, 24802, 0, 24814, 24826, 0, 0, 24838,
+  24850, 0, 0, 24862, 24874, 0, 0, 24886, 0, 0, 24898, 0,
+  24910, 24922, 24934, 24946, 24958, 0, 24970, 0, 24982, 0, 24994, 0,
+  0, 0, 25006, 0, 0, 0, 25018, 0, 0, 0, 25030, 0,
+  25042, 25054, 0, 25066, 0, 0, 0, 0, 25078, 0, 0, 25090,
+  0, 0, 25102, 25114, 0, 25126, 25138, 25150, 25162, 0, 0, 0,
+  25174, 0, 25187, 25200, 0, 0, 25213, 0, 0, 0, 0, 25226,
+  25239, 0, 25252, 25265, 0, 25278, 25291, 0, 0, 0, 0, 25304,
+  0, 0, 25317, 25330, 0, 0, 0, 0, 0, 25343, 25356, 25369,
+  25382, 0, 25395, 0, 0, 0, 25408, 0, 0, 25421, 0, 25434,
+  0, 0, 0, 0, 0, 0, 25447, 25460, 25473, 0, 25486, 25499,
+  25512, 0, 25525, 0, 25538, 0, 25551, 0, 25564, 0, 25577, 25590,
+  0, 25603, 25616, 0, 25629, 0, 0, 0, 0, 0, 25642, 25655,
+  0, 25668, 0, 25681, 0, 0, 25694, 25707, 25720, 25733, 0, 25746,
+  25759, 0, 0, 25772, 25785, 0, 25798, 25811, 0, 25824, 0, 25837,
+  0, 25850, 25863, 0, 25876, 0, 25889, 25902, 0, 0, 0, 0,
+  0, 25915, 0, 25928, 25941, 25954, 0, 25967, 25980, 25993, 0, 26006,
+  26019, 26032, 0, 0, 0, 26045, 0, 26058, 0, 26071, 0, 0,
+  0, 0, 26084, 0, 26097, 0, 26110, 0, 0, 0, 26123, 26136,
+  26149, 26162, 0, 0, 26175, 0, 26188, 26201, 0, 0, 26214, 0,
+  26227, 0, 26240, 0, 0, 26253, 0, 0, 0, 26266, 26279, 26292,
+  0, 0, 26305, 0, 0, 0, 0, 0, 0, 0, 26318, 0,
+  0, 26331, 0, 26344, 0, 26357, 0, 26370, 0, 0, 0, 26383,
+  0, 26396, 26409, 0, 0, 26422, 0, 0, 0, 0, 0, 26435,
+  26448, 0, 26461, 0, 26474, 0, 0, 26487, 0, 0, 0, 26500,
+  0, 26513, 0, 0, 0, 0, 26526, 0, 0, 26539, 0, 26552,
+  26565, 26578, 0, 0, 0, 0, 0, 0, 26591, 26604, 0, 0,
+  0, 0, 0, 26617, 0, 0, 26630, 26643, 0, 26656, 26669, 0,
+  0, 0, 0, 26682, 26695, 26708, 26721, 26734, 0, 0, 0, 0,
+  0, 26747, 0, 26760, 26773, 0, 26786, 0, 0, 26799, 0, 0,
+  26812, 0, 26825, 0, 0, 26838, 26852, 26866, 26880, 26894, 0, 26908,
+  0, 0, 0, 0, 26922, 0, 0, 26936, 0, 0, 26950, 0,
+  0, 0, 0, 0, 0, 0, 26964, 0, 0, 0, 26978, 26992,
+  27006, 27020, 0, 27034, 27048, 0, 27062, 27076, 27090, 0, 27104, 0,
+  27118, 0, 27132, 27146, 0, 0, 0, 0, 0, 27160, 27174, 27188,
+  27202, 0, 0, 27216, 0, 27230, 0, 0, 27244, 0, 0, 27258,
+  0, 27272, 0, 0, 27286, 27300, 27314, 0, 27328, 27342, 27356, 0,
+  27370, 27384, 0, 27398, 0, 0, 0, 27412, 0, 27426, 0, 0,
+  27440, 0, 27454, 27468, 27482, 27496, 27510, 27524, 0, 27538, 0, 0,
+  0, 0, 27552, 27566, 0, 0, 0, 0, 27580, 0, 0, 0,
+  27594, 27608, 0, 27622, 0, 0, 27636, 27650, 27664, 0, 27678, 0,
+  27692, 27706, 0, 0, 27720, 0, 27734, 0, 0, 27748, 0, 0,
+  27762, 0, 27776, 0, 27790, 27804, 0, 27818, 27832, 27846, 0, 27860,
+  0, 0, 27874, 27888, 0, 0, 0, 0, 0, 27902, 27916, 27930,
+  27944, 0, 0, 27958, 0, 0, 27972, 0, 27986, 0, 28000, 0,
+  28014, 28028, 28042, 0, 0, 0, 28056, 0, 0, 0, 28070, 0,
+  0, 28085, 0, 0, 28100, 28115, 28130, 0, 0, 0, 28145, 28160,
+  0, 0, 28175, 28190, 0, 28205, 28220, 0, 28235, 0, 0, 0,
+  0, 0, 0, 0, 0, 28250, 0, 28265, 28280, 0, 0, 0,
+  28295, 0, 28310, 28325, 28340, 28355, 0, 28370, 28385, 0, 28400, 28415,
+  0, 0, 0, 28430, 0, 0, 0, 0, 0, 0, 0, 0,
+  28445, 28460, 0, 28475, 28490, 0, 28505, 28520, 0, 0, 0, 0,
+  0, 28535, 28550, 0, 0, 28565, 28580, 28595, 0, 0, 0, 28610,
+  28625, 0, 28640, 0, 0, 0, 28655, 28670, 28685, 0, 0, 0,
+  28700, 28716, 28732, 0, 28748, 28764, 28780, 0, 0, 0, 28796, 0,
+  28812, 28828, 0, 0, 28844, 28860, 28876, 0, 0, 28892, 0, 0,
+  28908, 0, 28924, 0, 28940, 28956, 0, 28972, 28988, 29004, 0, 0,
+  0, 0, 29020, 29036, 0, 0, 0, 29052, 29068, 29084, 29100, 0,
+  29116, 0, 29132, 29148, 29164, 0, 29180, 0, 0, 0, 0, 0,
+  0, 29196, 0, 29213, 29230, 0, 0, 0, 0, 0, 29247, 0,
+  29264, 29281, 0, 0, 0, 0, 0, 0, 0, 29298, 29315, 0,
+  29332, 0, 0, 29349, 0, 29366, 29383, 29401, 29419, 0, 0, 0,
+  29437, 29455, 29473, 0, 29491, 29509, 0, 0, 29527, 0, 0, 29545,
+  0, 0, 29563, 0, 29582, 0, 29601, 29620, 0, 29639, 0, 0,
+  29658, 29678, 29698, 0, 0, 0, 0, 0, 29718, 0, 0, 0,
+  0, 29741
+};
+
+// per pattern: first position, count, then the values; odd values allow
+// a break
+extern const uint8_t hyphenValues[29768] = {
+  0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 1, 1, 1, 1, 1, 2, 0, 1, 4, 0, 2, 2, 2, 0,
+  2, 2, 1, 0, 2, 4, 1, 0, 1, 2, 0, 2, 4, 3, 1, 1, 1, 2, 1, 4, 1, 2, 2, 2,
+  0, 2, 4, 1, 0, 2, 4, 3, 0, 1, 4, 0, 3, 2, 5, 2, 0, 1, 2, 1, 1, 1, 0, 2,
+  4, 5, 0, 1, 1, 1, 1, 3, 0, 1, 2, 0, 1, 1, 2, 1, 1, 0, 3, 1, 4, 4, 1, 1,
+  5, 0, 1, 1, 1, 1, 1, 0, 3, 4, 3, 2, 0, 2, 2, 1, 0, 1, 1, 0, 2, 1, 2, 1,
+  1, 1, 1, 1, 5, 1, 2, 1, 4, 0, 2, 4, 1, 1, 2, 1, 2, 1, 1, 1, 1, 2, 5, 2,
+  1, 1, 1, 0, 3, 4, 1, 4, 0, 1, 1, 1, 1, 1, 0, 1, 1, 0, 3, 2, 1, 2, 0, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 2, 2, 1, 1, 1, 1, 1, 2, 1, 4, 2, 1, 2,
+  1, 1, 1, 1, 1, 1, 0, 1, 4, 0, 1, 1, 0, 2, 4, 5, 0, 1, 4, 0, 2, 4, 1, 0,
+  1, 4, 0, 1, 1, 1, 2, 4, 2, 0, 1, 4, 0, 1, 4, 0, 1, 1, 0, 2, 4, 5, 0, 2,
+  2, 3, 0, 1, 2, 0, 1, 3, 0, 1, 1, 0, 1, 1, 1, 1, 3, 2, 1, 4, 0, 3, 4, 1,
+  2, 2, 1, 2, 1, 1, 1, 0, 1, 1, 1, 1, 3, 0, 1, 1, 2, 1, 2, 1, 1, 3, 0, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 4, 0, 3, 4, 1, 4, 0, 2, 4, 1, 0, 2,
+  2, 1, 0, 2, 4, 5, 0, 3, 4, 0, 4, 0, 3, 4, 1, 2, 1, 1, 1, 0, 2, 2, 1, 0,
+  1, 2, 0, 3, 2, 0, 4, 0, 1, 2, 1, 1, 3, 0, 3, 4, 5, 4, 1, 1, 3, 0, 1, 4,
+  0, 1, 2, 0, 1, 2, 0, 1, 4, 1, 1, 1, 0, 1, 2, 0, 2, 4, 5, 0, 1, 4, 0, 1,
+  5, 0, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1, 4, 1, 1, 1, 2, 1, 4, 1, 1, 1, 1, 1,
+  1, 0, 3, 4, 1, 2, 1, 1, 5, 1, 1, 1, 0, 2, 2, 1, 0, 3, 4, 1, 2, 0, 1, 2,
+  0, 1, 2, 0, 3, 4, 1, 4, 0, 2, 2, 3, 0, 1, 4, 1, 1, 1, 0, 1, 2, 0, 3, 2,
+  1, 2, 0, 1, 2, 0, 2, 4, 1, 0, 3, 2, 1, 2, 0, 1, 4, 0, 2, 2, 1, 0, 1, 1,
+  0, 1, 1, 0, 2, 4, 1, 0, 2, 4, 5, 0, 2, 4, 1, 0, 1, 2, 0, 1, 4, 0, 2, 4,
+  1, 1, 1, 1, 0, 2, 4, 1, 0, 1, 1, 0, 2, 4, 1, 0, 2, 4, 3, 0, 3, 4, 1, 2,
+  0, 1, 4, 0, 1, 1, 0, 1, 4, 0, 1, 1, 0, 3, 4, 1, 4, 1, 1, 3, 0, 3, 4, 1,
+  4, 1, 1, 1, 0, 3, 4, 0, 2, 0, 2, 4, 1, 1, 1, 5, 0, 3, 4, 1, 2, 1, 2, 1,
+  4, 1, 1, 1, 1, 1, 1, 0, 3, 2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 4, 0,
+  1, 4, 0, 1, 4, 1, 2, 1, 2, 2, 1, 2, 1, 1, 5, 0, 1, 2, 1, 1, 2, 2, 1, 2,
+  1, 1, 1, 2, 1, 2, 0, 1, 1, 0, 2, 4, 1, 2, 1, 4, 0, 1, 4, 0, 1, 4, 0, 3,
+  2, 3, 2, 0, 3, 1, 2, 2, 0, 2, 4, 1, 0, 2, 2, 3, 0, 2, 4, 1, 2, 1, 2, 0,
+  3, 2, 1, 2, 0, 2, 2, 1, 1, 1, 3, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+  1, 2, 2, 1, 4, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 4, 0, 3, 4,
+  0, 2, 1, 1, 1, 2, 1, 2, 0, 2, 4, 5, 0, 2, 4, 5, 0, 2, 4, 3, 0, 2, 2, 3,
+  1, 1, 2, 2, 1, 2, 1, 2, 1, 2, 0, 2, 2, 1, 1, 2, 1, 4, 0, 1, 1, 1, 1, 1,
+  0, 1, 2, 0, 1, 1, 0, 1, 4, 2, 1, 2, 1, 1, 4, 0, 1, 1, 0, 2, 2, 1, 0, 1,
+  4, 0, 2, 4, 1, 0, 2, 2, 1, 0, 2, 4, 1, 0, 1, 2, 0, 2, 4, 1, 0, 3, 2, 1,
+  2, 0, 1, 1, 0, 2, 4, 1, 0, 3, 4, 1, 2, 0, 3, 4, 3, 2, 0, 1, 1, 0, 1, 4,
+  2, 1, 4, 0, 1, 1, 0, 1, 4, 0, 3, 2, 0, 2, 1, 1, 5, 0, 1, 4, 0, 1, 2, 1,
+  1, 3, 1, 2, 1, 2, 0, 1, 1, 0, 3, 4, 0, 4, 1, 1, 4, 1, 1, 1, 2, 1, 2, 1,
+  1, 4, 0, 3, 1, 0, 2, 1, 1, 5, 0, 1, 4, 2, 1, 4, 1, 1, 1, 1, 2, 3, 2, 1,
+  1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 3, 1, 1, 3, 1, 2, 1, 2, 1, 1, 1, 2, 1, 4,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2, 4, 3, 1, 1, 1, 1, 2, 1, 4, 1, 1, 1, 2,
+  1, 1, 0, 1, 4, 0, 1, 2, 0, 2, 2, 1, 0, 1, 5, 0, 1, 4, 0, 1, 1, 0, 3, 4,
+  1, 2, 3, 1, 2, 0, 1, 4, 0, 1, 4, 0, 2, 4, 2, 0, 1, 2, 0, 1, 4, 2, 1, 4,
+  3, 1, 4, 2, 1, 1, 0, 3, 4, 0, 4, 2, 1, 1, 1, 1, 2, 1, 1, 4, 1, 1, 3, 1,
+  1, 3, 2, 1, 4, 1, 1, 3, 1, 1, 5, 1, 2, 4, 4, 0, 1, 2, 2, 1, 1, 0, 1, 4,
+  0, 1, 4, 1, 1, 2, 0, 1, 4, 0, 1, 2, 3, 1, 4, 1, 1, 2, 1, 1, 3, 2, 1, 1,
+  2, 1, 2, 2, 1, 3, 2, 1, 4, 0, 1, 4, 1, 1, 2, 0, 1, 4, 1, 1, 1, 1, 1, 2,
+  1, 1, 2, 2, 1, 4, 2, 2, 4, 2, 2, 1, 3, 1, 1, 2, 2, 1, 1, 2, 1, 3, 3, 1,
+  4, 3, 1, 4, 3, 1, 4, 0, 1, 1, 2, 1, 4, 0, 1, 5, 1, 1, 2, 0, 3, 4, 0, 2,
+  0, 1, 1, 0, 3, 4, 0, 5, 0, 4, 4, 0, 0, 4, 0, 1, 3, 2, 1, 3, 0, 1, 4, 2,
+  1, 2, 2, 1, 4, 0, 1, 3, 0, 2, 2, 3, 0, 1, 1, 2, 1, 2, 1, 1, 4, 0, 1, 3,
+  2, 1, 4, 0, 1, 3, 0, 4, 5, 0, 0, 4, 2, 1, 4, 1, 1, 4, 1, 1, 3, 2, 1, 4,
+  3, 1, 4, 0, 1, 5, 0, 4, 4, 0, 0, 4, 0, 2, 2, 5, 0, 1, 3, 0, 1, 1, 0, 1,
+  3, 3, 1, 4, 3, 1, 4, 0, 1, 2, 3, 1, 2, 0, 4, 3, 0, 0, 2, 0, 1, 4, 0, 1,
+  3, 2, 1, 5, 0, 1, 4, 0, 1, 2, 0, 1, 2, 0, 2, 2, 1, 0, 1, 5, 2, 1, 3, 3,
+  1, 4, 3, 1, 2, 0, 1, 2, 3, 1, 4, 3, 1, 1, 3, 1, 2, 1, 1, 2, 1, 1, 4, 3,
+  1, 5, 1, 1, 4, 1, 1, 4, 0, 1, 3, 0, 1, 1, 0, 2, 3, 4, 3, 1, 4, 0, 3, 2,
+  3, 4, 0, 1, 4, 0, 1, 2, 2, 2, 2, 2, 0, 1, 3, 0, 4, 5, 0, 0, 4, 0, 1, 5,
+  0, 1, 5, 0, 2, 2, 1, 1, 1, 4, 0, 1, 1, 2, 1, 1, 1, 1, 3, 3, 1, 2, 2, 1,
+  1, 2, 1, 1, 0, 1, 4, 0, 1, 2, 1, 1, 4, 2, 1, 1, 1, 1, 2, 0, 3, 1, 4, 3,
+  0, 1, 3, 1, 1, 1, 1, 1, 1, 0, 1, 1, 3, 1, 2, 3, 1, 1, 0, 3, 1, 0, 1, 0,
+  1, 5, 0, 2, 4, 5, 0, 2, 2, 3, 0, 2, 4, 5, 0, 1, 2, 0, 1, 5, 0, 2, 2, 5,
+  1, 1, 4, 1, 1, 4, 0, 1, 3, 2, 1, 4, 0, 1, 3, 0, 1, 3, 3, 1, 4, 0, 1, 4,
+  2, 1, 4, 1, 1, 4, 1, 1, 4, 1, 1, 2, 1, 2, 1, 1, 2, 1, 2, 2, 1, 4, 2, 1,
+  4, 0, 1, 4, 0, 1, 5, 1, 2, 1, 4, 3, 1, 1, 2, 1, 4, 2, 1, 2, 2, 1, 2, 1,
+  1, 3, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 0, 2, 2, 2, 0, 3, 4, 0, 3, 0,
+  1, 4, 0, 1, 4, 2, 1, 2, 2, 1, 2, 2, 1, 2, 2, 2, 4, 1, 2, 2, 2, 4, 1, 1,
+  5, 0, 1, 1, 2, 1, 5, 0, 1, 5, 1, 1, 5, 2, 1, 5, 3, 1, 2, 1, 1, 1, 2, 1,
+  2, 2, 1, 2, 2, 1, 5, 1, 1, 1, 1, 1, 3, 0, 1, 4, 0, 1, 4, 0, 3, 4, 0, 3,
+  1, 1, 5, 2, 1, 2, 1, 3, 4, 0, 4, 1, 1, 3, 1, 1, 1, 3, 1, 4, 1, 1, 4, 1,
+  1, 5, 1, 1, 2, 1, 1, 1, 2, 1, 1, 0, 1, 2, 2, 1, 1, 2, 1, 1, 2, 2, 3, 4,
+  0, 1, 2, 2, 1, 1, 0, 1, 4, 1, 2, 1, 4, 2, 1, 2, 1, 2, 1, 2, 0, 1, 4, 1,
+  1, 1, 1, 1, 1, 0, 1, 2, 2, 1, 4, 0, 1, 4, 2, 1, 5, 1, 1, 5, 1, 1, 3, 3,
+  1, 4, 1, 1, 1, 1, 1, 5, 1, 1, 1, 1, 1, 3, 0, 1, 1, 0, 1, 5, 3, 1, 4, 0,
+  1, 4, 0, 1, 5, 2, 1, 4, 0, 1, 2, 3, 1, 1, 3, 1, 4, 0, 1, 4, 1, 1, 2, 2,
+  1, 3, 0, 1, 2, 1, 3, 2, 0, 5, 0, 1, 5, 2, 1, 2, 3, 1, 5, 3, 1, 2, 1, 1,
+  4, 1, 1, 2, 0, 1, 4, 3, 1, 4, 0, 1, 2, 0, 1, 4, 0, 1, 2, 0, 1, 1, 0, 1,
+  1, 2, 1, 4, 0, 1, 2, 1, 1, 2, 3, 1, 4, 0, 3, 1, 0, 4, 1, 1, 1, 3, 1, 4,
+  0, 1, 5, 0, 1, 3, 2, 1, 4, 0, 1, 5, 0, 1, 3, 0, 1, 5, 3, 1, 4, 0, 1, 1,
+  0, 1, 3, 1, 1, 4, 2, 1, 4, 1, 1, 1, 1, 1, 1, 3, 1, 5, 0, 1, 5, 0, 3, 3,
+  4, 4, 3, 1, 2, 0, 1, 5, 3, 1, 1, 0, 1, 3, 1, 1, 4, 3, 1, 3, 2, 1, 4, 0,
+  1, 2, 0, 1, 3, 0, 1, 3, 0, 3, 4, 0, 4, 0, 3, 2, 5, 3, 2, 1, 4, 0, 1, 5,
+  1, 1, 4, 2, 1, 2, 3, 1, 5, 1, 1, 1, 2, 1, 4, 3, 1, 4, 1, 3, 4, 0, 2, 2,
+  1, 4, 2, 1, 2, 1, 1, 2, 2, 1, 4, 1, 1, 4, 1, 1, 4, 2, 1, 4, 2, 1, 4, 2,
+  1, 2, 1, 1, 2, 3, 1, 4, 1, 1, 2, 3, 1, 4, 1, 1, 1, 1, 1, 5, 1, 1, 1, 0,
+  1, 4, 0, 1, 2, 0, 2, 4, 1, 2, 1, 5, 1, 1, 2, 1, 1, 4, 1, 1, 2, 1, 1, 3,
+  1, 1, 3, 0, 1, 4, 0, 1, 4, 0, 1, 4, 1, 2, 4, 4, 1, 1, 2, 1, 1, 1, 2, 1,
+  5, 2, 1, 1, 0, 1, 4, 2, 1, 3, 2, 1, 1, 1, 1, 2, 0, 1, 4, 0, 1, 2, 0, 1,
+  2, 0, 1, 4, 0, 1, 4, 0, 1, 2, 0, 2, 2, 1, 0, 1, 2, 2, 1, 1, 0, 1, 4, 0,
+  1, 2, 1, 1, 1, 2, 1, 4, 1, 1, 4, 0, 1, 4, 3, 1, 4, 2, 1, 3, 1, 1, 1, 2,
+  1, 1, 0, 3, 2, 0, 1, 0, 1, 4, 0, 1, 3, 0, 3, 4, 0, 4, 1, 1, 2, 2, 1, 1,
+  0, 3, 4, 0, 1, 1, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 1, 1, 1, 0, 1, 4, 2,
+  1, 4, 3, 1, 4, 2, 1, 4, 3, 1, 3, 2, 1, 4, 1, 1, 3, 1, 1, 5, 3, 1, 4, 0,
+  1, 3, 1, 1, 2, 0, 1, 1, 2, 1, 4, 1, 1, 1, 3, 1, 4, 0, 2, 5, 2, 1, 1, 4,
+  2, 1, 4, 3, 1, 4, 0, 1, 5, 0, 1, 4, 0, 2, 1, 2, 2, 1, 5, 1, 1, 3, 1, 1,
+  4, 2, 1, 4, 1, 1, 4, 0, 1, 4, 3, 1, 4, 1, 1, 3, 1, 1, 2, 3, 1, 4, 1, 1,
+  3, 2, 1, 2, 3, 1, 2, 0, 1, 3, 1, 1, 5, 1, 1, 5, 3, 1, 3, 0, 1, 3, 0, 3,
+  4, 4, 4, 0, 2, 4, 4, 1, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 2, 2, 1, 2, 2, 1,
+  4, 0, 1, 4, 0, 1, 4, 0, 1, 3, 1, 1, 4, 1, 1, 5, 1, 1, 4, 1, 1, 2, 1, 1,
+  1, 1, 1, 1, 3, 1, 2, 2, 1, 5, 3, 1, 4, 2, 1, 3, 0, 1, 4, 0, 1, 1, 0, 1,
+  4, 0, 1, 4, 0, 4, 2, 0, 0, 4, 0, 1, 2, 0, 1, 2, 0, 1, 4, 0, 1, 2, 2, 1,
+  2, 2, 1, 2, 0, 1, 1, 0, 1, 2, 2, 1, 4, 0, 1, 4, 2, 1, 3, 3, 1, 4, 1, 1,
+  2, 1, 1, 2, 0, 1, 5, 2, 1, 4, 2, 1, 4, 2, 2, 2, 1, 0, 1, 4, 2, 1, 2, 3,
+  1, 2, 2, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 4, 1, 1, 5, 0, 1, 3, 3, 1, 2, 0,
+  1, 4, 2, 1, 4, 0, 3, 2, 1, 2, 3, 1, 4, 1, 1, 2, 1, 1, 4, 1, 1, 2, 1, 1,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 1, 2, 0, 1, 2, 0, 1, 1, 0, 1,
+  3, 2, 1, 2, 1, 1, 1, 0, 1, 1, 2, 1, 4, 2, 1, 4, 0, 1, 2, 1, 1, 1, 1, 1,
+  2, 3, 1, 4, 3, 1, 4, 0, 2, 3, 4, 2, 1, 4, 3, 1, 4, 1, 1, 1, 1, 1, 1, 2,
+  1, 4, 1, 1, 2, 1, 1, 1, 3, 1, 4, 3, 1, 4, 0, 3, 4, 3, 2, 0, 1, 3, 0, 1,
+  4, 2, 1, 4, 0, 1, 4, 0, 1, 1, 3, 1, 4, 3, 1, 4, 2, 1, 4, 1, 1, 2, 1, 1,
+  2, 2, 1, 3, 2, 1, 2, 2, 1, 4, 2, 1, 1, 2, 1, 4, 1, 1, 4, 0, 3, 3, 0, 4,
+  1, 1, 3, 3, 1, 4, 3, 1, 4, 1, 1, 3, 3, 1, 3, 1, 1, 1, 1, 1, 3, 1, 1, 1,
+  3, 1, 4, 1, 3, 2, 0, 4, 1, 1, 4, 1, 1, 3, 1, 1, 3, 1, 1, 2, 1, 1, 1, 1,
+  1, 4, 0, 1, 1, 3, 1, 4, 1, 1, 1, 2, 1, 2, 2, 1, 2, 2, 1, 2, 2, 1, 2, 1,
+  1, 2, 1, 1, 2, 2, 1, 1, 2, 1, 1, 0, 1, 2, 2, 1, 3, 2, 1, 4, 1, 1, 2, 0,
+  1, 2, 1, 1, 1, 2, 1, 1, 3, 1, 5, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 1, 4, 1,
+  1, 2, 0, 1, 4, 2, 1, 4, 2, 1, 5, 2, 1, 1, 1, 1, 4, 2, 1, 1, 1, 1, 4, 1,
+  1, 4, 1, 1, 4, 2, 1, 1, 3, 1, 4, 0, 1, 3, 0, 3, 3, 0, 4, 2, 1, 2, 0, 2,
+  2, 2, 1, 1, 4, 3, 1, 4, 2, 1, 2, 0, 1, 4, 2, 1, 2, 0, 1, 4, 2, 1, 3, 0,
+  1, 5, 0, 1, 1, 0, 1, 4, 2, 1, 3, 1, 1, 4, 2, 1, 2, 0, 3, 3, 0, 1, 2, 1,
+  4, 0, 3, 5, 0, 4, 2, 1, 4, 0, 2, 1, 4, 0, 1, 1, 1, 1, 4, 1, 1, 2, 1, 1,
+  2, 2, 1, 4, 1, 1, 2, 1, 1, 2, 1, 1, 4, 3, 1, 3, 3, 1, 4, 3, 1, 4, 2, 1,
+  4, 2, 1, 2, 0, 1, 5, 2, 1, 2, 0, 1, 2, 1, 1, 2, 1, 1, 2, 3, 1, 2, 2, 1,
+  4, 1, 1, 2, 2, 1, 2, 0, 2, 2, 2, 2, 1, 1, 1, 3, 1, 0, 4, 3, 1, 2, 3, 1,
+  2, 0, 1, 2, 3, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 3, 0, 1, 4, 2, 1, 3, 1, 1,
+  4, 2, 1, 1, 1, 1, 4, 1, 1, 2, 3, 1, 4, 1, 3, 3, 0, 4, 1, 1, 2, 1, 1, 4,
+  3, 1, 4, 1, 1, 3, 1, 1, 2, 2, 1, 4, 3, 1, 2, 3, 1, 5, 2, 2, 4, 4, 1, 1,
+  3, 1, 1, 1, 2, 1, 4, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 1, 1,
+  1, 2, 1, 3, 2, 1, 2, 2, 1, 4, 1, 1, 3, 2, 1, 4, 2, 1, 3, 0, 2, 2, 1, 0,
+  1, 5, 1, 1, 1, 3, 1, 4, 0, 1, 5, 3, 1, 2, 1, 1, 1, 2, 1, 4, 0, 2, 4, 4,
+  2, 1, 2, 0, 1, 5, 1, 2, 1, 4, 0, 1, 5, 0, 1, 5, 0, 1, 4, 3, 1, 4, 0, 1,
+  4, 0, 1, 2, 2, 1, 1, 0, 2, 2, 1, 0, 1, 1, 2, 1, 2, 0, 1, 1, 0, 1, 5, 0,
+  1, 1, 0, 1, 5, 0, 1, 4, 1, 1, 2, 1, 1, 3, 0, 1, 3, 1, 1, 4, 0, 1, 4, 0,
+  1, 2, 1, 1, 1, 1, 2, 2, 5, 1, 1, 1, 1, 1, 4, 1, 1, 4, 2, 1, 2, 2, 1, 5,
+  2, 1, 2, 2, 1, 4, 0, 3, 4, 0, 3, 1, 1, 2, 0, 1, 2, 2, 2, 4, 3, 2, 2, 2,
+  3, 1, 1, 4, 2, 1, 2, 2, 1, 2, 2, 1, 2, 0, 1, 4, 0, 1, 4, 0, 1, 3, 0, 1,
+  2, 0, 4, 4, 0, 0, 4, 2, 1, 2, 3, 1, 4, 0, 1, 2, 0, 1, 3, 1, 1, 4, 0, 2,
+  2, 1, 0, 1, 1, 3, 1, 4, 0, 1, 1, 2, 1, 4, 0, 1, 3, 0, 1, 3, 0, 1, 4, 0,
+  1, 4, 2, 1, 2, 0, 1, 4, 0, 1, 2, 0, 1, 2, 0, 1, 1, 0, 3, 2, 0, 2, 3, 1,
+  2, 0, 1, 2, 0, 1, 1, 0, 2, 2, 1, 0, 1, 1, 0, 1, 5, 2, 1, 4, 0, 1, 1, 0,
+  1, 1, 1, 1, 5, 1, 1, 5, 3, 1, 4, 2, 1, 3, 0, 1, 2, 3, 1, 2, 0, 1, 1, 1,
+  1, 4, 3, 1, 4, 1, 1, 4, 1, 1, 5, 3, 1, 4, 2, 1, 1, 3, 1, 2, 0, 1, 4, 0,
+  4, 4, 0, 0, 4, 0, 3, 5, 0, 3, 0, 1, 3, 0, 1, 3, 0, 2, 4, 1, 0, 1, 4, 0,
+  1, 4, 0, 1, 2, 2, 1, 4, 0, 1, 4, 3, 1, 4, 1, 1, 1, 3, 1, 4, 2, 1, 4, 1,
+  2, 1, 4, 1, 1, 3, 1, 1, 3, 1, 1, 3, 1, 1, 4, 2, 1, 5, 1, 1, 4, 0, 1, 3,
+  1, 1, 3, 2, 1, 4, 3, 1, 3, 1, 1, 1, 2, 1, 4, 2, 1, 2, 0, 3, 4, 0, 3, 1,
+  2, 1, 4, 0, 1, 4, 1, 1, 3, 2, 1, 5, 1, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 1,
+  2, 2, 3, 4, 3, 1, 4, 2, 1, 5, 2, 1, 5, 1, 1, 5, 1, 1, 1, 1, 1, 1, 1, 1,
+  3, 2, 1, 3, 1, 1, 1, 3, 1, 4, 2, 1, 1, 2, 1, 2, 1, 1, 3, 3, 1, 2, 2, 1,
+  1, 1, 1, 2, 0, 3, 4, 1, 2, 1, 2, 4, 1, 3, 1, 4, 2, 1, 4, 3, 1, 3, 2, 1,
+  4, 0, 3, 2, 1, 4, 3, 1, 4, 0, 1, 3, 0, 1, 5, 0, 1, 4, 3, 1, 3, 1, 2, 4,
+  2, 0, 1, 4, 1, 1, 3, 3, 1, 4, 0, 1, 2, 1, 1, 1, 2, 1, 4, 0, 1, 3, 3, 1,
+  4, 0, 1, 3, 0, 1, 5, 0, 1, 2, 3, 1, 4, 1, 1, 1, 1, 1, 3, 3, 1, 4, 3, 1,
+  2, 3, 1, 4, 3, 1, 5, 1, 1, 4, 3, 1, 1, 3, 1, 4, 3, 1, 4, 1, 1, 3, 2, 1,
+  4, 1, 2, 5, 4, 3, 1, 3, 1, 1, 4, 3, 1, 5, 1, 1, 2, 3, 1, 2, 3, 1, 4, 2,
+  1, 5, 2, 1, 5, 1, 1, 4, 1, 1, 3, 2, 1, 3, 1, 1, 5, 0, 4, 3, 0, 0, 4, 1,
+  1, 5, 1, 1, 2, 1, 1, 3, 1, 1, 5, 1, 1, 1, 3, 1, 4, 2, 1, 4, 1, 1, 5, 1,
+  1, 3, 1, 1, 3, 1, 1, 5, 3, 1, 4, 2, 1, 5, 2, 1, 5, 0, 1, 5, 2, 1, 5, 1,
+  2, 4, 5, 3, 1, 4, 1, 1, 4, 2, 1, 3, 1, 1, 3, 1, 1, 5, 1, 1, 3, 2, 1, 4,
+  2, 1, 4, 1, 2, 3, 2, 1, 1, 4, 3, 1, 4, 2, 1, 1, 1, 2, 5, 2, 3, 1, 2, 2,
+  1, 4, 2, 1, 4, 1, 1, 1, 3, 1, 4, 1, 1, 4, 1, 1, 4, 2, 1, 4, 3, 1, 4, 1,
+  1, 4, 3, 1, 4, 3, 1, 2, 3, 1, 4, 3, 1, 2, 3, 1, 3, 3, 1, 3, 3, 1, 2, 3,
+  1, 2, 3, 1, 2, 3, 1, 1, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 3, 3, 1, 2, 3,
+  1, 2, 3, 1, 4, 3, 1, 2, 3, 1, 4, 3, 1, 4, 3, 1, 2, 3, 1, 2, 3, 1, 3, 3,
+  1, 4, 1, 1, 5, 1, 1, 5, 3, 1, 5, 2, 1, 3, 1, 1, 4, 2, 1, 1, 1, 1, 3, 2,
+  1, 1, 1, 1, 3, 2, 1, 3, 2, 1, 4, 1, 1, 3, 1, 1, 3, 1, 1, 3, 1, 1, 5, 2,
+  1, 4, 2, 1, 3, 2, 1, 4, 1, 1, 3, 2, 1, 5, 1, 1, 4, 3, 1, 4, 3, 1, 4, 0,
+  1, 4, 0, 1, 3, 2, 1, 5, 1, 1, 3, 2, 1, 5, 3, 1, 5, 2, 1, 1, 2, 1, 5, 2,
+  1, 3, 1, 1, 4, 0, 1, 4, 1, 3, 5, 0, 5, 3, 1, 4, 0, 1, 4, 0, 1, 5, 0, 1,
+  3, 1, 1, 4, 2, 1, 5, 2, 1, 3, 2, 1, 3, 2, 1, 5, 2, 1, 1, 1, 1, 5, 1, 1,
+  3, 2, 1, 1, 1, 1, 5, 1, 1, 3, 1, 1, 3, 2, 1, 1, 1, 2, 4, 1, 2, 2, 3, 3,
+  2, 1, 3, 1, 1, 3, 2, 1, 3, 1, 1, 3, 2, 1, 5, 2, 1, 2, 2, 1, 4, 2, 1, 2,
+  2, 1, 4, 0, 1, 4, 2, 1, 2, 2, 1, 4, 2, 1, 3, 2, 1, 3, 1, 1, 5, 4, 1, 4,
+  2, 1, 5, 0, 1, 4, 2, 1, 3, 4, 1, 5, 4, 1, 5, 2, 1, 3, 3, 1, 3, 2, 1, 4,
+  1, 1, 5, 2, 3, 5, 0, 4, 4, 1, 4, 2, 1, 4, 1, 1, 3, 2, 1, 4, 2, 1, 4, 2,
+  1, 4, 2, 1, 3, 2, 1, 2, 2, 1, 2, 2, 2, 5, 5, 1, 1, 3, 4, 1, 4, 2, 1, 4,
+  2, 1, 2, 2, 1, 4, 4, 1, 4, 1, 1, 3, 1, 1, 3, 0, 4, 5, 5, 0, 4, 3, 1, 3,
+  1, 1, 4, 2, 1, 5, 2, 1, 4, 2, 1, 1, 2, 1, 5, 2, 1, 5, 3, 1, 5, 2, 1, 5,
+  2, 1, 4, 1, 1, 5, 2, 2, 5, 5, 2, 1, 1, 2, 1, 3, 0, 1, 4, 1, 1, 4, 1, 1,
+  2, 1, 1, 4, 1, 1, 4, 2, 1, 4, 2, 1, 5, 2, 1, 4, 2, 1, 5, 2, 1, 5, 2, 1,
+  3, 4, 1, 3, 2, 1, 3, 3, 1, 5, 2, 1, 1, 2, 1, 3, 1, 1, 5, 2, 1, 3, 2, 1,
+  5, 1, 1, 1, 0, 1, 3, 2, 1, 4, 2, 1, 4, 2, 1, 4, 2, 1, 5, 3, 1, 5, 2, 1,
+  4, 3, 1, 1, 3, 1, 4, 3, 1, 3, 1, 1, 3, 4, 1, 4, 4, 1, 3, 2, 1, 3, 2, 1,
+  3, 2, 1, 3, 2, 1, 3, 2, 1, 5, 2, 1, 1, 2, 1, 3, 2, 1, 5, 2, 1, 3, 2, 1,
+  5, 2, 1, 3, 2, 1, 5, 2, 1, 5, 2, 1, 4, 3, 1, 4, 2, 1, 5, 2, 1, 3, 1, 1,
+  5, 4, 1, 4, 1, 1, 4, 1, 1, 3, 3, 1, 5, 3, 1, 3, 3, 1, 4, 0, 2, 4, 1, 3,
+  1, 5, 0, 1, 5, 0, 1, 5, 0, 1, 5, 1, 1, 5, 4, 1, 5, 2, 1, 4, 0, 1, 4, 4,
+  1, 4, 2, 1, 4, 2, 1, 3, 4, 1, 4, 2, 1, 3, 0, 1, 5, 0, 1, 4, 1, 1, 5, 2,
+  1, 1, 4, 1, 4, 0, 1, 4, 3, 1, 5, 3, 1, 4, 4, 1, 4, 0, 1, 4, 2, 1, 4, 4,
+  1, 5, 3, 1, 4, 4, 1, 4, 0, 1, 4, 0, 1, 3, 0, 1, 5, 0, 1, 3, 0, 4, 2, 0,
+  0, 4, 0, 1, 4, 0, 1, 3, 0, 1, 4, 3, 1, 5, 1, 2, 5, 4, 0, 3, 4, 0, 3, 0,
+  1, 4, 0, 3, 4, 0, 1, 0, 1, 5, 0, 1, 3, 3, 1, 2, 2, 1, 4, 2, 2, 2, 5, 3,
+  1, 5, 0, 1, 4, 2, 1, 4, 0, 1, 3, 1, 1, 4, 1, 1, 1, 0, 1, 5, 4, 1, 4, 0,
+  1, 4, 2, 1, 3, 0, 1, 4, 3, 1, 4, 0, 1, 4, 4, 1, 4, 2, 1, 5, 2, 1, 4, 3,
+  1, 5, 0, 1, 5, 3, 1, 4, 1, 1, 4, 3, 1, 3, 3, 1, 5, 2, 1, 3, 2, 1, 4, 0,
+  1, 4, 3, 1, 4, 4, 1, 4, 3, 1, 5, 3, 1, 5, 2, 1, 5, 0, 1, 5, 3, 1, 4, 3,
+  1, 5, 1, 1, 4, 4, 1, 4, 3, 1, 4, 3, 1, 4, 1, 1, 3, 3, 1, 4, 0, 1, 5, 2,
+  1, 2, 1, 1, 3, 2, 1, 4, 2, 1, 3, 2, 1, 5, 0, 1, 4, 4, 1, 4, 3, 1, 3, 4,
+  1, 5, 4, 1, 5, 0, 1, 4, 0, 1, 4, 3, 1, 5, 4, 1, 5, 0, 1, 4, 2, 1, 5, 2,
+  1, 5, 0, 1, 5, 2, 1, 3, 2, 1, 3, 2, 1, 3, 4, 1, 4, 2, 1, 2, 1, 1, 4, 0,
+  1, 5, 3, 1, 5, 2, 1, 1, 2, 2, 2, 5, 2, 1, 4, 1, 1, 2, 2, 1, 2, 1, 3, 3,
+  0, 4, 3, 1, 5, 1, 1, 4, 0, 1, 3, 0, 3, 5, 0, 3, 2, 1, 3, 0, 1, 1, 0, 1,
+  5, 3, 1, 5, 2, 1, 4, 2, 1, 1, 0, 1, 5, 1, 3, 4, 0, 3, 1, 1, 2, 0, 1, 3,
+  0, 1, 3, 2, 1, 5, 2, 1, 4, 4, 1, 4, 4, 1, 4, 3, 1, 3, 3, 1, 4, 0, 2, 4,
+  5, 0, 1, 4, 0, 1, 5, 3, 1, 4, 4, 1, 4, 3, 1, 4, 0, 1, 4, 1, 1, 1, 2, 1,
+  5, 1, 1, 3, 2, 1, 4, 2, 1, 4, 3, 1, 5, 1, 1, 3, 2, 1, 4, 1, 1, 5, 3, 1,
+  3, 3, 1, 4, 3, 1, 5, 3, 1, 2, 2, 1, 5, 1, 1, 3, 4, 1, 3, 1, 2, 4, 3, 3,
+  1, 5, 3, 1, 5, 1, 1, 4, 1, 1, 4, 1, 1, 4, 4, 1, 5, 1, 1, 4, 2, 1, 3, 3,
+  1, 4, 1, 1, 2, 1, 1, 2, 2, 1, 4, 1, 1, 4, 1, 2, 4, 1, 3, 1, 4, 1, 1, 3,
+  2, 1, 3, 2, 1, 3, 2, 1, 1, 3, 1, 5, 1, 1, 4, 4, 1, 2, 1, 1, 4, 1, 1, 4,
+  3, 1, 3, 3, 1, 3, 2, 1, 4, 2, 1, 4, 4, 1, 4, 2, 1, 4, 1, 1, 4, 4, 1, 4,
+  0, 1, 3, 0, 1, 4, 4, 1, 4, 2, 1, 5, 2, 1, 4, 1, 4, 5, 0, 0, 5, 1, 1, 4,
+  1, 1, 4, 2, 1, 1, 1, 1, 5, 4, 1, 4, 2, 1, 5, 1, 1, 3, 1, 1, 3, 1, 1, 1,
+  3, 1, 4, 3, 1, 3, 2, 1, 3, 1, 1, 5, 1, 1, 4, 3, 1, 4, 2, 1, 4, 1, 1, 4,
+  1, 1, 4, 1, 1, 4, 1, 1, 3, 0, 1, 5, 1, 1, 4, 1, 1, 5, 1, 2, 4, 1, 1, 1,
+  1, 1, 1, 5, 1, 1, 3, 1, 1, 2, 1, 4, 3, 0, 0, 3, 0, 1, 4, 4, 1, 4, 1, 1,
+  5, 2, 1, 5, 2, 1, 2, 2, 1, 4, 1, 1, 5, 2, 1, 5, 1, 1, 4, 1, 1, 4, 1, 1,
+  5, 1, 1, 2, 1, 1, 4, 3, 1, 4, 2, 3, 1, 0, 2, 1, 1, 4, 2, 1, 3, 3, 1, 4,
+  2, 1, 3, 1, 1, 4, 3, 1, 3, 1, 1, 5, 1, 1, 5, 2, 1, 3, 1, 1, 3, 1, 1, 5,
+  1, 1, 5, 1, 1, 3, 2, 1, 3, 1, 1, 5, 0, 1, 5, 3, 1, 4, 1, 1, 4, 2, 1, 3,
+  2, 1, 4, 2, 1, 3, 2, 1, 5, 1, 1, 3, 2, 1, 3, 2, 1, 4, 1, 1, 5, 1, 1, 3,
+  1, 1, 5, 4, 1, 4, 1, 1, 4, 1, 1, 3, 2, 1, 4, 1, 1, 4, 3, 1, 4, 2, 1, 3,
+  2, 1, 4, 2, 1, 3, 3, 1, 4, 4, 1, 4, 0, 1, 2, 1, 4, 1, 0, 0, 4, 1, 1, 1,
+  0, 1, 4, 2, 1, 4, 3, 1, 4, 2, 1, 3, 2, 1, 5, 1, 1, 5, 3, 1, 4, 2, 1, 1,
+  0, 1, 4, 2, 1, 3, 3, 1, 4, 1, 1, 2, 1, 1, 3, 2, 1, 5, 1, 1, 2, 1, 1, 3,
+  1, 1, 2, 1, 1, 2, 1, 2, 2, 5, 2, 2, 4, 4, 3, 1, 4, 2, 1, 4, 1, 1, 2, 1,
+  1, 2, 0, 3, 4, 0, 2, 0, 1, 2, 1, 1, 2, 3, 1, 4, 1, 1, 3, 2, 1, 1, 4, 1,
+  4, 1, 1, 5, 1, 1, 3, 1, 1, 3, 2, 1, 3, 2, 1, 5, 2, 1, 3, 4, 1, 4, 2, 1,
+  5, 3, 2, 2, 5, 1, 1, 2, 1, 1, 5, 2, 1, 1, 2, 1, 3, 3, 1, 4, 1, 1, 4, 3,
+  1, 4, 1, 1, 5, 1, 1, 4, 1, 1, 5, 4, 1, 5, 1, 1, 3, 0, 1, 5, 2, 1, 3, 3,
+  1, 3, 2, 1, 4, 4, 1, 4, 0, 3, 4, 0, 4, 2, 1, 3, 0, 1, 4, 4, 1, 4, 0, 1,
+  4, 0, 1, 5, 2, 1, 3, 2, 1, 4, 3, 1, 2, 0, 1, 5, 1, 1, 4, 1, 1, 4, 1, 2,
+  2, 5, 1, 1, 4, 3, 1, 4, 0, 1, 4, 2, 1, 3, 0, 2, 2, 3, 3, 1, 5, 0, 1, 4,
+  0, 1, 5, 3, 2, 2, 5, 2, 1, 2, 1, 3, 1, 0, 3, 3, 1, 4, 4, 1, 4, 3, 1, 4,
+  3, 1, 4, 3, 1, 4, 1, 1, 5, 4, 1, 4, 4, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 3,
+  4, 1, 4, 3, 1, 4, 0, 1, 4, 0, 1, 3, 2, 1, 3, 0, 1, 5, 1, 1, 5, 0, 1, 4,
+  3, 2, 5, 4, 4, 1, 4, 4, 1, 3, 4, 1, 4, 0, 1, 4, 0, 1, 4, 0, 1, 4, 2, 1,
+  3, 1, 1, 4, 0, 1, 5, 4, 1, 5, 0, 1, 4, 2, 1, 4, 1, 1, 3, 4, 1, 5, 2, 1,
+  3, 2, 1, 4, 3, 1, 5, 1, 1, 4, 4, 1, 5, 0, 2, 5, 4, 0, 2, 3, 4, 3, 1, 4,
+  1, 1, 3, 0, 1, 5, 3, 1, 4, 1, 1, 3, 3, 1, 3, 1, 1, 4, 1, 1, 2, 1, 1, 4,
+  1, 1, 4, 2, 1, 3, 0, 3, 4, 3, 3, 2, 1, 3, 0, 1, 5, 1, 1, 4, 4, 1, 2, 0,
+  1, 4, 3, 1, 4, 0, 1, 4, 4, 1, 4, 1, 1, 5, 0, 4, 5, 0, 0, 5, 2, 1, 5, 1,
+  3, 3, 0, 4, 4, 1, 4, 3, 1, 4, 3, 1, 4, 1, 1, 5, 2, 1, 3, 3, 1, 4, 3, 1,
+  4, 3, 1, 3, 3, 1, 5, 3, 1, 2, 3, 1, 5, 4, 1, 4, 3, 1, 3, 0, 1, 1, 0, 1,
+  3, 2, 3, 5, 0, 5, 2, 2, 3, 4, 1, 1, 5, 3, 1, 4, 4, 1, 4, 3, 1, 5, 1, 1,
+  4, 1, 1, 3, 1, 1, 3, 2, 2, 2, 5, 2, 1, 5, 2, 1, 4, 4, 1, 5, 1, 1, 4, 3,
+  1, 4, 2, 1, 3, 3, 1, 4, 3, 1, 4, 3, 1, 4, 4, 1, 4, 4, 1, 4, 1, 1, 5, 4,
+  1, 4, 0, 4, 3, 0, 0, 4, 2, 1, 4, 4, 1, 3, 3, 1, 4, 2, 1, 5, 0, 1, 3, 4,
+  1, 4, 2, 1, 5, 3, 1, 4, 3, 1, 1, 0, 1, 1, 4, 1, 5, 1, 1, 4, 2, 1, 1, 2,
+  1, 5, 3, 1, 4, 3, 2, 3, 4, 2, 1, 3, 2, 1, 3, 0, 1, 4, 3, 1, 3, 0, 4, 4,
+  0, 0, 4, 2, 1, 5, 4, 1, 4, 1, 1, 4, 2, 1, 5, 2, 1, 3, 2, 1, 3, 1, 2, 2,
+  5, 1, 1, 5, 0, 1, 4, 0, 1, 5, 0, 1, 4, 4, 1, 5, 1, 1, 4, 4, 1, 4, 0, 1,
+  4, 1, 1, 5, 1, 1, 2, 1, 1, 4, 1, 2, 2, 5, 0, 1, 5, 1, 1, 4, 2, 1, 4, 4,
+  1, 2, 2, 1, 4, 2, 1, 5, 1, 1, 3, 1, 1, 4, 3, 1, 4, 1, 1, 5, 2, 1, 3, 2,
+  1, 1, 2, 1, 5, 1, 1, 3, 1, 1, 4, 2, 1, 3, 2, 1, 5, 3, 1, 4, 0, 3, 5, 0,
+  5, 4, 1, 3, 3, 2, 5, 4, 3, 1, 4, 1, 1, 5, 1, 1, 1, 1, 1, 3, 1, 1, 1, 2,
+  1, 4, 1, 1, 3, 3, 1, 5, 1, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2,
+  1, 5, 1, 1, 5, 3, 1, 5, 2, 1, 1, 2, 2, 3, 4, 1, 2, 2, 5, 1, 1, 3, 2, 1,
+  1, 4, 1, 4, 2, 1, 3, 2, 1, 2, 2, 1, 3, 0, 1, 2, 2, 1, 2, 2, 1, 3, 2, 1,
+  4, 2, 1, 5, 1, 1, 4, 0, 1, 4, 0, 1, 4, 2, 1, 4, 1, 1, 3, 1, 2, 4, 3, 0,
+  1, 4, 1, 1, 3, 0, 1, 4, 0, 1, 4, 0, 1, 4, 0, 1, 4, 0, 1, 4, 1, 1, 4, 2,
+  1, 3, 2, 1, 1, 1, 1, 5, 1, 3, 4, 0, 4, 3, 1, 4, 1, 1, 4, 2, 1, 3, 0, 3,
+  2, 0, 4, 0, 1, 2, 1, 1, 5, 4, 1, 4, 2, 1, 2, 3, 1, 3, 2, 1, 5, 3, 1, 3,
+  2, 1, 5, 1, 1, 5, 2, 1, 4, 1, 1, 4, 2, 1, 4, 2, 3, 4, 0, 4, 2, 1, 3, 1,
+  1, 3, 3, 1, 4, 1, 1, 4, 3, 1, 5, 1, 1, 4, 1, 4, 4, 0, 0, 4, 1, 1, 4, 2,
+  1, 5, 2, 1, 4, 0, 3, 5, 5, 2, 3, 1, 4, 2, 1, 5, 2, 1, 5, 2, 1, 3, 4, 1,
+  5, 2, 1, 3, 2, 1, 3, 2, 1, 3, 3, 1, 4, 1, 1, 5, 0, 1, 4, 2, 1, 2, 2, 1,
+  4, 2, 1, 1, 2, 1, 1, 2, 1, 5, 1, 1, 4, 0, 4, 4, 0, 0, 5, 1, 1, 3, 1, 1,
+  3, 0, 1, 4, 2, 1, 4, 0, 1, 4, 0, 2, 4, 2, 2, 1, 3, 1, 1, 2, 0, 1, 2, 0,
+  1, 4, 1, 3, 2, 5, 5, 0, 1, 4, 2, 1, 5, 1, 1, 5, 2, 1, 3, 0, 1, 4, 2, 1,
+  5, 2, 1, 1, 1, 2, 4, 3, 0, 1, 4, 3, 1, 4, 3, 1, 5, 0, 1, 5, 4, 1, 4, 2,
+  1, 5, 1, 3, 3, 0, 4, 2, 1, 4, 1, 1, 4, 4, 1, 5, 3, 1, 4, 1, 1, 4, 1, 1,
+  5, 0, 1, 4, 1, 1, 5, 4, 1, 4, 3, 1, 5, 1, 1, 4, 4, 1, 4, 1, 1, 4, 2, 1,
+  3, 3, 1, 4, 3, 1, 3, 0, 1, 3, 3, 1, 4, 3, 1, 3, 3, 1, 4, 2, 2, 4, 4, 4,
+  1, 4, 2, 1, 5, 1, 1, 4, 2, 1, 4, 4, 1, 5, 0, 1, 5, 0, 1, 5, 0, 1, 3, 0,
+  1, 1, 0, 1, 4, 2, 1, 3, 2, 1, 4, 3, 1, 4, 0, 1, 3, 0, 2, 3, 4, 1, 1, 4,
+  0, 1, 5, 0, 1, 3, 1, 1, 3, 0, 1, 4, 4, 1, 3, 1, 1, 4, 2, 1, 4, 2, 1, 2,
+  2, 1, 4, 2, 1, 5, 0, 1, 4, 1, 1, 4, 1, 1, 3, 1, 1, 3, 0, 1, 3, 1, 1, 4,
+  2, 1, 4, 0, 1, 3, 3, 1, 3, 2, 1, 4, 1, 3, 4, 0, 4, 1, 1, 4, 0, 2, 1, 4,
+  3, 1, 3, 2, 1, 5, 3, 1, 4, 1, 1, 2, 1, 1, 3, 3, 1, 4, 1, 1, 4, 1, 1, 5,
+  1, 1, 3, 1, 1, 3, 1, 1, 3, 1, 3, 3, 0, 4, 1, 3, 3, 0, 4, 1, 4, 2, 0, 0,
+  4, 1, 1, 5, 1, 1, 5, 1, 1, 4, 4, 1, 4, 2, 1, 4, 1, 1, 5, 0, 1, 3, 0, 1,
+  5, 3, 1, 4, 4, 1, 5, 3, 1, 3, 1, 1, 3, 4, 1, 4, 3, 1, 4, 0, 1, 5, 2, 1,
+  4, 0, 1, 2, 3, 1, 5, 1, 1, 3, 1, 1, 5, 1, 1, 3, 1, 1, 4, 2, 1, 5, 4, 1,
+  4, 3, 1, 3, 4, 1, 4, 2, 1, 3, 4, 1, 4, 2, 1, 3, 2, 1, 3, 2, 1, 5, 2, 1,
+  4, 0, 1, 5, 3, 1, 3, 4, 1, 4, 1, 1, 5, 1, 4, 5, 0, 0, 4, 2, 1, 5, 2, 1,
+  3, 1, 1, 5, 2, 1, 2, 2, 1, 4, 0, 1, 5, 4, 1, 5, 0, 1, 4, 3, 1, 3, 3, 1,
+  4, 3, 1, 1, 0, 1, 5, 4, 1, 3, 3, 2, 4, 5, 1, 1, 5, 3, 1, 4, 1, 2, 5, 5,
+  0, 1, 4, 3, 1, 4, 3, 2, 1, 3, 3, 1, 4, 0, 1, 4, 3, 1, 4, 4, 1, 4, 0, 1,
+  3, 2, 1, 5, 2, 1, 4, 2, 1, 1, 1, 1, 4, 3, 1, 4, 3, 1, 4, 1, 1, 4, 3, 1,
+  4, 0, 1, 3, 3, 1, 4, 1, 1, 4, 4, 1, 4, 3, 1, 5, 0, 1, 4, 1, 1, 4, 0, 1,
+  4, 2, 1, 4, 4, 1, 2, 2, 1, 3, 2, 1, 3, 4, 1, 3, 1, 1, 5, 0, 1, 3, 1, 1,
+  3, 3, 1, 4, 1, 2, 4, 1, 1, 1, 5, 2, 1, 5, 4, 1, 5, 2, 1, 4, 0, 1, 5, 1,
+  1, 4, 2, 1, 4, 1, 1, 5, 0, 1, 4, 2, 1, 4, 0, 1, 4, 4, 1, 4, 3, 1, 3, 0,
+  1, 4, 3, 1, 3, 3, 1, 4, 1, 1, 5, 3, 1, 4, 0, 1, 3, 3, 1, 4, 4, 1, 5, 1,
+  1, 3, 2, 1, 1, 2, 1, 4, 1, 1, 4, 1, 1, 5, 3, 1, 4, 1, 2, 5, 2, 1, 1, 1,
+  1, 1, 3, 1, 1, 5, 3, 1, 4, 2, 1, 2, 1, 1, 3, 3, 1, 3, 0, 1, 5, 0, 1, 5,
+  2, 1, 4, 2, 1, 5, 2, 1, 4, 0, 1, 4, 2, 1, 4, 1, 1, 2, 1, 3, 4, 0, 5, 3,
+  1, 4, 0, 1, 4, 0, 1, 2, 0, 1, 4, 0, 1, 2, 1, 1, 5, 1, 1, 4, 1, 1, 3, 2,
+  1, 5, 1, 1, 3, 2, 1, 1, 1, 1, 5, 1, 1, 4, 4, 1, 4, 2, 1, 5, 1, 1, 4, 4,
+  1, 3, 2, 1, 3, 2, 1, 4, 2, 1, 3, 2, 1, 4, 2, 1, 5, 2, 1, 4, 2, 1, 2, 1,
+  1, 5, 3, 1, 4, 0, 1, 5, 1, 1, 4, 2, 1, 3, 1, 1, 3, 2, 1, 3, 4, 1, 4, 3,
+  1, 4, 3, 1, 4, 1, 1, 5, 4, 1, 4, 2, 2, 5, 4, 2, 1, 4, 2, 1, 3, 3, 1, 5,
+  0, 1, 4, 3, 1, 4, 3, 1, 5, 2, 1, 5, 0, 1, 3, 4, 1, 3, 2, 1, 5, 1, 2, 4,
+  3, 4, 1, 1, 4, 1, 4, 1, 1, 4, 2, 1, 4, 1, 1, 5, 3, 1, 4, 1, 1, 5, 3, 1,
+  2, 3, 1, 4, 2, 1, 5, 1, 1, 3, 0, 3, 3, 0, 3, 2, 1, 1, 1, 1, 5, 2, 1, 3,
+  4, 1, 3, 3, 1, 4, 3, 1, 5, 2, 2, 3, 3, 1, 1, 5, 3, 1, 4, 1, 1, 2, 2, 1,
+  3, 4, 1, 3, 1, 1, 4, 1, 1, 4, 4, 1, 3, 2, 1, 3, 3, 1, 3, 4, 1, 3, 1, 1,
+  5, 2, 1, 4, 1, 3, 2, 5, 5, 1, 1, 5, 1, 1, 4, 1, 1, 3, 0, 2, 1, 1, 2, 1,
+  3, 1, 2, 5, 2, 1, 1, 4, 3, 1, 5, 0, 1, 2, 4, 1, 5, 4, 1, 4, 1, 1, 3, 1,
+  1, 5, 1, 1, 3, 2, 1, 5, 1, 1, 4, 3, 1, 1, 2, 1, 3, 1, 1, 3, 2, 1, 4, 1,
+  1, 3, 1, 3, 3, 0, 4, 1, 1, 5, 1, 1, 5, 1, 1, 5, 3, 1, 4, 2, 1, 5, 2, 1,
+  3, 2, 1, 3, 1, 1, 5, 2, 1, 5, 3, 1, 5, 2, 1, 2, 2, 1, 4, 1, 1, 4, 1, 1,
+  3, 1, 1, 5, 2, 1, 1, 1, 1, 4, 2, 1, 3, 2, 1, 4, 1, 1, 3, 2, 1, 5, 1, 1,
+  3, 2, 1, 4, 2, 1, 1, 1, 1, 3, 2, 1, 1, 1, 1, 5, 4, 1, 4, 2, 2, 3, 4, 2,
+  1, 5, 4, 1, 5, 3, 1, 5, 3, 1, 5, 3, 1, 3, 1, 1, 3, 4, 1, 5, 3, 1, 5, 2,
+  1, 1, 1, 1, 3, 1, 1, 5, 1, 2, 4, 3, 1, 1, 5, 3, 1, 5, 2, 1, 3, 4, 1, 4,
+  2, 1, 4, 0, 2, 4, 5, 1, 1, 5, 2, 1, 1, 1, 1, 1, 1, 1, 3, 2, 1, 2, 3, 1,
+  2, 1, 1, 5, 2, 1, 5, 0, 1, 3, 2, 1, 4, 4, 1, 4, 2, 1, 4, 1, 1, 5, 2, 1,
+  3, 2, 1, 4, 1, 1, 5, 2, 2, 4, 4, 3, 1, 4, 2, 1, 4, 2, 1, 4, 2, 1, 2, 1,
+  1, 4, 1, 1, 4, 3, 2, 3, 4, 1, 1, 3, 1, 1, 3, 3, 1, 5, 2, 1, 3, 2, 1, 5,
+  3, 1, 2, 2, 1, 4, 1, 1, 3, 1, 2, 5, 4, 2, 1, 3, 3, 1, 5, 2, 1, 4, 2, 1,
+  4, 3, 1, 4, 4, 1, 4, 3, 1, 4, 2, 1, 3, 2, 1, 4, 0, 1, 3, 1, 2, 4, 4, 2,
+  1, 2, 0, 1, 3, 0, 1, 3, 3, 1, 4, 2, 1, 4, 1, 1, 4, 2, 1, 5, 1, 1, 4, 1,
+  1, 4, 3, 1, 3, 2, 1, 5, 3, 1, 1, 2, 1, 4, 2, 1, 1, 0, 1, 5, 0, 1, 3, 0,
+  1, 3, 3, 1, 4, 4, 1, 4, 2, 1, 4, 1, 1, 5, 2, 1, 3, 0, 1, 5, 0, 1, 3, 2,
+  1, 3, 2, 1, 3, 4, 1, 4, 1, 1, 4, 1, 1, 4, 4, 1, 4, 1, 1, 3, 2, 1, 2, 0,
+  1, 3, 3, 1, 3, 0, 1, 4, 3, 1, 4, 4, 1, 4, 3, 1, 4, 0, 1, 5, 2, 1, 5, 2,
+  3, 3, 0, 5, 4, 1, 2, 2, 1, 4, 2, 1, 4, 3, 1, 1, 2, 1, 4, 0, 1, 5, 1, 1,
+  4, 1, 1, 5, 1, 1, 3, 1, 1, 3, 1, 1, 3, 3, 1, 3, 3, 1, 3, 0, 4, 5, 0, 0,
+  4, 3, 1, 4, 3, 1, 3, 3, 1, 1, 1, 1, 4, 2, 2, 5, 4, 3, 1, 3, 3, 1, 4, 3,
+  1, 3, 3, 1, 4, 0, 1, 5, 2, 1, 3, 3, 1, 5, 0, 1, 3, 0, 1, 3, 0, 1, 2, 2,
+  1, 3, 1, 1, 5, 3, 1, 4, 2, 1, 4, 1, 1, 2, 1, 1, 4, 2, 1, 5, 3, 1, 5, 4,
+  1, 4, 3, 1, 4, 1, 1, 4, 1, 1, 4, 3, 1, 4, 1, 1, 2, 4, 1, 4, 1, 1, 3, 1,
+  3, 4, 0, 4, 2, 1, 4, 4, 1, 3, 1, 1, 4, 3, 1, 4, 4, 1, 4, 2, 1, 1, 2, 1,
+  3, 0, 1, 5, 2, 1, 4, 2, 1, 1, 2, 1, 2, 2, 1, 3, 2, 1, 4, 2, 1, 5, 2, 1,
+  1, 2, 1, 5, 2, 1, 1, 1, 1, 4, 4, 1, 4, 2, 1, 5, 3, 1, 2, 1, 1, 4, 2, 1,
+  4, 2, 1, 3, 1, 1, 3, 1, 1, 3, 3, 1, 4, 1, 1, 5, 1, 1, 5, 3, 1, 4, 0, 1,
+  4, 3, 1, 4, 2, 1, 4, 3, 1, 3, 1, 1, 4, 0, 1, 4, 1, 1, 4, 2, 1, 1, 2, 1,
+  5, 0, 1, 5, 3, 1, 5, 0, 1, 3, 1, 1, 2, 3, 1, 4, 3, 1, 4, 3, 1, 4, 0, 1,
+  5, 2, 1, 2, 3, 1, 4, 1, 1, 3, 3, 1, 4, 1, 1, 4, 2, 1, 2, 3, 1, 3, 1, 1,
+  3, 2, 1, 4, 1, 1, 2, 1, 1, 4, 1, 1, 4, 3, 1, 5, 1, 1, 3, 1, 1, 4, 1, 1,
+  3, 1, 1, 4, 1, 1, 3, 1, 1, 4, 1, 1, 5, 1, 1, 3, 1, 1, 5, 1, 4, 1, 0, 0,
+  4, 1, 1, 3, 1, 1, 3, 1, 1, 4, 3, 1, 3, 2, 1, 3, 2, 1, 1, 3, 1, 4, 3, 1,
+  4, 3, 1, 4, 0, 1, 1, 0, 1, 5, 3, 1, 3, 2, 1, 5, 3, 1, 4, 2, 1, 4, 2, 1,
+  4, 1, 1, 4, 1, 1, 3, 3, 1, 4, 3, 1, 4, 1, 1, 4, 3, 1, 4, 3, 1, 4, 4, 1,
+  4, 4, 1, 4, 4, 1, 4, 1, 1, 3, 2, 1, 3, 3, 2, 5, 2, 1, 1, 5, 1, 3, 4, 0,
+  4, 4, 1, 3, 1, 1, 4, 1, 1, 3, 3, 1, 5, 2, 1, 5, 3, 1, 4, 1, 1, 3, 1, 1,
+  4, 1, 1, 3, 2, 1, 4, 2, 2, 3, 4, 2, 1, 3, 2, 1, 4, 2, 1, 3, 4, 1, 5, 1,
+  1, 5, 1, 1, 3, 1, 1, 3, 1, 1, 3, 3, 1, 4, 0, 1, 5, 1, 1, 3, 3, 1, 4, 2,
+  1, 5, 3, 1, 4, 0, 1, 3, 2, 1, 5, 3, 1, 3, 3, 1, 4, 4, 1, 5, 1, 1, 4, 0,
+  1, 4, 1, 1, 4, 1, 1, 4, 0, 2, 3, 4, 4, 1, 5, 1, 1, 4, 4, 1, 4, 4, 1, 4,
+  3, 1, 5, 2, 2, 2, 3, 0, 1, 3, 2, 2, 4, 4, 1, 1, 5, 3, 1, 3, 2, 1, 1, 0,
+  1, 5, 0, 1, 5, 0, 1, 4, 0, 1, 4, 3, 1, 4, 3, 1, 5, 3, 2, 3, 3, 1, 1, 4,
+  3, 1, 4, 0, 2, 4, 1, 2, 1, 5, 3, 1, 5, 0, 3, 5, 0, 5, 3, 1, 4, 2, 1, 1,
+  0, 1, 5, 2, 1, 1, 2, 1, 3, 0, 1, 3, 4, 1, 5, 4, 1, 3, 4, 1, 4, 1, 1, 5,
+  0, 1, 5, 3, 1, 4, 0, 1, 4, 1, 1, 2, 1, 1, 3, 0, 1, 5, 3, 1, 5, 1, 1, 3,
+  1, 1, 3, 4, 1, 3, 4, 1, 4, 1, 1, 5, 2, 1, 4, 4, 1, 3, 3, 2, 3, 2, 0, 1,
+  5, 4, 1, 4, 3, 1, 4, 0, 2, 3, 4, 3, 1, 5, 3, 1, 5, 2, 1, 5, 0, 1, 5, 3,
+  1, 4, 0, 2, 2, 5, 0, 1, 2, 1, 1, 2, 4, 1, 5, 4, 1, 4, 0, 1, 4, 1, 1, 4,
+  1, 1, 4, 4, 1, 4, 0, 1, 4, 4, 1, 3, 1, 1, 3, 1, 1, 5, 1, 1, 4, 2, 1, 4,
+  1, 1, 2, 1, 1, 2, 1, 3, 4, 0, 4, 1, 1, 4, 3, 1, 2, 1, 1, 3, 1, 1, 5, 1,
+  1, 1, 1, 1, 4, 1, 1, 3, 0, 1, 5, 1, 1, 4, 1, 1, 1, 1, 1, 4, 0, 1, 4, 2,
+  1, 1, 2, 1, 5, 4, 1, 3, 3, 1, 3, 3, 1, 5, 0, 1, 4, 2, 1, 5, 2, 1, 5, 3,
+  1, 3, 0, 1, 4, 2, 1, 5, 2, 1, 5, 3, 1, 4, 0, 1, 4, 0, 1, 4, 3, 1, 4, 2,
+  1, 5, 4, 1, 4, 0, 1, 4, 4, 1, 4, 0, 1, 5, 2, 1, 5, 2, 1, 5, 4, 1, 4, 0,
+  1, 5, 0, 1, 3, 2, 3, 2, 0, 2, 0, 1, 3, 0, 1, 3, 0, 1, 1, 2, 1, 5, 3, 1,
+  3, 0, 4, 5, 0, 0, 3, 0, 1, 1, 3, 1, 5, 0, 1, 4, 0, 1, 4, 4, 1, 4, 0, 1,
+  4, 0, 1, 3, 0, 1, 4, 0, 1, 4, 2, 1, 4, 0, 1, 4, 1, 1, 4, 1, 3, 4, 0, 1,
+  0, 1, 5, 0, 1, 3, 2, 1, 5, 0, 1, 5, 0, 1, 4, 1, 1, 2, 0, 1, 3, 2, 1, 5,
+  2, 1, 3, 0, 1, 3, 3, 1, 4, 2, 1, 5, 3, 1, 4, 2, 1, 3, 3, 1, 4, 2, 1, 3,
+  4, 1, 4, 0, 1, 3, 0, 1, 3, 0, 1, 4, 2, 1, 2, 2, 1, 5, 2, 1, 2, 3, 1, 4,
+  2, 1, 3, 0, 1, 4, 0, 1, 4, 2, 1, 2, 0, 1, 5, 0, 1, 4, 3, 1, 3, 4, 1, 4,
+  3, 1, 5, 3, 1, 4, 0, 1, 5, 0, 1, 2, 3, 1, 4, 3, 1, 3, 3, 1, 5, 4, 1, 4,
+  1, 1, 4, 2, 1, 3, 2, 1, 4, 0, 2, 2, 3, 0, 1, 3, 0, 1, 5, 3, 1, 5, 2, 1,
+  5, 4, 1, 4, 4, 1, 3, 2, 1, 5, 2, 1, 5, 3, 1, 4, 3, 1, 2, 3, 1, 3, 3, 1,
+  3, 1, 1, 4, 1, 1, 3, 3, 1, 4, 2, 1, 4, 4, 1, 3, 2, 1, 3, 4, 1, 4, 1, 1,
+  1, 2, 1, 5, 1, 1, 5, 1, 1, 4, 2, 1, 4, 1, 1, 4, 4, 1, 4, 2, 1, 5, 1, 1,
+  1, 3, 1, 4, 4, 1, 4, 3, 1, 5, 4, 1, 4, 1, 1, 1, 2, 1, 4, 1, 1, 5, 2, 1,
+  1, 0, 1, 4, 2, 1, 5, 2, 1, 5, 2, 1, 4, 4, 1, 4, 2, 1, 4, 2, 1, 4, 1, 1,
+  2, 3, 1, 3, 2, 1, 4, 1, 1, 4, 1, 1, 5, 4, 1, 4, 1, 1, 4, 1, 1, 4, 0, 1,
+  4, 2, 1, 4, 2, 1, 4, 1, 1, 3, 2, 1, 1, 1, 1, 3, 1, 1, 1, 2, 1, 3, 2, 1,
+  4, 4, 1, 4, 2, 1, 4, 2, 1, 4, 4, 1, 4, 1, 1, 5, 1, 1, 5, 2, 1, 4, 2, 1,
+  3, 3, 1, 5, 1, 1, 5, 1, 1, 3, 2, 1, 5, 2, 1, 1, 4, 1, 4, 3, 1, 4, 1, 1,
+  3, 0, 1, 4, 0, 1, 4, 0, 1, 4, 1, 1, 4, 0, 2, 5, 5, 2, 1, 5, 3, 1, 5, 1,
+  1, 5, 1, 1, 4, 3, 1, 3, 2, 1, 4, 3, 1, 5, 3, 1, 1, 2, 1, 5, 2, 1, 5, 2,
+  1, 4, 1, 1, 4, 1, 1, 3, 1, 1, 4, 0, 1, 4, 2, 1, 4, 2, 1, 4, 0, 1, 5, 0,
+  1, 5, 2, 1, 5, 0, 3, 4, 0, 4, 1, 1, 2, 3, 1, 5, 0, 1, 4, 3, 1, 3, 1, 3,
+  3, 0, 4, 2, 1, 1, 2, 1, 5, 2, 1, 3, 2, 1, 3, 0, 1, 4, 3, 1, 3, 0, 1, 4,
+  2, 1, 4, 1, 1, 5, 0, 1, 5, 0, 1, 3, 3, 1, 5, 4, 1, 4, 2, 1, 4, 2, 1, 4,
+  1, 1, 5, 3, 1, 5, 4, 1, 5, 1, 1, 5, 3, 1, 4, 3, 1, 4, 2, 1, 1, 3, 1, 4,
+  4, 1, 3, 3, 1, 5, 3, 1, 4, 4, 1, 3, 3, 1, 4, 0, 1, 3, 4, 1, 3, 2, 1, 4,
+  2, 1, 3, 2, 1, 4, 3, 1, 5, 1, 1, 4, 3, 1, 4, 2, 1, 5, 4, 1, 5, 2, 1, 5,
+  1, 1, 4, 3, 1, 3, 2, 1, 5, 3, 1, 4, 4, 1, 4, 4, 1, 4, 1, 1, 4, 4, 1, 3,
+  2, 1, 5, 1, 1, 4, 1, 1, 4, 4, 1, 5, 1, 1, 4, 2, 1, 2, 3, 1, 5, 2, 1, 5,
+  2, 1, 3, 0, 1, 3, 2, 1, 3, 4, 1, 4, 2, 1, 3, 2, 1, 3, 2, 1, 5, 4, 1, 4,
+  3, 1, 1, 3, 1, 3, 3, 1, 5, 4, 1, 4, 4, 1, 4, 3, 1, 5, 3, 1, 3, 3, 1, 1,
+  3, 1, 1, 3, 1, 1, 3, 1, 4, 4, 1, 4, 3, 1, 4, 4, 1, 4, 4, 1, 2, 3, 1, 4,
+  3, 1, 3, 3, 1, 4, 3, 1, 3, 3, 1, 4, 3, 1, 4, 4, 1, 4, 3, 1, 5, 3, 1, 3,
+  3, 1, 3, 4, 1, 5, 4, 1, 3, 3, 1, 5, 3, 1, 4, 3, 1, 4, 4, 1, 3, 4, 1, 3,
+  3, 1, 3, 4, 1, 5, 3, 1, 4, 3, 1, 3, 4, 1, 2, 3, 1, 2, 3, 1, 3, 3, 1, 5,
+  3, 1, 4, 3, 1, 3, 3, 1, 4, 4, 1, 4, 4, 1, 5, 4, 1, 1, 3, 1, 4, 3, 1, 2,
+  3, 1, 3, 3, 1, 4, 4, 1, 1, 3, 1, 4, 4, 1, 5, 3, 1, 3, 3, 1, 1, 3, 1, 3,
+  4, 1, 3, 4, 1, 3, 3, 1, 4, 3, 1, 2, 3, 1, 4, 4, 1, 2, 4, 1, 2, 3, 1, 4,
+  3, 1, 4, 3, 1, 4, 3, 1, 2, 4, 1, 4, 3, 1, 4, 3, 1, 1, 3, 1, 1, 3, 1, 5,
+  3, 1, 5, 3, 1, 3, 4, 1, 3, 3, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 5,
+  2, 1, 5, 1, 1, 5, 1, 1, 5, 2, 1, 5, 3, 1, 5, 2, 1, 4, 2, 1, 5, 2, 1, 3,
+  3, 1, 4, 2, 1, 5, 4, 1, 4, 2, 1, 5, 2, 1, 3, 1, 1, 5, 3, 1, 5, 3, 1, 5,
+  2, 1, 3, 2, 1, 4, 2, 1, 5, 0, 1, 4, 1, 1, 5, 0, 2, 5, 5, 3, 1, 5, 2, 1,
+  5, 1, 2, 4, 5, 2, 1, 5, 2, 1, 5, 3, 1, 4, 4, 1, 5, 3, 1, 5, 2, 1, 3, 0,
+  1, 3, 2, 1, 3, 4, 1, 4, 1, 1, 3, 4, 1, 4, 2, 1, 3, 2, 1, 4, 3, 1, 5, 1,
+  1, 3, 2, 1, 4, 1, 1, 5, 1, 1, 5, 2, 1, 3, 2, 1, 4, 0, 1, 5, 5, 1, 5, 2,
+  1, 4, 3, 1, 3, 2, 1, 4, 5, 1, 4, 2, 1, 4, 2, 1, 5, 1, 1, 3, 2, 1, 3, 1,
+  1, 3, 2, 1, 5, 4, 1, 5, 4, 1, 3, 3, 1, 5, 2, 1, 3, 1, 1, 5, 4, 1, 4, 5,
+  1, 4, 2, 1, 5, 2, 1, 3, 1, 1, 5, 2, 1, 5, 2, 1, 3, 1, 1, 3, 1, 1, 5, 2,
+  1, 3, 1, 1, 5, 2, 1, 3, 4, 1, 5, 2, 1, 3, 2, 1, 3, 2, 1, 5, 2, 1, 3, 2,
+  1, 3, 2, 1, 3, 4, 1, 5, 2, 1, 3, 3, 1, 5, 1, 1, 5, 3, 1, 5, 2, 1, 3, 2,
+  1, 5, 2, 1, 4, 2, 1, 3, 2, 1, 5, 3, 1, 5, 3, 1, 4, 2, 1, 3, 2, 1, 5, 2,
+  1, 5, 3, 1, 4, 3, 1, 4, 5, 1, 5, 4, 1, 4, 3, 1, 4, 3, 1, 4, 2, 1, 5, 2,
+  1, 5, 3, 1, 5, 2, 1, 3, 4, 2, 5, 4, 2, 1, 5, 2, 1, 3, 0, 3, 3, 0, 3, 0,
+  4, 3, 0, 0, 5, 5, 1, 5, 0, 1, 5, 4, 1, 4, 3, 1, 3, 3, 1, 4, 3, 1, 5, 5,
+  1, 3, 5, 1, 3, 4, 1, 4, 3, 1, 5, 4, 1, 4, 0, 1, 3, 3, 1, 3, 2, 1, 5, 2,
+  1, 3, 3, 1, 4, 3, 1, 4, 3, 1, 5, 3, 1, 3, 3, 1, 4, 2, 1, 5, 3, 1, 5, 0,
+  1, 4, 3, 1, 5, 4, 1, 3, 0, 1, 4, 2, 1, 5, 0, 1, 3, 5, 1, 3, 3, 1, 5, 0,
+  1, 3, 2, 1, 5, 2, 1, 3, 2, 1, 3, 0, 1, 5, 0, 1, 3, 3, 1, 3, 1, 1, 5, 0,
+  1, 4, 0, 1, 4, 0, 1, 4, 3, 1, 3, 0, 1, 5, 2, 1, 3, 3, 1, 3, 3, 1, 5, 3,
+  1, 3, 4, 1, 3, 4, 1, 5, 0, 1, 5, 3, 1, 3, 0, 2, 4, 3, 0, 1, 5, 3, 1, 4,
+  4, 1, 5, 4, 1, 4, 2, 1, 5, 1, 1, 5, 1, 1, 4, 4, 1, 3, 2, 1, 5, 0, 1, 3,
+  3, 2, 5, 4, 2, 1, 5, 4, 1, 4, 2, 1, 4, 0, 2, 4, 5, 0, 1, 4, 3, 1, 5, 2,
+  1, 4, 5, 1, 4, 2, 1, 4, 2, 1, 5, 4, 1, 4, 3, 2, 5, 5, 0, 1, 3, 2, 1, 5,
+  5, 1, 5, 2, 1, 4, 3, 1, 3, 2, 1, 3, 3, 1, 3, 2, 1, 4, 0, 1, 3, 2, 1, 5,
+  4, 1, 5, 0, 1, 4, 0, 1, 3, 2, 1, 5, 3, 1, 5, 2, 1, 3, 4, 1, 5, 3, 1, 5,
+  0, 1, 4, 0, 1, 4, 3, 1, 4, 3, 1, 5, 2, 1, 5, 3, 1, 5, 3, 1, 3, 3, 1, 3,
+  3, 1, 5, 3, 1, 4, 3, 1, 4, 4, 1, 3, 3, 1, 5, 4, 1, 3, 1, 1, 5, 3, 1, 3,
+  1, 1, 4, 1, 1, 4, 4, 1, 5, 2, 1, 5, 1, 1, 5, 1, 1, 4, 1, 1, 4, 1, 1, 4,
+  1, 1, 4, 2, 1, 3, 3, 1, 5, 1, 1, 4, 2, 1, 4, 2, 1, 3, 2, 1, 3, 2, 1, 5,
+  1, 2, 4, 3, 0, 1, 5, 1, 1, 3, 2, 1, 5, 1, 1, 5, 2, 1, 5, 4, 1, 4, 5, 1,
+  4, 2, 1, 3, 1, 1, 3, 2, 1, 3, 1, 2, 4, 5, 1, 1, 3, 1, 2, 4, 3, 2, 1, 5,
+  2, 1, 4, 2, 1, 3, 2, 1, 5, 2, 1, 3, 2, 1, 5, 2, 2, 3, 3, 2, 1, 5, 1, 1,
+  5, 0, 1, 5, 2, 1, 5, 2, 1, 5, 1, 1, 4, 2, 1, 3, 2, 1, 5, 2, 1, 5, 2, 1,
+  5, 2, 1, 3, 2, 1, 5, 2, 1, 3, 3, 1, 3, 2, 1, 5, 2, 1, 5, 1, 1, 3, 1, 1,
+  4, 1, 1, 4, 2, 1, 3, 1, 1, 4, 2, 3, 5, 0, 5, 2, 1, 5, 4, 1, 3, 1, 4, 4,
+  3, 0, 3, 0, 1, 4, 2, 1, 4, 1, 1, 3, 3, 1, 5, 3, 1, 3, 2, 1, 5, 2, 1, 3,
+  2, 1, 5, 0, 1, 4, 2, 1, 3, 2, 1, 5, 2, 1, 3, 0, 1, 5, 1, 1, 3, 3, 1, 4,
+  2, 1, 3, 1, 1, 4, 2, 1, 4, 0, 1, 4, 0, 1, 5, 2, 1, 3, 3, 1, 3, 0, 1, 5,
+  2, 1, 5, 2, 1, 5, 2, 1, 5, 3, 1, 5, 1, 1, 5, 2, 1, 3, 2, 1, 5, 2, 1, 3,
+  2, 1, 4, 2, 3, 4, 0, 4, 5, 1, 4, 2, 1, 3, 2, 1, 5, 1, 1, 3, 1, 1, 5, 2,
+  1, 5, 4, 1, 4, 5, 1, 3, 1, 1, 5, 3, 1, 4, 2, 1, 5, 2, 1, 3, 2, 1, 5, 2,
+  1, 3, 2, 1, 5, 4, 1, 5, 2, 1, 5, 2, 1, 3, 4, 1, 3, 1, 1, 5, 4, 1, 4, 1,
+  1, 5, 2, 1, 3, 4, 1, 5, 3, 1, 5, 3, 1, 5, 2, 1, 3, 5, 1, 5, 5, 1, 3, 4,
+  1, 5, 1, 1, 5, 0, 2, 4, 3, 1, 1, 3, 1, 1, 3, 2, 1, 3, 0, 1, 5, 0, 1, 5,
+  2, 1, 5, 5, 1, 5, 3, 1, 4, 1, 1, 5, 3, 1, 3, 3, 1, 4, 2, 1, 5, 3, 1, 5,
+  4, 1, 5, 4, 1, 5, 4, 1, 5, 2, 1, 4, 2, 1, 5, 3, 1, 5, 2, 1, 3, 0, 1, 4,
+  3, 1, 4, 2, 1, 5, 2, 1, 5, 2, 1, 4, 2, 1, 5, 2, 1, 5, 0, 1, 5, 0, 1, 5,
+  1, 1, 3, 3, 1, 5, 4, 1, 5, 4, 1, 4, 5, 1, 5, 2, 1, 5, 3, 1, 5, 0, 1, 4,
+  0, 1, 3, 4, 1, 3, 3, 1, 4, 3, 1, 4, 0, 1, 5, 4, 1, 5, 1, 2, 5, 5, 3, 1,
+  4, 2, 1, 3, 2, 1, 5, 4, 1, 3, 3, 1, 4, 2, 1, 4, 1, 1, 5, 3, 1, 4, 3, 1,
+  5, 4, 1, 3, 3, 1, 4, 4, 1, 5, 1, 1, 5, 3, 1, 4, 5, 1, 4, 4, 1, 4, 3, 1,
+  3, 3, 1, 3, 1, 1, 5, 3, 1, 5, 3, 1, 5, 2, 1, 5, 4, 1, 3, 2, 1, 5, 5, 1,
+  3, 3, 1, 5, 3, 1, 3, 2, 1, 4, 3, 1, 5, 1, 1, 4, 1, 1, 4, 2, 1, 3, 2, 1,
+  5, 2, 1, 5, 2, 1, 5, 1, 1, 4, 1, 1, 4, 2, 1, 5, 2, 1, 3, 2, 2, 4, 3, 2,
+  1, 3, 2, 1, 5, 3, 1, 3, 2, 1, 5, 3, 1, 4, 3, 1, 5, 1, 1, 3, 2, 1, 5, 3,
+  1, 5, 0, 1, 4, 2, 1, 3, 4, 1, 3, 1, 1, 4, 3, 1, 5, 2, 1, 4, 3, 1, 5, 2,
+  1, 3, 3, 1, 5, 2, 1, 5, 3, 1, 5, 1, 1, 5, 2, 1, 3, 5, 1, 4, 2, 1, 3, 1,
+  1, 5, 2, 1, 5, 2, 1, 3, 3, 1, 3, 2, 1, 5, 2, 1, 3, 2, 3, 3, 0, 3, 3, 1,
+  4, 3, 1, 5, 3, 1, 3, 2, 1, 4, 0, 1, 5, 2, 1, 5, 2, 1, 3, 3, 1, 5, 5, 1,
+  4, 2, 1, 4, 5, 1, 4, 2, 1, 4, 2, 1, 4, 3, 1, 4, 3, 1, 4, 2, 1, 3, 1, 1,
+  5, 2, 1, 3, 0, 2, 5, 5, 2, 1, 5, 1, 1, 4, 1, 1, 4, 2, 1, 3, 2, 1, 3, 2,
+  1, 3, 1, 2, 4, 3, 2, 1, 5, 1, 1, 5, 2, 2, 3, 3, 0, 1, 5, 0, 1, 4, 1, 1,
+  3, 3, 1, 4, 3, 1, 3, 3, 1, 4, 3, 1, 5, 3, 1, 4, 2, 1, 5, 0, 1, 4, 2, 1,
+  4, 2, 1, 4, 2, 1, 4, 0, 1, 5, 4, 1, 5, 2, 1, 5, 0, 1, 5, 2, 1, 4, 0, 1,
+  5, 2, 1, 4, 0, 1, 4, 3, 1, 5, 3, 1, 3, 2, 1, 4, 3, 1, 4, 3, 1, 3, 3, 1,
+  3, 1, 1, 5, 2, 1, 5, 2, 1, 3, 3, 1, 5, 0, 1, 3, 3, 1, 3, 1, 2, 3, 3, 0,
+  1, 5, 2, 1, 5, 3, 1, 5, 3, 1, 5, 4, 1, 5, 2, 1, 5, 5, 1, 5, 5, 1, 4, 4,
+  1, 3, 1, 1, 5, 3, 1, 3, 3, 1, 5, 2, 1, 3, 2, 1, 5, 3, 1, 4, 3, 1, 4, 0,
+  1, 5, 3, 1, 5, 3, 1, 3, 2, 1, 5, 3, 1, 4, 2, 1, 5, 2, 1, 3, 1, 2, 4, 3,
+  0, 1, 5, 2, 1, 3, 3, 1, 5, 3, 1, 5, 3, 1, 4, 5, 1, 5, 3, 1, 4, 1, 1, 5,
+  0, 1, 3, 3, 1, 3, 2, 1, 5, 2, 1, 3, 0, 1, 3, 1, 2, 5, 5, 1, 1, 5, 1, 1,
+  4, 3, 1, 4, 3, 1, 5, 3, 1, 5, 3, 1, 5, 3, 1, 5, 4, 1, 3, 2, 1, 3, 5, 1,
+  4, 2, 1, 3, 0, 1, 4, 2, 1, 5, 5, 1, 5, 4, 1, 5, 5, 1, 4, 2, 1, 5, 3, 1,
+  3, 1, 1, 4, 4, 2, 5, 4, 5, 1, 3, 2, 1, 5, 2, 1, 5, 5, 1, 4, 3, 1, 4, 3,
+  1, 5, 2, 1, 3, 3, 1, 3, 1, 1, 4, 1, 1, 5, 1, 1, 5, 1, 1, 3, 2, 1, 4, 3,
+  1, 5, 4, 1, 5, 1, 1, 4, 0, 1, 3, 3, 2, 4, 4, 1, 1, 5, 1, 1, 3, 2, 1, 3,
+  0, 1, 5, 3, 1, 4, 0, 1, 3, 1, 1, 3, 1, 1, 5, 3, 1, 3, 2, 1, 3, 4, 1, 5,
+  0, 1, 3, 1, 2, 5, 5, 3, 1, 4, 1, 1, 5, 3, 1, 5, 3, 3, 3, 0, 3, 4, 1, 4,
+  5, 1, 4, 4, 1, 3, 3, 1, 4, 1, 1, 3, 1, 2, 4, 3, 3, 1, 3, 3, 1, 4, 1, 2,
+  5, 5, 4, 1, 5, 2, 1, 5, 1, 1, 3, 1, 1, 4, 2, 1, 3, 0, 1, 5, 2, 1, 3, 1,
+  1, 5, 2, 1, 5, 2, 1, 5, 4, 1, 4, 1, 1, 4, 1, 1, 5, 0, 1, 3, 3, 1, 3, 2,
+  1, 3, 2, 1, 5, 2, 1, 5, 2, 1, 3, 5, 1, 4, 1, 1, 3, 1, 1, 3, 2, 1, 5, 2,
+  1, 3, 2, 1, 3, 1, 1, 5, 1, 1, 5, 4, 1, 4, 2, 1, 3, 2, 1, 3, 2, 1, 3, 2,
+  1, 3, 1, 1, 5, 3, 1, 4, 5, 1, 5, 0, 1, 3, 2, 1, 5, 2, 1, 3, 2, 1, 4, 2,
+  1, 3, 5, 1, 4, 5, 1, 4, 5, 1, 5, 0, 1, 3, 1, 1, 5, 1, 1, 5, 2, 1, 3, 1,
+  1, 4, 1, 1, 5, 3, 1, 5, 2, 1, 3, 2, 1, 3, 2, 1, 3, 3, 1, 5, 2, 1, 3, 2,
+  1, 3, 1, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 3, 2,
+  1, 5, 1, 1, 3, 2, 1, 3, 4, 1, 5, 4, 1, 3, 2, 1, 4, 5, 1, 4, 2, 1, 3, 2,
+  1, 5, 0, 1, 5, 1, 1, 3, 3, 1, 3, 3, 1, 4, 3, 1, 5, 3, 1, 5, 3, 1, 4, 2,
+  1, 5, 2, 1, 5, 4, 1, 4, 5, 1, 4, 3, 1, 4, 4, 1, 4, 2, 1, 4, 3, 1, 4, 1,
+  1, 4, 1, 1, 4, 5, 1, 5, 3, 1, 3, 2, 1, 5, 2, 1, 5, 4, 1, 5, 3, 1, 3, 2,
+  1, 4, 2, 1, 5, 0, 1, 3, 0, 1, 5, 2, 1, 4, 2, 1, 5, 4, 1, 5, 3, 1, 5, 4,
+  1, 4, 0, 1, 5, 4, 1, 5, 3, 1, 5, 4, 1, 4, 0, 1, 5, 3, 1, 5, 3, 1, 3, 3,
+  1, 4, 1, 1, 3, 0, 1, 3, 4, 2, 4, 3, 4, 1, 3, 1, 1, 3, 4, 1, 3, 3, 1, 3,
+  4, 1, 4, 3, 1, 5, 3, 1, 3, 4, 1, 5, 3, 1, 4, 3, 1, 3, 0, 1, 3, 3, 1, 5,
+  0, 1, 4, 2, 1, 5, 3, 1, 3, 2, 1, 5, 1, 1, 5, 3, 1, 4, 3, 1, 4, 2, 1, 3,
+  2, 1, 5, 2, 1, 4, 2, 1, 3, 3, 1, 5, 2, 1, 4, 3, 1, 3, 1, 3, 4, 0, 4, 3,
+  1, 4, 2, 1, 5, 2, 1, 4, 2, 1, 3, 2, 1, 4, 2, 3, 4, 0, 4, 2, 1, 3, 2, 1,
+  5, 2, 1, 4, 3, 1, 3, 2, 1, 5, 2, 1, 3, 3, 1, 5, 0, 1, 5, 2, 1, 4, 3, 1,
+  5, 2, 1, 3, 2, 1, 3, 3, 1, 5, 3, 1, 3, 0, 1, 5, 3, 1, 4, 0, 1, 5, 4, 1,
+  5, 2, 3, 3, 0, 3, 3, 1, 3, 3, 1, 5, 3, 1, 5, 3, 1, 3, 2, 1, 4, 2, 1, 5,
+  2, 1, 5, 2, 1, 3, 2, 1, 5, 2, 1, 5, 0, 1, 5, 3, 1, 4, 2, 2, 5, 4, 3, 1,
+  4, 2, 1, 3, 3, 1, 3, 2, 1, 4, 3, 1, 5, 1, 1, 5, 2, 1, 5, 2, 1, 3, 3, 1,
+  4, 3, 1, 5, 3, 1, 4, 2, 1, 5, 5, 1, 4, 4, 1, 4, 1, 1, 4, 4, 1, 3, 4, 1,
+  4, 1, 1, 4, 1, 1, 4, 3, 1, 3, 3, 1, 4, 4, 1, 5, 4, 1, 4, 2, 1, 5, 1, 1,
+  5, 0, 1, 5, 3, 1, 3, 5, 1, 4, 3, 1, 4, 0, 3, 5, 0, 3, 2, 1, 5, 4, 2, 4,
+  5, 0, 5, 5, 0, 0, 0, 4, 0, 1, 4, 2, 1, 4, 3, 1, 5, 1, 1, 5, 1, 1, 5, 0,
+  1, 4, 0, 1, 4, 0, 1, 4, 3, 1, 3, 2, 1, 5, 5, 1, 5, 0, 1, 5, 0, 1, 3, 2,
+  1, 5, 0, 1, 4, 0, 1, 5, 4, 1, 5, 0, 1, 3, 2, 1, 5, 2, 1, 5, 5, 1, 5, 5,
+  1, 3, 0, 1, 5, 4, 2, 5, 4, 2, 1, 4, 2, 1, 3, 1, 1, 5, 4, 1, 4, 0, 1, 3,
+  2, 1, 5, 1, 1, 5, 1, 1, 4, 3, 1, 4, 2, 1, 5, 4, 1, 5, 4, 1, 4, 0, 1, 5,
+  0, 1, 5, 1, 1, 5, 4, 1, 5, 0, 1, 5, 2, 1, 3, 0, 1, 5, 4, 1, 3, 0, 1, 5,
+  0, 1, 3, 1, 1, 4, 1, 1, 4, 1, 1, 4, 2, 1, 5, 3, 1, 5, 3, 1, 5, 2, 1, 5,
+  3, 1, 4, 5, 1, 3, 2, 1, 5, 2, 1, 3, 0, 1, 4, 2, 1, 4, 3, 1, 4, 3, 1, 5,
+  4, 1, 4, 2, 1, 5, 3, 1, 3, 0, 1, 3, 0, 1, 4, 3, 1, 3, 1, 1, 3, 4, 1, 5,
+  2, 1, 3, 3, 1, 5, 3, 1, 3, 2, 1, 5, 2, 1, 5, 0, 1, 5, 2, 1, 5, 2, 1, 4,
+  3, 1, 5, 0, 1, 3, 2, 1, 3, 0, 1, 3, 1, 1, 5, 2, 1, 3, 2, 1, 3, 3, 1, 5,
+  2, 1, 3, 3, 1, 5, 5, 1, 4, 4, 1, 5, 0, 1, 4, 3, 1, 5, 4, 1, 5, 0, 1, 4,
+  3, 1, 3, 2, 1, 4, 3, 1, 3, 1, 1, 4, 1, 2, 4, 5, 1, 1, 3, 2, 1, 5, 2, 1,
+  3, 2, 1, 3, 3, 1, 4, 3, 1, 4, 3, 1, 3, 3, 1, 5, 1, 1, 5, 0, 1, 5, 2, 1,
+  3, 2, 1, 3, 2, 1, 5, 2, 1, 4, 2, 3, 4, 0, 4, 2, 1, 4, 3, 1, 5, 5, 1, 3,
+  2, 1, 4, 1, 2, 4, 3, 4, 1, 5, 2, 1, 5, 3, 1, 3, 2, 1, 4, 4, 1, 5, 2, 1,
+  3, 3, 1, 5, 3, 1, 5, 2, 1, 4, 3, 1, 5, 2, 1, 5, 2, 1, 3, 2, 1, 4, 2, 1,
+  4, 4, 1, 4, 1, 1, 3, 2, 1, 3, 3, 1, 5, 2, 1, 5, 2, 1, 5, 3, 1, 3, 3, 1,
+  3, 1, 1, 5, 1, 1, 4, 1, 1, 3, 1, 1, 4, 0, 1, 5, 3, 1, 3, 0, 1, 3, 3, 1,
+  3, 3, 1, 4, 3, 1, 3, 2, 1, 5, 0, 1, 5, 0, 2, 4, 3, 0, 1, 5, 0, 1, 5, 0,
+  1, 5, 1, 2, 3, 3, 3, 1, 3, 3, 1, 5, 0, 1, 4, 2, 1, 5, 2, 1, 5, 5, 1, 3,
+  3, 1, 4, 2, 1, 5, 5, 1, 4, 2, 1, 5, 4, 1, 4, 5, 1, 5, 2, 1, 3, 2, 1, 5,
+  2, 1, 3, 1, 1, 3, 3, 1, 5, 4, 1, 5, 3, 1, 3, 3, 1, 4, 5, 1, 5, 3, 1, 5,
+  4, 1, 4, 3, 1, 5, 3, 1, 3, 4, 1, 5, 3, 1, 4, 4, 1, 5, 3, 1, 3, 3, 1, 3,
+  4, 1, 4, 5, 1, 5, 4, 1, 3, 3, 1, 3, 5, 1, 3, 3, 1, 4, 4, 2, 3, 4, 3, 1,
+  5, 4, 1, 5, 3, 1, 3, 4, 1, 3, 5, 1, 3, 3, 1, 3, 3, 1, 4, 5, 1, 5, 4, 1,
+  5, 4, 1, 5, 4, 2, 5, 5, 4, 1, 5, 4, 1, 5, 4, 1, 3, 4, 1, 3, 3, 1, 3, 3,
+  1, 5, 3, 1, 5, 3, 1, 4, 3, 1, 5, 4, 1, 5, 4, 1, 3, 4, 1, 4, 4, 1, 5, 4,
+  1, 5, 4, 1, 5, 4, 1, 3, 5, 1, 5, 5, 1, 5, 5, 1, 4, 4, 2, 5, 5, 5, 1, 4,
+  4, 1, 5, 4, 1, 4, 4, 1, 5, 4, 1, 5, 3, 1, 3, 3, 1, 5, 4, 1, 5, 2, 3, 5,
+  0, 5, 2, 2, 5, 5, 1, 1, 4, 1, 1, 4, 2, 1, 5, 1, 1, 4, 2, 1, 5, 1, 1, 5,
+  2, 1, 5, 2, 1, 4, 2, 1, 5, 2, 1, 5, 1, 1, 5, 2, 1, 5, 3, 1, 5, 3, 1, 5,
+  3, 1, 4, 4, 1, 5, 4, 1, 5, 3, 1, 5, 6, 1, 5, 3, 3, 5, 0, 5, 0, 1, 5, 2,
+  2, 5, 5, 0, 1, 5, 0, 1, 5, 0, 1, 5, 3, 1, 4, 3, 1, 5, 2, 1, 4, 5, 1, 5,
+  4, 1, 5, 2, 1, 4, 4, 1, 5, 0, 1, 5, 2, 1, 5, 2, 1, 5, 1, 1, 4, 4, 1, 5,
+  1, 1, 4, 2, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 5, 5, 1, 5, 4, 1, 4, 3, 1, 5,
+  0, 1, 4, 2, 1, 5, 0, 1, 4, 2, 1, 5, 1, 1, 4, 1, 1, 4, 1, 1, 4, 1, 1, 4,
+  1, 1, 4, 2, 1, 5, 2, 1, 5, 4, 1, 4, 2, 1, 5, 6, 1, 5, 1, 1, 5, 2, 1, 5,
+  0, 1, 4, 4, 1, 5, 4, 1, 5, 0, 1, 4, 0, 1, 5, 0, 1, 4, 4, 1, 5, 4, 1, 5,
+  3, 1, 5, 3, 1, 4, 4, 1, 5, 3, 1, 5, 3, 1, 5, 2, 1, 4, 4, 1, 4, 1, 1, 5,
+  0, 1, 5, 5, 1, 5, 3, 1, 4, 6, 1, 4, 2, 1, 5, 3, 1, 5, 0, 1, 4, 1, 1, 4,
+  0, 1, 4, 1, 1, 5, 0, 1, 4, 3, 1, 4, 3, 1, 4, 3, 1, 4, 4, 1, 5, 0, 1, 5,
+  4, 1, 5, 0, 1, 5, 1, 2, 5, 5, 6, 1, 5, 2, 1, 4, 1, 1, 5, 0, 1, 5, 0, 1,
+  4, 0, 1, 5, 2, 1, 5, 3, 1, 5, 1, 1, 5, 3, 1, 4, 1, 1, 5, 2, 1, 5, 3, 1,
+  4, 3, 1, 4, 3, 1, 5, 3, 1, 5, 5, 1, 5, 2, 1, 5, 0, 5, 5, 0, 0, 5, 5, 2,
+  1, 4, 4, 1, 5, 5, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 5, 4, 1, 5, 4, 1, 5, 1,
+  1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 5, 2, 1, 5, 0, 1, 5, 0, 1, 4, 2, 1, 5, 2,
+  1, 5, 2, 1, 5, 0, 1, 4, 2, 1, 5, 1, 1, 5, 5, 1, 4, 3, 1, 5, 4, 1, 5, 4,
+  1, 4, 4, 1, 5, 3, 1, 5, 0, 1, 5, 2, 1, 4, 4, 1, 5, 4, 1, 5, 3, 1, 4, 0,
+  1, 5, 2, 1, 4, 4, 1, 5, 3, 1, 5, 4, 1, 5, 3, 1, 4, 3, 1, 4, 6, 1, 4, 2,
+  1, 5, 1, 1, 5, 3, 1, 5, 2, 1, 5, 2, 1, 4, 4, 1, 5, 2, 1, 5, 2, 1, 5, 2,
+  1, 5, 1, 3, 5, 0, 5, 3, 1, 5, 3, 1, 5, 1, 1, 5, 3, 1, 5, 3, 1, 5, 1, 1,
+  4, 3, 1, 5, 3, 1, 5, 6, 1, 4, 5, 1, 5, 0, 1, 5, 1, 1, 5, 5, 1, 4, 6, 1,
+  4, 5, 1, 5, 0, 1, 5, 2, 1, 5, 3, 1, 4, 3, 1, 4, 3, 1, 5, 4, 1, 5, 0, 1,
+  5, 0, 1, 5, 4, 1, 5, 3, 1, 5, 4, 1, 5, 4, 1, 5, 2, 1, 5, 3, 1, 4, 4, 1,
+  4, 4, 1, 4, 3, 1, 5, 4, 3, 5, 0, 5, 3, 1, 5, 0, 1, 5, 3, 1, 5, 3, 1, 5,
+  3, 1, 4, 2, 1, 4, 6, 1, 5, 3, 1, 4, 2, 1, 5, 3, 1, 5, 5, 1, 5, 3, 1, 5,
+  3, 1, 5, 5, 1, 4, 3, 1, 5, 4, 1, 5, 2, 1, 4, 6, 1, 5, 4, 1, 5, 3, 1, 4,
+  5, 1, 5, 3, 1, 4, 6, 1, 5, 3, 1, 5, 4, 1, 4, 4, 1, 4, 5, 1, 5, 4, 1, 5,
+  3, 1, 4, 6, 1, 5, 3, 3, 5, 0, 5, 5, 1, 5, 5, 1, 5, 4, 1, 5, 3, 1, 5, 4,
+  1, 5, 4, 1, 5, 3, 1, 5, 5, 1, 5, 5, 1, 5, 3, 1, 5, 4, 1, 5, 3, 1, 5, 3,
+  1, 5, 3, 1, 5, 4, 1, 5, 4, 1, 5, 6, 1, 5, 4, 1, 4, 2, 1, 5, 1, 1, 5, 5,
+  1, 5, 2, 1, 5, 2, 2, 5, 5, 1, 1, 5, 0, 1, 5, 6, 1, 5, 2, 1, 5, 2, 1, 5,
+  3, 1, 5, 0, 1, 5, 2, 1, 5, 2, 1, 5, 4, 1, 5, 4, 1, 5, 3, 1, 5, 2, 1, 5,
+  0, 1, 5, 5, 1, 5, 2, 1, 5, 6, 1, 5, 3, 1, 5, 3, 1, 5, 0, 1, 5, 0, 1, 5,
+  3, 1, 5, 2, 4, 10, 10, 10, 10, 6, 1, 5, 2, 4, 10, 10, 10, 10, 4, 1, 5, 2, 4, 10,
+  10, 10, 10, 7, 1, 5, 2, 4, 10, 10, 10, 10, 2, 4, 10, 10, 10, 10, 2, 4, 10, 10, 10, 10,
+  2, 4, 10, 10, 10, 10, 2, 4, 10, 10, 10, 10, 4, 1, 5, 2, 4, 10, 10, 11, 10, 2, 4, 10,
+  10, 10, 10, 2, 4, 10, 10, 10, 10, 2, 4, 10, 10, 10, 10, 2, 4, 10, 10, 10, 10, 2, 4, 10,
+  10, 11, 10, 2, 4, 10, 10, 11, 10, 2, 4, 10, 10, 11, 10, 3, 1, 5, 2, 4, 10, 11, 10, 10,
+  2, 4, 10, 11, 10, 10, 2, 4, 10, 10, 11, 10, 2, 4, 10, 10, 10, 10, 2, 4, 10, 11, 10, 10,
+  5, 1, 5, 2, 4, 10, 10, 11, 10, 2, 4, 10, 10, 10, 10, 2, 4, 10, 10, 10, 10, 1, 1, 5,
+  2, 1, 5, 2, 1, 5, 0, 1, 5, 0, 1, 5, 3, 1, 5, 2, 5, 10, 10, 11, 10, 10, 2, 5,
+  10, 10, 10, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11,
+  10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2,
+  5, 10, 10, 10, 11, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 11, 10, 10, 10, 2, 5, 10, 10,
+  11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11, 10, 10,
+  2, 5, 10, 11, 10, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10,
+  11, 10, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11, 10, 11, 2, 5, 10, 10, 11, 10,
+  10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 10, 11, 10, 2, 5, 10, 11, 10, 10, 10, 2, 5,
+  10, 10, 11, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11,
+  10, 10, 2, 5, 10, 11, 10, 10, 10, 2, 5, 10, 11, 10, 11, 10, 2, 5, 10, 10, 10, 11, 10, 2,
+  5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10,
+  11, 10, 10, 6, 1, 5, 2, 5, 10, 11, 10, 10, 10, 2, 5, 10, 11, 10, 10, 10, 2, 5, 10, 11,
+  10, 10, 10, 2, 5, 10, 11, 10, 10, 10, 2, 5, 10, 10, 10, 11, 10, 2, 5, 10, 10, 11, 10, 10,
+  2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10,
+  10, 10, 11, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 11, 10, 2, 5, 10, 10, 11, 10,
+  10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 10, 11, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5,
+  10, 10, 10, 10, 10, 2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 11,
+  10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 10, 11, 10, 2, 5, 10, 10, 11, 10, 10, 2,
+  5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 11, 10, 10, 2, 6, 10, 10,
+  11, 11, 10, 10, 2, 6, 10, 11, 11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 11, 10, 2, 6, 10, 11,
+  10, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 11,
+  10, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 10, 11, 10, 2, 6, 10, 10, 10, 10, 11, 10, 2, 6, 10, 10,
+  10, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 11, 10, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 11,
+  10, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 11,
+  10, 11, 11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 11,
+  10, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 10, 11, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 11,
+  10, 10, 11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 11,
+  10, 10, 11, 10, 2, 6, 10, 11, 10, 11, 10, 10, 2, 6, 10, 11, 10, 10, 10, 10, 2, 6, 10, 10,
+  11, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10, 11, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 11,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 11,
+  10, 10, 11, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 11, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 11, 10, 10, 11, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 11, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  11, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 11, 10, 10, 11, 11, 2, 6, 10, 11, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  10, 10, 10, 10, 2, 6, 10, 10, 10, 11, 11, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 11, 10, 10, 2, 6, 10, 11, 10, 10, 10, 10, 2, 6, 10, 11, 10, 10, 10, 10, 2, 6, 10, 11,
+  10, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 11,
+  10, 10, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10,
+  10, 10, 11, 10, 2, 6, 10, 10, 10, 11, 11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10,
+  10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  11, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10,
+  10, 10, 10, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 11, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2,
+  7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11,
+  11, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 10, 10, 10, 10, 2, 7, 10, 11,
+  10, 10, 11, 10, 10, 2, 7, 11, 10, 10, 10, 10, 11, 10, 2, 7, 10, 11, 10, 10, 10, 11, 10, 2,
+  7, 10, 11, 10, 10, 11, 11, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10,
+  10, 10, 2, 7, 10, 11, 10, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10,
+  11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2,
+  7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 11, 10,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 10, 10, 10, 10, 2, 7, 10, 11,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 10, 10, 10, 2,
+  7, 10, 10, 11, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 11,
+  10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2,
+  7, 10, 11, 10, 10, 10, 11, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  11, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2,
+  7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 11, 10, 10, 2,
+  7, 10, 11, 10, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 11,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 11, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2,
+  7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 10,
+  11, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 10,
+  11, 10, 11, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 11, 10, 10, 11, 10, 2,
+  7, 10, 11, 11, 10, 10, 11, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2,
+  7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 11, 10, 11, 10, 11, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 11,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2,
+  7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 11,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11,
+  10, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2,
+  7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 11,
+  10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2,
+  7, 10, 11, 10, 10, 11, 11, 10, 2, 7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 10, 11, 11, 10,
+  10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11,
+  10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2,
+  7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10,
+  10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10,
+  11, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2,
+  7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10,
+  10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2,
+  7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 11,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10,
+  11, 10, 11, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 11, 11, 10, 10, 10, 2,
+  7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11,
+  10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 11, 10, 2, 7, 10, 11, 10, 10, 11, 11, 10, 2, 7, 10, 11, 10, 10, 10, 11, 11, 2,
+  7, 10, 10, 11, 10, 11, 10, 10, 2, 7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 11,
+  10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 10, 10, 10, 10, 2, 7, 10, 10,
+  10, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2,
+  7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 10, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 10,
+  11, 10, 11, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 11, 10, 10, 10, 2,
+  7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 10, 10, 10, 10, 2, 7, 10, 11, 10, 10, 10,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 11,
+  10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 11, 10, 2,
+  7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 11, 10, 10, 10, 11, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2,
+  7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 10, 11,
+  10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10,
+  11, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 11, 10, 10, 2,
+  7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 10, 10, 11, 11, 10, 10, 2, 7, 10, 10,
+  10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 11, 10, 10, 11, 10, 2,
+  7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 11, 10, 11, 10, 2, 7, 10, 10, 10, 11, 10,
+  10, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 10, 10, 10, 11, 10, 10, 2, 7, 10, 10,
+  10, 10, 10, 11, 10, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 11, 10, 10, 10,
+  2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 11,
+  10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 11, 10, 10, 11, 10, 2, 8, 10, 11, 10, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 10, 11, 11, 10, 10, 10, 2, 8, 11, 10, 10, 10, 11, 10, 10, 10, 2, 8,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 10,
+  10, 11, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10,
+  2, 8, 10, 11, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11,
+  10, 10, 11, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10,
+  10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10,
+  11, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10,
+  2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 11, 10, 2, 8, 10, 10,
+  11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 11, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8,
+  10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10,
+  11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10,
+  2, 8, 10, 11, 10, 11, 10, 11, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11,
+  10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 11, 10,
+  10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 11,
+  10, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10,
+  2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10,
+  10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10,
+  10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8,
+  10, 10, 10, 11, 11, 10, 10, 10, 2, 8, 10, 11, 10, 11, 11, 10, 10, 10, 2, 8, 10, 11, 10, 11,
+  11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10,
+  2, 8, 10, 10, 10, 11, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 11, 10, 10, 10, 2, 8, 10, 10,
+  11, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 11, 10, 10,
+  11, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8,
+  10, 11, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10,
+  2, 8, 10, 10, 10, 11, 11, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10,
+  11, 10, 10, 10, 11, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 11, 10,
+  10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 11, 11, 10, 10, 2, 8,
+  10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10,
+  10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10,
+  2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10,
+  10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10,
+  11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10,
+  2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11,
+  10, 10, 10, 10, 11, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11,
+  11, 10, 2, 8, 10, 10, 11, 10, 10, 10, 11, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8,
+  10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10,
+  11, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10,
+  2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10,
+  10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10,
+  10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8,
+  10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10,
+  2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10,
+  11, 11, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 11, 10, 11, 10, 11,
+  10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 11, 10, 2, 8,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11,
+  10, 10, 11, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10,
+  2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10,
+  10, 11, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11,
+  10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8,
+  10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10,
+  10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 11, 11, 10, 10,
+  2, 8, 10, 10, 11, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10,
+  10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10,
+  10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8,
+  10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 10,
+  11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10,
+  2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10,
+  11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 11, 11, 10, 10, 11, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8,
+  10, 10, 11, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10,
+  2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 11, 10, 2, 8, 10, 11,
+  10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8,
+  10, 11, 10, 10, 10, 11, 11, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10,
+  11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10,
+  2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 11, 10, 2, 8, 10, 10,
+  10, 11, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11,
+  10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 11, 10, 2, 8,
+  10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11,
+  10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 11, 10,
+  2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10,
+  10, 11, 10, 10, 11, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 10,
+  10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 10, 11, 10, 10, 10, 2, 8,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 10, 10, 10, 2, 8, 10, 11, 10, 10,
+  10, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 10, 11, 10, 2, 8, 10, 11, 10, 10, 10, 10, 10, 10,
+  2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10,
+  11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8,
+  10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 11, 10, 10, 10, 10,
+  2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 11, 10, 2, 8, 10, 10,
+  10, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10,
+  10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 11, 10, 10, 2, 8,
+  10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10,
+  11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10,
+  2, 8, 10, 10, 11, 10, 11, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10,
+  10, 11, 11, 10, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11,
+  10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 11, 10,
+  10, 11, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 11, 10,
+  2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10,
+  10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 10, 11, 10, 10, 10, 2, 8,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 11,
+  10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 11,
+  10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10,
+  10, 2, 9, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2,
+  9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 11, 11, 10, 10, 2, 9, 10,
+  10, 10, 10, 11, 11, 11, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10, 11, 10,
+  10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 9, 10, 11, 10, 10, 11,
+  10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10,
+  10, 10, 2, 9, 11, 10, 10, 10, 10, 11, 11, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 11, 10, 10,
+  2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 9,
+  10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 9, 10, 11,
+  10, 10, 11, 10, 10, 11, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10,
+  10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11,
+  10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11,
+  10, 2, 9, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2,
+  9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 11, 10, 10, 2, 9, 10,
+  10, 11, 10, 10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10,
+  11, 10, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10,
+  10, 10, 11, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10,
+  10, 10, 2, 9, 10, 10, 10, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+  2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 9,
+  10, 10, 11, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11,
+  10, 10, 10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10,
+  10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10,
+  11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 10,
+  10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2,
+  9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 9, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11,
+  10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11,
+  10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10,
+  10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10,
+  2, 9, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10, 10, 11, 11, 10, 11, 10, 10, 10, 2, 9,
+  10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10,
+  11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10,
+  10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 11, 11, 10,
+  10, 10, 10, 2, 9, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 11, 10,
+  10, 2, 9, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2,
+  9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 9, 10,
+  11, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 11, 10, 10, 2, 9, 10, 11, 10,
+  10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10,
+  10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 11,
+  10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+  2, 9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 9,
+  10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 11,
+  10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10,
+  10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10,
+  10, 11, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10,
+  10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2,
+  9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10,
+  11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10,
+  11, 10, 10, 10, 11, 10, 2, 9, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10,
+  10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10,
+  11, 10, 2, 9, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 11, 10, 10, 11, 10, 10,
+  2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9,
+  10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10, 10,
+  11, 10, 11, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 11,
+  10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10,
+  10, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10,
+  10, 2, 9, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2,
+  9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 11, 10, 10, 10, 10, 10, 2, 9, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 11, 10,
+  10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10,
+  10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 11,
+  10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10,
+  2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 11,
+  10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11,
+  10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10,
+  11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10,
+  10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2,
+  9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 11, 10,
+  10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 11,
+  10, 10, 11, 10, 2, 9, 10, 10, 11, 10, 10, 11, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10,
+  11, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 11, 10, 2, 9, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+  2, 9, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9,
+  10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 10,
+  10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11,
+  10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10,
+  10, 11, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10,
+  10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2,
+  9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 9, 10,
+  10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11,
+  10, 11, 10, 10, 11, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10,
+  10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10,
+  10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 11, 10, 10,
+  2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9,
+  10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10,
+  11, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10,
+  10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 10, 10,
+  10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 11, 10, 11, 10, 10,
+  10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 11, 10, 2,
+  9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10,
+  10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 11,
+  10, 10, 11, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10, 10, 11, 11, 10, 10, 10, 10, 10,
+  2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 9,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 10,
+  10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10,
+  10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10,
+  11, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 11,
+  10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2,
+  9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11,
+  11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 10, 10, 11, 11, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 11, 10,
+  2, 9, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 9,
+  10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10,
+  10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11,
+  10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10,
+  11, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 10,
+  10, 2, 9, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2,
+  9, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 9, 10,
+  11, 10, 10, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10,
+  10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+  2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10,
+  10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11,
+  10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10,
+  10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10,
+  10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 11, 10, 2,
+  9, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 2, 10,
+  10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 11, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 11, 11, 10, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 2, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 11, 11, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 11, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 11, 10, 10, 10, 11, 11, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 10,
+  10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 10,
+  10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 10,
+  10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10,
+  10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 11,
+  10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+  2, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10,
+  10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10,
+  11, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10,
+  10, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 11, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2,
+  11, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10,
+  10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 11,
+  10, 10, 10, 2, 11, 10, 10, 11, 11, 10, 10, 10, 10, 10, 11, 10, 2, 11, 10, 10, 10, 10, 11, 10,
+  10, 10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 11,
+  10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 11,
+  10, 10, 11, 10, 10, 11, 10, 11, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+  2, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 10, 10, 11, 11, 10, 10,
+  10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 11, 10, 11, 10,
+  10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10,
+  10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 2, 11, 10, 10, 11,
+  10, 10, 10, 11, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10,
+  11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2,
+  11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10,
+  10, 2, 11, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 10,
+  10, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 10, 10,
+  11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 11,
+  10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 11, 10, 10,
+  11, 10, 11, 10, 11, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11,
+  10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+  2, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 11, 10, 11, 10, 11, 10, 10, 10, 11, 11,
+  10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 11, 10, 10,
+  10, 10, 11, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 10, 10,
+  11, 10, 10, 10, 10, 10, 2, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10,
+  10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2,
+  11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10,
+  10, 2, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10,
+  11, 10, 10, 2, 11, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10,
+  10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11,
+  10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 11, 10, 11,
+  10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 2, 11,
+  10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10,
+  2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+  10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10,
+  11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 11,
+  10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 2, 11, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2,
+  11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 11,
+  10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 11,
+  10, 10, 10, 2, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11,
+  11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11,
+  10, 10, 11, 10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10,
+  10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 11,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10,
+  2, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10,
+  10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10,
+  11, 11, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 11, 10,
+  10, 11, 10, 10, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 11, 10, 11, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 11, 10, 2, 11, 10,
+  10, 10, 11, 11, 10, 10, 11, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2,
+  11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10,
+  10, 2, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 10, 10, 11, 10, 10,
+  11, 10, 10, 2, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 11, 10, 10, 10, 10, 10, 11,
+  10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 11, 10, 10,
+  10, 11, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 11,
+  10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 11,
+  10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+  2, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10,
+  10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 10, 10,
+  11, 10, 11, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 10,
+  11, 10, 10, 10, 11, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10,
+  11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10,
+  2, 12, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 2, 12, 10, 10, 10, 10, 11, 10, 11, 10,
+  10, 11, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 11, 10, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 12,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 2, 12, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10,
+  10, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 10, 10, 11,
+  10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10,
+  11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10,
+  2, 12, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 11, 10, 11, 10, 11, 10, 10,
+  10, 11, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10,
+  11, 10, 10, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 12,
+  10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10,
+  10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 10, 11, 10,
+  10, 11, 10, 10, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 12, 10, 11,
+  10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10,
+  2, 12, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 11, 10, 10, 11, 10, 10, 11,
+  10, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11,
+  10, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 11, 10, 10, 11, 11, 10, 10, 11, 11, 10, 10, 2, 12,
+  10, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10,
+  10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10,
+  10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10,
+  10, 11, 11, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10, 10,
+  2, 12, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 11, 10,
+  10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 12, 10, 10, 10, 10,
+  11, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 12,
+  10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+  11, 10, 2, 12, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 11, 10, 11, 10,
+  10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10,
+  11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+  2, 12, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 11, 10, 2, 12, 10, 11, 10, 10, 11, 10, 10, 11,
+  10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 10, 10, 10,
+  10, 11, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 2, 12,
+  10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10,
+  10, 10, 2, 12, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 11,
+  10, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 11, 10, 2, 12, 10, 10,
+  10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+  2, 12, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 11, 10, 10,
+  11, 10, 11, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 12, 10, 10, 10, 11,
+  10, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 12,
+  10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 11, 11, 10, 10, 10, 11, 11, 10,
+  10, 10, 2, 12, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10,
+  10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 12, 10, 10,
+  10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+  2, 12, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10,
+  10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 10,
+  10, 11, 10, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 12,
+  10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11,
+  10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10,
+  11, 10, 10, 11, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10,
+  11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10,
+  2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 10, 10,
+  11, 11, 10, 10, 10, 2, 13, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 13, 10, 10,
+  10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10,
+  10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 2, 13, 10, 11, 10, 10, 11,
+  10, 10, 11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10, 2,
+  13, 10, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 10, 11, 10, 10,
+  10, 11, 10, 10, 10, 2, 13, 10, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10,
+  10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11,
+  10, 10, 2, 13, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 2, 13, 10, 11, 10, 11, 10,
+  10, 10, 11, 10, 10, 11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2,
+  13, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10, 11,
+  10, 10, 10, 10, 10, 2, 13, 10, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10, 10, 10, 2, 13, 10, 10,
+  10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+  10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11,
+  10, 10, 11, 10, 10, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2,
+  13, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 11, 11, 10, 10,
+  10, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10,
+  10, 10, 11, 10, 11, 11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10,
+  10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 11, 10,
+  11, 10, 11, 10, 10, 10, 11, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2,
+  13, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 13, 10, 11, 10, 10, 10, 10, 10, 10,
+  11, 10, 10, 10, 10, 2, 13, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 13, 10, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10,
+  11, 10, 2, 13, 10, 10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 10,
+  11, 10, 11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2,
+  13, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10, 11,
+  10, 11, 10, 10, 10, 2, 13, 10, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10, 11, 10, 2, 14, 10, 11,
+  10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 2, 14, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11,
+  10, 10, 10, 10, 2, 14, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 14, 10, 10,
+  11, 10, 11, 11, 10, 10, 10, 11, 10, 11, 10, 10, 2, 14, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10,
+  10, 11, 10, 10, 2, 14, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 2, 14, 10, 10,
+  10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 14, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+  11, 10, 10, 10, 2, 14, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 14, 10, 10,
+  10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 14, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+  10, 10, 11, 10, 2, 14, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 14, 10, 11,
+  10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 14, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 14, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 14, 10, 10,
+  10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 14, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+  11, 10, 10, 10, 2, 14, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 14, 10, 10,
+  11, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 14, 10, 11, 10, 10, 11, 10, 10, 11, 11, 10,
+  10, 11, 10, 10, 2, 14, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 14, 10, 10,
+  11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11,
+  11, 10, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 14, 10, 10,
+  11, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 10, 11, 10, 11,
+  10, 11, 10, 10, 2, 14, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 14, 10, 10,
+  11, 10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 10, 10, 11, 11,
+  10, 10, 10, 10, 2, 14, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 14, 10, 10,
+  10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 15, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10,
+  10, 11, 10, 10, 10, 2, 15, 10, 10, 11, 11, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 15,
+  10, 10, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 15, 10, 11, 10, 11, 10, 11, 10,
+  10, 11, 11, 10, 11, 10, 11, 10, 2, 15, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+  10, 2, 15, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 15, 10, 10, 11, 10,
+  11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 15, 10, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10,
+  11, 10, 10, 10, 2, 15, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 15, 10,
+  10, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 15, 10, 10, 11, 10, 10, 11, 10, 10,
+  10, 10, 10, 11, 10, 10, 10, 2, 16, 10, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 10, 10, 11, 10,
+  10, 2, 16, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 16, 10, 10, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 11, 10, 10, 2, 16, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+  10, 11, 11, 10, 10, 11, 10, 2, 16, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10,
+  10, 2, 16, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 16, 10, 10, 10,
+  11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 16, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+  11, 10, 10, 10, 10, 10, 10, 2, 16, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10,
+  10, 2, 16, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 17, 10, 10, 11,
+  10, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 17, 10, 10, 10, 11, 10, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 17, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11,
+  10, 10, 10, 10, 2, 17, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2,
+  17, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 18, 10, 10, 10, 11,
+  10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 18, 10, 10, 10, 11, 10, 11, 10, 10,
+  10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 18, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 11, 11,
+  10, 10, 11, 11, 10, 10, 2, 21, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10,
+  10, 10, 10, 10, 10, 2, 25, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+  10, 11, 10, 10, 10, 11, 10, 10
+};
+
+}
@@ -29,11 +29,20 @@
 #include <cstring>
 #include <ctime>
 #include <cerrno>
+#include <algorithm>
+#include <mutex>
+
+#include <mupdf/ucdn.h>
 
 #include "mudocument.hpp"
+#include "muimagedecoder.hpp"
+#include "mustream.hpp"
 #include "../graphics/resolutions.hpp"
 #include "../bookmark.hpp"
 #include "../utils.hpp"
+#include "../user.hpp"
+#include "../stagetimer.hpp"
+#include "../membudget.hpp"
 #include "../graphics/fzscreen_defs.h"
 #include "../graphics/controls.hpp"
 
@@ -41,14 +50,90 @@ extern int _newlib_heap_size_user;
 
 namespace bookr {
 
-// make sure only one document is open, do we need this?
-// vita can probably do multiple.
-static MUDocument* mudoc_singleton = nullptr;
-// texture of current pixmap, TODO: generic fztexture
-#ifdef __vita__
-static vita2d_texture *texture;
-#elif defined(SWITCH)
-#endif
+// Every document clones this context, so the handlers are registered once
+// and all of them share one resource store. The store's LRU eviction then
+// works across documents within User::options.documentCacheMB.
+static fz_context* sharedCtx = nullptr;
+static int liveDocuments = 0;
+// the document MUImageDecoder is working for
+static MUDocument* activeDocument = nullptr;
+
+// MuPDF is built without its CJK fonts (TOFU_CJK). Documents that need
+// them get the fallback font file instead, read in the first time one
+// asks; until then it costs nothing.
+static fz_font* fallbackFont = nullptr;
+static bool fallbackTried = false;
+static std::mutex fallbackMutex;
+
+static fz_font* loadFallbackFont(fz_context* ctx) {
+  std::lock_guard<std::mutex> lock(fallbackMutex);
+  if (!fallbackTried) {
+    fallbackTried = true;
+    string path = Screen::fallbackFontPath();
+    FILE* f = fopen(path.c_str(), "rb");
+    if (f != NULL) {
+      fseek(f, 0, SEEK_END);
+      long size = ftell(f);
+      fclose(f);
+      fz_try(ctx) {
+        fallbackFont = fz_new_font_from_file(ctx, NULL, path.c_str(), 0, 0);
+        // MuPDF keeps the whole file in memory
+        MemBudget::report(MemBudget::FALLBACK_FONT, size);
+      } fz_catch(ctx) {
+        fallbackFont = nullptr;
+      }
+    }
+    #ifdef DEBUG
+      printf("MUDocument: fallback font %s %s\n", path.c_str(), fallbackFont ? "loaded" : "missing");
+    #endif
+  }
+  return fallbackFont ? fz_keep_font(ctx, fallbackFont) : nullptr;
+}
+
+static fz_font* loadSystemCJKFont(fz_context* ctx, const char* name, int ordering, int serif) {
+  return loadFallbackFont(ctx);
+}
+
+static fz_font* loadSystemFallbackFont(fz_context* ctx, int script, int language, int serif, int bold, int italic) {
+  // only the scripts left out of the build; the others have their
+  // built in Noto font
+  if (script == UCDN_SCRIPT_HAN || script == UCDN_SCRIPT_HIRAGANA || script == UCDN_SCRIPT_KATAKANA ||
+    script == UCDN_SCRIPT_BOPOMOFO || script == UCDN_SCRIPT_HANGUL)
+    return loadFallbackFont(ctx);
+  return nullptr;
+}
+
+static fz_context* cloneSharedContext() {
+  if (sharedCtx == nullptr) {
+    // locks let the image decoder worker and other documents share the store
+    size_t store = (size_t)std::max(User::options.documentCacheMB, 8) << 20;
+    sharedCtx = fz_new_context(nullptr, MUImageDecoder::locks(), store);
+    if (sharedCtx == nullptr) {
+      printf("MuPDF context allocation problem");
+      return nullptr;
+    }
+    // the store grows up to its limit, count all of it
+    MemBudget::report(MemBudget::MUPDF_STORE, store);
+    fz_register_document_handlers(sharedCtx);
+    fz_install_load_system_font_funcs(sharedCtx, nullptr, loadSystemCJKFont, loadSystemFallbackFont);
+    fz_set_use_document_css(sharedCtx, 1);
+    MUImageDecoder::start(sharedCtx);
+  }
+  return fz_clone_context(sharedCtx);
+}
+
+static void releaseSharedContext() {
+  if (liveDocuments > 0 || sharedCtx == nullptr)
+    return;
+  MUImageDecoder::stop();
+  fz_drop_font(sharedCtx, fallbackFont);
+  fallbackFont = nullptr;
+  fallbackTried = false;
+  MemBudget::report(MemBudget::FALLBACK_FONT, 0);
+  fz_drop_context(sharedCtx);
+  sharedCtx = nullptr;
+  MemBudget::report(MemBudget::MUPDF_STORE, 0);
+}
 
 // These will crash...
 //, 2.5f, 2.75f, 3.0f, 3.5f, 4.0f, 5.0f, 7.5f, 10.0f, 16.0f };
@@ -59,7 +144,11 @@ static const float rotateLevels[] = { 0.0f, 90.0f, 180.0f, 270.0f };
 
 
 MUDocument::MUDocument(string& f) : 
-  m_ctx(nullptr), m_doc(nullptr), m_page(nullptr), loadNewPage(false), zooming(false),
+  m_ctx(nullptr), m_doc(nullptr), m_page(nullptr), m_pix(nullptr),
+  #ifdef __vita__
+  m_texture(nullptr),
+  #endif
+  loadNewPage(false), zooming(false),
   m_pageText(nullptr), m_links(nullptr), panX(0), panY(0), m_current_page(0),
   m_curPageLoaded(false), m_fitWidth(true), m_fitHeight(false), zoomLevel(8)
 {
@@ -74,18 +163,20 @@ MUDocument::MUDocument(string& f) :
   m_height = DEFAULT_SCREEN_HEIGHT;
 
   // Initalize fitz context
-  m_ctx = fz_new_context(nullptr, nullptr, FZ_STORE_DEFAULT);
-
-  if (m_ctx)
-    fz_register_document_handlers(m_ctx);
-  else
-    printf("MuPDF context allocation problem");
-
-  fz_set_use_document_css(m_ctx, 1);
+  m_ctx = cloneSharedContext();
+  liveDocuments++;
 
   // Open Document; TODO: Implement keyboard password
   fz_try(m_ctx) {
-    m_doc = fz_open_document(m_ctx, f.c_str());
+    // our own stream so the file can be reopened after a suspend
+    fz_stream* stm = MUStream::open(m_ctx, f.c_str());
+    fz_try(m_ctx) {
+      m_doc = fz_open_document_with_stream(m_ctx, f.c_str(), stm);
+    } fz_always(m_ctx) {
+      fz_drop_stream(m_ctx, stm);
+    } fz_catch(m_ctx) {
+      fz_rethrow(m_ctx);
+    }
     if (fz_needs_password(m_ctx, m_doc)) {
       int okay = 0;
       char *password;
@@ -96,8 +187,12 @@ MUDocument::MUDocument(string& f) :
     }
   } fz_catch(m_ctx) {
     printf("opening error: %s\n", fz_caught_message(m_ctx));
+    fz_drop_document(m_ctx, m_doc);
     fz_drop_context(m_ctx);
-    fz_throw(m_ctx, FZ_ERROR_GENERIC, "opening error:");
+    liveDocuments--;
+    releaseSharedContext();
+    // m_ctx is gone, report through Document::create instead
+    throw "Cannot open document";
   }
 
 
@@ -122,10 +217,26 @@ MUDocument::~MUDocument() {
   #endif
   
   saveLastView();
-  mudoc_singleton = nullptr;
+  #ifdef DEBUG
+    MUImageDecoder::printStats();
+    MUStream::printStats();
+  #endif
+  if (activeDocument == this) {
+    MUImageDecoder::reset(m_ctx);
+    activeDocument = nullptr;
+  }
+  #ifdef __vita__
+    if (m_texture != nullptr)
+      vita2d_free_texture(m_texture);
+  #endif
+  fz_drop_stext_page(m_ctx, m_pageText);
+  fz_drop_link(m_ctx, m_links);
+  fz_drop_page(m_ctx, m_page);
   fz_drop_pixmap(m_ctx, m_pix);
   fz_drop_document(m_ctx, m_doc);
   fz_drop_context(m_ctx);
+  liveDocuments--;
+  releaseSharedContext();
 }
 
 MUDocument* MUDocument::create(string& file) {
@@ -133,14 +244,7 @@ MUDocument* MUDocument::create(string& file) {
     printf("MUDocument::create\n");
   #endif
   
-  if (mudoc_singleton) {
-    printf("cannot open more than 1 pdf at the same time\n");
-    return mudoc_singleton;
-  }
-
   MUDocument* b = new MUDocument(file);
-  mudoc_singleton = b;
-
 
   b->redrawBuffer();
   return b;
@@ -150,7 +254,7 @@ MUDocument* MUDocument::create(string& file) {
 bool MUDocument::redrawBuffer() {
   #ifdef DEBUG
     printf("MUDocument::redrawBuffer pp\n");
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now(); 
+    MUStream::Stats ioBefore = MUStream::stats();
   #endif
   // fz_scale(&m_transform, m_scale / 72, m_scale / 72);
   // fz_pre_rotate(&m_transform, m_rotate);
@@ -162,17 +266,30 @@ bool MUDocument::redrawBuffer() {
   fz_drop_page(m_ctx, m_page);
   m_page = nullptr;
 
+  activate();
 
-  m_page = fz_load_page(m_ctx, m_doc, m_current_page);
-  m_links = fz_load_links(m_ctx, m_page);
-  m_pageText = fz_new_stext_page_from_page(m_ctx, m_page, nullptr);
+  {
+    StageTimer::Scope t(StageTimer::LOAD_PAGE);
+    m_page = fz_load_page(m_ctx, m_doc, m_current_page);
+  }
+  {
+    StageTimer::Scope t(StageTimer::LINKS);
+    m_links = fz_load_links(m_ctx, m_page);
+  }
+  {
+    StageTimer::Scope t(StageTimer::STEXT);
+    m_pageText = fz_new_stext_page_from_page(m_ctx, m_page, nullptr);
+  }
 
   #ifdef DEBUG
     printf("fz_load\n");
   #endif
 
   // bounds for inital window size
-  m_bounds = fz_bound_page(m_ctx, m_page);
+  {
+    StageTimer::Scope t(StageTimer::BOUNDS);
+    m_bounds = fz_bound_page(m_ctx, m_page);
+  }
   #ifdef DEBUG
     printf("bound_page; (%f, %f) - (%f, %f)\n", m_bounds.x0, m_bounds.y0, m_bounds.y0, m_bounds.y1);
   #endif
@@ -224,46 +341,95 @@ bool MUDocument::redrawBuffer() {
     printf("scale/transform\n");
   #endif
 
-  // TODO: Is display list or bbox better?
-  // This is currently the longest operation
-  pdf_annot *annot;
-  fz_try(m_ctx)
-    m_pix = fz_new_pixmap_from_page_contents(m_ctx, m_page, m_transform, fz_device_rgb(m_ctx), 0);
-  fz_catch(m_ctx) {
+  // Expensive images (JPX, JBIG2) are left as placeholders here and the
+  // full page comes back from MUImageDecoder through updateContent.
+  fz_display_list* list = nullptr;
+  bool deferred = false;
+  m_pix = nullptr;
+  fz_var(list);
+  // no Scope inside fz_try, a throw would longjmp past its destructor
+  auto rasterBegin = std::chrono::steady_clock::now();
+  fz_try(m_ctx) {
+    list = fz_new_display_list_from_page_contents(m_ctx, m_page);
+    m_pix = MUImageDecoder::renderPreview(m_ctx, list, m_transform, m_current_page, deferred);
+    if (deferred)
+      MUImageDecoder::submit(m_ctx, list, m_transform, m_current_page);
+    else
+      MUImageDecoder::cancel(m_ctx);
+  } fz_always(m_ctx) {
+    fz_drop_display_list(m_ctx, list);
+  } fz_catch(m_ctx) {
     printf("cannot render page: %s\n", fz_caught_message(m_ctx));
   }
+  StageTimer::record(StageTimer::RASTERIZE, std::chrono::duration<float, std::milli>(
+    std::chrono::steady_clock::now() - rasterBegin).count());
+
+  if (m_pix == nullptr)
+    return false;
 
   #ifdef DEBUG
     printf("new_pixmap n: %i \n", m_pix->n);
   #endif
 
+  #ifdef DEBUG
+    MUStream::Stats ioAfter = MUStream::stats();
+    printf("page %i io: %lld bytes, %d reads, %d seeks\n", m_current_page,
+      (long long)(ioAfter.bytesRead - ioBefore.bytesRead), ioAfter.readCalls - ioBefore.readCalls,
+      ioAfter.seeks - ioBefore.seeks);
+  #endif
+
+  uploadPixmap(m_pix);
+
+  fz_drop_pixmap(m_ctx, m_pix);
+  m_pix = nullptr;
+  // load annotations
+
+  return true;
+}
+
+void MUDocument::uploadPixmap(fz_pixmap* pix) {
   #ifdef __vita__
     // Crashes due to GPU memory use without this.
-    vita2d_free_texture(texture);
+    if (m_texture != nullptr)
+      vita2d_free_texture(m_texture);
 
     #ifdef DEBUG
       printf("post vita2d_free_texture\n");
     #endif
 
-    texture = _vita2d_load_pixmap_generic(m_pix);
+    m_texture = _vita2d_load_pixmap_generic(pix);
 
   #endif
 
   #ifdef DEBUG
     printf("post _vita2d_load_pixmap_generic\n");
   #endif
+}
 
-  fz_drop_pixmap(m_ctx, m_pix);
-  // load annotations
-
-  return true;
+// Another pooled document may have left work with the image decoder.
+void MUDocument::activate() {
+  if (activeDocument == this)
+    return;
+  MUImageDecoder::reset(m_ctx);
+  activeDocument = this;
 }
 
 int MUDocument::updateContent() {
+  activate();
+  fz_pixmap* decoded = MUImageDecoder::poll(m_ctx, m_current_page);
+  if (decoded != nullptr) {
+    uploadPixmap(decoded);
+    fz_drop_pixmap(m_ctx, decoded);
+    return BK_CMD_MARK_DIRTY;
+  }
+
   if (loadNewPage) {
     panY = 0;
     redrawBuffer();
-    saveLastView();
+    {
+      StageTimer::Scope t(StageTimer::BOOKMARK_SAVE);
+      saveLastView();
+    }
 
     loadNewPage = false;
     char t[256];
@@ -289,10 +455,10 @@ int MUDocument::updateContent() {
 }
 
 int MUDocument::resume() {
-  // mupdf leaves open file descriptors around. they don't survive a suspend.
-  // Is this still the case? yes
-  // TODO: Don't need to reload for epub/html based docs, all kept in memory and retained
-  return BK_CMD_RELOAD;
+  // mupdf leaves open file descriptors around. they don't survive a suspend,
+  // but MUStream reopens its file on the next read, so the document, store
+  // and texture are all kept. Just redraw what we already have.
+  return BK_CMD_MARK_DIRTY;
 }
 
 void MUDocument::renderContent() {
@@ -302,7 +468,8 @@ void MUDocument::renderContent() {
 
   Screen::clear(0xefefef, FZ_COLOR_BUFFER);
   #ifdef __vita__
-    vita2d_draw_texture(texture, panX, panY);
+    if (m_texture != nullptr)
+      vita2d_draw_texture(m_texture, panX, panY);
   #endif
 
   // TODO: Show Page Error, don"t draw texture then.
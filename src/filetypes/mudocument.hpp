@@ -13,6 +13,10 @@
 #ifndef BKMUPDFDOCUMENT_H
 #define BKMUPDFDOCUMENT_H
 
+#ifdef __vita__
+  #include <vita2d.h>
+#endif
+
 #include <mupdf/fitz.h>
 #include <mupdf/pdf.h>
 
@@ -35,6 +39,10 @@ private:
   fz_rect m_matches[512];
   fz_link *m_links;
   pdf_document *m_pdf;
+  // kept per document so a warm document shows its page straight away
+  #ifdef __vita__
+  vita2d_texture *m_texture;
+  #endif
   
   int m_current_page;
   int m_pages;
@@ -57,6 +65,8 @@ private:
   string filename;
 
   bool redrawBuffer();
+  void uploadPixmap(fz_pixmap* pix);
+  void activate();
 
 protected:
   MUDocument(string& f);
@@ -0,0 +1,435 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include "muimagedecoder.hpp"
+#include "../stagetimer.hpp"
+#include "../user.hpp"
+
+namespace bookr { namespace MUImageDecoder {
+
+// mupdf needs these as soon as a context is used from more than one thread
+static std::mutex fzMutexes[FZ_LOCK_MAX];
+
+static void lockMutex(void* user, int lock) {
+  fzMutexes[lock].lock();
+}
+
+static void unlockMutex(void* user, int lock) {
+  fzMutexes[lock].unlock();
+}
+
+static fz_locks_context fzLocks = { nullptr, lockMutex, unlockMutex };
+
+fz_locks_context* locks() {
+  return &fzLocks;
+}
+
+// Decode cost per codec, in ms per megapixel. Starts from a pessimistic
+// guess and follows what the worker actually measures.
+#define MAX_CODECS 32
+struct CodecStats {
+  float msPerMP;
+  int decoded;
+  int deferred;
+};
+static CodecStats codecStats[MAX_CODECS];
+static std::mutex statsMutex;
+
+static bool isExpensive(int codec) {
+  return codec == FZ_IMAGE_JPX || codec == FZ_IMAGE_JBIG2;
+}
+
+static const char* codecName(int codec) {
+  if (codec == FZ_IMAGE_JPX)
+    return "JPX";
+  if (codec == FZ_IMAGE_JBIG2)
+    return "JBIG2";
+  return "other";
+}
+
+static int codecFor(fz_context* ctx, fz_image* image) {
+  fz_compressed_buffer* buffer = fz_compressed_image_buffer(ctx, image);
+  if (buffer == nullptr || buffer->params.type < 0 || buffer->params.type >= MAX_CODECS)
+    return FZ_IMAGE_UNKNOWN;
+  return buffer->params.type;
+}
+
+static void resetStats() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  memset(codecStats, 0, sizeof(codecStats));
+  codecStats[FZ_IMAGE_JPX].msPerMP = 400.0f;
+  codecStats[FZ_IMAGE_JBIG2].msPerMP = 150.0f;
+}
+
+static float estimateMs(int codec, int w, int h) {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  return codecStats[codec].msPerMP * (float(w) * float(h) / 1000000.0f);
+}
+
+static void learn(int codec, int w, int h, float ms) {
+  // anything this fast came out of the store, not the decoder
+  if (ms < 2.0f)
+    return;
+  float mp = float(w) * float(h) / 1000000.0f;
+  if (mp <= 0.0f)
+    return;
+  std::lock_guard<std::mutex> lock(statsMutex);
+  CodecStats& s = codecStats[codec];
+  s.msPerMP = s.msPerMP * 0.75f + (ms / mp) * 0.25f;
+  s.decoded++;
+}
+
+// The draw device's own fill_image. Same function for every draw device, so
+// it is safe to share between the main thread and the worker.
+typedef void (*FillImageFn)(fz_context*, fz_device*, fz_image*, fz_matrix, float, fz_color_params);
+static FillImageFn drawFillImage = nullptr;
+
+static void hookDevice(fz_device* dev, FillImageFn fn) {
+  if (drawFillImage == nullptr)
+    drawFillImage = dev->fill_image;
+  dev->fill_image = fn;
+}
+
+static void fillPlaceholder(fz_context* ctx, fz_device* dev, fz_matrix ctm, float alpha, fz_color_params cp) {
+  static const float grey = 0.85f;
+  fz_path* path = fz_new_path(ctx);
+  fz_try(ctx) {
+    fz_moveto(ctx, path, 0, 0);
+    fz_lineto(ctx, path, 1, 0);
+    fz_lineto(ctx, path, 1, 1);
+    fz_lineto(ctx, path, 0, 1);
+    fz_closepath(ctx, path);
+    fz_fill_path(ctx, dev, path, 0, ctm, fz_device_gray(ctx), &grey, alpha, cp);
+  } fz_always(ctx) {
+    fz_drop_path(ctx, path);
+  } fz_catch(ctx) {
+    fz_rethrow(ctx);
+  }
+}
+
+static bool isDisabled(int codec) {
+  return codec == FZ_IMAGE_JPX && !User::options.jpeg2000Decoder;
+}
+
+// Images the worker decoded, with the size it drew them at. The draw device
+// picks the decode subsample from that size, so a preview at the same zoom
+// draws from the same store entry and can skip the budget; any other zoom
+// is a new decode. Each entry keeps a reference so the pointer can't be
+// reused by another image. Oldest entries go first.
+#define MAX_DECODED 64
+struct DecodedImage {
+  fz_image* image;
+  int w, h;
+};
+static vector<DecodedImage> decoded;
+static std::mutex decodedMutex;
+
+static void drawnSize(fz_matrix ctm, int& w, int& h) {
+  w = (int)(sqrtf(ctm.a * ctm.a + ctm.b * ctm.b) + 0.5f);
+  h = (int)(sqrtf(ctm.c * ctm.c + ctm.d * ctm.d) + 0.5f);
+}
+
+static void addDecoded(fz_context* ctx, fz_image* image, fz_matrix ctm) {
+  DecodedImage d = { image, 0, 0 };
+  drawnSize(ctm, d.w, d.h);
+  std::lock_guard<std::mutex> lock(decodedMutex);
+  for (size_t i = 0; i < decoded.size(); ++i) {
+    if (decoded[i].image == d.image && decoded[i].w == d.w && decoded[i].h == d.h)
+      return;
+  }
+  if (decoded.size() >= MAX_DECODED) {
+    fz_drop_image(ctx, decoded.front().image);
+    decoded.erase(decoded.begin());
+  }
+  d.image = fz_keep_image(ctx, image);
+  decoded.push_back(d);
+}
+
+static bool wasDecoded(fz_image* image, fz_matrix ctm) {
+  int w, h;
+  drawnSize(ctm, w, h);
+  std::lock_guard<std::mutex> lock(decodedMutex);
+  for (size_t i = 0; i < decoded.size(); ++i) {
+    if (decoded[i].image == image && decoded[i].w == w && decoded[i].h == h)
+      return true;
+  }
+  return false;
+}
+
+static void clearDecoded(fz_context* ctx) {
+  std::lock_guard<std::mutex> lock(decodedMutex);
+  for (size_t i = 0; i < decoded.size(); ++i)
+    fz_drop_image(ctx, decoded[i].image);
+  decoded.clear();
+}
+
+// preview state, main thread only
+static vector<DeferredImage> deferred;
+static int previewPage = -1;
+static bool previewNeedsWorker = false;
+
+static void previewFillImage(fz_context* ctx, fz_device* dev, fz_image* image, fz_matrix ctm, float alpha, fz_color_params cp) {
+  int codec = codecFor(ctx, image);
+  if (isExpensive(codec)) {
+    bool disabled = isDisabled(codec);
+    float ms = estimateMs(codec, image->w, image->h);
+    bool warm = wasDecoded(image, ctm);
+    if (disabled || (!warm && ms > User::options.pdfImageDecodeBudgetMs)) {
+      DeferredImage d = { previewPage, codec, image->w, image->h, ms };
+      deferred.push_back(d);
+      if (!disabled)
+        previewNeedsWorker = true;
+      {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        codecStats[codec].deferred++;
+      }
+      fillPlaceholder(ctx, dev, ctm, alpha, cp);
+      return;
+    }
+  }
+  drawFillImage(ctx, dev, image, ctm, alpha, cp);
+}
+
+static void backgroundFillImage(fz_context* ctx, fz_device* dev, fz_image* image, fz_matrix ctm, float alpha, fz_color_params cp) {
+  int codec = codecFor(ctx, image);
+  if (!isExpensive(codec)) {
+    drawFillImage(ctx, dev, image, ctm, alpha, cp);
+    return;
+  }
+  if (isDisabled(codec)) {
+    fillPlaceholder(ctx, dev, ctm, alpha, cp);
+    return;
+  }
+  auto begin = std::chrono::steady_clock::now();
+  drawFillImage(ctx, dev, image, ctm, alpha, cp);
+  auto end = std::chrono::steady_clock::now();
+  float ms = std::chrono::duration<float, std::milli>(end - begin).count();
+  learn(codec, image->w, image->h, ms);
+  addDecoded(ctx, image, ctm);
+  #ifdef DEBUG
+    printf("MUImageDecoder: %s %ix%i decoded in %.1fms\n", codecName(codec), image->w, image->h, ms);
+  #endif
+}
+
+static fz_pixmap* newPagePixmap(fz_context* ctx, fz_display_list* list, fz_matrix ctm) {
+  fz_rect rect = fz_transform_rect(fz_bound_display_list(ctx, list), ctm);
+  fz_pixmap* pix = fz_new_pixmap_with_bbox(ctx, fz_device_rgb(ctx), fz_round_rect(rect), nullptr, 0);
+  fz_clear_pixmap_with_value(ctx, pix, 0xff);
+  return pix;
+}
+
+static fz_pixmap* render(fz_context* ctx, fz_display_list* list, fz_matrix ctm, FillImageFn fn, fz_cookie* cookie) {
+  fz_pixmap* pix = nullptr;
+  fz_device* dev = nullptr;
+  fz_var(pix);
+  fz_var(dev);
+  fz_try(ctx) {
+    pix = newPagePixmap(ctx, list, ctm);
+    dev = fz_new_draw_device(ctx, fz_identity, pix);
+    hookDevice(dev, fn);
+    fz_run_display_list(ctx, list, dev, ctm, fz_infinite_rect, cookie);
+    fz_close_device(ctx, dev);
+  } fz_always(ctx) {
+    fz_drop_device(ctx, dev);
+  } fz_catch(ctx) {
+    fz_drop_pixmap(ctx, pix);
+    fz_rethrow(ctx);
+  }
+  return pix;
+}
+
+fz_pixmap* renderPreview(fz_context* ctx, fz_display_list* list, fz_matrix ctm, int page, bool& wasDeferred) {
+  deferred.clear();
+  previewPage = page;
+  previewNeedsWorker = false;
+
+  fz_pixmap* pix = render(ctx, list, ctm, previewFillImage, nullptr);
+
+  #ifdef DEBUG
+    for (size_t i = 0; i < deferred.size(); ++i)
+      printf("MUImageDecoder: page %i deferred %s %ix%i (est. %.0fms)\n", deferred[i].page,
+        codecName(deferred[i].codec), deferred[i].w, deferred[i].h, deferred[i].estimateMs);
+  #endif
+
+  wasDeferred = previewNeedsWorker;
+  return pix;
+}
+
+// StageTimer section: what the most recent preview left out, and what the
+// decodes have cost so far
+static void dumpStats(FILE* f) {
+  fprintf(f, "deferred images:\n");
+  for (size_t i = 0; i < deferred.size(); ++i)
+    fprintf(f, "page %i %s %ix%i est. %.0fms\n", deferred[i].page,
+      codecName(deferred[i].codec), deferred[i].w, deferred[i].h, deferred[i].estimateMs);
+  std::lock_guard<std::mutex> lock(statsMutex);
+  for (int i = 0; i < MAX_CODECS; ++i) {
+    if (!isExpensive(i))
+      continue;
+    fprintf(f, "%s decoded %i deferred %i, %.0fms/MP\n", codecName(i),
+      codecStats[i].decoded, codecStats[i].deferred, codecStats[i].msPerMP);
+  }
+}
+
+// worker state, guarded by jobMutex
+struct Job {
+  fz_display_list* list;
+  fz_matrix ctm;
+  int page;
+};
+static std::thread worker;
+static std::mutex jobMutex;
+static std::condition_variable jobCond;
+static fz_context* workerCtx = nullptr;
+static bool running = false;
+static bool hasJob = false;
+static Job job;
+static fz_cookie cookie;
+static fz_pixmap* result = nullptr;
+static int resultPage = -1;
+
+static void workerLoop() {
+  std::unique_lock<std::mutex> lock(jobMutex);
+  while (running) {
+    jobCond.wait(lock, []{ return !running || hasJob; });
+    if (!running)
+      break;
+    Job j = job;
+    hasJob = false;
+    memset(&cookie, 0, sizeof(cookie));
+    lock.unlock();
+
+    fz_pixmap* pix = nullptr;
+    fz_try(workerCtx) {
+      pix = render(workerCtx, j.list, j.ctm, backgroundFillImage, &cookie);
+    } fz_catch(workerCtx) {
+      printf("MUImageDecoder: cannot render page %i: %s\n", j.page, fz_caught_message(workerCtx));
+    }
+    fz_drop_display_list(workerCtx, j.list);
+
+    lock.lock();
+    if (pix != nullptr && cookie.abort == 0) {
+      fz_drop_pixmap(workerCtx, result);
+      result = pix;
+      resultPage = j.page;
+    } else {
+      fz_drop_pixmap(workerCtx, pix);
+    }
+  }
+}
+
+void start(fz_context* ctx) {
+  std::lock_guard<std::mutex> lock(jobMutex);
+  if (running)
+    return;
+  resetStats();
+  StageTimer::addSection(dumpStats);
+  // clone fails if ctx was created without locks(); run everything inline then
+  workerCtx = fz_clone_context(ctx);
+  if (workerCtx == nullptr) {
+    printf("MUImageDecoder: no worker context, decoding inline\n");
+    return;
+  }
+  running = true;
+  worker = std::thread(workerLoop);
+}
+
+void stop() {
+  {
+    std::lock_guard<std::mutex> lock(jobMutex);
+    if (!running)
+      return;
+    running = false;
+    cookie.abort = 1;
+  }
+  jobCond.notify_all();
+  worker.join();
+
+  if (hasJob)
+    fz_drop_display_list(workerCtx, job.list);
+  hasJob = false;
+  fz_drop_pixmap(workerCtx, result);
+  result = nullptr;
+  resultPage = -1;
+  clearDecoded(workerCtx);
+  fz_drop_context(workerCtx);
+  workerCtx = nullptr;
+}
+
+void submit(fz_context* ctx, fz_display_list* list, fz_matrix ctm, int page) {
+  std::lock_guard<std::mutex> lock(jobMutex);
+  if (!running)
+    return;
+  if (hasJob)
+    fz_drop_display_list(ctx, job.list);
+  cookie.abort = 1;
+  job.list = fz_keep_display_list(ctx, list);
+  job.ctm = ctm;
+  job.page = page;
+  hasJob = true;
+  jobCond.notify_one();
+}
+
+void cancel(fz_context* ctx) {
+  std::lock_guard<std::mutex> lock(jobMutex);
+  if (!running)
+    return;
+  if (hasJob)
+    fz_drop_display_list(ctx, job.list);
+  hasJob = false;
+  cookie.abort = 1;
+}
+
+void reset(fz_context* ctx) {
+  cancel(ctx);
+  {
+    std::lock_guard<std::mutex> lock(jobMutex);
+    fz_drop_pixmap(ctx, result);
+    result = nullptr;
+    resultPage = -1;
+  }
+  clearDecoded(ctx);
+}
+
+fz_pixmap* poll(fz_context* ctx, int page) {
+  std::lock_guard<std::mutex> lock(jobMutex);
+  if (result == nullptr)
+    return nullptr;
+  fz_pixmap* pix = result;
+  bool current = resultPage == page;
+  result = nullptr;
+  if (!current) {
+    fz_drop_pixmap(ctx, pix);
+    return nullptr;
+  }
+  return pix;
+}
+
+void printStats() {
+  std::lock_guard<std::mutex> lock(statsMutex);
+  for (int i = 0; i < MAX_CODECS; ++i) {
+    if (!isExpensive(i))
+      continue;
+    printf("MUImageDecoder: %s decoded %i deferred %i, %.0fms/MP\n", codecName(i),
+      codecStats[i].decoded, codecStats[i].deferred, codecStats[i].msPerMP);
+  }
+}
+
+} }
@@ -0,0 +1,88 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKMUIMAGEDECODER_H
+#define BKMUIMAGEDECODER_H
+
+#include <vector>
+
+#include <mupdf/fitz.h>
+
+using std::vector;
+
+namespace bookr {
+
+/*! \brief Off-thread decoding of expensive page images (JPX, JBIG2).
+ *
+ *  A page is first rasterized with a flat placeholder in place of any image
+ *  whose estimated decode time is over the per-codec budget. The page's
+ *  display list is then handed to a worker thread which renders it again
+ *  with every image decoded; the document picks the result up with poll().
+ */
+namespace MUImageDecoder {
+  struct DeferredImage {
+    int page;
+    int codec;     // FZ_IMAGE_JPX, FZ_IMAGE_JBIG2, ...
+    int w, h;
+    float estimateMs;
+  };
+
+  /**
+   * Lock callbacks, required by any context shared with the worker.
+   */
+  fz_locks_context* locks();
+
+  /**
+   * Start/stop the worker. The context is cloned for the worker's use;
+   * it is shared by every open document.
+   */
+  void start(fz_context* ctx);
+  void stop();
+
+  /**
+   * Rasterize a display list, replacing over-budget images with
+   * placeholders. Returns true in deferred if anything was left out.
+   */
+  fz_pixmap* renderPreview(fz_context* ctx, fz_display_list* list, fz_matrix ctm, int page, bool& deferred);
+
+  /**
+   * Queue a full render of the list. Replaces (and aborts) any queued or
+   * running job for another page.
+   */
+  void submit(fz_context* ctx, fz_display_list* list, fz_matrix ctm, int page);
+
+  /**
+   * Drop any queued or running job.
+   */
+  void cancel(fz_context* ctx);
+
+  /**
+   * Forget everything about the previous document: drops any job, any
+   * finished result and the record of decoded images.
+   */
+  void reset(fz_context* ctx);
+
+  /**
+   * Finished full render for page, or nullptr. Caller owns the pixmap.
+   */
+  fz_pixmap* poll(fz_context* ctx, int page);
+
+  /**
+   * Print decode stats. The images deferred on the most recent preview go
+   * into StageTimer::dump() as well.
+   */
+  void printStats();
+}
+
+}
+
+#endif
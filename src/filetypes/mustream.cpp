@@ -0,0 +1,147 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+
+#include "mustream.hpp"
+#include "blockcache.hpp"
+
+namespace bookr { namespace MUStream {
+
+// random access blocks, kept LRU
+#define CACHE_BLOCKS 8
+// sequential access reads this many blocks in one call
+#define READ_AHEAD_BLOCKS 4
+// pdf xref tables and trailers live at the end of the file; blocks in this
+// region are only evicted when nothing else can be
+#define TAIL_BYTES (2 * FILE_BLOCK_SIZE)
+
+static Stats totals;
+
+struct FileState {
+  FileHandle file;
+  BlockCache blocks;
+  // read-ahead window for sequential access, keyed by its offset
+  BlockCache window;
+  int64_t lastMissOffset;
+};
+
+static int readChecked(fz_context* ctx, FileState* state, int64_t offset, char* buf, int n) {
+  totals.readCalls++;
+  int64_t r = state->file.read(offset, buf, n);
+  if (r < 0)
+    fz_throw(ctx, FZ_ERROR_GENERIC, "cannot read %s: %s", state->file.name().c_str(), strerror(errno));
+  totals.bytesRead += r;
+  return (int)r;
+}
+
+static int nextFile(fz_context* ctx, fz_stream* stm, size_t max) {
+  FileState* state = (FileState*)stm->state;
+  if (stm->pos >= state->file.size())
+    return EOF;
+
+  int64_t offset = stm->pos & ~(int64_t)(FILE_BLOCK_SIZE - 1);
+  BlockCache::Block* w = state->window.at(0);
+  BlockCache::Block* b;
+
+  if (w->key >= 0 && stm->pos >= w->key && stm->pos < w->key + w->len) {
+    // inside the read-ahead window
+    totals.hits++;
+    b = w;
+  } else if ((b = state->blocks.find(offset)) != nullptr) {
+    totals.hits++;
+  } else if (offset == state->lastMissOffset + FILE_BLOCK_SIZE) {
+    // walking forward through the file, read a big chunk in one go
+    totals.misses++;
+    b = state->window.victim();
+    int len = readChecked(ctx, state, offset, b->data, READ_AHEAD_BLOCKS * FILE_BLOCK_SIZE);
+    state->window.store(b, offset, len);
+    state->lastMissOffset = offset + (READ_AHEAD_BLOCKS - 1) * FILE_BLOCK_SIZE;
+  } else {
+    totals.misses++;
+    b = state->blocks.victim();
+    int len = readChecked(ctx, state, offset, b->data, FILE_BLOCK_SIZE);
+    state->blocks.store(b, offset, len, offset + FILE_BLOCK_SIZE > state->file.size() - TAIL_BYTES);
+    state->lastMissOffset = offset;
+  }
+
+  if (stm->pos >= b->key + b->len)
+    return EOF;
+
+  unsigned char* data = (unsigned char*)b->data;
+  stm->rp = data + (stm->pos - b->key);
+  stm->wp = data + b->len;
+  stm->pos = b->key + b->len;
+  return *stm->rp++;
+}
+
+// No I/O here; the next read finds its block.
+static void seekFile(fz_context* ctx, fz_stream* stm, int64_t offset, int whence) {
+  FileState* state = (FileState*)stm->state;
+  totals.seeks++;
+
+  int64_t base = 0;
+  if (whence == SEEK_CUR)
+    base = stm->pos - (stm->wp - stm->rp);
+  else if (whence == SEEK_END)
+    base = state->file.size();
+  int64_t pos = base + offset;
+  if (pos < 0)
+    fz_throw(ctx, FZ_ERROR_GENERIC, "cannot seek to %lld", (long long)pos);
+  if (pos > state->file.size())
+    pos = state->file.size();
+
+  stm->pos = pos;
+  stm->rp = stm->wp;
+}
+
+static void dropFile(fz_context* ctx, void* opaque) {
+  delete (FileState*)opaque;
+}
+
+fz_stream* open(fz_context* ctx, const char* path) {
+  FileState* state = new FileState();
+  state->lastMissOffset = -2 * FILE_BLOCK_SIZE;
+  if (!state->blocks.allocate(CACHE_BLOCKS, FILE_BLOCK_SIZE) ||
+      !state->window.allocate(1, READ_AHEAD_BLOCKS * FILE_BLOCK_SIZE)) {
+    delete state;
+    fz_throw(ctx, FZ_ERROR_MEMORY, "cannot allocate stream buffers");
+  }
+  if (!state->file.open(path)) {
+    delete state;
+    fz_throw(ctx, FZ_ERROR_GENERIC, "cannot open %s: %s", path, strerror(errno));
+  }
+
+  fz_stream* stm = nullptr;
+  fz_try(ctx) {
+    stm = fz_new_stream(ctx, state, nextFile, dropFile);
+  } fz_catch(ctx) {
+    delete state;
+    fz_rethrow(ctx);
+  }
+  stm->seek = seekFile;
+  return stm;
+}
+
+Stats stats() {
+  return totals;
+}
+
+void printStats() {
+  printf("MUStream: %lld bytes in %d reads, %d seeks, %d hits, %d misses\n",
+    (long long)totals.bytesRead, totals.readCalls, totals.seeks, totals.hits, totals.misses);
+}
+
+} }
@@ -0,0 +1,52 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKMUSTREAM_H
+#define BKMUSTREAM_H
+
+#include <cstdint>
+
+#include <mupdf/fitz.h>
+
+namespace bookr {
+
+/*! \brief File backed fz_stream for MuPDF documents.
+ *
+ *  Reads are done in large aligned blocks: a small LRU cache serves the
+ *  random access around xref tables and object streams, and sequential
+ *  access gets a bigger read-ahead window. Seeks do no I/O at all.
+ *
+ *  File handles are invalid after the Vita resumes. The stream reopens the
+ *  file the first time it is touched after Screen::getSuspendSerial()
+ *  changes, so documents no longer need a full reload on resume.
+ */
+namespace MUStream {
+  struct Stats {
+    int64_t bytesRead;
+    int readCalls;    // actual reads hitting the file system
+    int seeks;        // seeks requested by mupdf
+    int hits;
+    int misses;
+  };
+
+  fz_stream* open(fz_context* ctx, const char* path);
+
+  /**
+   * Totals over every stream opened so far.
+   */
+  Stats stats();
+  void printStats();
+}
+
+}
+
+#endif
@@ -10,87 +10,318 @@
  * Licensed under GPLv3+, see LICENSE
 */
 
+#include <algorithm>
 #include <cstdio>
-#include <list>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
 
-#include "palmdoc.h"
-#include "palmdoc/palmdoc.h"
-
-using std::string;
+#include "palmdoc.hpp"
+#include "textencoding.hpp"
+#include "htmltext.hpp"
+#include "blockcache.hpp"
 
 namespace bookr {
 
-PalmDoc::PalmDoc() : buffer(0) { }
-PalmDoc::~PalmDoc() {
-	saveLastView();
-	if (buffer)
-		free(buffer);
+// Palm database layout
+#define PDB_HEADER 78
+#define PDB_NAME 32
+#define PDB_TYPE 60
+#define PDB_RECORDS 76
+#define PDB_ENTRY 8
+
+// record 0: the PalmDoc header, then for MOBI the MOBI header
+#define PALMDOC_HEADER 16
+#define PALMDOC_NONE 1
+#define PALMDOC_LZ77 2
+#define MOBI_HEADER_MIN 0xe4
+#define MOBI_HEADER_READ 0xf4
+#define MOBI_TITLE_MAX 256
+
+#define PALMDOC_CACHE_RECORDS 8
+
+static inline uint32_t be16(const unsigned char* p) {
+  return (p[0] << 8) | p[1];
 }
 
-PalmDoc* PalmDoc::create(string& file, string& longFileName) {
-	PalmDoc* r = new PalmDoc();
-	r->fileName = file;
-	r->longFileName = longFileName;
-	int length = 0;
-	int isMobi = 0;
-	char ctitle[dmDBNameLength];
-
-	// convert file to plain text
-	char* b = palmdoc_decode(file.c_str(), &length, &isMobi, ctitle);
-	if (b == NULL) {
-		return 0;
-	}
-
-	r->title = ctitle;
-
-	if (isMobi) {
-		r->buffer = FancyText::parseHTML(r, b, length);
-	} else {
-		r->buffer = FancyText::parseText(r, b, length);
-	}
-
-	r->resetFonts();
-	r->resizeView(480, 272);
-	return r;
+static inline uint32_t be32(const unsigned char* p) {
+  return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
 }
 
-void PalmDoc::getFileName(string& fn) {
-	fn = fileName;
+// PalmDoc LZ77: literals, runs of up to 8 literals, a blank and a
+// letter in one byte, or a copy of 3 to 10 bytes from up to 2047 back.
+// Stops at capacity or at a copy from before the start.
+static int unpack(const unsigned char* in, int n, char* out, int capacity) {
+  int o = 0;
+  int i = 0;
+  while (i < n && o < capacity) {
+    unsigned c = in[i++];
+    if (c >= 1 && c <= 8) {
+      int m = std::min(std::min((int)c, n - i), capacity - o);
+      memcpy(out + o, in + i, m);
+      o += m;
+      i += c;
+    } else if (c < 0x80) {
+      out[o++] = c;
+    } else if (c >= 0xc0) {
+      out[o++] = ' ';
+      if (o < capacity)
+        out[o++] = c ^ 0x80;
+    } else {
+      if (i >= n)
+        break;
+      unsigned pair = (c << 8) | in[i++];
+      int distance = (pair >> 3) & 0x7ff;
+      int m = (pair & 7) + 3;
+      if (distance == 0 || distance > o)
+        break;
+      // may overlap what it writes
+      for (; m > 0 && o < capacity; --m, ++o)
+        out[o] = out[o - distance];
+    }
+  }
+  return o;
+}
+
+// Bytes at the end of a MOBI record that aren't text: one entry for
+// each flag above bit 0, sized by a backwards varint at its end, then
+// the tail of a character cut by the record end for bit 0.
+static int trailingSize(const unsigned char* p, int n, int flags) {
+  int size = 0;
+  for (int f = flags >> 1; f != 0; f >>= 1) {
+    if ((f & 1) == 0)
+      continue;
+    int v = 0;
+    for (int k = n - size - 1, shift = 0; k >= 0 && shift < 28; --k, shift += 7) {
+      v |= (p[k] & 0x7f) << shift;
+      if (p[k] & 0x80)
+        break;
+    }
+    size += v;
+    if (size >= n)
+      return n;
+  }
+  if ((flags & 1) && n - size > 0)
+    size += (p[n - size - 1] & 3) + 1;
+  return std::min(size, n);
+}
+
+/*! \brief The text of a PalmDoc or MOBI book, decompressed as read.
+ *
+ *  Text record k holds bytes k * recordSize on, so a read goes straight
+ *  to the records it covers. The last few decompressed are kept.
+ */
+class PalmDocRecords : public TextSource {
+  TextSource* file;
+  std::vector<int64_t> offsets;   // of every record, then the file size
+  int64_t length;
+  int recordSize;
+  int compression;
+  int extraFlags;
+  std::mutex mutex;
+  std::vector<unsigned char> packed;
+  // decompressed records, keyed by record number
+  BlockCache cache;
+
+  BlockCache::Block* record(int k) {
+    BlockCache::Block* d = cache.find(k);
+    if (d != nullptr)
+      return d;
+    d = cache.victim();
+    // text records follow record 0
+    int64_t start = offsets[k + 1];
+    int n = (int)std::min(offsets[k + 2] - start, (int64_t)2 * recordSize + 0x1000);
+    packed.resize(std::max(n, 1));
+    if (file->read(start, (char*)&packed[0], n) != n)
+      return nullptr;
+    n -= trailingSize(&packed[0], n, extraFlags);
+    int len;
+    if (compression == PALMDOC_LZ77) {
+      len = unpack(&packed[0], n, d->data, recordSize);
+    } else {
+      len = std::min(n, recordSize);
+      memcpy(d->data, &packed[0], len);
+    }
+    // a record that comes out short is padded, so the ones after it
+    // still start where the header says
+    if (len < recordSize)
+      memset(d->data + len, ' ', recordSize - len);
+    cache.store(d, k, recordSize);
+    return d;
+  }
+
+public:
+  bool mobi;
+  int encoding;
+  string title;
+
+  PalmDocRecords() : file(nullptr), length(0), recordSize(0), compression(0), extraFlags(0), mobi(false),
+    encoding(TEXT_ENCODING_AUTO) {
+  }
+
+  ~PalmDocRecords() {
+    delete file;
+  }
+
+  // Reads the record list and the headers; no text yet.
+  bool open(const string& path) {
+    file = TextSource::openFile(path);
+    if (file == nullptr)
+      return false;
+    unsigned char h[PDB_HEADER];
+    if (file->read(0, (char*)h, PDB_HEADER) != PDB_HEADER)
+      return false;
+    if (memcmp(h + PDB_TYPE, "BOOKMOBI", 8) == 0)
+      mobi = true;
+    else if (memcmp(h + PDB_TYPE, "TEXtREAd", 8) != 0)
+      return false;
+    title.assign((const char*)h, strnlen((const char*)h, PDB_NAME));
+
+    int count = be16(h + PDB_RECORDS);
+    if (count < 2)
+      return false;
+    std::vector<unsigned char> list(count * PDB_ENTRY);
+    if (file->read(PDB_HEADER, (char*)&list[0], (int)list.size()) != (int)list.size())
+      return false;
+    for (int i = 0; i < count; ++i)
+      offsets.push_back(be32(&list[i * PDB_ENTRY]));
+    offsets.push_back(file->size());
+    for (int i = 0; i < count; ++i)
+      if (offsets[i + 1] < offsets[i])
+        return false;
+
+    unsigned char r0[MOBI_HEADER_READ];
+    int n = (int)std::min(offsets[1] - offsets[0], (int64_t)MOBI_HEADER_READ);
+    if (n < PALMDOC_HEADER || file->read(offsets[0], (char*)r0, n) != n)
+      return false;
+    compression = be16(r0);
+    length = be32(r0 + 4);
+    int records = be16(r0 + 8);
+    recordSize = be16(r0 + 10);
+    if (compression != PALMDOC_NONE && compression != PALMDOC_LZ77) {
+      // HUFF/CDIC books need their dictionaries whole
+      printf("PalmDoc: compression %d is not supported\n", compression);
+      return false;
+    }
+    if (recordSize == 0 || records >= count)
+      return false;
+    length = std::min(length, (int64_t)records * recordSize);
+
+    if (mobi) {
+      if (be16(r0 + 12) != 0) {
+        printf("PalmDoc: encrypted book\n");
+        return false;
+      }
+      if (n >= PALMDOC_HEADER + 16 && memcmp(r0 + PALMDOC_HEADER, "MOBI", 4) == 0) {
+        uint32_t headerLength = be32(r0 + PALMDOC_HEADER + 4);
+        uint32_t textEncoding = be32(r0 + PALMDOC_HEADER + 12);
+        encoding = textEncoding == 65001 ? TEXT_ENCODING_UTF8 : TEXT_ENCODING_LATIN1;
+        if (headerLength >= MOBI_HEADER_MIN && n >= MOBI_HEADER_READ)
+          extraFlags = be16(r0 + 0xf2);
+        if (n >= 0x5c) {
+          uint32_t nameOffset = be32(r0 + 0x54);
+          int nameLength = (int)std::min(be32(r0 + 0x58), (uint32_t)MOBI_TITLE_MAX);
+          char name[MOBI_TITLE_MAX];
+          if (nameLength > 0 && file->read(offsets[0] + nameOffset, name, nameLength) == nameLength)
+            title.assign(name, nameLength);
+        }
+      }
+    }
+
+    return cache.allocate(PALMDOC_CACHE_RECORDS, recordSize);
+  }
+
+  virtual int64_t size() {
+    return length;
+  }
+
+  virtual int read(int64_t offset, char* out, int n) {
+    if (offset < 0 || offset >= length || n <= 0)
+      return 0;
+    if (n > length - offset)
+      n = (int)(length - offset);
+    std::lock_guard<std::mutex> lock(mutex);
+    int done = 0;
+    while (done < n) {
+      int64_t pos = offset + done;
+      BlockCache::Block* d = record((int)(pos / recordSize));
+      if (d == nullptr)
+        return done > 0 ? done : -1;
+      int inRecord = (int)(pos % recordSize);
+      int m = std::min(n - done, recordSize - inRecord);
+      memcpy(out + done, d->data + inRecord, m);
+      done += m;
+    }
+    return done;
+  }
+};
+
+PalmDoc::PalmDoc() : mobi(false) { }
+PalmDoc::~PalmDoc() {
+  saveLastView();
 }
 
-void PalmDoc::getTitle(string& s, int type) {
-  switch(type){
-  case 1:
-    s = title;
-    break;
-  case 2:
-    s = longFileName;
-    break;
-  case 3:
-    s = title; 
-    s += " ["; 
-    s += longFileName;
-    s += "]";
-    break;
-  case 4:
-    s = longFileName;
-    s += " [";
-    s += title;
-    s += "]";
-    break;
-  default:
-    s = title;
-    break;
+PalmDoc* PalmDoc::create(string& file) {
+  #ifdef DEBUG
+    printf("PalmDoc::create\n");
+  #endif
+  PalmDocRecords* records = new PalmDocRecords();
+  if (!records->open(file)) {
+    #ifdef DEBUG
+      printf("cannot open %s as a PalmDoc\n", file.c_str());
+    #endif
+    delete records;
+    return NULL;
   }
+  bool mobi = records->mobi;
+  string title = records->title;
+
+  // the header's encoding unless the user picked one; PalmDoc has none
+  int encoding = User::options.txtEncoding != TEXT_ENCODING_AUTO ? User::options.txtEncoding : records->encoding;
+  TextSource* source = TextEncoding::open(records, encoding);
+  if (source != NULL && mobi)
+    source = HtmlText::lines(source);
+  if (source == NULL)
+    return NULL;
+
+  PalmDoc* r = new PalmDoc();
+  r->fileName = file;
+  r->title = title;
+  r->mobi = mobi;
+  r->hardLines = mobi;
+  r->openSource(source);
+
+  #ifdef PSP
+    r->resizeView(480, 272);
+  #elif defined(__vita__)
+    r->resizeView(960, 544);
+  #endif
+
+  return r;
+}
 
+void PalmDoc::getFileName(string& fn) {
+  fn = fileName;
+}
+
+void PalmDoc::getTitle(string& t) {
+  t = title;
 }
 
 void PalmDoc::getType(string& t) {
-	t = "PalmDoc";
+  t = mobi ? "MOBI" : "PalmDoc";
 }
 
 bool PalmDoc::isPalmDoc(string& file) {
-	return palmdoc_is_palmdoc(file.c_str()) != 0;
+  TextSource* s = TextSource::openFile(file);
+  if (s == NULL)
+    return false;
+  char h[PDB_HEADER];
+  bool palm = s->read(0, h, PDB_HEADER) == PDB_HEADER &&
+    (memcmp(h + PDB_TYPE, "TEXtREAd", 8) == 0 || memcmp(h + PDB_TYPE, "BOOKMOBI", 8) == 0);
+  delete s;
+  return palm;
 }
 
-}
\ No newline at end of file
+}
@@ -14,31 +14,38 @@
 #define BKPALMDOC_H
 
 #include "../graphics/screen.hpp"
-#include "../fancytext.h"
+#include "fancytext.hpp"
 
 using std::string;
 
 namespace bookr {
 
+/*! \brief PalmDoc and MOBI books.
+ *
+ *  Both are Palm databases of compressed text records. Records are
+ *  decompressed when the line index or the page on screen reaches them
+ *  and a few are kept, so a big book opens at once and never sits in
+ *  memory whole. MOBI text is HTML and is converted to lines on the way.
+ */
 class PalmDoc : public FancyText {
 private:
-	string fileName;
-	string title;
-	char* buffer;
+  string fileName;
+  string title;
+  bool mobi;
 
 protected:
-	PalmDoc();
-	~PalmDoc();
+  PalmDoc();
+  ~PalmDoc();
 
 public:
-	virtual void getFileName(string&);
-	virtual void getTitle(string&,int type = 0);
-	virtual void getType(string&);
+  virtual void getFileName(string&);
+  virtual void getTitle(string&);
+  virtual void getType(string&);
 
-	static PalmDoc* create(string& file,string& longFileName);
-	static bool isPalmDoc(string& file);
+  static PalmDoc* create(string& file);
+  static bool isPalmDoc(string& file);
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
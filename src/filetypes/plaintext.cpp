@@ -14,80 +14,35 @@
 #include <list>
 
 #include "plaintext.hpp"
+#include "textencoding.hpp"
 #include "../utils.hpp"
 
 namespace bookr {
 
-PlainText::PlainText() : buffer(0) { }
+PlainText::PlainText() { }
 PlainText::~PlainText() {
   saveLastView();
-  if (buffer)
-    free(buffer);
 }
 
 PlainText* PlainText::create(string& file) {
   #ifdef DEBUG
     printf("PlainText::create\n");
   #endif
-  PlainText* r = new PlainText();
-  r->fileName = file;
-
-  // read file to memory
-  #ifdef DEBUG
-    printf("pre fopen\n");
-  #endif
-  FILE* f = fopen(file.c_str(), "r");
-  if (f == NULL) {
+  // nothing is read up front: the line index streams the file in the
+  // background and pages are read as they are shown. Text in other
+  // encodings is converted to UTF-8 on the way.
+  TextSource* source = TextEncoding::openText(file, User::options.txtEncoding);
+  if (source == NULL) {
     #ifdef DEBUG
-      printf("fopen null\n");
+      printf("cannot open %s\n", file.c_str());
     #endif
-    delete r;
     return NULL;
   }
-  #ifdef DEBUG
-    printf("post fopen\n");
-  #endif
-
-  long length = 0;
-  fseek(f, 0, SEEK_END);
-  length = ftell(f);
-  fseek(f, 0, SEEK_SET);
-  if (length > 4*1024*1024)
-    length = 4*1024*1024;
-  char* b = (char*)malloc(length);
-  fread(b, length, 1, f);
-  fclose(f);
 
-  bool isHTML = false;
-  // FIX: make the heuristic a bit more advanced than that...
-  const char* fc = file.c_str();
-  int fs = file.size();
-  if (
-    ((fc[fs - 1] | 0x20) == 'l') &&
-    ((fc[fs - 2] | 0x20) == 'm') &&
-    ((fc[fs - 3] | 0x20) == 't') &&
-    ((fc[fs - 4] | 0x20) == 'h')
-  ) {
-    isHTML = true;
-  }
-  if (
-    ((fc[fs - 1] | 0x20) == 'm') &&
-    ((fc[fs - 2] | 0x20) == 't') &&
-    ((fc[fs - 3] | 0x20) == 'h')
-  ) {
-    isHTML = true;
-  }
-  
-  if (isHTML) {
-    //r->buffer = FancyText::parseHTML(r, b, length);
-  } else {
-    r->buffer = FancyText::parseText(r, b, length);
-  }
+  PlainText* r = new PlainText();
+  r->fileName = file;
+  r->openSource(source);
 
-  #ifdef DEBUG
-    printf("post parse\n");
-  #endif
-  
   //r->resetFonts();
   #ifdef PSP
     r->resizeView(480, 272);
@@ -111,10 +66,7 @@ void PlainText::getType(string& t) {
 }
 
 bool PlainText::isPlainText(string& file) {
-  // Read First 4 bytes
-  FILE* f = fopen(file.c_str(), "r");
   const char* ext = get_ext(file.c_str());
-  fclose(f);
 
   // Trusting the user for now...
   return strcmp(ext, ".txt") == 0;
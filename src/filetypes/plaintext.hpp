@@ -23,7 +23,6 @@ namespace bookr {
 class PlainText : public FancyText {
 private:
   string fileName;
-  char* buffer;
 
 protected:
   PlainText();
@@ -0,0 +1,581 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TEXT_SCAN_NEON
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#define TEXT_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "textencoding.hpp"
+#include "blockcache.hpp"
+
+namespace bookr {
+
+// textcodepages.cpp
+extern const uint16_t gbkTable[];
+extern const uint16_t sjisTable[];
+extern const uint16_t cp1251Table[];
+extern const uint16_t cp1252Table[];
+extern const uint16_t tcvn3Table[];
+extern const uint16_t vniTable[];
+extern const uint8_t vniMarkIndex[];
+extern const uint16_t vniCompose[];
+
+#define GBK_TRAILS 190
+#define SJIS_TRAILS 188
+#define VNI_MARKS 34
+#define REPLACEMENT 0xfffd
+
+// raw bytes converted at a time, and converted blocks kept
+#define TC_BLOCK (64 * 1024)
+#define TC_CACHE_BLOCKS 4
+
+static const char* names[TEXT_ENCODINGS] = {
+  "Auto", "UTF-8", "GBK", "Shift-JIS", "Cyrillic (CP1251)", "Latin-1", "VNI", "TCVN3"
+};
+
+const char* TextEncoding::name(int encoding) {
+  return encoding >= 0 && encoding < TEXT_ENCODINGS ? names[encoding] : names[TEXT_ENCODING_AUTO];
+}
+
+// Length of the run of ASCII at the start of p, sixteen bytes a step:
+// only the top bits need looking at.
+static inline int asciiSpan(const unsigned char* p, int n) {
+  int i = 0;
+  #if defined(TEXT_SCAN_SSE2)
+    for (; i + 16 <= n; i += 16) {
+      int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(p + i)));
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+  #elif defined(TEXT_SCAN_NEON)
+    for (; i + 16 <= n; i += 16) {
+      uint64x2_t v = vreinterpretq_u64_u8(vld1q_u8(p + i));
+      if (((vgetq_lane_u64(v, 0) | vgetq_lane_u64(v, 1)) & 0x8080808080808080ULL) != 0)
+        break;    // the loop below finds the byte
+    }
+  #endif
+  for (; i < n; ++i)
+    if (p[i] >= 0x80)
+      return i;
+  return n;
+}
+
+static inline int put(uint32_t c, char* out) {
+  if (c < 0x80) {
+    out[0] = c;
+    return 1;
+  } else if (c < 0x800) {
+    out[0] = 0xc0 | (c >> 6);
+    out[1] = 0x80 | (c & 0x3f);
+    return 2;
+  }
+  out[0] = 0xe0 | (c >> 12);
+  out[1] = 0x80 | ((c >> 6) & 0x3f);
+  out[2] = 0x80 | (c & 0x3f);
+  return 3;
+}
+
+bool TextEncoding::validUTF8(const char* text, int n, bool atEnd) {
+  const unsigned char* p = (const unsigned char*)text;
+  int i = 0;
+  for (;;) {
+    i += asciiSpan(p + i, n - i);
+    if (i >= n)
+      return true;
+    unsigned char b = p[i];
+    int need;
+    if (b < 0xc2)
+      return false;   // a stray continuation byte, or overlong
+    else if (b < 0xe0)
+      need = 1;
+    else if (b < 0xf0)
+      need = 2;
+    else if (b < 0xf5)
+      need = 3;
+    else
+      return false;
+    int have = std::min(need, n - i - 1);
+    for (int k = 1; k <= have; ++k)
+      if ((p[i + k] & 0xc0) != 0x80)
+        return false;
+    if (have < need)
+      return !atEnd;
+    // overlong forms, surrogates and past U+10FFFF
+    unsigned char c = p[i + 1];
+    if ((b == 0xe0 && c < 0xa0) || (b == 0xed && c >= 0xa0) || (b == 0xf0 && c < 0x90) || (b == 0xf4 && c >= 0x90))
+      return false;
+    i += need + 1;
+  }
+}
+
+static inline int gbkTrail(unsigned char t) {
+  return t >= 0x40 && t <= 0xfe && t != 0x7f ? t - (t < 0x7f ? 0x40 : 0x41) : -1;
+}
+
+static inline int sjisLead(unsigned char b) {
+  if (b >= 0x81 && b <= 0x9f)
+    return b - 0x81;
+  if (b >= 0xe0 && b <= 0xfc)
+    return b - 0xe0 + 31;
+  return -1;
+}
+
+static inline int sjisTrail(unsigned char t) {
+  return t >= 0x40 && t <= 0xfc && t != 0x7f ? t - (t < 0x7f ? 0x40 : 0x41) : -1;
+}
+
+// the letters VNI puts marks after: aeouy, both cases, then ơ ư Ơ Ư
+static inline int vniBase(unsigned char b) {
+  switch (b) {
+    case 'a': return 0;
+    case 'e': return 1;
+    case 'o': return 2;
+    case 'u': return 3;
+    case 'y': return 4;
+    case 'A': return 5;
+    case 'E': return 6;
+    case 'O': return 7;
+    case 'U': return 8;
+    case 'Y': return 9;
+    case 0xf4: return 10;
+    case 0xf6: return 11;
+    case 0xd4: return 12;
+    case 0xd6: return 13;
+  }
+  return -1;
+}
+
+static inline bool vniMark(unsigned char b) {
+  return b >= 0x80 && vniMarkIndex[b - 0x80] != 0;
+}
+
+static const uint16_t* singleByteTable(int encoding) {
+  switch (encoding) {
+    case TEXT_ENCODING_CP1251: return cp1251Table;
+    case TEXT_ENCODING_TCVN3: return tcvn3Table;
+    case TEXT_ENCODING_VNI: return vniTable;
+  }
+  return cp1252Table;
+}
+
+// Decodes the character at p, which the ASCII span loop stopped at.
+// Returns its length, or 0 if the buffer ends before it does.
+static inline int decodeOne(int encoding, const uint16_t* single, const unsigned char* p, int n, bool atEnd, uint32_t& c) {
+  unsigned char b = p[0];
+  switch (encoding) {
+    case TEXT_ENCODING_GBK: {
+      if (b < 0x80) {
+        c = b;
+        return 1;
+      }
+      if (b == 0x80) {
+        c = 0x20ac;   // CP936 puts the euro here
+        return 1;
+      }
+      if (b == 0xff)
+        break;
+      if (n < 2) {
+        if (!atEnd)
+          return 0;
+        break;
+      }
+      int t = gbkTrail(p[1]);
+      if (t < 0)
+        break;
+      c = gbkTable[(b - 0x81) * GBK_TRAILS + t];
+      if (c == 0)
+        c = REPLACEMENT;
+      return 2;
+    }
+    case TEXT_ENCODING_SJIS: {
+      if (b < 0x80) {
+        c = b;
+        return 1;
+      }
+      if (b >= 0xa1 && b <= 0xdf) {
+        c = 0xff61 + (b - 0xa1);    // halfwidth katakana
+        return 1;
+      }
+      int lead = sjisLead(b);
+      if (lead < 0)
+        break;
+      if (n < 2) {
+        if (!atEnd)
+          return 0;
+        break;
+      }
+      int t = sjisTrail(p[1]);
+      if (t < 0)
+        break;
+      c = sjisTable[lead * SJIS_TRAILS + t];
+      if (c == 0)
+        c = REPLACEMENT;
+      return 2;
+    }
+    case TEXT_ENCODING_VNI: {
+      int base = vniBase(b);
+      if (base >= 0) {
+        // the mark that may follow changes the letter
+        if (n < 2 && !atEnd)
+          return 0;
+        if (n >= 2 && vniMark(p[1])) {
+          uint16_t composed = vniCompose[base * VNI_MARKS + vniMarkIndex[p[1] - 0x80] - 1];
+          if (composed != 0) {
+            c = composed;
+            return 2;
+          }
+        }
+      }
+      c = b < 0x80 ? b : single[b - 0x80];
+      return 1;
+    }
+    default:
+      c = b < 0x80 ? b : single[b - 0x80];
+      return 1;
+  }
+  c = REPLACEMENT;
+  return 1;
+}
+
+int TextEncoding::convert(int encoding, const char* text, int n, bool atEnd, char* out, int& consumed) {
+  const unsigned char* p = (const unsigned char*)text;
+  const uint16_t* single = singleByteTable(encoding);
+  bool vni = encoding == TEXT_ENCODING_VNI;
+  char* o = out;
+  int i = 0;
+  while (i < n) {
+    int m = asciiSpan(p + i, n - i);
+    // a VNI vowel belongs to the mark after it
+    if (vni && m > 0 && vniBase(p[i + m - 1]) >= 0 && (i + m < n ? vniMark(p[i + m]) : !atEnd))
+      --m;
+    memcpy(o, p + i, m);
+    o += m;
+    i += m;
+    if (i >= n)
+      break;
+    uint32_t c;
+    int len = decodeOne(encoding, single, p + i, n - i, atEnd, c);
+    if (len == 0)
+      break;
+    o += put(c, o);
+    i += len;
+  }
+  consumed = i;
+  return (int)(o - out);
+}
+
+// Scores for the double byte sets over a sample: characters that decode,
+// bytes that don't, and the characters typical of each language.
+struct DoubleByteScore {
+  int pairs;
+  int errors;
+  int typical;
+  int odd;      // SJIS halfwidth katakana, rare in real text
+};
+
+static DoubleByteScore scoreGBK(const unsigned char* p, int n) {
+  DoubleByteScore s = { 0, 0, 0, 0 };
+  for (int i = 0; i < n; ) {
+    unsigned char b = p[i];
+    if (b < 0x80) {
+      ++i;
+      continue;
+    }
+    int t = i + 1 < n && b >= 0x81 && b <= 0xfe ? gbkTrail(p[i + 1]) : -1;
+    if (t >= 0 && gbkTable[(b - 0x81) * GBK_TRAILS + t] != 0) {
+      ++s.pairs;
+      // the common hanzi of GB2312 level 1 and 2
+      if (b >= 0xb0 && b <= 0xf7 && p[i + 1] >= 0xa1)
+        ++s.typical;
+      i += 2;
+    } else {
+      // a cut pair at the end of the sample is no error
+      if (i + 1 < n)
+        ++s.errors;
+      ++i;
+    }
+  }
+  return s;
+}
+
+static DoubleByteScore scoreSJIS(const unsigned char* p, int n) {
+  DoubleByteScore s = { 0, 0, 0, 0 };
+  for (int i = 0; i < n; ) {
+    unsigned char b = p[i];
+    if (b < 0x80) {
+      ++i;
+      continue;
+    }
+    if (b >= 0xa1 && b <= 0xdf) {
+      ++s.odd;
+      ++i;
+      continue;
+    }
+    int lead = sjisLead(b);
+    int t = i + 1 < n && lead >= 0 ? sjisTrail(p[i + 1]) : -1;
+    if (t >= 0 && sjisTable[lead * SJIS_TRAILS + t] != 0) {
+      ++s.pairs;
+      // hiragana and katakana
+      unsigned char u = p[i + 1];
+      if ((b == 0x82 && u >= 0x9f && u <= 0xf1) || (b == 0x83 && u <= 0x96))
+        ++s.typical;
+      i += 2;
+    } else {
+      if (i + 1 < n)
+        ++s.errors;
+      ++i;
+    }
+  }
+  return s;
+}
+
+int TextEncoding::detect(const char* sample, int n, bool atEnd) {
+  const unsigned char* p = (const unsigned char*)sample;
+  if (validUTF8(sample, n, atEnd))
+    return TEXT_ENCODING_UTF8;
+
+  // Japanese always has plenty of kana; Chinese mostly keeps to GB2312
+  DoubleByteScore sjis = scoreSJIS(p, n);
+  if (sjis.pairs > 0 && sjis.errors * 100 <= sjis.pairs && sjis.typical * 5 >= sjis.pairs && sjis.odd * 10 <= sjis.pairs)
+    return TEXT_ENCODING_SJIS;
+  DoubleByteScore gbk = scoreGBK(p, n);
+  if (gbk.pairs > 0 && gbk.errors * 100 <= gbk.pairs && gbk.typical * 2 >= gbk.pairs)
+    return TEXT_ENCODING_GBK;
+
+  // single byte sets, by which high bytes turn up where
+  int high = 0;       // bytes >= 0x80
+  int runs = 0;       // ... right after another one
+  int marked = 0;     // VNI marks after a vowel, and VNI's ơ ư đ
+  int tcvn = 0;       // TCVN3 ă â ê ô ơ ư đ and its lowercase with tones
+  for (int i = 0; i < n; ++i) {
+    unsigned char b = p[i];
+    if (b < 0x80)
+      continue;
+    ++high;
+    if (i > 0 && p[i - 1] >= 0x80)
+      ++runs;
+    if ((vniMark(b) && i > 0 && vniBase(p[i - 1]) >= 0) || b == 0xf4 || b == 0xf6 || b == 0xf1)
+      ++marked;
+    // but not the Latin-1 quotes, dot and degree in the same place
+    if (((b >= 0xa8 && b <= 0xae) || (b >= 0xb5 && b <= 0xdf)) && b != 0xab && b != 0xbb && b != 0xb7 && b != 0xb0)
+      ++tcvn;
+  }
+  if (marked * 10 >= high * 7)
+    return TEXT_ENCODING_VNI;
+  // Cyrillic words are all high bytes
+  if (runs * 2 >= high)
+    return TEXT_ENCODING_CP1251;
+  if (tcvn * 3 >= high)
+    return TEXT_ENCODING_TCVN3;
+  return TEXT_ENCODING_LATIN1;
+}
+
+/*! \brief A TextSource converted to UTF-8 as it is read.
+ *
+ *  The raw text is converted in blocks of TC_BLOCK bytes, front to back,
+ *  the first time anything at or past them is read; where each block
+ *  starts in both texts is kept, so later reads convert just the blocks
+ *  they need again. Opening a big file only converts the first page, and
+ *  the line index streaming through it learns the size on the way.
+ */
+class TranscodedTextSource : public TextSource {
+  struct Span {
+    int64_t in;
+    int64_t out;
+  };
+
+  TextSource* raw;
+  int encoding;
+  std::mutex mutex;
+  // starts of the blocks converted so far, plus the next one until
+  // complete
+  std::vector<Span> spans;
+  bool complete;
+  std::atomic<bool> known;
+  int64_t length;
+  char* input;
+  // converted blocks, keyed by block number
+  BlockCache cache;
+
+  BlockCache::Block* convertBlock(int k) {
+    BlockCache::Block* c = cache.find(k);
+    if (c != nullptr)
+      return c;
+    c = cache.victim();
+    int r = raw->read(spans[k].in, input, TC_BLOCK);
+    if (r < 0)
+      return nullptr;
+    bool atEnd = r < TC_BLOCK;
+    int consumed;
+    cache.store(c, k, TextEncoding::convert(encoding, input, r, atEnd, c->data, consumed));
+    if (k + 1 == (int)spans.size() && !complete) {
+      if (atEnd) {
+        length = spans[k].out + c->len;
+        complete = true;
+        known = true;
+      } else {
+        // a character cut by the end of the block starts the next one
+        Span next = { spans[k].in + consumed, spans[k].out + c->len };
+        spans.push_back(next);
+      }
+    }
+    return c;
+  }
+
+public:
+  TranscodedTextSource(TextSource* r, int e) : raw(r), encoding(e), complete(false), known(false), length(0) {
+    Span first = { 0, 0 };
+    spans.push_back(first);
+    input = (char*)malloc(TC_BLOCK);
+    cache.allocate(TC_CACHE_BLOCKS, 3 * TC_BLOCK);
+  }
+
+  ~TranscodedTextSource() {
+    free(input);
+    delete raw;
+  }
+
+  bool ready() {
+    return input != nullptr && cache.ready();
+  }
+
+  virtual bool sizeKnown() {
+    return known;
+  }
+
+  virtual TextSource* file() {
+    return raw;
+  }
+
+  // encoding, length, then the spans; only once complete
+  virtual std::vector<int64_t> state() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<int64_t> saved;
+    if (!complete)
+      return saved;
+    saved.push_back(encoding);
+    saved.push_back(length);
+    for (size_t i = 0; i < spans.size(); ++i) {
+      saved.push_back(spans[i].in);
+      saved.push_back(spans[i].out);
+    }
+    return saved;
+  }
+
+  // The same bytes convert to the same blocks, so the spans found so far
+  // are a prefix of the saved ones and the cached blocks stay valid.
+  virtual bool restore(const std::vector<int64_t>& saved) {
+    if (saved.size() < 4 || saved.size() % 2 != 0 || saved[0] != encoding || saved[1] < 0)
+      return false;
+    std::vector<Span> table;
+    for (size_t i = 2; i < saved.size(); i += 2) {
+      Span s = { saved[i], saved[i + 1] };
+      if (table.empty() ? s.in != 0 || s.out != 0 : s.in <= table.back().in || s.out < table.back().out || s.out > saved[1])
+        return false;
+      table.push_back(s);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (table.size() < spans.size())
+      return false;
+    spans.swap(table);
+    length = saved[1];
+    complete = true;
+    known = true;
+    return true;
+  }
+
+  // converts the rest of the text to measure it; a block at a time, so
+  // readers get a turn
+  virtual int64_t size() {
+    for (;;) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (complete)
+        return length;
+      if (convertBlock((int)spans.size() - 1) == nullptr)
+        return spans.back().out;
+    }
+  }
+
+  virtual int read(int64_t offset, char* out, int n) {
+    if (offset < 0 || n <= 0)
+      return 0;
+    std::lock_guard<std::mutex> lock(mutex);
+    int done = 0;
+    while (done < n) {
+      int64_t pos = offset + done;
+      while (!complete && pos >= spans.back().out)
+        if (convertBlock((int)spans.size() - 1) == nullptr)
+          return done > 0 ? done : -1;
+      if (complete && pos >= length)
+        break;
+      // the last block starting at or before pos
+      int k = (int)(std::upper_bound(spans.begin(), spans.end(), pos,
+        [](int64_t v, const Span& s) { return v < s.out; }) - spans.begin()) - 1;
+      BlockCache::Block* c = convertBlock(k);
+      if (c == nullptr)
+        return done > 0 ? done : -1;
+      int inBlock = (int)(pos - spans[k].out);
+      int avail = c->len - inBlock;
+      if (avail <= 0)
+        break;
+      int m = std::min(n - done, avail);
+      memcpy(out + done, c->data + inBlock, m);
+      done += m;
+    }
+    return done;
+  }
+};
+
+TextSource* TextEncoding::transcode(TextSource* raw, int encoding) {
+  if (encoding <= TEXT_ENCODING_UTF8 || encoding >= TEXT_ENCODINGS)
+    return raw;
+  TranscodedTextSource* s = new TranscodedTextSource(raw, encoding);
+  if (!s->ready()) {
+    printf("TextEncoding: cannot allocate conversion buffers\n");
+    delete s;
+    return NULL;
+  }
+  return s;
+}
+
+TextSource* TextEncoding::open(TextSource* raw, int encoding) {
+  if (encoding == TEXT_ENCODING_AUTO) {
+    std::vector<char> sample(TEXT_ENCODING_SAMPLE);
+    int n = raw->read(0, &sample[0], TEXT_ENCODING_SAMPLE);
+    encoding = n > 0 ? detect(&sample[0], n, n < TEXT_ENCODING_SAMPLE) : TEXT_ENCODING_UTF8;
+    #ifdef DEBUG
+      printf("TextEncoding: text looks like %s\n", name(encoding));
+    #endif
+  }
+  return transcode(raw, encoding);
+}
+
+TextSource* TextEncoding::openText(const string& path, int encoding) {
+  TextSource* raw = TextSource::openFile(path);
+  if (raw == NULL)
+    return NULL;
+  return open(raw, encoding);
+}
+
+}
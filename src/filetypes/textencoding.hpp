@@ -0,0 +1,83 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKTEXTENCODING_H
+#define BKTEXTENCODING_H
+
+#include <cstdint>
+
+#include "textsource.hpp"
+
+namespace bookr {
+
+// values of the txtEncoding option
+#define TEXT_ENCODING_AUTO 0
+#define TEXT_ENCODING_UTF8 1
+#define TEXT_ENCODING_GBK 2
+#define TEXT_ENCODING_SJIS 3
+#define TEXT_ENCODING_CP1251 4
+#define TEXT_ENCODING_LATIN1 5
+#define TEXT_ENCODING_VNI 6
+#define TEXT_ENCODING_TCVN3 7
+#define TEXT_ENCODINGS 8
+
+// bytes read to guess the encoding of a file
+#define TEXT_ENCODING_SAMPLE (64 * 1024)
+
+namespace TextEncoding {
+  const char* name(int encoding);
+
+  /**
+   * Guesses the encoding of a sample from the start of a file: UTF-8 when
+   * it validates, then the double byte sets by how cleanly they decode,
+   * then the single byte ones by which bytes are used. atEnd says the
+   * sample is the whole file, so a cut sequence at its end is an error.
+   */
+  int detect(const char* sample, int n, bool atEnd);
+
+  /**
+   * True if p holds well formed UTF-8. A sequence cut by the end of the
+   * buffer is fine unless atEnd.
+   */
+  bool validUTF8(const char* p, int n, bool atEnd);
+
+  /**
+   * Converts up to n bytes of text in encoding to UTF-8. Stops before a
+   * character the buffer ends in the middle of, unless atEnd; consumed is
+   * set to the bytes used. out needs room for 3 * n bytes; returns the
+   * bytes written. Bad bytes become U+FFFD.
+   */
+  int convert(int encoding, const char* in, int n, bool atEnd, char* out, int& consumed);
+
+  /**
+   * Source reading raw in encoding as UTF-8. Converts on demand, front
+   * to back, keeping a few converted blocks; takes raw over. UTF-8 gives
+   * back raw itself.
+   */
+  TextSource* transcode(TextSource* raw, int encoding);
+
+  /**
+   * raw as UTF-8, guessing its encoding from the start of it first when
+   * encoding is TEXT_ENCODING_AUTO; takes raw over.
+   */
+  TextSource* open(TextSource* raw, int encoding);
+
+  /**
+   * Opens a text file as UTF-8, guessing its encoding first when encoding
+   * is TEXT_ENCODING_AUTO. NULL if the file cannot be opened.
+   */
+  TextSource* openText(const string& path, int encoding);
+}
+
+}
+
+#endif
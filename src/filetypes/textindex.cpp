@@ -0,0 +1,562 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TEXT_SCAN_NEON
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#define TEXT_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "linebreak.hpp"
+#include "textindex.hpp"
+
+namespace bookr {
+
+// the index thread streams the file in chunks this big
+#define INDEX_CHUNK (256 * 1024)
+// finding a line reads forward in smaller steps
+#define LOCATE_CHUNK (16 * 1024)
+// files this big are indexed on all cores
+#ifndef TEXT_INDEX_PARALLEL_MIN
+#define TEXT_INDEX_PARALLEL_MIN (8 * 1024 * 1024)
+#endif
+// how far past a cut to look for a safe line start
+#define SAFE_SEARCH (1024 * 1024)
+// smaller files index faster than their table loads
+#define TEXT_INDEX_SAVE_MIN (4 * 1024 * 1024)
+
+// Offset of the first '\n' in p[0, n), or n. Sixteen bytes a step where
+// the cpu has vectors; the vita and switch both have NEON.
+static inline int findNewline(const char* p, int n) {
+  int i = 0;
+  #if defined(TEXT_SCAN_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; i + 16 <= n; i += 16) {
+      int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i)), nl));
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+  #elif defined(TEXT_SCAN_NEON)
+    const uint8x16_t nl = vdupq_n_u8('\n');
+    for (; i + 16 <= n; i += 16) {
+      uint64x2_t eq = vreinterpretq_u64_u8(vceqq_u8(vld1q_u8((const uint8_t*)p + i), nl));
+      if ((vgetq_lane_u64(eq, 0) | vgetq_lane_u64(eq, 1)) != 0)
+        break;    // the loop below finds the lane
+    }
+  #endif
+  for (; i < n; ++i)
+    if (p[i] == '\n')
+      return i;
+  return n;
+}
+
+TextLineScanner::TextLineScanner(int w, int64_t offset, int l) :
+  wrapCR(w < 0 ? 0 : w), newlines(0), runStart(0), eatUntil(0), pending(0), lineBytes(0),
+  pos(offset), line(l), lineStart(offset), brokeOnNewline(false) {
+}
+
+void TextLineScanner::popPending() {
+  // the breaks of a run are its first newlines, so the lines they start
+  // follow one another byte by byte
+  ++line;
+  lineStart = runStart + 1;
+  ++runStart;
+  --pending;
+  brokeOnNewline = true;
+  lineBytes = (int)(pos - lineStart);
+}
+
+int TextLineScanner::feed(const char* p, int n, bool& newLine) {
+  newLine = false;
+  if (pending > 0) {
+    popPending();
+    newLine = true;
+    return 0;
+  }
+  int i = 0;
+  while (i < n) {
+    if (newlines == 0 && pos >= eatUntil && lineBytes < TEXT_LINE_MAX) {
+      // plain text: skip to the next newline or the line limit in one go
+      int span = findNewline(p + i, std::min(n - i, TEXT_LINE_MAX - lineBytes));
+      lineBytes += span;
+      pos += span;
+      i += span;
+      if (i >= n)
+        break;
+    }
+    unsigned char c = p[i];
+    if (c == '\n' && (newlines > 0 || pos >= eatUntil)) {
+      if (newlines == 0)
+        runStart = pos;
+      ++newlines;
+      ++pos;
+      ++i;
+      continue;
+    }
+    if (newlines > 0) {
+      int breaks = endRun();
+      if (breaks > 0) {
+        // c starts (or continues) the last line of the run; scan it again
+        pending = breaks;
+        popPending();
+        newLine = true;
+        return i;
+      }
+    }
+    if (lineBytes >= TEXT_LINE_MAX && (c & 0xc0) != 0x80 && pos >= eatUntil) {
+      ++line;
+      lineStart = pos;
+      lineBytes = 0;
+      brokeOnNewline = false;
+      newLine = true;
+      return i;
+    }
+    ++lineBytes;
+    ++pos;
+    ++i;
+  }
+  return i;
+}
+
+// Mirrors what the reader always did with txtWrapCR: a newline breaks
+// when the wrapCR + 1 bytes after it are newlines too. One that doesn't
+// turns the newlines among those bytes into spaces.
+int TextLineScanner::endRun() {
+  int breaks = newlines;
+  if (wrapCR > 0) {
+    breaks = std::max(0, newlines - wrapCR - 1);
+    eatUntil = runStart + breaks + wrapCR + 2;
+  }
+  lineBytes += newlines;
+  newlines = 0;
+  return breaks;
+}
+
+bool TextLineScanner::finish() {
+  if (newlines > 0)
+    pending = endRun();
+  if (pending > 0) {
+    popPending();
+    return true;
+  }
+  return false;
+}
+
+// Walks the lines of a source from a line start, wrapping each one.
+class TextLineWalker {
+  TextSource* source;
+  int width;
+  GlyphAdvances* advances;
+  bool hyphenate;
+  TextLineScanner scanner;
+  char* buffer;
+  int capacity;
+  int64_t bufferOffset;
+  int length;
+  int used;
+  bool eof;
+  std::vector<char> spill;
+  std::vector<uint32_t> breaks;
+
+  int wrapTo(int64_t end);
+
+public:
+  TextLineIndex::Checkpoint at;   // the line being walked
+  int lastDisplay;                // display lines of the line just left
+
+  TextLineWalker(TextSource* s, const TextLayoutKey& key, GlyphAdvances* a, const TextLineIndex::Checkpoint& from, int chunk) :
+    source(s), width(key.width), advances(a), hyphenate(key.hyphenate), scanner(key.wrapCR, from.offset, from.line),
+    capacity(chunk), bufferOffset(from.offset), length(0), used(0), eof(false), at(from), lastDisplay(0) {
+    buffer = (char*)malloc(chunk);
+    if (buffer == nullptr)
+      eof = true;
+  }
+
+  ~TextLineWalker() {
+    free(buffer);
+  }
+
+  /**
+   * Wrap the current line and move on to the next. Returns false if the
+   * current line is the last one.
+   */
+  bool next();
+};
+
+int TextLineWalker::wrapTo(int64_t end) {
+  int n = (int)(end - at.offset);
+  if (n <= 0)
+    return 1;
+  const char* text;
+  if (at.offset >= bufferOffset) {
+    text = buffer + (at.offset - bufferOffset);
+  } else {
+    // started in an earlier buffer
+    spill.resize(n);
+    n = std::max(source->read(at.offset, &spill[0], n), 0);
+    text = &spill[0];
+  }
+  // break bits only matter to a line that wraps
+  if (TextLayout::fits(text, n, width, advances))
+    return 1;
+  breaks.resize(LINE_BREAK_WORDS(n) + 1);
+  LineBreaks::find(text, n, &breaks[0]);
+  return TextLayout::wrap(text, n, width, advances, &breaks[0], hyphenate, nullptr);
+}
+
+bool TextLineWalker::next() {
+  bool newLine = false;
+  while (!newLine) {
+    if (!eof && used == length) {
+      bufferOffset += length;
+      length = source->read(bufferOffset, buffer, capacity);
+      used = 0;
+      if (length <= 0) {
+        length = 0;
+        eof = true;
+      }
+    }
+    if (!eof) {
+      used += scanner.feed(buffer + used, length - used, newLine);
+    } else if (!scanner.finish()) {
+      lastDisplay = wrapTo(scanner.pos);
+      return false;
+    } else {
+      newLine = true;
+    }
+  }
+  lastDisplay = wrapTo(scanner.brokeOnNewline ? scanner.lineStart - 1 : scanner.lineStart);
+  at.offset = scanner.lineStart;
+  at.line = scanner.line;
+  at.display += lastDisplay;
+  return true;
+}
+
+TextLineIndex::TextLineIndex(TextSource* s, const TextLayoutKey& k, const string& path) :
+  source(s), key(k), advances(GlyphAdvances::forScale(k.scale)), cachePath(path), stop(false), done(false), lines(1), displayLines(1), scanned(0) {
+  Checkpoint first = { 0, 0, 0 };
+  checkpoints.push_back(first);
+  if (!cachePath.empty() && source->file()->size() >= TEXT_INDEX_SAVE_MIN && load())
+    done = true;
+}
+
+TextLineIndex::~TextLineIndex() {
+  stop = true;
+  if (thread.joinable())
+    thread.join();
+}
+
+void TextLineIndex::start() {
+  if (!done)
+    thread = std::thread(&TextLineIndex::run, this);
+}
+
+static int indexWorkers() {
+  #ifdef __vita__
+    return 3;   // cores an application gets
+  #else
+    unsigned n = std::thread::hardware_concurrency();
+    return n > 0 ? (int)std::min(n, 8u) : 1;
+  #endif
+}
+
+// A line start that doesn't depend on anything before it. With wrapCR = 0
+// that is anything after a newline. Otherwise, up to wrapCR newlines of a
+// run may be joined because of an earlier one, so a run of 2 * wrapCR + 3
+// breaks no matter what, and its last line starts wrapCR + 1 newlines
+// before its end.
+int64_t TextLineIndex::findSafeStart(int64_t from) {
+  char buffer[LOCATE_CHUNK];
+  int wrapCR = key.wrapCR;
+  int need = wrapCR > 0 ? 2 * wrapCR + 3 : 1;
+  int newlines = 0;
+  for (int64_t offset = from; offset < from + SAFE_SEARCH; ) {
+    int n = source->read(offset, buffer, LOCATE_CHUNK);
+    if (n <= 0)
+      return -1;
+    for (int i = 0; i < n; ++i) {
+      if (buffer[i] == '\n') {
+        ++newlines;
+        if (wrapCR == 0)
+          return offset + i + 1;
+      } else {
+        if (newlines >= need)
+          return offset + i - wrapCR - 1;
+        newlines = 0;
+      }
+    }
+    offset += n;
+  }
+  return -1;
+}
+
+// Walks the lines starting in [start, end); start must be a line start.
+// Checkpoints go to out numbered from start, or straight into the index if
+// out is null. Returns the lines and display lines walked, -1 if stopped.
+TextLineIndex::Count TextLineIndex::scanRange(int64_t start, int64_t end, std::vector<Checkpoint>* out) {
+  Checkpoint from = { start, 0, 0 };
+  TextLineWalker walker(source, key, advances, from, INDEX_CHUNK);
+  int next = TEXT_INDEX_LINES;
+  int64_t nextOffset = start + TEXT_INDEX_BYTES;
+  Count count = { -1, -1 };
+
+  while (!stop) {
+    if (!walker.next()) {
+      // end of the file
+      count.lines = walker.at.line + 1;
+      count.display = walker.at.display + walker.lastDisplay;
+      if (out == nullptr) {
+        lines = count.lines;
+        displayLines = count.display;
+        scanned = source->size();
+      }
+      break;
+    }
+    // a line starting right at the end of the file is still a line
+    if (walker.at.offset >= end && end < source->size()) {
+      count.lines = walker.at.line;
+      count.display = walker.at.display;
+      break;
+    }
+    if (walker.at.line >= next || walker.at.offset >= nextOffset) {
+      if (out != nullptr) {
+        out->push_back(walker.at);
+      } else {
+        std::lock_guard<std::mutex> lock(mutex);
+        checkpoints.push_back(walker.at);
+      }
+      next = walker.at.line + TEXT_INDEX_LINES;
+      nextOffset = walker.at.offset + TEXT_INDEX_BYTES;
+    }
+    if (out == nullptr) {
+      lines = walker.at.line + 1;
+      displayLines = walker.at.display + 1;
+      scanned = walker.at.offset;
+    }
+  }
+  return count;
+}
+
+// Big files are cut at safe line starts and the pieces walked in
+// parallel. The first piece publishes as it goes so the first pages work
+// straight away; the others are merged in order as they finish.
+void TextLineIndex::run() {
+  // A converted source only learns its size by being read. Converting a
+  // big one through first costs far less than walking it on one core.
+  bool known = source->sizeKnown();
+  if (!known && source->file()->size() >= TEXT_INDEX_PARALLEL_MIN && indexWorkers() > 1) {
+    source->size();
+    known = source->sizeKnown();
+  }
+  int64_t size = known ? source->size() : INT64_MAX;
+  std::vector<int64_t> starts(1, 0);
+  if (known && size >= TEXT_INDEX_PARALLEL_MIN) {
+    int workers = indexWorkers();
+    for (int k = 1; k < workers; ++k) {
+      int64_t s = findSafeStart(size * k / workers);
+      if (s > starts.back() && s < size)
+        starts.push_back(s);
+    }
+  }
+  starts.push_back(size);
+
+  int pieces = (int)starts.size() - 1;
+  std::vector<std::vector<Checkpoint> > found(pieces);
+  std::vector<Count> counts(pieces);
+  std::vector<std::thread> helpers;
+  for (int k = 1; k < pieces; ++k)
+    helpers.push_back(std::thread([this, k, &starts, &found, &counts] {
+      counts[k] = scanRange(starts[k], starts[k + 1], &found[k]);
+    }));
+
+  Count base = scanRange(0, starts[1], nullptr);
+  if (pieces > 1 && base.lines >= 0) {
+    lines = base.lines + 1;
+    displayLines = base.display + 1;
+  }
+  for (int k = 1; k < pieces; ++k) {
+    helpers[k - 1].join();
+    if (base.lines < 0 || counts[k].lines < 0) {
+      base.lines = -1;
+      continue;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      Checkpoint first = { starts[k], base.lines, base.display };
+      checkpoints.push_back(first);
+      for (size_t i = 0; i < found[k].size(); ++i) {
+        Checkpoint c = { found[k][i].offset, found[k][i].line + base.lines, found[k][i].display + base.display };
+        checkpoints.push_back(c);
+      }
+    }
+    base.lines += counts[k].lines;
+    base.display += counts[k].display;
+    // the line at the next cut is known to exist too
+    bool last = k + 1 == pieces;
+    lines = last ? base.lines : base.lines + 1;
+    displayLines = last ? base.display : base.display + 1;
+    scanned = starts[k + 1];
+  }
+
+  #ifdef DEBUG
+    printf("TextLineIndex: %d lines, %d display lines, %d checkpoints, %d pieces\n",
+      (int)lines, (int)displayLines, (int)checkpoints.size(), pieces);
+  #endif
+  // a converted source knows its size once the walk reached the end
+  if (base.lines >= 0 && !cachePath.empty() && source->sizeKnown() && source->file()->size() >= TEXT_INDEX_SAVE_MIN)
+    save();
+  done = true;
+}
+
+TextLineIndex::Checkpoint TextLineIndex::checkpointBefore(int value, bool byDisplay) {
+  std::lock_guard<std::mutex> lock(mutex);
+  int lo = 0;
+  int hi = (int)checkpoints.size() - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if ((byDisplay ? checkpoints[mid].display : checkpoints[mid].line) <= value)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return checkpoints[lo];
+}
+
+int64_t TextLineIndex::lineOffset(int line) {
+  Checkpoint c = checkpointBefore(line, false);
+  TextLineWalker walker(source, key, advances, c, LOCATE_CHUNK);
+  while (walker.at.line < line)
+    if (!walker.next())
+      return source->size();
+  return walker.at.offset;
+}
+
+TextLineIndex::Checkpoint TextLineIndex::lineForDisplay(int d) {
+  Checkpoint c = checkpointBefore(d, true);
+  TextLineWalker walker(source, key, advances, c, LOCATE_CHUNK);
+  for (;;) {
+    Checkpoint here = walker.at;
+    if (!walker.next() || walker.at.display > d)
+      return here;
+  }
+}
+
+int TextLineIndex::displayForLine(int line) {
+  Checkpoint c = checkpointBefore(line, false);
+  TextLineWalker walker(source, key, advances, c, LOCATE_CHUNK);
+  while (walker.at.line < line)
+    if (!walker.next())
+      return walker.at.display + walker.lastDisplay;
+  return walker.at.display;
+}
+
+// Saved tables ----------------------------------------------------------
+
+// The checkpoints follow the header, then the source's state() words.
+// Tables are keyed on the file as stored, which for a converted text is
+// the raw one; size is that of the text indexed.
+struct IndexFileHeader {
+  char magic[4];
+  uint32_t version;
+  int64_t fileSize;
+  int64_t size;
+  uint64_t content;
+  uint64_t key;
+  int32_t lines;
+  int32_t displayLines;
+  int32_t checkpoints;
+  int32_t state;
+};
+
+#define INDEX_FILE_VERSION 4
+// enough of the file to tell a different file of the same size
+#define CONTENT_SAMPLE (64 * 1024)
+
+uint64_t TextLineIndex::contentHash() {
+  TextSource* f = source->file();
+  std::vector<char> sample(CONTENT_SAMPLE);
+  int n = f->read(0, &sample[0], CONTENT_SAMPLE);
+  uint64_t h = TextLayout::fnv1a(&sample[0], n > 0 ? n : 0);
+  n = f->read(std::max<int64_t>(0, f->size() - CONTENT_SAMPLE), &sample[0], CONTENT_SAMPLE);
+  return TextLayout::fnv1a(&sample[0], n > 0 ? n : 0, h);
+}
+
+bool TextLineIndex::load() {
+  FILE* f = fopen(cachePath.c_str(), "rb");
+  if (f == NULL)
+    return false;
+  IndexFileHeader h;
+  bool ok = fread(&h, sizeof(h), 1, f) == 1 && memcmp(h.magic, "BKTI", 4) == 0 &&
+    h.version == INDEX_FILE_VERSION && h.fileSize == source->file()->size() && h.key == key.hash() &&
+    h.checkpoints > 0 && h.state >= 0 && h.size >= 0 && h.content == contentHash();
+  if (ok) {
+    // a truncated or damaged file must not ask for more than it holds
+    long start = ftell(f);
+    ok = fseek(f, 0, SEEK_END) == 0 && (ftell(f) - start - h.checkpoints * (long)sizeof(Checkpoint)) /
+      (long)sizeof(int64_t) >= h.state && fseek(f, start, SEEK_SET) == 0;
+  }
+  if (ok) {
+    std::vector<Checkpoint> table(h.checkpoints);
+    std::vector<int64_t> state(h.state);
+    ok = fread(&table[0], sizeof(Checkpoint), table.size(), f) == table.size() &&
+      (state.empty() || fread(&state[0], sizeof(int64_t), state.size(), f) == state.size()) &&
+      source->restore(state);
+    if (ok) {
+      std::lock_guard<std::mutex> lock(mutex);
+      checkpoints.swap(table);
+      lines = h.lines;
+      displayLines = h.displayLines;
+      scanned = h.size;
+    }
+  }
+  fclose(f);
+  #ifdef DEBUG
+    printf("TextLineIndex: %s %s\n", ok ? "loaded" : "cannot use", cachePath.c_str());
+  #endif
+  return ok;
+}
+
+void TextLineIndex::save() {
+  FILE* f = fopen(cachePath.c_str(), "wb");
+  if (f == NULL) {
+    printf("cannot save text index to %s\n", cachePath.c_str());
+    return;
+  }
+  IndexFileHeader h;
+  memcpy(h.magic, "BKTI", 4);
+  h.version = INDEX_FILE_VERSION;
+  h.fileSize = source->file()->size();
+  h.size = source->size();
+  h.content = contentHash();
+  h.key = key.hash();
+  h.lines = lines;
+  h.displayLines = displayLines;
+  std::vector<int64_t> state = source->state();
+  h.state = (int32_t)state.size();
+  std::lock_guard<std::mutex> lock(mutex);
+  h.checkpoints = (int32_t)checkpoints.size();
+  fwrite(&h, sizeof(h), 1, f);
+  fwrite(&checkpoints[0], sizeof(Checkpoint), checkpoints.size(), f);
+  if (!state.empty())
+    fwrite(&state[0], sizeof(int64_t), state.size(), f);
+  fclose(f);
+}
+
+}
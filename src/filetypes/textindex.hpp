@@ -0,0 +1,160 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKTEXTINDEX_H
+#define BKTEXTINDEX_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "textsource.hpp"
+#include "textlayout.hpp"
+
+namespace bookr {
+
+// lines longer than this are broken, so a page never needs more than
+// linesPerPage * TEXT_LINE_MAX bytes
+#define TEXT_LINE_MAX 2048
+// the index remembers where every TEXT_INDEX_LINES-th line starts, and
+// at least one line every TEXT_INDEX_BYTES so long paragraphs stay cheap
+#define TEXT_INDEX_LINES 1024
+#define TEXT_INDEX_BYTES (64 * 1024)
+
+/*! \brief Splits text into the lines the reader shows.
+ *
+ *  A newline ends a line. With txtWrapCR = w, a run of k newlines only
+ *  gives k - w - 1 line breaks and the rest are joined into the text, so
+ *  hard wrapped paragraphs flow together. Lines are also broken after
+ *  TEXT_LINE_MAX bytes, between UTF-8 sequences.
+ *
+ *  Scanning from any line start gives the same lines as scanning from the
+ *  top of the file, which is what lets the index keep only checkpoints.
+ */
+class TextLineScanner {
+  int wrapCR;
+  int newlines;       // run of '\n' not decided yet
+  int64_t runStart;
+  int64_t eatUntil;   // newlines before this are joined into the line
+  int pending;        // breaks of a finished run still to hand out
+  int lineBytes;
+
+  void popPending();
+  int endRun();
+
+public:
+  int64_t pos;        // file offset of the next byte to feed
+  int line;           // line being scanned
+  int64_t lineStart;
+  bool brokeOnNewline;  // the previous line ended with a '\n'
+
+  TextLineScanner(int wrapCR, int64_t offset, int line);
+
+  /**
+   * Scan up to n bytes of text starting at pos. Returns as soon as a new
+   * line begins, with newLine set; the return value is the bytes used.
+   */
+  int feed(const char* p, int n, bool& newLine);
+
+  /**
+   * End of text: settles the last run of newlines. Call until false.
+   */
+  bool finish();
+};
+
+/*! \brief Sparse map from lines to file offsets and display lines.
+ *
+ *  Built on background threads that stream the source once, wrap every
+ *  line for one TextLayoutKey and record a checkpoint every
+ *  TEXT_INDEX_LINES lines or TEXT_INDEX_BYTES: where the line starts and
+ *  which display line it starts on. Finding a line or a page walks forward from the
+ *  checkpoint before it, so a jump costs the same anywhere in the book
+ *  and the table stays tiny even for huge files.
+ *
+ *  A finished table for a big file is saved to cachePath and loaded
+ *  instead of rebuilt when the same file is opened with the same layout.
+ *  The source's state() goes with it, so a converted text can jump into
+ *  the middle without converting everything before.
+ */
+class TextLineIndex {
+public:
+  struct Checkpoint {
+    int64_t offset;
+    int line;
+    int display;    // first display line of line
+  };
+
+private:
+  struct Count {
+    int lines;
+    int display;
+  };
+
+  TextSource* source;
+  TextLayoutKey key;
+  GlyphAdvances* advances;
+  string cachePath;
+  std::vector<Checkpoint> checkpoints;
+  std::mutex mutex;
+  std::thread thread;
+  std::atomic<bool> stop;
+  std::atomic<bool> done;
+  std::atomic<int> lines;
+  std::atomic<int> displayLines;
+  std::atomic<int64_t> scanned;
+
+  void run();
+  int64_t findSafeStart(int64_t from);
+  Count scanRange(int64_t start, int64_t end, std::vector<Checkpoint>* out);
+  Checkpoint checkpointBefore(int value, bool byDisplay);
+  uint64_t contentHash();
+  bool load();
+  void save();
+
+public:
+  TextLineIndex(TextSource* source, const TextLayoutKey& key, const string& cachePath);
+  ~TextLineIndex();
+
+  void start();
+
+  const TextLayoutKey& layoutKey() { return key; }
+  bool complete() { return done; }
+
+  /**
+   * Lines and display lines known so far; the totals once complete().
+   */
+  int totalLines() { return lines; }
+  int totalDisplayLines() { return displayLines; }
+  int64_t bytesScanned() { return scanned; }
+
+  /**
+   * Offset where line starts, or the size of the source if there is no
+   * such line.
+   */
+  int64_t lineOffset(int line);
+
+  /**
+   * The line that display line d is part of.
+   */
+  Checkpoint lineForDisplay(int d);
+
+  /**
+   * First display line of line, or the display line count past the end.
+   */
+  int displayForLine(int line);
+};
+
+}
+
+#endif
@@ -0,0 +1,377 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <algorithm>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TEXT_SCAN_NEON
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#define TEXT_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "linebreak.hpp"
+#include "textlayout.hpp"
+#include "../graphics/screen.hpp"
+
+namespace bookr {
+
+uint64_t TextLayout::fnv1a(const void* data, size_t n, uint64_t h) {
+  const unsigned char* p = (const unsigned char*)data;
+  for (size_t i = 0; i < n; ++i) {
+    h ^= p[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+uint64_t TextLayoutKey::hash() const {
+  int v[4] = { width, wrapCR, fontSize, hyphenate };
+  uint64_t h = TextLayout::fnv1a(v, sizeof(v));
+  h = TextLayout::fnv1a(&scale, sizeof(scale), h);
+  return TextLayout::fnv1a(fontFace.c_str(), fontFace.size(), h);
+}
+
+#define UNKNOWN_ADVANCE 0xffff
+// longest word hyphenation is tried on
+#define LINE_HYPHEN_WORD 31
+
+GlyphAdvances::GlyphAdvances(float s) : scale(s) {
+  bmp = new std::atomic<uint16_t>[0x10000];
+  for (int c = 0; c < 0x10000; ++c)
+    bmp[c].store(UNKNOWN_ADVANCE, std::memory_order_relaxed);
+  maxAscii = 1;
+  for (int c = 0; c < 128; ++c) {
+    ascii[c] = c >= 32 && c < 127 ? measure(c) : 0;
+    maxAscii = std::max(maxAscii, ascii[c]);
+  }
+  // tabs and joined newlines lay out as spaces
+  ascii['\t'] = ascii['\n'] = ascii[' '];
+  for (uint32_t c = 0xa0; c < 0x100; ++c)
+    measure(c);
+}
+
+GlyphAdvances* GlyphAdvances::forScale(float scale) {
+  static std::mutex lock;
+  static std::vector<GlyphAdvances*> tables;
+  std::lock_guard<std::mutex> guard(lock);
+  for (size_t i = 0; i < tables.size(); ++i)
+    if (tables[i]->scale == scale)
+      return tables[i];
+  // kept for good, like the fonts themselves
+  GlyphAdvances* t = new GlyphAdvances(scale);
+  tables.push_back(t);
+  return t;
+}
+
+static int encode(uint32_t c, char* out) {
+  int n;
+  if (c < 0x80) {
+    out[0] = c;
+    n = 1;
+  } else if (c < 0x800) {
+    out[0] = 0xc0 | (c >> 6);
+    out[1] = 0x80 | (c & 0x3f);
+    n = 2;
+  } else if (c < 0x10000) {
+    out[0] = 0xe0 | (c >> 12);
+    out[1] = 0x80 | ((c >> 6) & 0x3f);
+    out[2] = 0x80 | (c & 0x3f);
+    n = 3;
+  } else {
+    out[0] = 0xf0 | (c >> 18);
+    out[1] = 0x80 | ((c >> 12) & 0x3f);
+    out[2] = 0x80 | ((c >> 6) & 0x3f);
+    out[3] = 0x80 | (c & 0x3f);
+    n = 4;
+  }
+  out[n] = 0;
+  return n;
+}
+
+int GlyphAdvances::measure(uint32_t c) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (c < 0x10000) {
+    uint16_t a = bmp[c].load(std::memory_order_relaxed);
+    if (a != UNKNOWN_ADVANCE)
+      return a;
+  } else {
+    std::unordered_map<uint32_t, int>::iterator it = astral.find(c);
+    if (it != astral.end())
+      return it->second;
+  }
+  char s[5];
+  encode(c, s);
+  int w = std::max(0, std::min(Screen::textWidth(scale, s), UNKNOWN_ADVANCE - 1));
+  if (c < 0x10000)
+    bmp[c].store(w, std::memory_order_relaxed);
+  else
+    astral[c] = w;
+  return w;
+}
+
+uint32_t TextLayout::decode(const unsigned char* p, int n, int& len) {
+  unsigned char c = p[0];
+  int need;
+  uint32_t cp;
+  if (c < 0x80) {
+    len = 1;
+    return c;
+  } else if ((c & 0xe0) == 0xc0) {
+    need = 1;
+    cp = c & 0x1f;
+  } else if ((c & 0xf0) == 0xe0) {
+    need = 2;
+    cp = c & 0x0f;
+  } else if ((c & 0xf8) == 0xf0) {
+    need = 3;
+    cp = c & 0x07;
+  } else {
+    len = 1;
+    return c;
+  }
+  if (need >= n) {
+    len = 1;
+    return c;
+  }
+  for (int k = 1; k <= need; ++k) {
+    if ((p[k] & 0xc0) != 0x80) {
+      len = 1;
+      return c;
+    }
+    cp = (cp << 6) | (p[k] & 0x3f);
+  }
+  len = need + 1;
+  return cp;
+}
+
+// Length of the run of printable ASCII, spaces included, at the start of
+// p: one signed compare per sixteen bytes catches both the control
+// characters and everything above 0x7f.
+static inline int asciiSpan(const unsigned char* p, int n) {
+  int i = 0;
+  #if defined(TEXT_SCAN_SSE2)
+    const __m128i limit = _mm_set1_epi8(0x20);
+    for (; i + 16 <= n; i += 16) {
+      int mask = _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(p + i)), limit));
+      if (mask != 0)
+        return i + __builtin_ctz(mask);
+    }
+  #elif defined(TEXT_SCAN_NEON)
+    const int8x16_t limit = vdupq_n_s8(0x20);
+    for (; i + 16 <= n; i += 16) {
+      uint64x2_t lt = vreinterpretq_u64_u8(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(p + i)), limit));
+      if ((vgetq_lane_u64(lt, 0) | vgetq_lane_u64(lt, 1)) != 0)
+        break;    // the loop below finds the lane
+    }
+  #endif
+  for (; i < n; ++i)
+    if ((signed char)p[i] < 0x20)
+      return i;
+  return n;
+}
+
+// Width of n ASCII bytes, counting the spaces and finding the last one
+// on the way, if any. No branches, so the table loads overlap.
+static inline int spanWidth(const int* ascii, const unsigned char* p, int n, int& blanks, int& last) {
+  int w = 0;
+  for (int i = 0; i < n; ++i) {
+    int blank = p[i] == ' ';
+    w += ascii[p[i]];
+    blanks += blank;
+    last = blank ? i : last;
+  }
+  return w;
+}
+
+static inline bool isBlank(unsigned char c) {
+  // joined newlines read as spaces
+  return c == ' ' || c == '\t' || c == '\n';
+}
+
+int TextLayout::width(const char* text, int n, GlyphAdvances* advances) {
+  const unsigned char* p = (const unsigned char*)text;
+  int w = 0;
+  for (int i = 0; i < n; ) {
+    int len;
+    w += advances->advance(decode(p + i, n - i, len));
+    i += len;
+  }
+  return w;
+}
+
+
+// The same test wrap makes before placing each glyph, without placing
+// anything: only a glyph other than a blank past the edge wraps.
+bool TextLayout::fits(const char* text, int n, int width, GlyphAdvances* advances) {
+  const unsigned char* p = (const unsigned char*)text;
+  const int* ascii = advances->asciiAdvances();
+  const int maxAdvance = advances->maxAsciiAdvance();
+  int w = 0;
+  int i = 0;
+  while (i < n) {
+    unsigned char b = p[i];
+    if (b >= ' ' && b < 0x80 && (width - w) / maxAdvance >= 2) {
+      // these fit whatever they are
+      int m = asciiSpan(p + i, std::min(n - i, (width - w) / maxAdvance));
+      for (int k = 0; k < m; ++k)
+        w += ascii[p[i + k]];
+      i += m;
+      continue;
+    }
+    int len = 1;
+    int advance = b >= 0x80 ? advances->advance(decode(p + i, n - i, len)) : ascii[b];
+    if ((b >= 0x80 || !isBlank(b)) && i > 0 && w + advance > width)
+      return false;
+    w += advance;
+    i += len;
+  }
+  return true;
+}
+
+static inline void emit(std::vector<WrappedLine>* out, int start, int n, float spaceWidth, bool hyphen) {
+  if (out != nullptr) {
+    WrappedLine l = { start, n, spaceWidth, hyphen };
+    out->push_back(l);
+  }
+}
+
+static inline bool isLetter(unsigned char c) {
+  return (unsigned)((c | 0x20) - 'a') < 26;
+}
+
+int TextLayout::wrap(const char* text, int n, int width, GlyphAdvances* advances, const uint32_t* breaks,
+    bool hyphenate, std::vector<WrappedLine>* out) {
+  const unsigned char* p = (const unsigned char*)text;
+  const int* ascii = advances->asciiAdvances();
+  const int space = ascii[' '];
+  const int maxAdvance = advances->maxAsciiAdvance();
+  int count = 0;
+  int lineStart = 0;
+  int lineWidth = 0;
+  // last place the line could end, and the line up to it; a blank there
+  // goes with the break
+  int breakAt = -1;
+  bool breakBlank = false;
+  int widthAtBreak = 0;
+  int gapsAtBreak = 0;
+  int gaps = 0;
+
+  // space width that fills the line when it is w wide with g gaps
+  auto justified = [&](int w, int g) {
+    return g > 0 ? space + float(width - w) / float(g) : float(space);
+  };
+
+  // the latest hyphen in the word that glyph i overflows which beats
+  // breakAt and leaves room for the hyphen, or -1
+  auto hyphenPoint = [&](int i) {
+    int ws = i;
+    while (ws > 0 && i - ws <= LINE_HYPHEN_WORD && isLetter(p[ws - 1]))
+      --ws;
+    int we = i;
+    while (we < n && we - ws <= LINE_HYPHEN_WORD && isLetter(p[we]))
+      ++we;
+    uint32_t points = LineBreaks::hyphenate(text + ws, we - ws);
+    int tail = 0;   // width of the word from the hyphen to i
+    for (int h = i; h > ws && h > lineStart && h > breakAt; --h) {
+      if (h < i)
+        tail += ascii[p[h]];
+      if ((points >> (h - ws) & 1) && lineWidth - tail + ascii['-'] <= width)
+        return h;
+    }
+    return -1;
+  };
+
+  // places the glyph at i, wrapping first if it doesn't fit
+  auto place = [&](int i, int advance, bool blank) {
+    // blanks may hang past the edge; anything else wraps
+    if (!blank && lineWidth + advance > width && i > lineStart) {
+      int h = hyphenate && i > 0 && (isLetter(p[i]) || isLetter(p[i - 1])) ? hyphenPoint(i) : -1;
+      if (h > 0) {
+        int tail = 0;
+        for (int k = h; k < i; ++k)
+          tail += ascii[p[k]];
+        emit(out, lineStart, h - lineStart, justified(lineWidth - tail + ascii['-'], gaps), true);
+        lineWidth = tail;
+        lineStart = h;
+      } else if (breakAt > lineStart) {
+        emit(out, lineStart, breakAt - lineStart, justified(widthAtBreak, gapsAtBreak), false);
+        if (breakBlank) {
+          lineWidth -= widthAtBreak + ascii[p[breakAt]];
+          lineStart = breakAt + 1;
+        } else {
+          lineWidth -= widthAtBreak;
+          lineStart = breakAt;
+        }
+      } else {
+        // one word wider than the line: cut it
+        emit(out, lineStart, i - lineStart, space, false);
+        lineWidth = 0;
+        lineStart = i;
+      }
+      ++count;
+      breakAt = -1;
+      gaps = 0;
+    }
+    if (i > lineStart && (blank || (breaks != nullptr && (breaks[i >> 5] >> (i & 31) & 1)))) {
+      breakAt = i;
+      breakBlank = blank;
+      widthAtBreak = lineWidth;
+      gapsAtBreak = gaps;
+      gaps += blank;
+    }
+    lineWidth += advance;
+  };
+
+  int i = 0;
+  while (i < n) {
+    unsigned char b = p[i];
+    // this many more ASCII glyphs fit whatever they are
+    int fit = (width - lineWidth) / maxAdvance;
+    if (b >= 0x80) {
+      int len;
+      uint32_t c = decode(p + i, n - i, len);
+      place(i, advances->advance(c), false);
+      i += len;
+    } else if (b < ' ' || fit < 2 || (b == ' ' && i == lineStart)) {
+      place(i, ascii[b], isBlank(b));
+      ++i;
+    } else {
+      // nothing in the span can wrap, only the last break in it needs
+      // noting
+      int m = asciiSpan(p + i, std::min(n - i, fit));
+      int blanks = 0;
+      int last = -1;
+      int w = spanWidth(ascii, p + i, m, blanks, last);
+      int k = breaks != nullptr ? LineBreaks::lastBit(breaks, std::max(i, lineStart + 1), i + m) - i : -1;
+      bool blank = last >= 0 && last > k;
+      if (blank || k >= 0) {
+        int at = blank ? last : k;
+        int tail = 0;
+        for (int j = at; j < m; ++j)
+          tail += ascii[p[i + j]];
+        breakAt = i + at;
+        breakBlank = blank;
+        widthAtBreak = lineWidth + w - tail;
+        gapsAtBreak = gaps + blanks - blank;
+      }
+      gaps += blanks;
+      lineWidth += w;
+      i += m;
+    }
+  }
+  emit(out, lineStart, n - lineStart, space, false);
+  return count + 1;
+}
+
+}
@@ -0,0 +1,129 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKTEXTLAYOUT_H
+#define BKTEXTLAYOUT_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using std::string;
+
+namespace bookr {
+
+/*! \brief Advance widths of the glyphs of the text font at one scale.
+ *
+ *  A flat table covers the BMP and a hash the rest; each glyph is
+ *  measured once, the first time it is seen. ASCII also has a small
+ *  table of its own that the span loop of TextLayout::wrap reads.
+ *  Lookups are safe from any thread, the index workers wrap too.
+ */
+class GlyphAdvances {
+  float scale;
+  int ascii[128];
+  int maxAscii;
+  std::atomic<uint16_t>* bmp;     // UNKNOWN_ADVANCE until measured
+  std::unordered_map<uint32_t, int> astral;
+  std::mutex mutex;
+
+  int measure(uint32_t c);
+  GlyphAdvances(float scale);
+
+public:
+  /**
+   * The shared table for scale; created and filled with ASCII and
+   * Latin-1 on first use. Do that from the render thread.
+   */
+  static GlyphAdvances* forScale(float scale);
+
+  int advance(uint32_t c) {
+    if (c < 128)
+      return ascii[c];
+    if (c < 0x10000) {
+      uint16_t a = bmp[c].load(std::memory_order_relaxed);
+      if (a != 0xffff)
+        return a;
+    }
+    return measure(c);
+  }
+
+  const int* asciiAdvances() const { return ascii; }
+  int maxAsciiAdvance() const { return maxAscii; }
+};
+
+/*! \brief Everything that changes where lines wrap.
+ *
+ *  Layouts are kept per key, so going back to an earlier view (rotating
+ *  back, say) finds its pages already counted.
+ */
+struct TextLayoutKey {
+  int width;
+  int wrapCR;
+  int fontSize;
+  string fontFace;
+  float scale;    // of the font the text is drawn with
+  bool hyphenate;
+
+  bool operator==(const TextLayoutKey& o) const {
+    return width == o.width && wrapCR == o.wrapCR && fontSize == o.fontSize && fontFace == o.fontFace &&
+      scale == o.scale && hyphenate == o.hyphenate;
+  }
+  uint64_t hash() const;
+};
+
+// One display line of a source line; offsets are into the source line.
+struct WrappedLine {
+  int start;
+  int n;
+  float spaceWidth;   // justified width of the blanks
+  bool hyphen;        // broken inside a word; draw a hyphen after it
+};
+
+namespace TextLayout {
+  /**
+   * Greedy word wrap of one UTF-8 source line to width pixels. Lines
+   * break after blanks and where breaks, from LineBreaks::find, has a bit
+   * set; with hyphenate, a word that doesn't fit is hyphenated when that
+   * fills the line better. Appends the display lines to out when given,
+   * and returns how many there are; always at least one, even for an
+   * empty line.
+   */
+  int wrap(const char* text, int n, int width, GlyphAdvances* advances, const uint32_t* breaks, bool hyphenate,
+    std::vector<WrappedLine>* out);
+
+  /**
+   * Decodes the UTF-8 sequence at p, at most n bytes. Sets len to the
+   * bytes used; a malformed byte reads as itself, one byte long.
+   */
+  uint32_t decode(const unsigned char* p, int n, int& len);
+
+  /**
+   * Width of n bytes of UTF-8 text.
+   */
+  int width(const char* text, int n, GlyphAdvances* advances);
+
+  /**
+   * True if wrap would keep the text on one line. Stops at the first
+   * glyph that doesn't fit, and needs no break bits.
+   */
+  bool fits(const char* text, int n, int width, GlyphAdvances* advances);
+
+  uint64_t fnv1a(const void* data, size_t n, uint64_t h = 14695981039346656037ULL);
+}
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include "textsource.hpp"
+#include "blockcache.hpp"
+
+namespace bookr {
+
+#define TS_CACHE_BLOCKS 8
+
+class FileTextSource : public TextSource {
+  // the viewer and the line index both read; one lock covers the handle
+  // and the blocks
+  std::mutex mutex;
+  FileHandle file;
+  BlockCache blocks;
+
+  BlockCache::Block* block(int64_t offset) {
+    BlockCache::Block* b = blocks.find(offset);
+    if (b != nullptr)
+      return b;
+    b = blocks.victim();
+    int64_t r = file.read(offset, b->data, FILE_BLOCK_SIZE);
+    if (r < 0)
+      return nullptr;
+    blocks.store(b, offset, (int)r);
+    return b;
+  }
+
+public:
+  bool open(const string& path) {
+    return blocks.allocate(TS_CACHE_BLOCKS, FILE_BLOCK_SIZE) && file.open(path);
+  }
+
+  virtual int64_t size() {
+    return file.size();
+  }
+
+  virtual int read(int64_t offset, char* out, int n) {
+    int64_t length = file.size();
+    if (offset < 0 || offset >= length || n <= 0)
+      return 0;
+    if (n > length - offset)
+      n = (int)(length - offset);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    int done = 0;
+    while (done < n) {
+      int64_t pos = offset + done;
+      int64_t start = pos & ~(int64_t)(FILE_BLOCK_SIZE - 1);
+      int inBlock = (int)(pos - start);
+      int want = n - done;
+      if (inBlock == 0 && want >= FILE_BLOCK_SIZE) {
+        // whole blocks (the index streaming through the file) skip the
+        // cache so they don't push out the pages being read
+        int whole = want & ~(FILE_BLOCK_SIZE - 1);
+        int r = (int)file.read(pos, out + done, whole);
+        if (r <= 0)
+          return done > 0 ? done : r;
+        done += r;
+        if (r < whole)
+          break;
+        continue;
+      }
+      BlockCache::Block* b = block(start);
+      if (b == nullptr)
+        return done > 0 ? done : -1;
+      int avail = b->len - inBlock;
+      if (avail <= 0)
+        break;
+      int c = want < avail ? want : avail;
+      memcpy(out + done, b->data + inBlock, c);
+      done += c;
+    }
+    return done;
+  }
+};
+
+TextSource* TextSource::openFile(const string& path) {
+  FileTextSource* s = new FileTextSource();
+  if (!s->open(path)) {
+    #ifdef DEBUG
+      printf("TextSource: cannot open %s\n", path.c_str());
+    #endif
+    delete s;
+    return NULL;
+  }
+  return s;
+}
+
+}
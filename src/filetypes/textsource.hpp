@@ -0,0 +1,72 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKTEXTSOURCE_H
+#define BKTEXTSOURCE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace bookr {
+
+/*! \brief Random access to the bytes of a text document.
+ *
+ *  Text documents never hold the whole book in memory; they ask their
+ *  source for the bytes around the page on screen, and the line index asks
+ *  for everything once, front to back, on its own thread. Implementations
+ *  must be safe to read from both at the same time.
+ */
+class TextSource {
+public:
+  virtual ~TextSource() { }
+
+  virtual int64_t size() = 0;
+
+  /**
+   * False while size() would have to read the whole source to answer.
+   */
+  virtual bool sizeKnown() { return true; }
+
+  /**
+   * Copy up to n bytes starting at offset into out. Returns the bytes
+   * copied, 0 past the end and -1 on a read error.
+   */
+  virtual int read(int64_t offset, char* out, int n) = 0;
+
+  /**
+   * The source as stored: this one, or the one it converts. Its size is
+   * always known, so saved line indexes are keyed on it.
+   */
+  virtual TextSource* file() { return this; }
+
+  /**
+   * What the source learned reading itself through, worth saving with a
+   * line index so the next open can jump straight into the middle. Empty
+   * while nothing is known. restore() takes back a saved state() and
+   * returns false if it doesn't belong to this source.
+   */
+  virtual std::vector<int64_t> state() { return std::vector<int64_t>(); }
+  virtual bool restore(const std::vector<int64_t>& saved) { return saved.empty(); }
+
+  /**
+   * Plain file, read through a small block cache. NULL if the file
+   * cannot be opened.
+   */
+  static TextSource* openFile(const string& path);
+};
+
+}
+
+#endif
@@ -22,11 +22,13 @@ static void* memalign(int t, int s) {
 #endif
 
 #include "font.hpp"
+#include FT_ADVANCES_H
+#include "font_faces.hpp"
 #include "../user.hpp"
 
 namespace bookr {
 
-Font::Font() : metrics(0), isUTF(false), ftlib(0), ftface(0) {
+Font::Font() : metrics(0), isUTF(false), ftface(0) {
 }
 
 Font::~Font() {
@@ -39,93 +41,74 @@ Font::~Font() {
 // based on http://gpwiki.org/index.php/OpenGL_Font_System
 
 Font* Font::createFromFile(char* fileName, int fontSize, bool autohint) {
-	// This initializes FreeType
-	FT_Library library;
-	if (FT_Init_FreeType(&library) != 0) {
-	  //		printf("cannot init freetype\n");
-		return 0;
-	}
-
-	// Load the font
-	FT_Face face;
-	if (FT_New_Face(library, fileName, 0, &face) != 0) {
+	// Load the font, or share it if it is open already
+	FT_Face face = FontFaces::openFile(fileName);
+	if (face == 0) {
 	  //	printf("cannot load font\n");
-	  FT_Done_FreeType(library);
 		return 0;
 	}
 
-	return createProto(library, face, fontSize, autohint);
+	Font* font = createProto(face, fontSize, autohint);
+	FontFaces::release(face);
+	return font;
 }
 
 Font* Font::createFromMemory(unsigned char* buffer, int bufferSize, int fontSize, bool autohint) {
-	// This initializes FreeType
-	FT_Library library;
-	if (FT_Init_FreeType(&library) != 0) {
-	  //	printf("cannot init freetype\n");
-		return 0;
-	}
-
-	// Load the font
-	FT_Face face;
-	if (FT_New_Memory_Face(library, buffer, bufferSize, 0, &face) != 0) {
+	// Load the font, or share it if it is open already
+	FT_Face face = FontFaces::openMemory(buffer, bufferSize);
+	if (face == 0) {
 	  //	printf("cannot load font\n");
-	  FT_Done_FreeType(library);
 		return 0;
 	}
 
-	return createProto(library, face, fontSize, autohint);
+	Font* font = createProto(face, fontSize, autohint);
+	FontFaces::release(face);
+	return font;
 }
 
+// UTF fonts keep their face for the glyphs past Latin-1
 Font* Font::createUTFFromFile(char* fileName, int fontSize, bool autohint) {
-	// This initializes FreeType
-	FT_Library library;
-	if (FT_Init_FreeType(&library) != 0) {
-	  //	printf("cannot init freetype\n");
+	FT_Face face = FontFaces::openFile(fileName);
+	if (face == 0) {
+	  //printf("cannot load font\n");
 		return 0;
 	}
-
-	// Load the font
-	FT_Face face;
-	if (FT_New_Face(library, fileName, 0, &face) != 0) {
-	  //printf("cannot load font\n");
-	  FT_Done_FreeType(library);
+	Font* ret = createProto(face, fontSize, autohint);
+	if (ret == 0) {
+		FontFaces::release(face);
 		return 0;
 	}
-	Font* ret = createProto(library, face, fontSize, autohint);
 	ret->isUTF = true;
 	ret->fileName = fileName;
 	ret->bufferSize = 0;
 	ret->fontSize = fontSize;
 	ret->autohint = autohint;
+	ret->ftface = face;
 	return ret;
 }
 
 Font* Font::createUTFFromMemory(unsigned char* buffer, int bufferSize, int fontSize, bool autohint) {
-	// This initializes FreeType
-	FT_Library library;
-	if (FT_Init_FreeType(&library) != 0) {
-	  //printf("cannot init freetype\n");
+	FT_Face face = FontFaces::openMemory(buffer, bufferSize);
+	if (face == 0) {
+	  //printf("cannot load font\n");
 		return 0;
 	}
 
-	// Load the font
-	FT_Face face;
-	if (FT_New_Memory_Face(library, buffer, bufferSize, 0, &face) != 0) {
-	  //printf("cannot load font\n");
-	  FT_Done_FreeType(library);
+	Font* ret = createProto(face, fontSize, autohint);
+	if (ret == 0) {
+		FontFaces::release(face);
 		return 0;
 	}
-
-	Font* ret = createProto(library, face, fontSize, autohint);
 	ret->buffer = buffer;
 	ret->bufferSize = bufferSize;
 	ret->fontSize = fontSize;
 	ret->autohint = autohint;
 	ret->isUTF = true;
+	ret->ftface = face;
 	return ret;
 }
 
-Font* Font::createProto(FT_Library& library, FT_Face& face, int fontSize, bool autohint) {
+Font* Font::createProto(FT_Face face, int fontSize, bool autohint) {
 	// Margins around characters to prevent them from 'bleeding' into
 	// each other.
 	int margin = 3;
@@ -240,7 +223,6 @@ Font* Font::createProto(FT_Library& library, FT_Face& face, int fontSize, bool a
 	}
 
 
-	FT_Done_FreeType(library);
 	Font* font = new Font();
 	// if (!initFromImage(font, image, false)) {
 	// 	font->release();
@@ -270,33 +252,18 @@ int Font::fontTextWidth(const char *text)
 }
 
 int Font::initUTFFont(){
-  if (ftlib == 0 && FT_Init_FreeType(&ftlib) != 0) {
-    return 0;
-  }
-  
-  if(this->bufferSize>0){
-    if (ftface == 0 && FT_New_Memory_Face(ftlib, this->buffer, this->bufferSize, 0, &ftface) != 0) {
-      return 0;
-    }
-  }
-  else{
-    if (ftface == 0 && FT_New_Face(ftlib, this->fileName.c_str(), 0, &ftface) != 0) {
-      return 0;
-    }
-    
-  }
-  return 1;
+  // the face was closed by doneUTFFont; opening it again is shared
+  if (ftface == 0)
+    ftface = this->bufferSize > 0 ? FontFaces::openMemory(this->buffer, this->bufferSize) :
+      FontFaces::openFile(this->fileName);
+  return ftface != 0;
 }
 
 void Font::doneUTFFont(){
   if(ftface){
-    FT_Done_Face(ftface);
+    FontFaces::release(ftface);
     ftface = 0;
   }
-  if(ftlib){
-    FT_Done_FreeType(ftlib);
-    ftlib = 0;
-  }
 }
 
 int Font::getSingleMetrics(unsigned long idx, CharMetrics* met, Texture** texturepp){
@@ -320,7 +287,6 @@ int Font::getSingleMetrics(unsigned long idx, CharMetrics* met, Texture** textur
 
   
     int margin = 3;  // XXX may change this later XXX
-    int image_height = 32, image_width = 32;
     
     // Abort if this is not a 'true type', scalable font.
     if (!(ftface->face_flags & FT_FACE_FLAG_SCALABLE) or !(ftface->face_flags & FT_FACE_FLAG_HORIZONTAL)) {
@@ -328,102 +294,21 @@ int Font::getSingleMetrics(unsigned long idx, CharMetrics* met, Texture** textur
       return 0;
     }
     
-    // Set the font size
-    FT_Set_Pixel_Sizes(ftface, fontSize, 0);
-    
-    
-    //int max_descent = 0, max_ascent = 0;
-    
-    int loadMode = FT_LOAD_DEFAULT;
-    if (autohint)
-      loadMode |= FT_LOAD_FORCE_AUTOHINT;
-    
-    int char_index = FT_Get_Char_Index(ftface, idx);
-    if (idx < 32)
-      char_index = 0;
-    
-    // Render the glyph
-    FT_Load_Glyph(ftface, char_index, loadMode);
-    FT_Render_Glyph(ftface->glyph, FT_RENDER_MODE_NORMAL);
-
-    //advance = (ftface->glyph->metrics.horiAdvance >> 6) + margin;
-    //max_ascent = ftface->glyph->bitmap_top;
-    //max_descent = ftface->glyph->bitmap.rows - ftface->glyph->bitmap_top;
-    
-    int needed_image_height = this->lineHeight + margin;
-    while (image_height < needed_image_height)
-      image_height *= 2;
-    
-    int needed_image_width = (ftface->glyph->metrics.horiAdvance >> 6) +2 * margin;
-    while (image_width < needed_image_width)
-      image_width *= 2;
-    
-    // Allocate memory for the texture
-    int clutSize = 256;
-    Image* image = Image::createEmpty(image_width, image_height, clutSize, Image::mono8);
-    unsigned char* fontTexture = (unsigned char*)image->getData();
-    // add clut to texture
-    unsigned int* clut = image->getCLUT();
-    for (int i = 0; i < clutSize; i++) {
-      clut[i] = 0xffffff | (i << 24);
-    }
-    //for (int i = 0; i < image_height * image_width; ++i)
-    //	fontTexture[i] = 0;
-    //int fontLineHeight = max_ascent + max_descent + margin;
-    
-    // These are the position at which to draw the next glyph
-    //int x = margin, y = margin + max_ascent;
+    // Only the advance is needed, no bitmap. The face is shared, so set
+    // the size every time
+    FT_Set_Pixel_Sizes(ftface, 0, fontSize);
+    FT_Fixed advance = 0;
+    FT_Get_Advance(ftface, idx < 32 ? 0 : FT_Get_Char_Index(ftface, idx),
+      autohint ? FT_LOAD_FORCE_AUTOHINT : FT_LOAD_DEFAULT, &advance);
     
     // Fill in the GlyphEntry
-    met->width = (ftface->glyph->metrics.horiAdvance >> 6);
+    met->width = advance >> 16;
     met->xadvance = met->width;
     met->xoffset = 0;
     met->yoffset = 0;
     met->height = this->lineHeight - margin;
     met->x = margin;
     met->y = margin;
-    
-    // Copy the image gotten from FreeType onto the texture
-    // at the correct position
-
-    for (int row = 0; row < ftface->glyph->bitmap.rows; ++row){
-      for (int pixel = 0; pixel < ftface->glyph->bitmap.width; ++pixel){
-	fontTexture[(met->x + ftface->glyph->bitmap_left + pixel) +
-		    (met->y + this->maxAscent - ftface->glyph->bitmap_top + row) * image_width] =
-	  ftface->glyph->bitmap.buffer[pixel + row * ftface->glyph->bitmap.pitch];
-      }
-    }
-    
- //    *texturepp = new Font();
-
- //    if( *texturepp == 0 ) {
- //      if (*texturepp){
-	// ((Font*)(*texturepp)) -> release();
-	// *texturepp = 0;
- //      }
- //      image->release();
- //      return 0;
- //    }
- //    else {
- //       ((Font*)(*texturepp))->metrics = 0;
- //       ((Font*)(*texturepp))->metrics = (CharMetrics*)memalign(16,sizeof(CharMetrics));
- //       if (((Font*)(*texturepp))->metrics){
- // 	memset(((Font*)(*texturepp))->metrics, 0, sizeof(CharMetrics));
- // 	((Font*)(*texturepp))->metrics->width = met->width;
- // 	((Font*)(*texturepp))->metrics->height = met->height;
- // 	((Font*)(*texturepp))->metrics->xoffset = met->xoffset;
- // 	((Font*)(*texturepp))->metrics->yoffset = met->yoffset;
- // 	((Font*)(*texturepp))->metrics->x = met->x;
- // 	((Font*)(*texturepp))->metrics->y = met->y;
- // 	((Font*)(*texturepp))->metrics->xadvance = met->xadvance;
- //       }
- //       ((Font*)(*texturepp))->lineHeight = this->lineHeight;
- //       ((Font*)(*texturepp))->maxAscent = this->maxAscent;
- //      (*texturepp)->texEnv(_TEX_MODULATE);
- //      (*texturepp)->filter(_NEAREST, _NEAREST);
- //      image->release();
- //      
- //    }
     return 1;
 }
 
@@ -44,10 +44,9 @@ class Font : public RefCounted {
   bool autohint;
   unsigned char * buffer;
   int bufferSize;
-  FT_Library ftlib;
   FT_Face ftface;
 
-  static Font* createProto(FT_Library& library, FT_Face& face, int fontSize, bool autohint);
+  static Font* createProto(FT_Face face, int fontSize, bool autohint);
 
 protected:
   Font();
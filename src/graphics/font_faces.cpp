@@ -0,0 +1,209 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+
+// switch has no mmap, it takes the FreeType stream like the vita
+#if defined(DESKTOP) && !defined(WIN32)
+#define FONTFACES_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "font_faces.hpp"
+#include "glyph_cache.hpp"
+#include "screen.hpp"
+
+namespace bookr {
+
+// how much of each end of a font goes into its hash
+#define FONT_SAMPLE (64 * 1024)
+
+struct OpenFace {
+  FT_Face face;
+  std::string path;     // empty for font data
+  std::string data;     // the copy of font data
+  void* map;
+  size_t size;
+  uint64_t hash;
+  int refs;
+};
+
+static FT_Library ft = 0;
+static std::vector<OpenFace*> faces;
+static FT_Face fallbackFace = 0;
+static bool fallbackTried = false;
+
+static uint64_t fnv1a(const unsigned char* p, size_t n, uint64_t h) {
+  for (size_t i = 0; i < n; ++i) {
+    h ^= p[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+static uint64_t sampleHash(const unsigned char* head, size_t headSize, const unsigned char* tail, size_t tailSize,
+  size_t size) {
+  uint64_t h = fnv1a((const unsigned char*)&size, sizeof(size), 14695981039346656037ULL);
+  return fnv1a(tail, tailSize, fnv1a(head, headSize, h));
+}
+
+static uint64_t dataHash(const unsigned char* data, size_t size) {
+  size_t n = size < FONT_SAMPLE ? size : FONT_SAMPLE;
+  return sampleHash(data, n, data + size - n, n, size);
+}
+
+static FT_Face share(OpenFace* f) {
+  ++f->refs;
+  return f->face;
+}
+
+// Takes f into the table once FreeType has its face; frees it otherwise.
+static FT_Face add(OpenFace* f, FT_Error error) {
+  if (error != 0) {
+    #ifdef DEBUG
+      printf("FontFaces: cannot open %s (%d)\n", f->path.empty() ? "font data" : f->path.c_str(), error);
+    #endif
+    #ifdef FONTFACES_MMAP
+      if (f->map != nullptr)
+        munmap(f->map, f->size);
+    #endif
+    delete f;
+    return 0;
+  }
+  f->refs = 1;
+  faces.push_back(f);
+  return f->face;
+}
+
+FT_Library FontFaces::library() {
+  if (ft == 0 && FT_Init_FreeType(&ft) != 0) {
+    printf("FontFaces: cannot init FreeType\n");
+    ft = 0;
+  }
+  return ft;
+}
+
+FT_Face FontFaces::openFile(const std::string& path) {
+  for (size_t i = 0; i < faces.size(); ++i) {
+    if (faces[i]->path == path)
+      return share(faces[i]);
+  }
+  if (library() == 0)
+    return 0;
+
+  OpenFace* f = new OpenFace();
+  f->face = 0;
+  f->path = path;
+  f->map = nullptr;
+  f->size = 0;
+  #ifdef FONTFACES_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p != MAP_FAILED) {
+        f->map = p;
+        f->size = st.st_size;
+      }
+    }
+    if (fd >= 0)
+      ::close(fd);
+    if (f->map == nullptr)
+      return add(f, FT_Err_Cannot_Open_Resource);
+    f->hash = dataHash((const unsigned char*)f->map, f->size);
+    return add(f, FT_New_Memory_Face(ft, (const FT_Byte*)f->map, f->size, 0, &f->face));
+  #else
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == NULL)
+      return add(f, FT_Err_Cannot_Open_Resource);
+    fseek(file, 0, SEEK_END);
+    f->size = ftell(file);
+    size_t n = f->size < FONT_SAMPLE ? f->size : FONT_SAMPLE;
+    std::vector<unsigned char> head(n), tail(n);
+    fseek(file, 0, SEEK_SET);
+    bool ok = fread(&head[0], 1, n, file) == n;
+    fseek(file, f->size - n, SEEK_SET);
+    ok = ok && fread(&tail[0], 1, n, file) == n;
+    fclose(file);
+    if (!ok || n == 0)
+      return add(f, FT_Err_Cannot_Open_Stream);
+    f->hash = sampleHash(&head[0], n, &tail[0], n, f->size);
+    return add(f, FT_New_Face(ft, path.c_str(), 0, &f->face));
+  #endif
+}
+
+FT_Face FontFaces::openMemory(const unsigned char* data, size_t size) {
+  if (size == 0)
+    return 0;
+  uint64_t hash = dataHash(data, size);
+  for (size_t i = 0; i < faces.size(); ++i) {
+    OpenFace* f = faces[i];
+    if (f->path.empty() && f->hash == hash && f->size == size && memcmp(f->data.data(), data, size) == 0)
+      return share(f);
+  }
+  if (library() == 0)
+    return 0;
+
+  OpenFace* f = new OpenFace();
+  f->face = 0;
+  f->data.assign((const char*)data, size);
+  f->map = nullptr;
+  f->size = size;
+  f->hash = hash;
+  return add(f, FT_New_Memory_Face(ft, (const FT_Byte*)f->data.data(), size, 0, &f->face));
+}
+
+void FontFaces::release(FT_Face face) {
+  for (size_t i = 0; i < faces.size(); ++i) {
+    OpenFace* f = faces[i];
+    if (f->face != face)
+      continue;
+    if (--f->refs > 0)
+      return;
+    GlyphCache::dropFace(face);
+    FT_Done_Face(face);
+    #ifdef FONTFACES_MMAP
+      if (f->map != nullptr)
+        munmap(f->map, f->size);
+    #endif
+    delete f;
+    faces.erase(faces.begin() + i);
+    return;
+  }
+}
+
+FT_Face FontFaces::fallback() {
+  if (!fallbackTried) {
+    fallbackTried = true;
+    fallbackFace = openFile(Screen::fallbackFontPath());
+    #ifdef DEBUG
+      printf("FontFaces: fallback font %s\n", fallbackFace ? "opened" : "missing");
+    #endif
+  }
+  return fallbackFace;
+}
+
+uint64_t FontFaces::hash(FT_Face face) {
+  for (size_t i = 0; i < faces.size(); ++i) {
+    if (faces[i]->face == face)
+      return faces[i]->hash;
+  }
+  return 0;
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+
+#ifndef BKFONTFACES_H
+#define BKFONTFACES_H
+
+#include <cstdint>
+#include <string>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace bookr {
+
+/*! \brief The FreeType library of the process and the faces open in it.
+ *
+ *  Faces are shared: opening a font file, or font data, that is already
+ *  open returns the same FT_Face with one more reference, so UI text and
+ *  document text parse each font once. Every open needs a release(); the
+ *  last one closes the face and drops its glyph caches.
+ *
+ *  Font files are memory mapped on desktops; elsewhere FreeType reads
+ *  them through its stream, only the parts it needs. Font data is copied
+ *  once, the caller may free it.
+ *
+ *  Use from the render thread only, FreeType faces are not thread safe.
+ */
+namespace FontFaces {
+  FT_Library library();
+
+  FT_Face openFile(const std::string& path);
+  FT_Face openMemory(const unsigned char* data, size_t size);
+  void release(FT_Face face);
+
+  /**
+   * The face of Screen::fallbackFontPath(), opened on the first call; 0
+   * when there is no such font. It stays open.
+   */
+  FT_Face fallback();
+
+  /**
+   * Identifies the font data of face, for files kept about it: a hash
+   * of its size and its first and last 64 KB.
+   */
+  uint64_t hash(FT_Face face);
+}
+
+}
+
+#endif
@@ -21,7 +21,7 @@
 
 namespace bookr {
 
-Font::Font() : metrics(0), isUTF(false), ftlib(0), ftface(0) {
+Font::Font() : metrics(0), isUTF(false), ftface(0) {
   printf("Font()\n");
 }
 
@@ -0,0 +1,527 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::string;
+
+#include "glyph_cache.hpp"
+#include "font_faces.hpp"
+#include "screen.hpp"
+#include "../user.hpp"
+
+namespace bookr {
+
+// empty texels right of and below each glyph, so linear filtering doesn't
+// pick up the neighbours
+#define GLYPH_PADDING 1
+
+static std::vector<GlyphCache*> caches;
+
+GlyphCache::GlyphCache(FT_Face f, int size, int flags, bool d) : face(f), pixelSize(size), loadFlags(flags), distance(d),
+  packing(-1), useClock(0),
+  font(0), changed(false) {
+  memset(&totals, 0, sizeof(totals));
+  for (int i = 0; i < 128; ++i)
+    ascii[i].page = GLYPH_UNCACHED;
+}
+
+GlyphCache::~GlyphCache() {
+  if (changed)
+    saveAtlas();
+  for (size_t i = 0; i < pages.size(); ++i)
+    free(pages[i].pixels);
+}
+
+GlyphCache* GlyphCache::forFace(FT_Face face, int pixelSize, int loadFlags, bool distance) {
+  for (size_t i = 0; i < caches.size(); ++i) {
+    GlyphCache* c = caches[i];
+    if (c->face == face && c->pixelSize == pixelSize && c->loadFlags == loadFlags && c->distance == distance)
+      return c;
+  }
+  GlyphCache* c = new GlyphCache(face, pixelSize, loadFlags, distance);
+  caches.push_back(c);
+  return c;
+}
+
+void GlyphCache::dropFace(FT_Face face) {
+  for (size_t i = 0; i < caches.size(); ) {
+    if (caches[i]->face == face) {
+      #ifdef DEBUG
+        caches[i]->printStats();
+      #endif
+      delete caches[i];
+      caches.erase(caches.begin() + i);
+    } else {
+      ++i;
+    }
+  }
+}
+
+// Finds room for a w x h box: on the page being packed, on a new page
+// while the cache may grow, else on the least recently used page, emptied.
+bool GlyphCache::place(int w, int h, int& page, int& x, int& y) {
+  if (w > GLYPH_PAGE_SIZE || h > GLYPH_PAGE_SIZE)
+    return false;
+  if (packing >= 0) {
+    Page& p = pages[packing];
+    if (p.shelfX + w > GLYPH_PAGE_SIZE) {
+      p.shelfX = 0;
+      p.shelfY += p.shelfHeight;
+      p.shelfHeight = 0;
+    }
+    if (p.shelfY + h > GLYPH_PAGE_SIZE)
+      packing = -1;
+  }
+  if (packing < 0) {
+    int most = User::options.evictGlyphCacheOnNewPage ? GLYPH_PAGES_MIN : GLYPH_PAGES_MAX;
+    if ((int)pages.size() < most) {
+      Page p;
+      p.pixels = (unsigned char*)calloc(GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE);
+      if (p.pixels == nullptr)
+        return false;
+      p.shelfX = p.shelfY = p.shelfHeight = 0;
+      p.dirtyTop = p.dirtyBottom = 0;
+      p.lastUse = 0;
+      pages.push_back(p);
+      packing = pages.size() - 1;
+    } else {
+      packing = 0;
+      for (size_t i = 1; i < pages.size(); ++i) {
+        if (pages[i].lastUse < pages[packing].lastUse)
+          packing = i;
+      }
+      evict(packing);
+    }
+  }
+
+  Page& p = pages[packing];
+  page = packing;
+  x = p.shelfX;
+  y = p.shelfY;
+  p.shelfX += w;
+  p.shelfHeight = std::max(p.shelfHeight, h);
+  return true;
+}
+
+// Empties page, dropping every glyph on it.
+void GlyphCache::evict(int page) {
+  for (size_t i = 0; i < listeners.size(); ++i)
+    listeners[i]->glyphPageEvicted(page);
+  Page& p = pages[page];
+  for (size_t i = 0; i < p.glyphs.size(); ++i) {
+    uint32_t c = p.glyphs[i];
+    if (c < 128)
+      ascii[c].page = GLYPH_UNCACHED;
+    else
+      glyphs.erase(c);
+  }
+  totals.glyphs -= p.glyphs.size();
+  p.glyphs.clear();
+  memset(p.pixels, 0, GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE);
+  p.shelfX = p.shelfY = p.shelfHeight = 0;
+  p.dirtyTop = 0;
+  p.dirtyBottom = GLYPH_PAGE_SIZE;
+  ++totals.evictions;
+}
+
+// squared distance transform of one row or column (Felzenszwalb and
+// Huttenlocher): d[i] = min over j of f[j] + (i - j)^2
+static void distance1D(const float* f, float* d, int n, int* v, float* z) {
+  int k = 0;
+  v[0] = 0;
+  z[0] = -1e20f;
+  z[1] = 1e20f;
+  for (int q = 1; q < n; ++q) {
+    float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+    while (s <= z[k]) {
+      --k;
+      s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = 1e20f;
+  }
+  k = 0;
+  for (int q = 0; q < n; ++q) {
+    while (z[k + 1] < q)
+      ++k;
+    d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+  }
+}
+
+// Squared distance from each texel of a w x h grid to the nearest texel
+// where inside is want.
+static void distance2D(const std::vector<unsigned char>& inside, bool want, int w, int h, std::vector<float>& out) {
+  int n = std::max(w, h);
+  std::vector<float> f(n), d(n), z(n + 1);
+  std::vector<int> v(n);
+  out.resize(w * h);
+  for (int i = 0; i < w * h; ++i)
+    out[i] = (inside[i] != 0) == want ? 0.0f : 1e20f;
+  for (int x = 0; x < w; ++x) {
+    for (int y = 0; y < h; ++y)
+      f[y] = out[y * w + x];
+    distance1D(&f[0], &d[0], h, &v[0], &z[0]);
+    for (int y = 0; y < h; ++y)
+      out[y * w + x] = d[y];
+  }
+  for (int y = 0; y < h; ++y) {
+    distance1D(&out[y * w], &d[0], w, &v[0], &z[0]);
+    memcpy(&out[y * w], &d[0], w * sizeof(float));
+  }
+}
+
+// Distance field of g from bitmap, rendered GLYPH_SDF_OVERSAMPLE times
+// larger than g so the outline is placed to a fraction of a texel. Sets
+// the box of g, which adds GLYPH_SDF_SPREAD texels on each side.
+static void distanceField(const FT_GlyphSlot slot, CachedGlyph& g, std::vector<unsigned char>& out) {
+  const int k = GLYPH_SDF_OVERSAMPLE;
+  const int spread = GLYPH_SDF_SPREAD;
+  const FT_Bitmap& bitmap = slot->bitmap;
+  // box in texels, from the pen position
+  int left = (int)floorf((float)slot->bitmap_left / k) - spread;
+  int top = (int)ceilf((float)slot->bitmap_top / k) + spread;
+  int right = (int)ceilf((float)(slot->bitmap_left + (int)bitmap.width) / k) + spread;
+  int bottom = (int)floorf((float)(slot->bitmap_top - (int)bitmap.rows) / k) - spread;
+  g.left = left;
+  g.top = top;
+  g.width = right - left;
+  g.height = top - bottom;
+
+  int hw = g.width * k, hh = g.height * k;
+  std::vector<unsigned char> inside(hw * hh, 0);
+  int ox = slot->bitmap_left - left * k;
+  int oy = top * k - slot->bitmap_top;
+  for (int row = 0; row < (int)bitmap.rows; ++row) {
+    for (int col = 0; col < (int)bitmap.width; ++col)
+      inside[(row + oy) * hw + col + ox] = bitmap.buffer[row * bitmap.pitch + col] >= 128;
+  }
+  std::vector<float> toInside, toOutside;
+  distance2D(inside, true, hw, hh, toInside);
+  distance2D(inside, false, hw, hh, toOutside);
+
+  out.resize(g.width * g.height);
+  for (int y = 0; y < g.height; ++y) {
+    for (int x = 0; x < g.width; ++x) {
+      // the texel centre falls between four samples
+      float d = 0.0f;
+      for (int i = 0; i < 4; ++i) {
+        int at = (y * k + k / 2 - 1 + i / 2) * hw + x * k + k / 2 - 1 + i % 2;
+        d += inside[at] ? sqrtf(toOutside[at]) - 0.5f : 0.5f - sqrtf(toInside[at]);
+      }
+      float v = 128.0f + d / 4 / k * 127.0f / spread;
+      out[y * g.width + x] = (unsigned char)std::max(0.0f, std::min(255.0f, v));
+    }
+  }
+}
+
+CachedGlyph GlyphCache::rasterize(uint32_t c) {
+  if (c >= 128) {
+    std::unordered_map<uint32_t, CachedGlyph>::iterator it = glyphs.find(c);
+    if (it != glyphs.end()) {
+      ++totals.hits;
+      if (it->second.page >= 0)
+        pages[it->second.page].lastUse = ++useClock;
+      return it->second;
+    }
+  }
+  ++totals.misses;
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+  CachedGlyph g;
+  memset(&g, 0, sizeof(g));
+  g.page = -1;
+  // what the face lacks comes from the fallback font, if there is one
+  FT_Face from = face;
+  if (c >= 0x80 && FT_Get_Char_Index(face, c) == 0) {
+    FT_Face fallback = FontFaces::fallback();
+    if (fallback != 0 && FT_Get_Char_Index(fallback, c) != 0)
+      from = fallback;
+  }
+  // faces are shared with other sizes
+  FT_Set_Pixel_Sizes(from, 0, distance ? pixelSize * GLYPH_SDF_OVERSAMPLE : pixelSize);
+  if (FT_Load_Char(from, c, FT_LOAD_RENDER | loadFlags) == 0) {
+    FT_GlyphSlot slot = from->glyph;
+    FT_Bitmap& bitmap = slot->bitmap;
+    const unsigned char* src = bitmap.buffer;
+    int pitch = bitmap.pitch;
+    g.width = bitmap.width;
+    g.height = bitmap.rows;
+    g.left = slot->bitmap_left;
+    g.top = slot->bitmap_top;
+    g.advance = slot->advance.x >> 6;
+    std::vector<unsigned char> field;
+    if (distance) {
+      g.advance = (slot->advance.x / GLYPH_SDF_OVERSAMPLE + 32) >> 6;
+      if (g.width > 0 && g.height > 0) {
+        distanceField(slot, g, field);
+        src = &field[0];
+        pitch = g.width;
+      }
+    }
+    int page, x, y;
+    if (g.width > 0 && g.height > 0 &&
+      place(g.width + GLYPH_PADDING, g.height + GLYPH_PADDING, page, x, y)) {
+      Page& p = pages[page];
+      for (int row = 0; row < g.height; ++row)
+        memcpy(p.pixels + (y + row) * GLYPH_PAGE_SIZE + x, src + row * pitch, g.width);
+      if (p.dirtyTop >= p.dirtyBottom) {
+        p.dirtyTop = y;
+        p.dirtyBottom = y + g.height;
+      } else {
+        p.dirtyTop = std::min(p.dirtyTop, y);
+        p.dirtyBottom = std::max(p.dirtyBottom, y + (int)g.height);
+      }
+      p.lastUse = ++useClock;
+      p.glyphs.push_back(c);
+      g.page = page;
+      g.x = x;
+      g.y = y;
+    }
+  }
+  if (g.page < 0) {
+    // nothing to draw, but the advance is still worth keeping
+    g.width = g.height = 0;
+  }
+  if (c < 128)
+    ascii[c] = g;
+  else
+    glyphs[c] = g;
+  ++totals.glyphs;
+  changed = true;
+
+  totals.rasterMicros += std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - t0).count();
+  return g;
+}
+
+bool GlyphCache::dirtyRows(int page, int& top, int& bottom) {
+  Page& p = pages[page];
+  if (p.dirtyTop >= p.dirtyBottom)
+    return false;
+  top = p.dirtyTop;
+  bottom = p.dirtyBottom;
+  p.dirtyTop = p.dirtyBottom = 0;
+  return true;
+}
+
+void GlyphCache::addListener(GlyphCacheListener* l) {
+  listeners.push_back(l);
+}
+
+void GlyphCache::removeListener(GlyphCacheListener* l) {
+  listeners.erase(std::remove(listeners.begin(), listeners.end(), l), listeners.end());
+}
+
+struct AtlasFileHeader {
+  char magic[4];
+  int32_t version;
+  uint64_t font;
+  int32_t pixelSize;
+  int32_t loadFlags;
+  int32_t distance;
+  int32_t pageSize;
+  int32_t pages;
+  int32_t packing;
+  int32_t glyphs;
+};
+
+struct AtlasFileShelf {
+  int32_t shelfX, shelfY, shelfHeight;
+};
+
+struct AtlasFileGlyph {
+  uint32_t c;
+  CachedGlyph glyph;
+};
+
+#define ATLAS_FILE_VERSION 2
+
+void GlyphCache::persist(uint64_t f) {
+  font = f;
+  char name[64];
+  snprintf(name, sizeof(name), "glyphs-%016llx-%d-%x%s.atlas", (unsigned long long)font, pixelSize, loadFlags,
+    distance ? "-sdf" : "");
+  #ifdef __vita__
+    atlasPath = Screen::basePath() + "data/Bookr/" + name;
+  #else
+    atlasPath = Screen::basePath() + "/" + name;
+  #endif
+  if (pages.empty() && glyphs.empty())
+    loadAtlas();
+}
+
+// Reads the pages and glyphs of the atlas file, as many pages as the
+// cache may hold. The pages come back fully dirty, for the renderers.
+bool GlyphCache::loadAtlas() {
+  FILE* f = fopen(atlasPath.c_str(), "rb");
+  if (f == NULL)
+    return false;
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  AtlasFileHeader h;
+  bool ok = fread(&h, sizeof(h), 1, f) == 1 && memcmp(h.magic, "BKGA", 4) == 0 &&
+    h.version == ATLAS_FILE_VERSION && h.font == font && h.pixelSize == pixelSize && h.loadFlags == loadFlags &&
+    h.distance == distance && h.pageSize == GLYPH_PAGE_SIZE && h.pages >= 0 && h.pages <= GLYPH_PAGES_MAX && h.glyphs >= 0;
+  if (ok) {
+    // a truncated or damaged file must not ask for more than it holds
+    long start = ftell(f);
+    ok = fseek(f, 0, SEEK_END) == 0 &&
+      (ftell(f) - start - h.pages * (long)sizeof(AtlasFileShelf)) / (long)sizeof(AtlasFileGlyph) >= h.glyphs &&
+      fseek(f, start, SEEK_SET) == 0;
+  }
+  std::vector<AtlasFileShelf> shelves;
+  std::vector<AtlasFileGlyph> table;
+  if (ok) {
+    shelves.resize(h.pages);
+    table.resize(h.glyphs);
+    ok = (h.pages == 0 || fread(&shelves[0], sizeof(AtlasFileShelf), h.pages, f) == (size_t)h.pages) &&
+      (h.glyphs == 0 || fread(&table[0], sizeof(AtlasFileGlyph), h.glyphs, f) == (size_t)h.glyphs);
+  }
+  for (size_t i = 0; i < table.size() && ok; ++i) {
+    const CachedGlyph& g = table[i].glyph;
+    if (g.page >= 0)
+      ok = g.page < h.pages && g.x >= 0 && g.y >= 0 && g.width >= 0 && g.height >= 0 &&
+        g.x + g.width <= GLYPH_PAGE_SIZE && g.y + g.height <= GLYPH_PAGE_SIZE;
+  }
+  int most = User::options.evictGlyphCacheOnNewPage ? GLYPH_PAGES_MIN : GLYPH_PAGES_MAX;
+  int n = ok ? std::min<int>(h.pages, most) : 0;
+  for (int i = 0; i < n && ok; ++i) {
+    Page p;
+    p.pixels = (unsigned char*)malloc(GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE);
+    ok = p.pixels != nullptr && fread(p.pixels, GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE, f) == GLYPH_PAGE_SIZE;
+    if (!ok) {
+      free(p.pixels);
+      break;
+    }
+    p.shelfX = shelves[i].shelfX;
+    p.shelfY = shelves[i].shelfY;
+    p.shelfHeight = shelves[i].shelfHeight;
+    p.dirtyTop = 0;
+    p.dirtyBottom = GLYPH_PAGE_SIZE;
+    p.lastUse = 0;
+    pages.push_back(p);
+  }
+  fclose(f);
+  if (ok) {
+    for (size_t i = 0; i < table.size(); ++i) {
+      uint32_t c = table[i].c;
+      const CachedGlyph& g = table[i].glyph;
+      // glyphs on pages left out are rendered again when needed
+      if (g.page >= n)
+        continue;
+      if (g.page >= 0)
+        pages[g.page].glyphs.push_back(c);
+      if (c < 128)
+        ascii[c] = g;
+      else
+        glyphs[c] = g;
+      ++totals.glyphs;
+    }
+    packing = h.packing < n ? h.packing : -1;
+  } else {
+    for (size_t i = 0; i < pages.size(); ++i)
+      free(pages[i].pixels);
+    pages.clear();
+  }
+  totals.rasterMicros += std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - t0).count();
+  #ifdef DEBUG
+    printf("GlyphCache: %s %s, %d glyphs\n", ok ? "loaded" : "cannot use", atlasPath.c_str(), totals.glyphs);
+  #endif
+  return ok;
+}
+
+void GlyphCache::saveAtlas() {
+  if (atlasPath.empty())
+    return;
+  FILE* f = fopen(atlasPath.c_str(), "wb");
+  if (f == NULL) {
+    printf("cannot save glyph atlas to %s\n", atlasPath.c_str());
+    return;
+  }
+  std::vector<AtlasFileGlyph> table;
+  for (int c = 0; c < 128; ++c) {
+    if (ascii[c].page != GLYPH_UNCACHED) {
+      AtlasFileGlyph g = { (uint32_t)c, ascii[c] };
+      table.push_back(g);
+    }
+  }
+  for (std::unordered_map<uint32_t, CachedGlyph>::iterator it = glyphs.begin(); it != glyphs.end(); ++it) {
+    AtlasFileGlyph g = { it->first, it->second };
+    table.push_back(g);
+  }
+  AtlasFileHeader h;
+  memcpy(h.magic, "BKGA", 4);
+  h.version = ATLAS_FILE_VERSION;
+  h.font = font;
+  h.pixelSize = pixelSize;
+  h.loadFlags = loadFlags;
+  h.distance = distance;
+  h.pageSize = GLYPH_PAGE_SIZE;
+  h.pages = pages.size();
+  h.packing = packing;
+  h.glyphs = table.size();
+  fwrite(&h, sizeof(h), 1, f);
+  for (size_t i = 0; i < pages.size(); ++i) {
+    AtlasFileShelf s = { pages[i].shelfX, pages[i].shelfY, pages[i].shelfHeight };
+    fwrite(&s, sizeof(s), 1, f);
+  }
+  if (!table.empty())
+    fwrite(&table[0], sizeof(AtlasFileGlyph), table.size(), f);
+  for (size_t i = 0; i < pages.size(); ++i)
+    fwrite(pages[i].pixels, GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE, f);
+  fclose(f);
+  changed = false;
+}
+
+GlyphCache::Stats GlyphCache::stats() {
+  Stats s = totals;
+  s.pages = pages.size();
+  s.bytes = (int64_t)pages.size() * GLYPH_PAGE_SIZE * GLYPH_PAGE_SIZE;
+  return s;
+}
+
+void GlyphCache::printStats() {
+  Stats s = stats();
+  int lookups = s.hits + s.misses;
+  printf("GlyphCache: %dpx%s, %d glyphs in %d pages (%lld KB), %d hits %d misses (%.1f%% hits), %d evictions, "
+    "%.2f ms rasterizing\n", pixelSize, distance ? " distance field" : "", s.glyphs, s.pages,
+    (long long)(s.bytes / 1024), s.hits, s.misses, lookups > 0 ? 100.0 * s.hits / lookups : 0.0, s.evictions, s.rasterMicros / 1000.0);
+}
+
+uint32_t GlyphCache::decode(const char*& p, const char* end) {
+  unsigned char c = *p++;
+  if (c < 0x80)
+    return c;
+  int extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : -1;
+  if (extra < 0 || c > 0xf4 || end - p < extra)
+    return 0xfffd;
+  uint32_t u = c & (0x3f >> extra);
+  for (int i = 0; i < extra; ++i) {
+    if ((p[i] & 0xc0) != 0x80)
+      return 0xfffd;
+    u = (u << 6) | (p[i] & 0x3f);
+  }
+  p += extra;
+  return u;
+}
+
+}
@@ -0,0 +1,181 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+
+#ifndef BKGLYPHCACHE_H
+#define BKGLYPHCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace bookr {
+
+// atlas pages are square, one byte of coverage per texel
+#define GLYPH_PAGE_SIZE 512
+// pages a cache may hold; with evictGlyphCacheOnNewPage a full cache
+// evicts as soon as it has GLYPH_PAGES_MIN
+#define GLYPH_PAGES_MIN 2
+#define GLYPH_PAGES_MAX 8
+// CachedGlyph::page of an ASCII slot not rasterized yet
+#define GLYPH_UNCACHED -2
+// distance field glyphs are rendered once at this size and scaled; the
+// field reaches GLYPH_SDF_SPREAD texels each side of the outline, and is
+// measured on an outline rendered GLYPH_SDF_OVERSAMPLE times larger
+#define GLYPH_SDF_SIZE 32
+#define GLYPH_SDF_SPREAD 4
+#define GLYPH_SDF_OVERSAMPLE 4
+
+struct CachedGlyph {
+  int page;             // atlas page, -1 when the glyph has no pixels
+  short x, y;           // top left in the page
+  short width, height;
+  short left, top;      // bearing from the pen position, of the box
+  short advance;        // pixels
+};
+
+/*! \brief Told before the glyphs of an atlas page are thrown away.
+ *
+ *  Renderers that queue quads draw them here, while the page still has
+ *  the pixels they point at.
+ */
+class GlyphCacheListener {
+public:
+  virtual ~GlyphCacheListener() { }
+  virtual void glyphPageEvicted(int page) = 0;
+};
+
+/*! \brief Glyphs of one face at one size, rasterized on first use.
+ *
+ *  Glyphs are packed in shelves into fixed size atlas pages. When every
+ *  page is full the least recently used page is emptied and reused, so
+ *  CJK text costs the glyphs on screen and not the whole font. Pages are
+ *  plain memory; a renderer uploads the rows dirtyRows() reports.
+ *
+ *  Caches are shared: everything drawing with the same face and size
+ *  asks forFace() and gets the same one. A cache can also be kept on
+ *  disk, see persist(), so the glyphs of the last run are there from
+ *  the start and FreeType only renders the ones never drawn before.
+ *
+ *  A distance field cache keeps, instead of coverage, how far each texel
+ *  is from the outline: 128 on it, more inside. Boxes grow by
+ *  GLYPH_SDF_SPREAD on every side. Drawn through a threshold, one size of
+ *  it is sharp at any scale.
+ */
+class GlyphCache {
+public:
+  struct Stats {
+    int glyphs;
+    int pages;
+    int64_t bytes;
+    int hits;
+    int misses;
+    int evictions;
+    int64_t rasterMicros;   // spent in FreeType
+  };
+
+private:
+  struct Page {
+    unsigned char* pixels;
+    int shelfX, shelfY, shelfHeight;
+    int dirtyTop, dirtyBottom;  // rows changed since the last upload
+    int64_t lastUse;
+    std::vector<uint32_t> glyphs;
+  };
+
+  FT_Face face;
+  int pixelSize;
+  int loadFlags;
+  bool distance;
+  std::unordered_map<uint32_t, CachedGlyph> glyphs;
+  // ASCII skips the hash; page is GLYPH_UNCACHED until rasterized
+  CachedGlyph ascii[128];
+  std::vector<Page> pages;
+  int packing;          // page new glyphs go to; -1 when it is full
+  std::vector<GlyphCacheListener*> listeners;
+  int64_t useClock;
+  Stats totals;
+  std::string atlasPath;  // empty unless persist() was called
+  uint64_t font;
+  bool changed;         // glyphs added since the atlas file was read
+
+  GlyphCache(FT_Face face, int pixelSize, int loadFlags, bool distance);
+  bool loadAtlas();
+  CachedGlyph rasterize(uint32_t c);
+  bool place(int w, int h, int& page, int& x, int& y);
+  void evict(int page);
+
+public:
+  ~GlyphCache();
+
+  /**
+   * The cache for face at pixelSize, created on first use. loadFlags are
+   * added to FT_LOAD_RENDER. With distance, a distance field cache.
+   */
+  static GlyphCache* forFace(FT_Face face, int pixelSize, int loadFlags = 0, bool distance = false);
+  /**
+   * Deletes the caches of face; FontFaces calls it before FT_Done_Face.
+   */
+  static void dropFace(FT_Face face);
+
+  /**
+   * The glyph for codepoint c, rasterized now if it isn't cached. The
+   * result is a copy; its page may be reused by the next get().
+   */
+  CachedGlyph get(uint32_t c) {
+    if (c < 128 && ascii[c].page != GLYPH_UNCACHED) {
+      ++totals.hits;
+      if (ascii[c].page >= 0)
+        pages[ascii[c].page].lastUse = ++useClock;
+      return ascii[c];
+    }
+    return rasterize(c);
+  }
+
+  int pageCount() { return pages.size(); }
+  const unsigned char* pagePixels(int page) { return pages[page].pixels; }
+
+  /**
+   * Rows [top, bottom) of page changed since the last call; false when
+   * none did.
+   */
+  bool dirtyRows(int page, int& top, int& bottom);
+
+  /**
+   * Keeps the cache in an atlas file named after font, pixel size and
+   * load flags: fills it from the file now if there is one, and writes
+   * the file back when the cache is deleted with glyphs added since.
+   * font is FontFaces::hash() of the face.
+   */
+  void persist(uint64_t font);
+  void saveAtlas();
+
+  void addListener(GlyphCacheListener* l);
+  void removeListener(GlyphCacheListener* l);
+
+  Stats stats();
+  void printStats();
+
+  /**
+   * Decodes the UTF-8 sequence at p, moving p past it; a malformed byte
+   * reads as U+FFFD.
+   */
+  static uint32_t decode(const char*& p, const char* end);
+};
+
+}
+
+#endif
@@ -109,6 +109,10 @@ namespace Screen {
 
   void setTextSize(float x, float y);
   void drawText(int x, int y, unsigned int color, float scale, const char *text);
+  /**
+   * Advance of UTF-8 text drawn with drawText at scale.
+   */
+  int textWidth(float scale, const char *text);
 
   void copyImage(int psm, int sx, int sy, int width, int height, int srcw, void *src,
     int dx, int dy, int destw, void *dest);
@@ -126,6 +130,23 @@ namespace Screen {
   void drawTextureTintScale(const Texture *texture, float x, float y, float x_scale, float y_scale, unsigned int color);
   void drawTextureTintScaleRotate(const Texture *texture, float x, float y, float x_scale, float y_scale, float rad, unsigned int color);
 
+  /**
+   * Offscreen texture of the screen's size that drawing can be sent to,
+   * or NULL where that isn't supported. Free it with freeRenderTarget.
+   */
+  Texture* createRenderTarget();
+  void freeRenderTarget(Texture *target);
+  /**
+   * Send drawing to target, cleared to color, until endRenderTarget. Only
+   * between frames, never inside startDirectList and endAndDisplayList.
+   */
+  void startRenderTarget(Texture *target, unsigned int color);
+  void endRenderTarget();
+  /**
+   * Color startDirectList clears the frame with.
+   */
+  unsigned int getClearColor();
+
   void* framebuffer();
 
   void blendFunc(int op, int src, int dst);
@@ -149,6 +170,12 @@ namespace Screen {
   void setBoundTexture(Texture *);
 
   string basePath();
+  /**
+   * The font for scripts the other fonts lack, CJK above all. It isn't
+   * built in; it is opened from here the first time a glyph needs it.
+   * The Vita package carries one, a copy in data/Bookr/fonts overrides it.
+   */
+  string fallbackFontPath();
   int dirContents(const char* path, vector<Dirent>& a);
 
   int getSuspendSerial();
@@ -10,6 +10,8 @@
  * Licensed under GPLv3+, see LICENSE
 */
 
+#include <cstdio>
+
 #include "screen.hpp"
 #include "controls.hpp"
 
@@ -79,6 +81,20 @@ int repsForButtonMask(int mask) {
 	return 0;
 }
 
+string fallbackFontPath() {
+#ifdef __vita__
+	// a font the user put in data/Bookr wins over the one in the package
+	string path = basePath() + "data/Bookr/fonts/DroidSansFallback.ttf";
+	FILE* f = fopen(path.c_str(), "rb");
+	if (f == NULL)
+		return "app0:data/Bookr/fonts/DroidSansFallback.ttf";
+	fclose(f);
+	return path;
+#else
+	return basePath() + "/fonts/DroidSansFallback.ttf";
+#endif
+}
+
 // char *speedLabels = {
 // 	"Default",
 // 	"10Mhz/5Mhz",
@@ -248,6 +248,8 @@ void getAnalogPad(int& x, int& y) {
 }
 
 void swapBuffers() {
+    if (ResourceManager::getSpriteRenderer() != nullptr)
+        ResourceManager::getSpriteRenderer()->Flush();
     glfwSwapBuffers(window);
 }
 
@@ -427,4 +429,24 @@ void drawTextureScale(const Texture *texture, float x, float y, float x_scale, f
 
 }
 
+Texture* createRenderTarget() {
+    return NULL;
+}
+
+void freeRenderTarget(Texture *target) {
+
+}
+
+void startRenderTarget(Texture *target, unsigned int color) {
+
+}
+
+void endRenderTarget() {
+
+}
+
+unsigned int getClearColor() {
+    return 0;
+}
+
 } }
@@ -31,7 +31,7 @@
 #include "icon0_t_png.h"
 #include "NotoSans-Regular_ttf.h"
 #include "text_vert.h"
-#include "text_frag.h"
+#include "text_sdf_frag.h"
 //-----------------------------------------------------------------------------
 // nxlink support
 //-----------------------------------------------------------------------------
@@ -337,8 +337,8 @@ static void loadShaders() {
     ResourceManager::LoadTexture((const char*)icon0_t_png, GL_TRUE, "logo", false, icon0_t_png_size);
 
     // text
-    ResourceManager::LoadShader((const char*)text_vert, (const char*)text_frag, nullptr, "text", false,
-      text_vert_size, text_frag_size);
+    ResourceManager::LoadShader((const char*)text_vert, (const char*)text_sdf_frag, nullptr, "text", false,
+      text_vert_size, text_sdf_frag_size);
 
     ui_text_renderer = new TextRenderer(ResourceManager::GetShader("text"), static_cast<GLfloat>(SCR_WIDTH), static_cast<GLfloat>(SCR_HEIGHT));
 
@@ -420,6 +420,15 @@ void drawText(int x, int y, unsigned int color, float scale, const char *text) {
 
 }
 
+int textWidth(float scale, const char *text) {
+  // no text drawing yet; a fixed cell per character like the old layout
+  int n = 0;
+  for (const char* p = text; *p; ++p)
+    if ((*p & 0xc0) != 0x80)
+      ++n;
+  return (int)(n * 10 * scale);
+}
+
 void drawFontTextf(Font *font, int x, int y, unsigned int color, unsigned int size, const char *text, ...) {
 
 }
@@ -505,6 +514,8 @@ void endAndDisplayList() {
 
 
 void swapBuffers() {
+  if (ResourceManager::getSpriteRenderer() != nullptr)
+    ResourceManager::getSpriteRenderer()->Flush();
   eglSwapBuffers(s_display, s_surface);
 }
 
@@ -567,6 +578,26 @@ void drawTextureTintScaleRotate(const Texture *texture, float x, float y, float
 
 }
 
+Texture* createRenderTarget() {
+  return NULL;
+}
+
+void freeRenderTarget(Texture *target) {
+
+}
+
+void startRenderTarget(Texture *target, unsigned int color) {
+
+}
+
+void endRenderTarget() {
+
+}
+
+unsigned int getClearColor() {
+  return 0;
+}
+
 /*  Active Shader
     bind correct vertex array
   */
@@ -176,6 +176,10 @@ void drawText(int x, int y, unsigned int color, float scale, const char *text) {
   vita2d_pgf_draw_text(pgf, x, y, color, scale, text);
 }
 
+int textWidth(float scale, const char *text) {
+  return vita2d_pgf_text_width(pgf, scale, text);
+}
+
 void setTextSize(float x, float y) {
 
 }
@@ -323,6 +327,37 @@ void drawTextureTintScaleRotate(const Texture *texture, float x, float y, float
   vita2d_draw_texture_tint_scale_rotate(texture->vita_texture, x, y, x_scale, y_scale, rad, color);
 }
 
+// vita2d keeps one projection, the screen's, so targets are that size too
+Texture* createRenderTarget() {
+  vita2d_texture* t = vita2d_create_empty_texture_rendertarget(WIDTH, HEIGHT, SCE_GXM_TEXTURE_FORMAT_A8B8G8R8);
+  if (t == NULL)
+    return NULL;
+  return Texture::createFromVitaTexture(t);
+}
+
+void freeRenderTarget(Texture *target) {
+  // the last frames may still sample it
+  vita2d_wait_rendering_done();
+  vita2d_free_texture(target->vita_texture);
+  target->release();
+}
+
+void startRenderTarget(Texture *target, unsigned int color) {
+  vita2d_start_drawing_advanced(target->vita_texture, SCE_GXM_SCENE_FRAGMENT_SET_DEPENDENCY);
+  unsigned int frameColor = vita2d_get_clear_color();
+  vita2d_set_clear_color(color);
+  vita2d_clear_screen();
+  vita2d_set_clear_color(frameColor);
+}
+
+void endRenderTarget() {
+  vita2d_end_drawing();
+}
+
+unsigned int getClearColor() {
+  return vita2d_get_clear_color();
+}
+
 
 
 /*  Active Shader
@@ -0,0 +1,16 @@
+#version 330 core
+in vec2 TexCoords;
+in vec3 TextColor;
+out vec4 color;
+
+uniform sampler2D text;
+
+void main()
+{    
+    // Distance to the outline, 0.5 on it; the edge is blended over about
+    // one screen pixel however much the glyph is scaled
+    float distance = texture(text, TexCoords).r;
+    float smoothing = clamp(0.7 * fwidth(distance), 0.001, 0.5);
+    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+    color = vec4(TextColor, alpha);
+}
@@ -6,10 +6,17 @@
 ** Creative Commons, either version 4 of the License, or (at your
 ** option) any later version.
 ******************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
 #include "sprite_renderer.hpp"
 
 namespace bookr {
 
+// Quads the vertex buffer starts with room for
+#define SPRITE_BATCH_QUADS 64
+
 SpriteRenderer::SpriteRenderer(Shader shader)
 {
     this->shader = shader;
@@ -18,83 +25,140 @@ SpriteRenderer::SpriteRenderer(Shader shader)
 
 SpriteRenderer::~SpriteRenderer()
 {
+    glDeleteTextures(1, &this->emptyTexture);
+    glDeleteBuffers(1, &this->VBO);
     glDeleteVertexArrays(1, &this->quadVAO);
 }
 
 void SpriteRenderer::DrawSprite(Texture2D texture, glm::vec2 position, glm::vec2 size, GLfloat rotate, glm::vec3 color)
 {
-    // Prepare transformations
-    this->shader.Use();
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(position, 0.0f));  // First translate (transformations are: scale happens first, then rotation and then finall translation happens; reversed order)
-
-    model = glm::translate(model, glm::vec3(0.5f * size.x, 0.5f * size.y, 0.0f)); // Move origin of rotation to center of quad
-    model = glm::rotate(model, rotate, glm::vec3(0.0f, 0.0f, 1.0f)); // Then rotate
-    model = glm::translate(model, glm::vec3(-0.5f * size.x, -0.5f * size.y, 0.0f)); // Move origin back
-
-    model = glm::scale(model, glm::vec3(size, 1.0f)); // Last scale
-
-    this->shader.SetMatrix4("model", model);
-
-    // Render textured quad
-    this->shader.SetVector4f("spriteColor", glm::vec4(color, 1.0f));
-
-    // glBindTexture(GL_TEXTURE_2D, texture.ID);
-    texture.Bind();
-
-    glBindVertexArray(this->quadVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-    glBindVertexArray(0);
-    glUseProgram(0);
+    this->queue(texture.ID, position, size, rotate, glm::vec4(color, 1.0f));
 }
 
 void SpriteRenderer::DrawQuad(glm::vec2 position, glm::vec2 size, GLfloat rotate, glm::vec4 color)
 {
-    this->shader.Use();
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(position, 0.0f));  // First translate (transformations are: scale happens first, then rotation and then finall translation happens; reversed order)
-
-    model = glm::translate(model, glm::vec3(0.5f * size.x, 0.5f * size.y, 0.0f)); // Move origin of rotation to center of quad
-    model = glm::rotate(model, rotate, glm::vec3(0.0f, 0.0f, 1.0f)); // Then rotate
-    model = glm::translate(model, glm::vec3(-0.5f * size.x, -0.5f * size.y, 0.0f)); // Move origin back
-
-    model = glm::scale(model, glm::vec3(size, 1.0f)); // Last scale
+    this->queue(this->emptyTexture, position, size, rotate, color);
+}
 
-    this->shader.SetMatrix4("model", model);
-    this->shader.SetVector4f("spriteColor", color);
+void SpriteRenderer::queue(GLuint texture, glm::vec2 position, glm::vec2 size, GLfloat rotate, glm::vec4 color)
+{
+    // Corners of the quad, rotated around its center
+    static const GLfloat unit[4][2] = { { 0.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+    GLfloat c = 1.0f, s = 0.0f;
+    if (rotate != 0.0f) {
+        c = cosf(rotate);
+        s = sinf(rotate);
+    }
+    GLfloat cx = position.x + 0.5f * size.x, cy = position.y + 0.5f * size.y;
+    GLfloat x[4], y[4];
+    GLfloat x0 = cx, y0 = cy, x1 = cx, y1 = cy;
+    for (int i = 0; i < 4; ++i)
+    {
+        GLfloat dx = (unit[i][0] - 0.5f) * size.x, dy = (unit[i][1] - 0.5f) * size.y;
+        x[i] = cx + c * dx - s * dy;
+        y[i] = cy + s * dx + c * dy;
+        x0 = std::min(x0, x[i]);
+        y0 = std::min(y0, y[i]);
+        x1 = std::max(x1, x[i]);
+        y1 = std::max(y1, y[i]);
+    }
+    SpriteVertex quad[6] = {
+        { x[0], y[0], 0.0f, 1.0f, color.r, color.g, color.b, color.a },
+        { x[1], y[1], 1.0f, 0.0f, color.r, color.g, color.b, color.a },
+        { x[2], y[2], 0.0f, 0.0f, color.r, color.g, color.b, color.a },
+
+        { x[0], y[0], 0.0f, 1.0f, color.r, color.g, color.b, color.a },
+        { x[3], y[3], 1.0f, 1.0f, color.r, color.g, color.b, color.a },
+        { x[1], y[1], 1.0f, 0.0f, color.r, color.g, color.b, color.a }
+    };
 
-    glBindTexture(GL_TEXTURE_2D, emptyTexture);
+    // Join the latest group with the same texture, unless a group after
+    // it overlaps the quad and has to stay underneath
+    SpriteGroup* group = nullptr;
+    for (size_t i = this->Used; i-- > 0; )
+    {
+        SpriteGroup& g = this->Groups[i];
+        if (g.Texture == texture) {
+            group = &g;
+            break;
+        }
+        if (g.X0 < x1 && x0 < g.X1 && g.Y0 < y1 && y0 < g.Y1)
+            break;
+    }
+    if (group == nullptr)
+    {
+        if (this->Used == this->Groups.size())
+            this->Groups.push_back(SpriteGroup());
+        group = &this->Groups[this->Used++];
+        group->Texture = texture;
+        group->X0 = x0;
+        group->Y0 = y0;
+        group->X1 = x1;
+        group->Y1 = y1;
+    }
+    else
+    {
+        group->X0 = std::min(group->X0, x0);
+        group->Y0 = std::min(group->Y0, y0);
+        group->X1 = std::max(group->X1, x1);
+        group->Y1 = std::max(group->Y1, y1);
+    }
+    group->Vertices.insert(group->Vertices.end(), quad, quad + 6);
+}
 
+// Uploads all the queued quads at once and draws each group from its range.
+void SpriteRenderer::Flush()
+{
+    if (this->Used == 0)
+        return;
+    GLsizei count = 0;
+    for (size_t i = 0; i < this->Used; ++i)
+        count += this->Groups[i].Vertices.size();
+    this->shader.Use();
+    glActiveTexture(GL_TEXTURE0);
     glBindVertexArray(this->quadVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+    if (count > this->BufferVertices) {
+        while (this->BufferVertices < count)
+            this->BufferVertices *= 2;
+        glBufferData(GL_ARRAY_BUFFER, sizeof(SpriteVertex) * this->BufferVertices, NULL, GL_DYNAMIC_DRAW);
+    }
+    GLsizei first = 0;
+    for (size_t i = 0; i < this->Used; ++i)
+    {
+        std::vector<SpriteVertex>& quads = this->Groups[i].Vertices;
+        glBufferSubData(GL_ARRAY_BUFFER, sizeof(SpriteVertex) * first, sizeof(SpriteVertex) * quads.size(), &quads[0]);
+        first += quads.size();
+    }
+    first = 0;
+    for (size_t i = 0; i < this->Used; ++i)
+    {
+        std::vector<SpriteVertex>& quads = this->Groups[i].Vertices;
+        glBindTexture(GL_TEXTURE_2D, this->Groups[i].Texture);
+        glDrawArrays(GL_TRIANGLES, first, quads.size());
+        first += quads.size();
+        quads.clear();
+    }
+    this->Used = 0;
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
-    glUseProgram(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 void SpriteRenderer::initRenderData()
 {
-    // Configure VAO/VBO
-    GLuint VBO;
-    GLfloat vertices[] = { 
-        // Pos      // Tex
-        0.0f, 1.0f, 0.0f, 1.0f,
-        1.0f, 0.0f, 1.0f, 0.0f,
-        0.0f, 0.0f, 0.0f, 0.0f, 
-
-        0.0f, 1.0f, 0.0f, 1.0f,
-        1.0f, 1.0f, 1.0f, 1.0f,
-        1.0f, 0.0f, 1.0f, 0.0f
-    };
-
+    this->Used = 0;
+    this->BufferVertices = SPRITE_BATCH_QUADS * 6;
+    // Configure VAO/VBO for the quads of a batch
     glGenVertexArrays(1, &this->quadVAO);
-    glGenBuffers(1, &VBO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
+    glGenBuffers(1, &this->VBO);
     glBindVertexArray(this->quadVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(SpriteVertex) * this->BufferVertices, NULL, GL_DYNAMIC_DRAW);
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), (GLvoid*)0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (GLvoid*)offsetof(SpriteVertex, X));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (GLvoid*)offsetof(SpriteVertex, R));
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
@@ -110,4 +174,4 @@ void SpriteRenderer::initRenderData()
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-}
\ No newline at end of file
+}
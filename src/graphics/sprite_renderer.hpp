@@ -9,6 +9,8 @@
 #ifndef SPRITE_RENDERER_H
 #define SPRITE_RENDERER_H
 
+#include <vector>
+
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -18,6 +20,24 @@
 
 namespace bookr {
 
+// One corner of a sprite quad: position, texture coordinates and color
+struct SpriteVertex {
+    GLfloat X, Y, U, V;
+    GLfloat R, G, B, A;
+};
+
+// Quads of one texture, drawn with a single call, and the box around them
+struct SpriteGroup {
+    GLuint Texture;
+    GLfloat X0, Y0, X1, Y1;
+    std::vector<SpriteVertex> Vertices;
+};
+
+// Draws textured and flat colored quads. DrawSprite and DrawQuad only queue
+// the quad; Flush draws everything queued from one vertex buffer, with a
+// draw call per texture. Quads are grouped by texture, but a quad never
+// moves in front of an earlier one it overlaps, so what is on top stays on
+// top. Text rendering and Screen::swapBuffers flush first.
 class SpriteRenderer
 {
 public:
@@ -28,13 +48,22 @@ public:
     // Renders a defined quad textured with given sprite
     void DrawSprite(Texture2D texture, glm::vec2 position, glm::vec2 size = glm::vec2(10, 10), GLfloat rotate = 0.0f, glm::vec3 color = glm::vec3(1.0f));
     void DrawQuad(glm::vec2 position, glm::vec2 size = glm::vec2(10, 10), GLfloat rotate = 0.0f, glm::vec4 color = glm::vec4(1.0f));
+    // Draws the queued quads
+    void Flush();
 private:
     // Render state
     Shader shader; 
-    GLuint quadVAO;
+    GLuint quadVAO, VBO;
+    // Capacity of VBO, in vertices
+    GLsizei BufferVertices;
     GLuint emptyTexture;
+    // Queued quads, in the order they are drawn; groups past Used are
+    // empty and kept for their storage
+    std::vector<SpriteGroup> Groups;
+    size_t Used;
     // Initializes and configures the quad's buffer and vertex attributes
     void initRenderData();
+    void queue(GLuint texture, glm::vec2 position, glm::vec2 size, GLfloat rotate, glm::vec4 color);
 };
 
 }
@@ -6,6 +6,7 @@
 ** Creative Commons, either version 4 of the License, or (at your
 ** option) any later version.
 ******************************************************************/
+#include <cstddef>
 #include <iostream>
 
 #include <glm/gtc/matrix_transform.hpp>
@@ -13,27 +14,22 @@
 #include FT_FREETYPE_H
 
 #include "text_renderer.hpp"
+#include "font_faces.hpp"
 #include "../resource_manager.hpp"
 
 
 namespace bookr {
 
+// Quads the vertex buffer starts with room for
+#define TEXT_BATCH_QUADS 256
+
 TextRenderer::TextRenderer(GLuint width, GLuint height)
 {
     // Load and configure shader
-    this->TextShader = ResourceManager::LoadShader("shaders/text.vert", "shaders/text.frag", nullptr, "text");
+    this->TextShader = ResourceManager::LoadShader("shaders/text.vert", "shaders/text_sdf.frag", nullptr, "text");
     this->TextShader.SetMatrix4("projection", glm::ortho(0.0f, static_cast<GLfloat>(width), static_cast<GLfloat>(height), 0.0f), GL_TRUE);
     this->TextShader.SetInteger("text", 0);
-    // Configure VAO/VBO for texture quads
-    glGenVertexArrays(1, &this->VAO);
-    glGenBuffers(1, &this->VBO);
-    glBindVertexArray(this->VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    this->initRenderData();
 }
 
 TextRenderer::TextRenderer(Shader shader, GLuint width, GLuint height)
@@ -41,125 +37,196 @@ TextRenderer::TextRenderer(Shader shader, GLuint width, GLuint height)
     this->TextShader = shader;
     this->TextShader.SetMatrix4("projection", glm::ortho(0.0f, static_cast<GLfloat>(width), static_cast<GLfloat>(height), 0.0f), GL_TRUE);
     this->TextShader.SetInteger("text", 0);
+    this->initRenderData();
+}
+
+TextRenderer::~TextRenderer()
+{
+    this->closeFont();
+    glDeleteBuffers(1, &this->VBO);
+    glDeleteVertexArrays(1, &this->VAO);
+}
+
+void TextRenderer::initRenderData()
+{
+    this->Face = 0;
+    this->Glyphs = nullptr;
+    this->Batching = 0;
+    this->BufferVertices = TEXT_BATCH_QUADS * 6;
+    // Configure VAO/VBO for the glyph quads of a batch
     glGenVertexArrays(1, &this->VAO);
     glGenBuffers(1, &this->VBO);
     glBindVertexArray(this->VAO);
     glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(TextVertex) * this->BufferVertices, NULL, GL_DYNAMIC_DRAW);
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), 0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (GLvoid*)offsetof(TextVertex, X));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (GLvoid*)offsetof(TextVertex, R));
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 }
 
+void TextRenderer::closeFont()
+{
+    if (this->Glyphs != nullptr) {
+        this->Glyphs->removeListener(this);
+        this->Glyphs = nullptr;
+    }
+    if (this->Face) {
+        FontFaces::release(this->Face);
+        this->Face = 0;
+    }
+    if (!this->Pages.empty())
+        glDeleteTextures(this->Pages.size(), &this->Pages[0]);
+    this->Pages.clear();
+    this->Vertices.clear();
+}
+
 void TextRenderer::Load(std::string font, GLuint fontSize, bool fromMemory)
 {
-    // First clear the previously loaded Characters
-    this->Characters.clear();
-    // Then initialize and load the FreeType library
-    FT_Library ft;    
-    if (FT_Init_FreeType(&ft)) // All functions return a value different than 0 whenever an error occurred
-        std::cout << "ERROR::FREETYPE: Could not init FreeType Library" << std::endl;
-    // Load font as face
-    FT_Face face;
-    if (fromMemory) {
-        if (FT_New_Memory_Face(ft, (const unsigned char*)font.c_str(), font.size(), 0, &face))
-            std::cout << "ERROR::FREETYPE: Failed to load font from memory" << std::endl;
+    // First drop the previously loaded font
+    this->closeFont();
+    // Then open the font as a face, shared with everything else using it
+    FT_Face face = fromMemory ? FontFaces::openMemory((const unsigned char*)font.data(), font.size()) :
+        FontFaces::openFile(font);
+    if (!face)
+    {
+        std::cout << "ERROR::FREETYPE: Failed to load font" << std::endl;
+        return;
     }
-    else {
-        if (FT_New_Face(ft, font.c_str(), 0, &face))
-            std::cout << "ERROR::FREETYPE: Failed to load font" << std::endl;
+    this->Face = face;
+    this->FontSize = fontSize;
+    this->Glyphs = GlyphCache::forFace(face, GLYPH_SDF_SIZE, FT_LOAD_NO_HINTING, true);
+    this->Glyphs->persist(FontFaces::hash(face));
+    this->Glyphs->addListener(this);
+}
+
+void TextRenderer::RenderText(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 color)
+{
+    if (this->Glyphs == nullptr)
+        return;
+    const GLfloat texel = 1.0f / GLYPH_PAGE_SIZE;
+    // Glyphs are cached at GLYPH_SDF_SIZE, whatever size they are drawn at
+    scale *= (GLfloat)this->FontSize / GLYPH_SDF_SIZE;
+    GLfloat top = this->Glyphs->get('H').top - GLYPH_SDF_SPREAD;
+    // Iterate through all characters
+    const char* c = text.data();
+    const char* end = c + text.size();
+    while (c < end)
+    {
+        CachedGlyph ch = this->Glyphs->get(GlyphCache::decode(c, end));
+
+        GLfloat xpos = x + ch.left * scale;
+        GLfloat ypos = y + (top - ch.top) * scale;
+
+        GLfloat w = ch.width * scale;
+        GLfloat h = ch.height * scale;
+        // Now advance cursors for next glyph
+        x += ch.advance * scale;
+        if (ch.page < 0)
+            continue;
+        // Queue the glyph quad with the others of its page
+        GLfloat u0 = ch.x * texel, v0 = ch.y * texel;
+        GLfloat u1 = (ch.x + ch.width) * texel, v1 = (ch.y + ch.height) * texel;
+        TextVertex quad[6] = {
+            { xpos,     ypos + h,   u0, v1, color.r, color.g, color.b },
+            { xpos + w, ypos,       u1, v0, color.r, color.g, color.b },
+            { xpos,     ypos,       u0, v0, color.r, color.g, color.b },
+
+            { xpos,     ypos + h,   u0, v1, color.r, color.g, color.b },
+            { xpos + w, ypos + h,   u1, v1, color.r, color.g, color.b },
+            { xpos + w, ypos,       u1, v0, color.r, color.g, color.b }
+        };
+        if ((int)this->Vertices.size() <= ch.page)
+            this->Vertices.resize(ch.page + 1);
+        this->Vertices[ch.page].insert(this->Vertices[ch.page].end(), quad, quad + 6);
     }
-    // Set size to load glyphs as
-    FT_Set_Pixel_Sizes(face, 0, fontSize);
+    if (this->Batching == 0)
+        this->flush();
+}
+
+void TextRenderer::BeginBatch()
+{
+    ++this->Batching;
+}
+
+void TextRenderer::EndBatch()
+{
+    if (this->Batching > 0 && --this->Batching == 0)
+        this->flush();
+}
+
+void TextRenderer::glyphPageEvicted(int page)
+{
+    this->flush();
+}
+
+// Brings the page textures up to date with the rows the cache changed.
+void TextRenderer::upload()
+{
     // Disable byte-alignment restriction
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1); 
-    // Then for the first 128 ASCII characters, pre-load/compile their characters and store them
-    for (GLubyte c = 0; c < 128; c++) // lol see what I did there 
+    for (int page = 0; page < this->Glyphs->pageCount(); ++page)
     {
-        // Load character glyph 
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER))
+        if (page == (int)this->Pages.size())
         {
-            std::cout << "ERROR::FREETYTPE: Failed to load Glyph" << std::endl;
-            continue;
+            GLuint texture;
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE, 0, GL_RED, GL_UNSIGNED_BYTE,
+                this->Glyphs->pagePixels(page));
+            // Set texture options
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            this->Pages.push_back(texture);
+        }
+        int top, bottom;
+        if (this->Glyphs->dirtyRows(page, top, bottom))
+        {
+            glBindTexture(GL_TEXTURE_2D, this->Pages[page]);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, top, GLYPH_PAGE_SIZE, bottom - top, GL_RED, GL_UNSIGNED_BYTE,
+                this->Glyphs->pagePixels(page) + top * GLYPH_PAGE_SIZE);
         }
-        // Generate texture
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RED,
-            face->glyph->bitmap.width,
-            face->glyph->bitmap.rows,
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer
-            );
-        // Set texture options
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-       
-        // Now store character for later use
-        Character character = {
-            texture,
-            glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-            glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-            static_cast<GLuint>(face->glyph->advance.x)
-        };
-        Characters.insert(std::pair<GLchar, Character>(c, character));
     }
-    glBindTexture(GL_TEXTURE_2D, 0);
-    // Destroy FreeType once we're finished
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
 }
 
-void TextRenderer::RenderText(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 color)
+// Uploads the queued quads and draws them, one call per atlas page.
+void TextRenderer::flush()
 {
+    size_t queued = 0;
+    for (size_t page = 0; page < this->Vertices.size(); ++page)
+        queued += this->Vertices[page].size();
+    if (queued == 0)
+        return;
+    // Quads queued before the text go underneath it
+    if (ResourceManager::getSpriteRenderer() != nullptr)
+        ResourceManager::getSpriteRenderer()->Flush();
+    this->upload();
     // Activate corresponding render state	
     this->TextShader.Use();
-    this->TextShader.SetVector3f("textColor", color);
     glActiveTexture(GL_TEXTURE0);
     glBindVertexArray(this->VAO);
-
-    // Iterate through all characters
-    std::string::const_iterator c;
-    for (c = text.begin(); c != text.end(); c++)
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+    for (size_t page = 0; page < this->Vertices.size(); ++page)
     {
-        Character ch = Characters[*c];
-
-        GLfloat xpos = x + ch.Bearing.x * scale;
-        GLfloat ypos = y + (this->Characters['H'].Bearing.y - ch.Bearing.y) * scale;
-
-        GLfloat w = ch.Size.x * scale;
-        GLfloat h = ch.Size.y * scale;
-        // Update VBO for each character
-        GLfloat vertices[6][4] = {
-            { xpos,     ypos + h,   0.0, 1.0 },
-            { xpos + w, ypos,       1.0, 0.0 },
-            { xpos,     ypos,       0.0, 0.0 },
-
-            { xpos,     ypos + h,   0.0, 1.0 },
-            { xpos + w, ypos + h,   1.0, 1.0 },
-            { xpos + w, ypos,       1.0, 0.0 }
-        };
-        // Render glyph texture over quad
-        glBindTexture(GL_TEXTURE_2D, ch.TextureID);
-        // Update content of VBO memory
-        glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices); // Be sure to use glBufferSubData and not glBufferData
-
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        // Render quad
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-        // Now advance cursors for next glyph
-        x += (ch.Advance >> 6) * scale; // Bitshift by 6 to get value in pixels (1/64th times 2^6 = 64)
+        std::vector<TextVertex>& quads = this->Vertices[page];
+        GLsizei count = quads.size();
+        if (count == 0)
+            continue;
+        if (count > this->BufferVertices) {
+            while (this->BufferVertices < count)
+                this->BufferVertices *= 2;
+            glBufferData(GL_ARRAY_BUFFER, sizeof(TextVertex) * this->BufferVertices, NULL, GL_DYNAMIC_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(TextVertex) * count, &quads[0]);
+        glBindTexture(GL_TEXTURE_2D, this->Pages[page]);
+        glDrawArrays(GL_TRIANGLES, 0, count);
+        quads.clear();
     }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
     glBindTexture(GL_TEXTURE_2D, 0);
 }
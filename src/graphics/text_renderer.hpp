@@ -9,47 +9,75 @@
 #ifndef TEXT_RENDERER_H
 #define TEXT_RENDERER_H
 
-#include <map>
+#include <string>
+#include <vector>
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
 #include "texture2d.hpp"
 #include "shader.hpp"
+#include "glyph_cache.hpp"
 
 namespace bookr {
 
-/// Holds all state information relevant to a character as loaded using FreeType
-struct Character {
-    GLuint TextureID;   // ID handle of the glyph texture
-    glm::ivec2 Size;    // Size of glyph
-    glm::ivec2 Bearing; // Offset from baseline to left/top of glyph
-    GLuint Advance;     // Horizontal offset to advance to next glyph
+// One corner of a glyph quad: position, atlas coordinates and color
+struct TextVertex {
+    GLfloat X, Y, U, V;
+    GLfloat R, G, B;
 };
 
 
 // A renderer class for rendering text displayed by a font loaded using the 
-// FreeType library. A single font is loaded, processed into a list of Character
-// items for later rendering.
-class TextRenderer
+// FreeType library. Glyphs come from a GlyphCache as they are first drawn,
+// so any UTF-8 text renders, and each atlas page of the cache is a texture.
+// The cache holds distance fields, so text is sharp at any size and scale
+// from the one set of glyphs.
+//
+// Glyph quads are collected in one vertex buffer and drawn with a call per
+// atlas page: at the end of each RenderText, or at EndBatch for all the
+// text rendered since BeginBatch.
+class TextRenderer : public GlyphCacheListener
 {
 public:
-    // Holds a list of pre-compiled Characters
-    std::map<GLchar, Character> Characters; 
     // Shader used for text rendering
     Shader TextShader;
     // Constructor
     TextRenderer(GLuint width, GLuint height);
     TextRenderer(Shader shader, GLuint width, GLuint height);
-    // Pre-compiles a list of characters from the given font
+    ~TextRenderer();
+    // Opens the given font, drawn fontSize pixels high at scale 1; glyphs
+    // are rasterized when first rendered, or come from the atlas file an
+    // earlier run saved
     void Load(std::string font, GLuint fontSize, bool fromMemory = false);
-    // Renders a string of text using the precompiled list of characters
+    // Renders a string of UTF-8 text; any scale, no new glyphs needed
     void RenderText(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 color = glm::vec3(1.0f));
+    // Holds back the draws of RenderText until EndBatch, which draws all of
+    // them at once. Anything else drawn in between ends up under the text.
+    void BeginBatch();
+    void EndBatch();
+    // Draws what is queued before the cache reuses one of its pages
+    virtual void glyphPageEvicted(int page);
 private:
     // Render state
     GLuint VAO, VBO;
+    // Capacity of VBO, in vertices
+    GLsizei BufferVertices;
+    // Font state
+    FT_Face Face;
+    GLuint FontSize;
+    GlyphCache* Glyphs;
+    // A texture per atlas page of Glyphs
+    std::vector<GLuint> Pages;
+    // Quads waiting to be drawn, by atlas page
+    std::vector<std::vector<TextVertex> > Vertices;
+    int Batching;
+    void initRenderData();
+    void closeFont();
+    void upload();
+    void flush();
 };
 
 }
 
-#endif 
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -31,8 +31,6 @@ extern "C" {
   extern unsigned char res_uitex2[];
   extern unsigned int size_res_uifont;
   extern unsigned char res_uifont[];
-  extern unsigned char pdf_font_DroidSansFallback_ttf_buf[];
-  extern unsigned int  pdf_font_DroidSansFallback_ttf_len;
   extern unsigned char _binary_icon0_t_png_start;
   extern unsigned int _binary_icon0_t_png_size;
 
@@ -267,12 +265,23 @@ void Layer::drawDialogFrame(string& title, string& triangleLabel, string& circle
   //   drawText(t, fontBig, 480 - tw - 40, 248 + scrY);
 }
 
+// rows inside the frame drawDialogFrame draws
+#define MENU_TEXT_LEFT 30
+#define MENU_TITLE_TOP 10
+#define MENU_ROW_TOP 50
+#define MENU_ROW_HEIGHT 32
+
 void Layer::drawMenu(string& title, string& triangleLabel, vector<MenuItem>& items) {
   drawMenu(title, triangleLabel, items, false);
 }
 
 void Layer::drawMenu(string& title, string& triangleLabel, vector<MenuItem>& items, string& upperBreadCrumb) {
+  // batches nest, the path goes out with the items
+  ResourceManager::getTextRenderer()->BeginBatch();
   drawMenu(title, triangleLabel, items, false);
+  drawText(Screen::WIDTH * 0.1 + MENU_TEXT_LEFT, Screen::HEIGHT * 0.2 - MENU_ROW_HEIGHT, RGBA8(200, 200, 200, 255), 1.0f,
+    upperBreadCrumb.c_str());
+  ResourceManager::getTextRenderer()->EndBatch();
 }
 
 void Layer::drawMenu(string& title, string& triangleLabel, vector<MenuItem>& items, bool useUTFFont) {
@@ -362,7 +371,12 @@ void Layer::drawMenu(string& title, string& triangleLabel, vector<MenuItem>& ite
   // itemFont->bindForDisplay();
 
   // Screen::ambientColor(0xffffffff);
-  // contents
+  // contents; every label goes out in one draw per glyph page, over the
+  // frame and the selection bar
+  float left = Screen::WIDTH * 0.1;
+  float top = Screen::HEIGHT * 0.2;
+  ResourceManager::getTextRenderer()->BeginBatch();
+  drawText(left + MENU_TEXT_LEFT, top + MENU_TITLE_TOP, RGBA8(255, 255, 255, 255), 1.0f, title.c_str());
   int yoff = 3;
   for (int i = 0; i < maxItemNum; ++i) {
     // if (i + topItem == selItem)
@@ -380,8 +394,17 @@ void Layer::drawMenu(string& title, string& triangleLabel, vector<MenuItem>& ite
       // }
     }
     else {
+      float y = top + MENU_ROW_TOP + i * MENU_ROW_HEIGHT;
+      unsigned int color = RGBA8(255, 255, 255, 255);
+      if (i + topItem == selItem) {
+        drawRectangle(left + MENU_TEXT_LEFT - 10, y - yoff, Screen::WIDTH * 0.8 - 2 * (MENU_TEXT_LEFT - 10),
+          MENU_ROW_HEIGHT, RGBA8(255, 255, 255, 255));
+        color = RGBA8(0, 0, 0, 255);
+      }
+      drawText(left + MENU_TEXT_LEFT, y, color, 1.0f, items[i + topItem].label.c_str());
     }
   }
+  ResourceManager::getTextRenderer()->EndBatch();
   // Screen::ambientColor(0xff000000);
   // if(useUTFFont){
   //   int tooLong;
@@ -622,6 +645,21 @@ static int countLines(string& t) {
 void Layer::drawPopup(string& text, string& title, int bg1, int bg2, int fg) {
   //texUI->bindForDisplay();
   int l = countLines(text);
+  int h = MENU_ROW_TOP + l * MENU_ROW_HEIGHT;
+  float y = h >= (int)Screen::HEIGHT ? 0 : (Screen::HEIGHT - h) / 2;
+  drawRectangle(Screen::WIDTH * 0.1, y, Screen::WIDTH * 0.8, h, bg1);
+  drawRectangle(Screen::WIDTH * 0.1 + 10, y + 5, Screen::WIDTH * 0.8 - 20, MENU_ROW_HEIGHT, bg2);
+  // the text renderer draws a line at a time; all of them go out together
+  ResourceManager::getTextRenderer()->BeginBatch();
+  drawText(Screen::WIDTH * 0.1 + MENU_TEXT_LEFT, y + 8, fg, 1.0f, title.c_str());
+  size_t start = 0;
+  for (int i = 0; i < l; ++i) {
+    size_t end = text.find('\n', start);
+    string line = text.substr(start, end == string::npos ? string::npos : end - start);
+    drawText(Screen::WIDTH * 0.1 + MENU_TEXT_LEFT, y + MENU_ROW_TOP + i * MENU_ROW_HEIGHT, fg, 1.0f, line.c_str());
+    start = end + 1;
+  }
+  ResourceManager::getTextRenderer()->EndBatch();
   // // icons
   // Screen::ambientColor(bg1|0xff000000);
   // // drawImage(410, 9 + y, BK_IMG_CIRCLE_XSIZE, BK_IMG_CIRCLE_YSIZE, BK_IMG_CIRCLE_X, BK_IMG_CIRCLE_Y);
@@ -212,6 +212,8 @@ class Layer : public RefCounted {
 public:
   virtual int update(unsigned int buttons) = 0;
   virtual void render() = 0;
+  // Offscreen drawing render() will need, done before the frame starts.
+  virtual void prepare() { }
 
   static void load();
   static void unload();
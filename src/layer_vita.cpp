@@ -45,8 +45,6 @@ extern "C" {
   extern unsigned char res_uitex[];
   extern unsigned int size_res_uitex2;
   extern unsigned char res_uitex2[];
-  extern unsigned char pdf_font_DroidSansFallback_ttf_buf[];
-  extern unsigned int  pdf_font_DroidSansFallback_ttf_len;
 
   extern unsigned char res_uifont[];
   extern unsigned int size_res_uifont;
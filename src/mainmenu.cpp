@@ -18,6 +18,7 @@
 #include "mainmenu.hpp"
 #include "document.hpp"
 #include "bookmark.hpp"
+#include "filetypes/textencoding.hpp"
 #include "popup.hpp"
 #include "bookrconfig.h"
 
@@ -64,6 +65,8 @@
 #define OPTIONS_MENU_ITEM_CPU_BUS_SPEED			18
 #define OPTIONS_MENU_ITEM_CPU_MENU_SPEED		19
 #define OPTIONS_MENU_ITEM_CLEAR_BOOKMARKS		20
+#define OPTIONS_MENU_ITEM_PLAIN_ENCODING		21
+#define OPTIONS_MENU_ITEM_PLAIN_HYPHENATE		22
 
 namespace bookr {
 
@@ -254,6 +257,14 @@ void MainMenu::buildOptionMenu() {
 
 	optionItems.push_back(MenuItem("Clear bookmarks", "Select", 0));
 
+	snprintf(txt, 1024, "Plain text - Encoding: %s", TextEncoding::name(User::options.txtEncoding));
+	t = txt;
+	optionItems.push_back(MenuItem(t, "Change", BK_MENU_ITEM_USE_LR_ICON));
+
+	t = "Plain text - Hyphenation: ";
+	t += User::options.txtHyphenate ? "Enabled" : "Disabled";
+	optionItems.push_back(MenuItem(t, "Toggle", 0));
+
 }
 
 int MainMenu::update(unsigned int buttons) {
@@ -429,6 +440,11 @@ int MainMenu::updateOptions(unsigned int buttons) {
 			buildOptionMenu();
 			return BK_CMD_MARK_DIRTY;
 		}
+		if (selItem == OPTIONS_MENU_ITEM_PLAIN_HYPHENATE) {
+			User::options.txtHyphenate = !User::options.txtHyphenate;
+			buildOptionMenu();
+			return BK_CMD_MARK_DIRTY;
+		}
 		if (selItem == OPTIONS_MENU_ITEM_COLOR_SCHEMES) {
 			return BK_CMD_INVOKE_COLOR_SCHEME_MANAGER;//_TXTFG;
 		}
@@ -579,6 +595,13 @@ int MainMenu::updateOptions(unsigned int buttons) {
 				buildOptionMenu();
 			}
 			return BK_CMD_MARK_DIRTY;
+		} else if (selItem == OPTIONS_MENU_ITEM_PLAIN_ENCODING) {
+			--User::options.txtEncoding;
+			if (User::options.txtEncoding < 0) {
+				User::options.txtEncoding = TEXT_ENCODINGS - 1;
+			}
+			buildOptionMenu();
+			return BK_CMD_MARK_DIRTY;
 		} else if (selItem == OPTIONS_MENU_ITEM_BROWSER_TEXTSIZE) {
 			--User::options.browserTextSize;
 			if (User::options.browserTextSize < 0) {
@@ -674,6 +697,13 @@ int MainMenu::updateOptions(unsigned int buttons) {
 				buildOptionMenu();
 			}
 			return BK_CMD_MARK_DIRTY;
+		} else if (selItem == OPTIONS_MENU_ITEM_PLAIN_ENCODING) {
+			++User::options.txtEncoding;
+			if (User::options.txtEncoding >= TEXT_ENCODINGS) {
+				User::options.txtEncoding = 0;
+			}
+			buildOptionMenu();
+			return BK_CMD_MARK_DIRTY;
 		} else if (selItem == OPTIONS_MENU_ITEM_BROWSER_TEXTSIZE) {
 			++User::options.browserTextSize;
 			if (User::options.browserTextSize > 2) {
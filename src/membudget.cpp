@@ -0,0 +1,74 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <algorithm>
+#include <mutex>
+
+#include "membudget.hpp"
+#include "graphics/screen.hpp"
+#include "user.hpp"
+
+#ifdef __vita__
+extern int _newlib_heap_size_user;
+#endif
+
+namespace bookr { namespace MemBudget {
+
+static size_t reported[CONSUMER_COUNT];
+// djvu reports from its worker thread
+static std::mutex budgetMutex;
+
+static size_t totalLocked() {
+  size_t sum = 0;
+  for (int i = 0; i < CONSUMER_COUNT; ++i)
+    sum += reported[i];
+  return sum;
+}
+
+static size_t limitLocked() {
+  size_t budget = (size_t)std::max(User::options.memoryBudgetMB, 16) << 20;
+  #ifdef __vita__
+    // keep half of whatever the heap has left for everything that isn't a cache
+    size_t used = Screen::getUsedMemory();
+    size_t heap = _newlib_heap_size_user;
+    if (used > 0 && used < heap) {
+      size_t caches = std::min(totalLocked(), used);
+      budget = std::min(budget, caches + (heap - used) / 2);
+    }
+  #endif
+  return budget;
+}
+
+size_t limit() {
+  std::lock_guard<std::mutex> lock(budgetMutex);
+  return limitLocked();
+}
+
+void report(Consumer c, size_t bytes) {
+  std::lock_guard<std::mutex> lock(budgetMutex);
+  reported[c] = bytes;
+}
+
+size_t usage(Consumer c) {
+  std::lock_guard<std::mutex> lock(budgetMutex);
+  return reported[c];
+}
+
+size_t allowance(Consumer c, size_t minBytes, size_t maxBytes) {
+  std::lock_guard<std::mutex> lock(budgetMutex);
+  size_t lim = limitLocked();
+  size_t others = totalLocked() - reported[c];
+  size_t left = lim > others ? lim - others : 0;
+  return std::max(minBytes, std::min(left, maxBytes));
+}
+
+} }
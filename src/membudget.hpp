@@ -0,0 +1,52 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKMEMBUDGET_H
+#define BKMEMBUDGET_H
+
+#include <cstddef>
+
+namespace bookr {
+
+/*! \brief One memory budget shared by every cache in the app.
+ *
+ *  Caches report what they hold and ask for an allowance before growing.
+ *  The allowance is the budget (User::options.memoryBudgetMB, and never
+ *  more than half the free heap where the platform can tell) minus what
+ *  everybody else reports, so one cache shrinks when another grows.
+ */
+namespace MemBudget {
+  enum Consumer {
+    MUPDF_STORE,
+    DJVU_DECODE,      // ddjvu's own cache of decoded chunks
+    DJVU_PAGES,       // rendered djvu pages
+    FALLBACK_FONT,    // the CJK font MuPDF loads when a document needs it
+    CONSUMER_COUNT
+  };
+
+  size_t limit();
+
+  /**
+   * Report the bytes c currently holds (or has reserved).
+   */
+  void report(Consumer c, size_t bytes);
+  size_t usage(Consumer c);
+
+  /**
+   * What c may hold right now, clamped to [minBytes, maxBytes].
+   */
+  size_t allowance(Consumer c, size_t minBytes, size_t maxBytes);
+}
+
+}
+
+#endif
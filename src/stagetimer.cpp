@@ -0,0 +1,133 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "stagetimer.hpp"
+
+namespace bookr { namespace StageTimer {
+
+struct Ring {
+  float samples[RING_SIZE];
+  int next;
+  int count;
+};
+
+static Ring rings[STAGE_COUNT];
+// the DjVu worker records too
+static std::mutex ringMutex;
+
+static std::vector<SectionWriter> sections;
+
+static const char* stageNames[STAGE_COUNT] = {
+  "load_page",
+  "links",
+  "stext",
+  "bounds",
+  "rasterize",
+  "texture_create",
+  "texture_upload",
+  "bookmark_save",
+  "djvu_decode",
+  "djvu_render"
+};
+
+void record(Stage stage, float ms) {
+  std::lock_guard<std::mutex> lock(ringMutex);
+  Ring& r = rings[stage];
+  r.samples[r.next] = ms;
+  r.next = (r.next + 1) % RING_SIZE;
+  if (r.count < RING_SIZE)
+    r.count++;
+}
+
+const char* name(Stage stage) {
+  return stageNames[stage];
+}
+
+void clear() {
+  std::lock_guard<std::mutex> lock(ringMutex);
+  memset(rings, 0, sizeof(rings));
+}
+
+// oldest first
+static int copySamples(Stage stage, float* out) {
+  std::lock_guard<std::mutex> lock(ringMutex);
+  Ring& r = rings[stage];
+  int first = (r.next - r.count + RING_SIZE) % RING_SIZE;
+  for (int i = 0; i < r.count; ++i)
+    out[i] = r.samples[(first + i) % RING_SIZE];
+  return r.count;
+}
+
+static float percentile(float* sorted, int n, int p) {
+  int i = (n * p + 99) / 100 - 1;
+  return sorted[std::max(0, std::min(i, n - 1))];
+}
+
+Summary summary(Stage stage) {
+  float s[RING_SIZE];
+  Summary sum = { 0, 0.0f, 0.0f, 0.0f, 0.0f };
+  int n = copySamples(stage, s);
+  if (n == 0)
+    return sum;
+  std::sort(s, s + n);
+  sum.count = n;
+  sum.p50 = percentile(s, n, 50);
+  sum.p90 = percentile(s, n, 90);
+  sum.p99 = percentile(s, n, 99);
+  sum.max = s[n - 1];
+  return sum;
+}
+
+bool dump(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (f == NULL) {
+    printf("cannot save timings to %s\n", path);
+    return false;
+  }
+
+  fprintf(f, "%-16s %6s %9s %9s %9s %9s\n", "stage", "count", "p50 ms", "p90 ms", "p99 ms", "max ms");
+  for (int i = 0; i < STAGE_COUNT; ++i) {
+    Summary s = summary((Stage)i);
+    fprintf(f, "%-16s %6d %9.2f %9.2f %9.2f %9.2f\n", stageNames[i], s.count, s.p50, s.p90, s.p99, s.max);
+  }
+
+  fprintf(f, "\n");
+  float samples[RING_SIZE];
+  for (int i = 0; i < STAGE_COUNT; ++i) {
+    int n = copySamples((Stage)i, samples);
+    fprintf(f, "%s:", stageNames[i]);
+    for (int j = 0; j < n; ++j)
+      fprintf(f, " %.2f", samples[j]);
+    fprintf(f, "\n");
+  }
+
+  for (size_t i = 0; i < sections.size(); ++i) {
+    fprintf(f, "\n");
+    sections[i](f);
+  }
+
+  fclose(f);
+  return true;
+}
+
+void addSection(SectionWriter writer) {
+  if (std::find(sections.begin(), sections.end(), writer) == sections.end())
+    sections.push_back(writer);
+}
+
+} }
@@ -0,0 +1,85 @@
+/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+#ifndef BKSTAGETIMER_H
+#define BKSTAGETIMER_H
+
+#include <chrono>
+#include <cstdio>
+
+namespace bookr {
+
+/*! \brief Page turn timings, broken down by pipeline stage.
+ *
+ *  Always on: a sample is two steady_clock reads and a store into a fixed
+ *  ring buffer per stage. summary() and dump() work out percentiles over
+ *  whatever the rings currently hold.
+ */
+namespace StageTimer {
+  enum Stage {
+    LOAD_PAGE,
+    LINKS,
+    STEXT,
+    BOUNDS,
+    RASTERIZE,
+    TEXTURE_CREATE,
+    TEXTURE_UPLOAD,
+    BOOKMARK_SAVE,
+    DJVU_DECODE,
+    DJVU_RENDER,
+    STAGE_COUNT
+  };
+
+  // samples kept per stage
+  static const int RING_SIZE = 256;
+
+  struct Summary {
+    int count;
+    float p50, p90, p99, max;
+  };
+
+  void record(Stage stage, float ms);
+  Summary summary(Stage stage);
+  const char* name(Stage stage);
+  void clear();
+
+  /**
+   * Write per-stage summaries and raw samples to path, then every section
+   * added with addSection().
+   */
+  bool dump(const char* path);
+
+  /**
+   * Extra report appended to dump(), called on the dumping thread.
+   * Adding the same writer twice has no effect.
+   */
+  typedef void (*SectionWriter)(FILE* f);
+  void addSection(SectionWriter writer);
+
+  /**
+   * Times the enclosing block.
+   */
+  class Scope {
+    Stage stage;
+    std::chrono::steady_clock::time_point begin;
+  public:
+    explicit Scope(Stage s) : stage(s), begin(std::chrono::steady_clock::now()) { }
+    ~Scope() {
+      auto end = std::chrono::steady_clock::now();
+      record(stage, std::chrono::duration<float, std::milli>(end - begin).count());
+    }
+  };
+}
+
+}
+
+#endif
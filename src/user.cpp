@@ -114,6 +114,13 @@ void User::setDefaultOptions() {
   options.pageScrollCacheMode = 0;
   options.ignoreXInOutlineOnSquare = false;
   options.jpeg2000Decoder = true;
+  options.pdfImageDecodeBudgetMs = 40;
+  options.documentPoolSize = 2;
+  options.documentCacheMB = 96;
+  options.djvuMaskMode = true;
+  options.memoryBudgetMB = 160;
+  options.txtEncoding = 0;
+  options.txtHyphenate = false;
 }
 
 void User::save() {
@@ -193,6 +200,13 @@ void User::save() {
   fprintf(f, "\t\t<set option=\"evictGlyphCacheOnNewPage\" value=\"%d\" />\n", options.evictGlyphCacheOnNewPage ? 1 : 0);
   fprintf(f, "\t\t<set option=\"ignoreXInOutlineOnSquare\" value=\"%d\" />\n", options.ignoreXInOutlineOnSquare ? 1 : 0);
   fprintf(f, "\t\t<set option=\"jpeg2000Decoder\" value=\"%d\" />\n", options.jpeg2000Decoder ? 1 : 0);
+  fprintf(f, "\t\t<set option=\"pdfImageDecodeBudgetMs\" value=\"%d\" />\n", options.pdfImageDecodeBudgetMs);
+  fprintf(f, "\t\t<set option=\"documentPoolSize\" value=\"%d\" />\n", options.documentPoolSize);
+  fprintf(f, "\t\t<set option=\"documentCacheMB\" value=\"%d\" />\n", options.documentCacheMB);
+  fprintf(f, "\t\t<set option=\"djvuMaskMode\" value=\"%d\" />\n", options.djvuMaskMode ? 1 : 0);
+  fprintf(f, "\t\t<set option=\"memoryBudgetMB\" value=\"%d\" />\n", options.memoryBudgetMB);
+  fprintf(f, "\t\t<set option=\"txtEncoding\" value=\"%d\" />\n", options.txtEncoding);
+  fprintf(f, "\t\t<set option=\"txtHyphenate\" value=\"%d\" />\n", options.txtHyphenate ? 1 : 0);
 
   fprintf(f, "\t</options>\n");
   fprintf(f, "</user>\n");
@@ -375,6 +389,13 @@ void User::load() {
       else if (strncmp(option, "evictGlyphCacheOnNewPage",         128) == 0) options.evictGlyphCacheOnNewPage         = atoi(value)!=0;
       else if (strncmp(option, "ignoreXInOutlineOnSquare",         128) == 0) options.ignoreXInOutlineOnSquare         = atoi(value)!=0;
       else if (strncmp(option, "jpeg2000Decoder",         128) == 0) options.jpeg2000Decoder         = atoi(value)!=0;
+      else if (strncmp(option, "pdfImageDecodeBudgetMs",         128) == 0) options.pdfImageDecodeBudgetMs         = atoi(value);
+      else if (strncmp(option, "documentPoolSize",         128) == 0) options.documentPoolSize         = atoi(value);
+      else if (strncmp(option, "documentCacheMB",         128) == 0) options.documentCacheMB         = atoi(value);
+      else if (strncmp(option, "djvuMaskMode",         128) == 0) options.djvuMaskMode         = atoi(value)!=0;
+      else if (strncmp(option, "memoryBudgetMB",         128) == 0) options.memoryBudgetMB         = atoi(value);
+      else if (strncmp(option, "txtEncoding",         128) == 0) options.txtEncoding         = atoi(value);
+      else if (strncmp(option, "txtHyphenate",         128) == 0) options.txtHyphenate         = atoi(value) != 0;
 
       eset = eset->NextSiblingElement("set"); 
     }
@@ -117,6 +117,20 @@ struct Options {
   bool ignoreXInOutlineOnSquare;
   bool t_ignore_x;
   bool jpeg2000Decoder;
+  // JPX/JBIG2 images estimated to take longer than this are decoded off-thread
+  int pdfImageDecodeBudgetMs;
+  // documents kept open after closing, for instant reopen
+  int documentPoolSize;
+  // resource store shared by every open MuPDF document
+  int documentCacheMB;
+  // render bilevel DjVu pages as 8 bit masks tinted with the color scheme
+  bool djvuMaskMode;
+  // shared by every cache, see MemBudget
+  int memoryBudgetMB;
+  // plain text encoding, TEXT_ENCODING_* in filetypes/textencoding.hpp; 0 guesses
+  int txtEncoding;
+  // hyphenate English words where that fills text lines better
+  bool txtHyphenate;
 };
 
 class User {
@@ -2,6 +2,7 @@
 
 #include "graphics/screen.hpp"
 #include "utils.hpp"
+#include "stagetimer.hpp"
 
 #include <cstdio>
 #include <cstdlib>
@@ -18,7 +19,11 @@ vita2d_texture* _vita2d_load_pixmap_generic(fz_pixmap *pixmap)
   int height = pixmap->h;
 
   printf("creating empty texture w: %i h: %i\n", width, height);
-  vita2d_texture *texture = vita2d_create_empty_texture(width, height);
+  vita2d_texture *texture;
+  {
+    StageTimer::Scope t(StageTimer::TEXTURE_CREATE);
+    texture = vita2d_create_empty_texture(width, height);
+  }
   if (texture == NULL) {
     printf("failed to create empty texture\n");
     return NULL;
@@ -29,6 +34,7 @@ vita2d_texture* _vita2d_load_pixmap_generic(fz_pixmap *pixmap)
 
   printf("got text data/stride %i\n", tex_stride);
   
+  StageTimer::Scope t(StageTimer::TEXTURE_UPLOAD);
   // Crashes on bad pdfs and too much zoom?
   for (int y = 0; y < height; ++y) {
     unsigned int *tex_pointer = (unsigned int *)(texture_data + y*tex_stride);
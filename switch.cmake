@@ -61,9 +61,14 @@ add_executable(bookr-modern
   src/graphics/texture2d.cpp
   src/graphics/sprite_renderer.cpp
   src/graphics/text_renderer.cpp
+  src/graphics/glyph_cache.cpp
+  src/graphics/font_faces.cpp
   src/resource_manager.cpp
   
   src/filetypes/mudocument.cpp
+  src/filetypes/muimagedecoder.cpp
+  src/filetypes/mustream.cpp
+  src/filetypes/blockcache.cpp
 )
 
 set(OPENGL_opengl_LIBRARY EGL glapi drm_nouveau)
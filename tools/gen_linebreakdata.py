@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+#
+# bookr-modern: a graphics based document reader
+# Licensed under GPLv3+, see LICENSE
+#
+# Writes src/filetypes/linebreakdata.cpp, the tables linebreak.cpp uses:
+#
+#   gen_linebreakdata.py LineBreak.txt hyph-en-us.tex linebreakdata.cpp
+#
+# LineBreak.txt is the Unicode Character Database file (Unicode 14 for the
+# checked in tables); hyph-en-us.tex the TeX en-us patterns from hyph-utf8.
+# The build runs this when both are given to cmake, see BUILDING.md.
+
+import sys
+
+# code points past this are left to the default class
+LIMIT = 0x40000
+# code points per class block
+BLOCK = 64
+
+# the classes linebreak.cpp knows, in the order of its enum
+CLASSES = ['AL', 'ID', 'CM', 'SP', 'BA', 'HY', 'BB', 'OP', 'CL', 'CP', 'QU', 'GL',
+           'NS', 'EX', 'SY', 'IS', 'PR', 'PO', 'NU', 'IN', 'ZW', 'WJ', 'RI']
+# and what the others fold into
+FOLD = {'HL': 'AL', 'AI': 'AL', 'XX': 'AL', 'SA': 'AL', 'SG': 'AL', 'CB': 'ID',
+        'H2': 'ID', 'H3': 'ID', 'JL': 'ID', 'JV': 'ID', 'JT': 'ID', 'EB': 'ID',
+        'EM': 'CM', 'ZWJ': 'CM', 'CJ': 'NS', 'B2': 'BA', 'BK': 'SP', 'CR': 'SP',
+        'LF': 'SP', 'NL': 'SP'}
+
+# letters of the hyphenation trie; 0 is the root
+ALPHABET = {'.': 27}
+for k in range(26):
+    ALPHABET[chr(ord('a') + k)] = k + 1
+# exceptions are whole word patterns whose values beat any pattern's
+EXCEPTION_BREAK = 11
+EXCEPTION_KEEP = 10
+
+
+def parse_range(field):
+    if '..' in field:
+        a, b = field.split('..')
+        return int(a, 16), int(b, 16)
+    return int(field, 16), int(field, 16)
+
+
+def read_classes(path):
+    raw = ['XX'] * LIMIT
+    missing = []
+    entries = []
+    for line in open(path, encoding='utf-8'):
+        if line.startswith('# @missing:'):
+            field, cls = line[len('# @missing:'):].split(';')
+            missing.append((parse_range(field.strip()), cls.strip()))
+            continue
+        line = line.split('#')[0].strip()
+        if not line:
+            continue
+        field, cls = line.split(';')
+        entries.append((parse_range(field.strip()), cls.strip()))
+    for (a, b), cls in missing + entries:
+        for c in range(a, min(b, LIMIT - 1) + 1):
+            raw[c] = cls
+    index = {c: i for i, c in enumerate(CLASSES)}
+    classes = [index[FOLD.get(c, c)] for c in raw]
+    # tabs lay out as blanks
+    classes[9] = index['SP']
+    return classes
+
+
+# Simplified UAX #14 pair rules: True when no break may fall between a
+# character of class a and one of class b with nothing between them.
+def prohibited(a, b):
+    A = CLASSES[a]
+    B = CLASSES[b]
+    if A == 'ZW':
+        return False
+    if B in ('WJ', 'ZW') or A == 'WJ':
+        return True
+    if A == 'GL':
+        return True
+    if B == 'GL' and A not in ('BA', 'HY'):
+        return True
+    if B in ('CL', 'CP', 'EX', 'IS', 'SY'):
+        return True
+    if A == 'OP':
+        return True
+    if A == 'QU' or B == 'QU':
+        return True
+    if A in ('CL', 'CP') and B == 'NS':
+        return True
+    if B in ('BA', 'HY', 'NS') or A == 'BB':
+        return True
+    if B == 'IN':
+        return True
+    if (A == 'AL' and B == 'NU') or (A == 'NU' and B == 'AL'):
+        return True
+    if (A == 'PR' and B == 'ID') or (A == 'ID' and B == 'PO'):
+        return True
+    if (A in ('PR', 'PO') and B == 'AL') or (A == 'AL' and B in ('PR', 'PO')):
+        return True
+    if (A in ('PR', 'PO') and B in ('OP', 'NU')) or (A in ('HY', 'IS', 'SY', 'NU') and B == 'NU'):
+        return True
+    if A in ('NU', 'CL', 'CP') and B in ('PO', 'PR'):
+        return True
+    if A == 'AL' and B == 'AL':
+        return True
+    if A == 'IS' and B == 'AL':
+        return True
+    if (A in ('AL', 'NU') and B == 'OP') or (A == 'CP' and B in ('AL', 'NU')):
+        return True
+    if A == 'RI' and B == 'RI':
+        return True
+    return False
+
+
+# The contents of every \name{...} group in a TeX file, comments removed.
+def tex_groups(path, name):
+    text = ''.join(line.split('%')[0] + '\n' for line in open(path, encoding='utf-8'))
+    groups = []
+    start = text.find('\\' + name + '{')
+    while start >= 0:
+        end = text.index('}', start)
+        groups.append(text[start + len(name) + 2:end])
+        start = text.find('\\' + name + '{', end)
+    return groups
+
+
+# letters -> (first position with a value, values), positions counted
+# before each letter
+def read_patterns(path):
+    patterns = {}
+    for group in tex_groups(path, 'patterns'):
+        for token in group.split():
+            letters = ''
+            values = [0]
+            for ch in token:
+                if ch.isdigit():
+                    values[-1] = int(ch)
+                else:
+                    letters += ch
+                    values.append(0)
+            if any(ch not in ALPHABET for ch in letters):
+                continue
+            first = next(i for i, v in enumerate(values) if v)
+            last = max(i for i, v in enumerate(values) if v)
+            patterns[letters] = (first, values[first:last + 1])
+    for group in tex_groups(path, 'hyphenation'):
+        for token in group.split():
+            word = token.replace('-', '')
+            if any(ch not in ALPHABET or ch == '.' for ch in word):
+                continue
+            breaks = set()
+            k = 0
+            for ch in token:
+                if ch == '-':
+                    breaks.add(k)
+                else:
+                    k += 1
+            # the positions between the letters of '.word.'
+            values = [EXCEPTION_BREAK if k in breaks else EXCEPTION_KEEP for k in range(1, len(word))]
+            patterns['.' + word + '.'] = (2, values)
+    return patterns
+
+
+def build_trie(patterns):
+    trie = {}
+    for letters in patterns:
+        t = trie
+        for ch in letters:
+            t = t.setdefault(ch, {})
+    # breadth first, so the children of a node sit together
+    nodes = [0]
+    where = [0]
+    pool = [0]
+    order = [(0, '', trie)]
+    i = 0
+    while i < len(order):
+        node, prefix, t = order[i]
+        i += 1
+        kids = sorted(t.keys(), key=lambda ch: ALPHABET[ch])
+        first = len(nodes)
+        for ch in kids:
+            nodes.append(0)
+            where.append(0)
+            order.append((len(nodes) - 1, prefix + ch, t[ch]))
+        letter = ALPHABET[prefix[-1]] if prefix else 0
+        nodes[node] = letter | (len(kids) << 5) | (first << 10)
+        if prefix in patterns:
+            start, values = patterns[prefix]
+            where[node] = len(pool)
+            pool += [start, len(values)] + values
+    assert len(pool) < 65536 and len(nodes) < (1 << 22)
+    return nodes, where, pool
+
+
+def emit(out, decl, values, per, fmt):
+    out.write('%s = {\n' % decl)
+    for k in range(0, len(values), per):
+        out.write('  ' + ', '.join(fmt % v for v in values[k:k + per]) + (',' if k + per < len(values) else '') + '\n')
+    out.write('};\n')
+
+
+HEADER = '''/*
+ * bookr-modern: a graphics based document reader
+ * Copyright (C) 2019 pathway27 (Sree)
+ * IS A MODIFICATION OF THE ORIGINAL
+ * Bookr and bookr-mod for PSP
+ * Copyright (C) 2005 Carlos Carrasco Martinez (carloscm at gmail dot com),
+ *               2007 Christian Payeur (christian dot payeur at gmail dot com),
+ *               2009 Nguyen Chi Tam (nguyenchitam at gmail dot com),
+ * AND VARIOUS OTHER FORKS, See Forks in README.md
+ * Licensed under GPLv3+, see LICENSE
+*/
+
+// Generated by tools/gen_linebreakdata.py, do not edit. Line break classes
+// come from the Unicode 14 LineBreak.txt, folded into the classes
+// linebreak.cpp knows; the hyphenation patterns and exceptions are the
+// TeX en-us set (hyph-en-us.tex).
+
+#include <cstdint>
+
+namespace bookr {
+
+'''
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit('usage: gen_linebreakdata.py LineBreak.txt hyph-en-us.tex linebreakdata.cpp')
+    classes = read_classes(sys.argv[1])
+    blocks = []
+    seen = {}
+    index = []
+    for s in range(0, LIMIT, BLOCK):
+        block = tuple(classes[s:s + BLOCK])
+        if block not in seen:
+            seen[block] = len(blocks)
+            blocks.append(block)
+        index.append(seen[block])
+    assert len(blocks) < 256
+    pairs = [sum(1 << b for b in range(len(CLASSES)) if not prohibited(a, b)) for a in range(len(CLASSES))]
+    nodes, where, pool = build_trie(read_patterns(sys.argv[2]))
+
+    with open(sys.argv[3], 'w') as out:
+        out.write(HEADER)
+        out.write('// class block of every %d code points below U+%X\n' % (BLOCK, LIMIT))
+        emit(out, 'extern const uint8_t lineBreakIndex[%d]' % len(index), index, 16, '%d')
+        out.write('\n// %d distinct blocks of %d classes\n' % (len(blocks), BLOCK))
+        emit(out, 'extern const uint8_t lineBreakBlocks[%d]' % (len(blocks) * BLOCK), [c for b in blocks for c in b], 32, '%d')
+        out.write('\n// bit b of entry a: a break may fall between classes a and b\n')
+        emit(out, 'extern const uint32_t lineBreakPairs[%d]' % len(pairs), pairs, 6, '0x%06x')
+        out.write('\n// pattern trie, breadth first: letter | children << 5 | first child << 10,\n'
+                  '// letters a-z are 1-26 and the word boundary 27\n')
+        emit(out, 'extern const uint32_t hyphenNodes[%d]' % len(nodes), nodes, 8, '0x%08x')
+        out.write('\n// where in hyphenValues the pattern ending at each node is, or 0\n')
+        emit(out, 'extern const uint16_t hyphenPatterns[%d]' % len(where), where, 12, '%d')
+        out.write('\n// per pattern: first position, count, then the values; odd values allow\n// a break\n')
+        emit(out, 'extern const uint8_t hyphenValues[%d]' % len(pool), pool, 24, '%d')
+        out.write('\n}\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -61,7 +61,9 @@ ExternalProject_Add(mupdf_lib
   CONFIGURE_COMMAND make generate
   UPDATE_COMMAND ""
   #--Build step-----------------
+  # TOFU_CJK leaves out the CJK fonts, see loadFallbackFont in mudocument.cpp
   BUILD_COMMAND make OS=vita build=release prefix=/usr/local/vitasdk/arm-vita-eabi HAVE_X11=no HAVE_GLUT=no
+    XCFLAGS=-DTOFU_CJK
   BUILD_IN_SOURCE 1
   #--Install step---------------
   INSTALL_COMMAND ""
@@ -86,6 +88,31 @@ link_directories(
 )
 
 
+# DjVu needs djvulibre built for the vita (libdjvu/ddjvuapi.h, libdjvulibre.a)
+option(ENABLE_DJVU "build the DjVu viewer" OFF)
+if(ENABLE_DJVU)
+  add_definitions(-DENABLE_DJVU)
+  set(djvu_srcs src/filetypes/djvu.cpp)
+  set(djvu_libs djvulibre)
+endif()
+
+# linebreakdata.cpp is generated; the checked in copy is used unless both
+# sources are given, see BUILDING.md
+set(LINEBREAK_TXT "" CACHE FILEPATH "Unicode LineBreak.txt to generate the line break tables from")
+set(HYPHENATION_TEX "" CACHE FILEPATH "hyph-en-us.tex to generate the hyphenation tables from")
+set(linebreak_data src/filetypes/linebreakdata.cpp)
+if(LINEBREAK_TXT AND HYPHENATION_TEX)
+  find_package(PythonInterp 3 REQUIRED)
+  set(linebreak_data ${CMAKE_CURRENT_BINARY_DIR}/linebreakdata.cpp)
+  add_custom_command(
+    OUTPUT ${linebreak_data}
+    COMMAND ${PYTHON_EXECUTABLE} ${CMAKE_SOURCE_DIR}/tools/gen_linebreakdata.py
+      ${LINEBREAK_TXT} ${HYPHENATION_TEX} ${linebreak_data}
+    DEPENDS ${CMAKE_SOURCE_DIR}/tools/gen_linebreakdata.py ${LINEBREAK_TXT} ${HYPHENATION_TEX}
+    COMMENT "Generating line break tables"
+  )
+endif()
+
 ## Build and link
 # Add all the files needed to compile here
 add_executable(bookr-mod-vita
@@ -95,6 +122,15 @@ add_executable(bookr-mod-vita
   src/bookmark.cpp
   src/filetypes/fancytext.cpp
   src/filetypes/plaintext.cpp
+  src/filetypes/palmdoc.cpp
+  src/filetypes/textsource.cpp
+  src/filetypes/textindex.cpp
+  src/filetypes/textlayout.cpp
+  src/filetypes/textencoding.cpp
+  src/filetypes/textcodepages.cpp
+  src/filetypes/htmltext.cpp
+  src/filetypes/linebreak.cpp
+  ${linebreak_data}
 
   data/fonts/res_txtfont.c
   data/fonts/res_uifont.c
@@ -105,6 +141,10 @@ add_executable(bookr-mod-vita
   src/layer_vita.cpp
 
   src/filetypes/mudocument.cpp
+  src/filetypes/muimagedecoder.cpp
+  src/filetypes/mustream.cpp
+  src/filetypes/blockcache.cpp
+  ${djvu_srcs}
   src/graphics/font_vita.cpp
 )
 
@@ -112,6 +152,7 @@ add_executable(bookr-mod-vita
 #-lpsp2shell -lSceSysmodule_stub -lSceNet_stub \ -lSceNetCtl_stub -lSceKernel_stub -lScePower_stub -lSceAppMgr_stub
 #mupdf -ldjvulibre -lraster -lworld -lfonts -lstream -lbase -lm
 target_link_libraries(bookr-mod-vita
+  ${djvu_libs}
   vita2d
   mupdf
   mupdf-third
@@ -150,6 +191,8 @@ vita_create_vpk(bookr-mod-vita.vpk ${VITA_TITLEID} eboot.bin
   FILE data/logos/bg.png sce_sys/livearea/contents/bg.png
   FILE data/logos/startup.png sce_sys/livearea/contents/startup.png
   FILE data/sce_sys/livearea/contents/template.xml sce_sys/livearea/contents/template.xml
+  # MuPDF is built without its CJK fonts; the same font ships as a file
+  FILE ${SOURCE_DIR}/resources/fonts/droid/DroidSansFallback.ttf data/Bookr/fonts/DroidSansFallback.ttf
 )
 
 add_dependencies(bookr-mod-vita mupdf_lib)